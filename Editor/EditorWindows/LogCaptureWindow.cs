@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices.Editor.Windows
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Linq;
+    using System.Text;
+    using Epic.OnlineServices.Logging;
+    using UnityEditor;
+    using UnityEngine;
+
+    /// <summary>
+    /// Decodes and filters binary EOS log captures (see
+    /// <see cref="EOSLogCaptureWriter"/>) into readable text.
+    /// </summary>
+    [Serializable]
+    public class LogCaptureWindow : EOSEditorWindow
+    {
+        /// <summary>
+        /// Number of decoded lines shown in the preview area. Exporting always
+        /// writes every matching line.
+        /// </summary>
+        private const int PreviewLineCount = 1000;
+
+        private const string ArgInput = "-EOSLogCaptureInput";
+        private const string ArgOutput = "-EOSLogCaptureOutput";
+        private const string ArgLevel = "-EOSLogCaptureLevel";
+        private const string ArgCategories = "-EOSLogCaptureCategories";
+        private const string ArgContains = "-EOSLogCaptureContains";
+
+        [RetainPreference("CapturePath")]
+        private string capturePath = string.Empty;
+
+        private LogLevel maximumLevel = LogLevel.VeryVerbose;
+        private string categories = string.Empty;
+        private string messageContains = string.Empty;
+
+        private string preview = string.Empty;
+        private string summary = string.Empty;
+        private Vector2 scrollPosition;
+
+        public LogCaptureWindow() : base("Log Capture Decoder") { }
+
+        [MenuItem("EOS Plugin/Advanced/Decode Log Capture")]
+        public static void ShowWindow()
+        {
+            GetWindow<LogCaptureWindow>();
+        }
+
+        protected override void Setup()
+        {
+            base.Setup();
+
+            // This window has a text area, which does not play nicely with
+            // automatic resizing (see CheckDeploymentWindow).
+            SetAutoResize(false);
+        }
+
+        protected override void RenderWindow()
+        {
+            EditorGUILayout.BeginHorizontal();
+            capturePath = EditorGUILayout.TextField("Capture File", capturePath);
+            if (GUILayout.Button("Browse", GUILayout.Width(80)))
+            {
+                string selected = EditorUtility.OpenFilePanel("Select EOS Log Capture", string.IsNullOrEmpty(capturePath) ? string.Empty : Path.GetDirectoryName(capturePath), EOSLogCaptureFormat.FileExtension.TrimStart('.'));
+                if (!string.IsNullOrEmpty(selected))
+                {
+                    capturePath = selected;
+                }
+            }
+            EditorGUILayout.EndHorizontal();
+
+            maximumLevel = (LogLevel)EditorGUILayout.EnumPopup("Maximum Level", maximumLevel);
+            categories = EditorGUILayout.TextField(new GUIContent("Categories", "Comma separated list of categories to include. Leave empty to include all categories."), categories);
+            messageContains = EditorGUILayout.TextField("Message Contains", messageContains);
+
+            GUI.enabled = File.Exists(capturePath);
+            EditorGUILayout.BeginHorizontal();
+            if (GUILayout.Button("Decode"))
+            {
+                Decode();
+            }
+
+            if (GUILayout.Button("Export to Text..."))
+            {
+                Export();
+            }
+            EditorGUILayout.EndHorizontal();
+            GUI.enabled = true;
+
+            if (!string.IsNullOrEmpty(summary))
+            {
+                EditorGUILayout.HelpBox(summary, MessageType.Info);
+            }
+
+            scrollPosition = GUILayout.BeginScrollView(scrollPosition, GUILayout.MaxHeight(Screen.height));
+            GUI.enabled = false;
+            GUILayout.TextArea(preview);
+            GUI.enabled = true;
+            GUILayout.EndScrollView();
+        }
+
+        private EOSLogCaptureFilter CreateFilter()
+        {
+            return CreateFilter(maximumLevel, categories, messageContains);
+        }
+
+        private static EOSLogCaptureFilter CreateFilter(LogLevel level, string categoryList, string contains)
+        {
+            return new EOSLogCaptureFilter
+            {
+                MaximumLevel = level,
+                Categories = (categoryList ?? string.Empty)
+                    .Split(new[] { ',' }, StringSplitOptions.RemoveEmptyEntries)
+                    .Select(category => category.Trim())
+                    .ToList(),
+                MessageContains = contains
+            };
+        }
+
+        private void Decode()
+        {
+            try
+            {
+                EOSLogCaptureReader reader = new(capturePath);
+                StringBuilder builder = new();
+                int matching = 0;
+
+                foreach (EOSLogCaptureEntry entry in reader.ReadEntries(CreateFilter()))
+                {
+                    if (matching < PreviewLineCount)
+                    {
+                        builder.AppendLine(entry.ToString());
+                    }
+
+                    ++matching;
+                }
+
+                preview = builder.ToString();
+                summary = $"Capture started {reader.StartTime:O}. {matching} matching message(s)" +
+                          (matching > PreviewLineCount ? $", showing the first {PreviewLineCount}" : string.Empty) +
+                          $". {reader.DroppedCount} message(s) dropped during capture.";
+            }
+            catch (Exception e)
+            {
+                preview = string.Empty;
+                summary = $"Unable to decode \"{capturePath}\": {e.Message}";
+            }
+        }
+
+        private void Export()
+        {
+            string outputPath = EditorUtility.SaveFilePanel(
+                "Export Decoded Log",
+                Path.GetDirectoryName(capturePath),
+                Path.GetFileNameWithoutExtension(capturePath),
+                "txt");
+
+            if (string.IsNullOrEmpty(outputPath))
+            {
+                return;
+            }
+
+            int count = EOSLogCaptureReader.DecodeToText(capturePath, outputPath, CreateFilter());
+            summary = $"Wrote {count} message(s) to \"{outputPath}\".";
+        }
+
+        /// <summary>
+        /// Entry point for decoding captures from the command line, for
+        /// instance:
+        /// <code>
+        /// Unity -batchmode -quit -executeMethod PlayEveryWare.EpicOnlineServices.Editor.Windows.LogCaptureWindow.DecodeFromCommandLine
+        ///     -EOSLogCaptureInput capture.eoslog -EOSLogCaptureOutput capture.txt
+        ///     [-EOSLogCaptureLevel Warning] [-EOSLogCaptureCategories LogEOSP2P,LogEOSLobby] [-EOSLogCaptureContains text]
+        /// </code>
+        /// </summary>
+        public static void DecodeFromCommandLine()
+        {
+            Dictionary<string, string> arguments = new(StringComparer.OrdinalIgnoreCase);
+            string[] args = Environment.GetCommandLineArgs();
+            for (int i = 0; i < args.Length - 1; ++i)
+            {
+                if (args[i].StartsWith("-EOSLogCapture", StringComparison.OrdinalIgnoreCase))
+                {
+                    arguments[args[i]] = args[i + 1];
+                }
+            }
+
+            if (!arguments.TryGetValue(ArgInput, out string input))
+            {
+                Debug.LogError($"{nameof(LogCaptureWindow)}: {ArgInput} is required.");
+                return;
+            }
+
+            if (!arguments.TryGetValue(ArgOutput, out string output))
+            {
+                output = Path.ChangeExtension(input, ".txt");
+            }
+
+            LogLevel level = LogLevel.VeryVerbose;
+            if (arguments.TryGetValue(ArgLevel, out string levelArgument) &&
+                !Enum.TryParse(levelArgument, true, out level))
+            {
+                Debug.LogError($"{nameof(LogCaptureWindow)}: \"{levelArgument}\" is not a valid log level.");
+                return;
+            }
+
+            arguments.TryGetValue(ArgCategories, out string categoryArgument);
+            arguments.TryGetValue(ArgContains, out string containsArgument);
+
+            int count = EOSLogCaptureReader.DecodeToText(input, output, CreateFilter(level, categoryArgument, containsArgument));
+            Debug.Log($"{nameof(LogCaptureWindow)}: Wrote {count} message(s) from \"{input}\" to \"{output}\".");
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices.Editor.Utility
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using System.Runtime.InteropServices;
+    using System.Text;
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Lobby;
+    using Epic.OnlineServices.P2P;
+    using Epic.OnlineServices.Stats;
+    using UnityEditor;
+    using UnityEngine;
+    using CommandLineUtility = PlayEveryWare.EpicOnlineServices.Utility.CommandLineUtility;
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Measures the time and managed allocations per call of the C# wrapper
+    /// around the EOS SDK: <see cref="Helper"/> allocations and pinned buffers,
+    /// <see cref="Utf8String"/> conversions, callback dispatch and socket id
+    /// updates, and the marshalling of representative options, outputs and
+    /// callbacks. Native calls are left out, so the EOS SDK does not need to
+    /// be loaded.
+    ///
+    /// Can be run headless, writing the results as JSON:
+    /// <code>
+    /// Unity -batchmode -quit -projectPath project -executeMethod PlayEveryWare.EpicOnlineServices.Editor.Utility.MarshallingBenchmark.RunFromCommandLine
+    ///     -EOSBenchmarkOutput results.json
+    /// </code>
+    /// </summary>
+    public static class MarshallingBenchmark
+    {
+        private const string ArgOutput = "-EOSBenchmarkOutput";
+
+        private const int WarmupCalls = 1000;
+        private const int CallsPerSample = 10000;
+        private const int Samples = 7;
+
+        private const int StatCount = 16;
+        private const int PacketSizeBytes = 512;
+
+        /// <summary>
+        /// The result of one benchmark.
+        /// </summary>
+        [Serializable]
+        public class BenchmarkResult
+        {
+            public string name;
+            public int calls;
+
+            /// <summary>
+            /// Median over the samples of the time per call.
+            /// </summary>
+            public double nanosecondsPerCall;
+
+            /// <summary>
+            /// Fastest sample of the time per call.
+            /// </summary>
+            public double minNanosecondsPerCall;
+
+            public double bytesAllocatedPerCall;
+            public int gen0Collections;
+
+            /// <summary>
+            /// Why the benchmark could not be run, or null if it was.
+            /// </summary>
+            public string error;
+        }
+
+        /// <summary>
+        /// All results of a run, with enough about the environment to compare
+        /// runs with each other.
+        /// </summary>
+        [Serializable]
+        public class Report
+        {
+            public string timestamp;
+            public string unityVersion;
+            public string operatingSystem;
+            public string processorType;
+            public List<BenchmarkResult> results = new();
+        }
+
+        [MenuItem("EOS Plugin/Advanced/Benchmarks/Wrapper Marshalling")]
+        static void RunFromMenu()
+        {
+            Debug.Log(ToTable(Run()));
+        }
+
+        /// <summary>
+        /// Runs the benchmarks and writes the results to the path given with
+        /// <c>-EOSBenchmarkOutput</c>, or logs them if no path is given.
+        /// </summary>
+        public static void RunFromCommandLine()
+        {
+            Report report = Run();
+            Debug.Log(ToTable(report));
+            WriteReport(report, nameof(MarshallingBenchmark));
+        }
+
+        /// <summary>
+        /// Writes a report as JSON to the path given with
+        /// <c>-EOSBenchmarkOutput</c>, if there is one.
+        /// </summary>
+        /// <param name="report">The report to write.</param>
+        /// <param name="benchmarkName">Name of the benchmark, for the log.</param>
+        internal static void WriteReport(Report report, string benchmarkName)
+        {
+            string output = CommandLineUtility.GetValue(ArgOutput);
+            if (output != null)
+            {
+                File.WriteAllText(output, JsonUtility.ToJson(report, true));
+                Debug.Log($"{benchmarkName}: Wrote {report.results.Count} result(s) to \"{output}\".");
+            }
+        }
+
+        /// <summary>
+        /// Creates an empty report describing the machine it is run on.
+        /// </summary>
+        internal static Report CreateReport()
+        {
+            return new Report
+            {
+                timestamp = DateTime.UtcNow.ToString("o"),
+                unityVersion = Application.unityVersion,
+                operatingSystem = SystemInfo.operatingSystem,
+                processorType = SystemInfo.processorType
+            };
+        }
+
+        /// <summary>
+        /// Runs every benchmark.
+        /// </summary>
+        public static Report Run()
+        {
+            Report report = CreateReport();
+
+            // Stand-ins for the native memory the SDK hands out. Only their
+            // addresses are used, so they are never read as SDK objects.
+            IntPtr nativeIds = Marshal.AllocHGlobal(2 * IntPtr.Size);
+            IntPtr nativeString = Marshal.StringToHGlobalAnsi("4c2a8f1e9b3d4e6f8a0b1c2d3e4f5a6b");
+            IntPtr callbackInfo = Marshal.AllocHGlobal(Marshal.SizeOf(typeof(LobbyUpdateReceivedCallbackInfoInternal)));
+
+            try
+            {
+                ProductUserId localUserId = new(nativeIds);
+                ProductUserId remoteUserId = new(new IntPtr(nativeIds.ToInt64() + IntPtr.Size));
+
+                string bucketId = "benchmark:bucket";
+                byte[] buffer = new byte[PacketSizeBytes];
+                report.results.Add(Measure("Utf8String.FromCachedEncoding", () => { Utf8String value = bucketId; }));
+                report.results.Add(Measure("Utf8String.Encode", () => { Utf8String value = new Utf8String(bucketId); }));
+                report.results.Add(Measure("Helper.AddAllocation", () =>
+                {
+                    IntPtr pointer = Helper.AddAllocation(64);
+                    Helper.Dispose(ref pointer);
+                }));
+                report.results.Add(Measure("Helper.AddPinnedBuffer", () =>
+                {
+                    IntPtr pointer = Helper.AddPinnedBuffer(buffer);
+                    Helper.Dispose(ref pointer);
+                }));
+
+                // Options holding strings and ids, as passed to most requests
+                CreateLobbyOptions createLobbyOptions = new()
+                {
+                    LocalUserId = localUserId,
+                    MaxLobbyMembers = 8,
+                    PermissionLevel = LobbyPermissionLevel.Publicadvertised,
+                    BucketId = bucketId,
+                    LobbyId = "benchmark-lobby",
+                    AllowedPlatformIds = new uint[] { 1, 2, 3 }
+                };
+                report.results.Add(Measure("Options.Strings (Lobby.CreateLobby)", () =>
+                {
+                    CreateLobbyOptionsInternal optionsInternal = default;
+                    optionsInternal.Set(ref createLobbyOptions);
+                    Helper.Dispose(ref optionsInternal);
+                }));
+
+                // Options holding an array of structures with strings
+                IngestData[] stats = new IngestData[StatCount];
+                for (int i = 0; i < StatCount; ++i)
+                {
+                    stats[i] = new IngestData { StatName = $"benchmark_stat_{i}", IngestAmount = i };
+                }
+                IngestStatOptions ingestStatOptions = new() { LocalUserId = localUserId, TargetUserId = localUserId, Stats = stats };
+                report.results.Add(Measure($"Options.AttributeArray (Stats.IngestStat, {StatCount} stats)", () =>
+                {
+                    IngestStatOptionsInternal optionsInternal = default;
+                    optionsInternal.Set(ref ingestStatOptions);
+                    Helper.Dispose(ref optionsInternal);
+                }));
+
+                // Outputs: a handle and a string written by the SDK
+                report.results.Add(Measure("Output.Handle (ProductUserId)", () => { Helper.Get(nativeIds, out ProductUserId id); }));
+                report.results.Add(Measure("Output.String", () =>
+                {
+                    Helper.Get(nativeString, out Utf8String value);
+                    string decoded = value;
+                }));
+
+                // A callback, from registering the delegate to the callback
+                // reading its info and being removed. Request callbacks ask
+                // the SDK whether their result completes the operation, so a
+                // notification, whose info has no result code, is used to
+                // keep the SDK out of it.
+                Marshal.WriteIntPtr(callbackInfo, Marshal.OffsetOf(typeof(LobbyUpdateReceivedCallbackInfoInternal), "m_LobbyId").ToInt32(), nativeString);
+                int clientDataOffset = Marshal.OffsetOf(typeof(LobbyUpdateReceivedCallbackInfoInternal), "m_ClientData").ToInt32();
+                OnLobbyUpdateReceivedCallback notificationDelegate = (ref LobbyUpdateReceivedCallbackInfo data) => { string lobbyId = data.LobbyId; };
+                report.results.Add(Measure("Callback.RoundTrip (Lobby.LobbyUpdateReceived)", () =>
+                {
+                    Helper.AddCallback(out IntPtr clientDataPointer, null, notificationDelegate);
+                    Marshal.WriteIntPtr(callbackInfo, clientDataOffset, clientDataPointer);
+                    LobbyUpdateReceivedCallbackInfoInternal data = Marshal.PtrToStructure<LobbyUpdateReceivedCallbackInfoInternal>(callbackInfo);
+                    OnLobbyUpdateReceivedCallbackInternalImplementation.EntryPoint(ref data);
+                    Helper.RemoveCallback(clientDataPointer);
+                }));
+
+                // The P2P hot path
+                SendPacketOptions sendPacketOptions = new()
+                {
+                    LocalUserId = localUserId,
+                    RemoteUserId = remoteUserId,
+                    SocketId = new SocketId { SocketName = "benchmark" },
+                    Channel = 1,
+                    Data = new ArraySegment<byte>(buffer),
+                    Reliability = PacketReliability.UnreliableUnordered
+                };
+                report.results.Add(Measure($"P2P.SendPacketOptions ({PacketSizeBytes} bytes)", () =>
+                {
+                    SendPacketOptionsInternal optionsInternal = default;
+                    optionsInternal.Set(ref sendPacketOptions);
+                    optionsInternal.Dispose();
+                }));
+
+                // What ReceivePacket does around the native call, for a
+                // socket id that didn't change since the last packet
+                SocketId socketId = new() { SocketName = "benchmark" };
+                ProductUserId peerId = null;
+                report.results.Add(Measure("P2P.SocketId update (ReceivePacket)", () =>
+                {
+                    bool wasCacheValid = socketId.PrepareForUpdate();
+                    IntPtr socketIdAddress = Helper.AddPinnedBuffer(socketId.m_AllBytes);
+                    IntPtr dataAddress = Helper.AddPinnedBuffer(new ArraySegment<byte>(buffer));
+                    if (peerId == null || peerId.InnerHandle != nativeIds)
+                    {
+                        Helper.Get(nativeIds, out peerId);
+                    }
+                    socketId.CheckIfChanged(wasCacheValid);
+                    Helper.Dispose(ref socketIdAddress);
+                    Helper.Dispose(ref dataAddress);
+                    string socketName = socketId.SocketName;
+                }));
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(callbackInfo);
+                Marshal.FreeHGlobal(nativeString);
+                Marshal.FreeHGlobal(nativeIds);
+
+                // The fake ids must not be handed out for real ones later
+                Helper.ClearInternedHandles();
+            }
+
+            return report;
+        }
+
+        /// <summary>
+        /// Formats the results of a run as a table.
+        /// </summary>
+        public static string ToTable(Report report)
+        {
+            return ToTable(report, $"Wrapper marshalling, {Samples} samples x {CallsPerSample} calls (ns per call is the median sample)");
+        }
+
+        /// <summary>
+        /// Formats the results of a run as a table under the given title.
+        /// </summary>
+        internal static string ToTable(Report report, string title)
+        {
+            StringBuilder table = new();
+            table.AppendLine(title);
+            table.AppendLine($"{"Benchmark",-52} {"ns/call",10} {"min",10} {"B/call",10} {"GC",5}");
+
+            foreach (BenchmarkResult result in report.results)
+            {
+                if (result.error != null)
+                {
+                    table.AppendLine($"{result.name,-52} failed: {result.error}");
+                    continue;
+                }
+
+                table.AppendLine($"{result.name,-52} {result.nanosecondsPerCall,10:F1} {result.minNanosecondsPerCall,10:F1} {result.bytesAllocatedPerCall,10:F1} {result.gen0Collections,5}");
+            }
+
+            return table.ToString();
+        }
+
+        private static BenchmarkResult Measure(string name, Action call)
+        {
+            return Measure(name, call, WarmupCalls, CallsPerSample, 1);
+        }
+
+        /// <summary>
+        /// Measures <paramref name="call"/> over <see cref="Samples"/> samples.
+        /// </summary>
+        /// <param name="name">Name of the result.</param>
+        /// <param name="call">The code to measure.</param>
+        /// <param name="warmupCalls">Calls made before measuring.</param>
+        /// <param name="callsPerSample">Calls made per sample.</param>
+        /// <param name="itemsPerCall">
+        /// Number of operations each call performs. Results are reported per
+        /// operation, so loops over arrays can be compared item by item.
+        /// </param>
+        /// <returns>
+        /// The result, with <see cref="BenchmarkResult.error"/> set if
+        /// <paramref name="call"/> threw, so the other benchmarks of a run
+        /// still get measured and reported.
+        /// </returns>
+        internal static BenchmarkResult Measure(string name, Action call, int warmupCalls, int callsPerSample, int itemsPerCall)
+        {
+            try
+            {
+                return MeasureSamples(name, call, warmupCalls, callsPerSample, itemsPerCall);
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"{nameof(MarshallingBenchmark)}: \"{name}\" failed: {e}");
+                return new BenchmarkResult { name = name, error = $"{e.GetType().Name}: {e.Message}" };
+            }
+        }
+
+        private static BenchmarkResult MeasureSamples(string name, Action call, int warmupCalls, int callsPerSample, int itemsPerCall)
+        {
+            // Warm up so JIT, type caches and the encoding cache aren't measured
+            for (int i = 0; i < warmupCalls; ++i)
+            {
+                call();
+            }
+
+            long operationsPerSample = (long)callsPerSample * itemsPerCall;
+            double[] samples = new double[Samples];
+            long allocated = 0;
+            int collections = GC.CollectionCount(0);
+
+            for (int sample = 0; sample < Samples; ++sample)
+            {
+                long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+                Stopwatch stopwatch = Stopwatch.StartNew();
+                for (int i = 0; i < callsPerSample; ++i)
+                {
+                    call();
+                }
+
+                stopwatch.Stop();
+                allocated += GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+                samples[sample] = stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / operationsPerSample;
+            }
+
+            Array.Sort(samples);
+            return new BenchmarkResult
+            {
+                name = name,
+                calls = (int)Math.Min(int.MaxValue, Samples * operationsPerSample),
+                nanosecondsPerCall = samples[Samples / 2],
+                minNanosecondsPerCall = samples[0],
+                bytesAllocatedPerCall = (double)allocated / (Samples * operationsPerSample),
+                gen0Collections = GC.CollectionCount(0) - collections
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices.Editor.Utility
+{
+    using System;
+    using System.Runtime.InteropServices;
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Leaderboards;
+    using Epic.OnlineServices.Stats;
+    using UnityEditor;
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Compares the reflection based <see cref="Marshal.PtrToStructure(IntPtr, Type)"/>
+    /// and <see cref="Marshal.StructureToPtr(object, IntPtr, bool)"/> path
+    /// against the blittable copy path in <see cref="Helper"/>, over
+    /// native arrays of the structures returned by leaderboard and stats
+    /// queries. Does not require the EOS SDK to be loaded.
+    ///
+    /// Every pair of results does the same work, so they can be compared
+    /// directly: reading or writing one structure at a time, or reading a
+    /// whole native array into a new managed one. Times and allocations
+    /// are per structure.
+    ///
+    /// Can be run headless, writing the results as JSON like
+    /// <see cref="MarshallingBenchmark"/>:
+    /// <code>
+    /// Unity -batchmode -quit -projectPath project -executeMethod PlayEveryWare.EpicOnlineServices.Editor.Utility.StructMarshallingBenchmark.RunFromCommandLine
+    ///     -EOSBenchmarkOutput results.json
+    /// </code>
+    /// </summary>
+    public static class StructMarshallingBenchmark
+    {
+        private const int ItemCount = 1000;
+        private const int Iterations = 200;
+        private const int WarmupIterations = 5;
+
+        [MenuItem("EOS Plugin/Advanced/Benchmarks/Struct Marshalling")]
+        static void RunFromMenu()
+        {
+            Debug.Log(ToTable(Run()));
+        }
+
+        /// <summary>
+        /// Runs every benchmark, logs the results and writes them as JSON to
+        /// the path given with <c>-EOSBenchmarkOutput</c>, if there is one.
+        /// </summary>
+        public static void RunFromCommandLine()
+        {
+            MarshallingBenchmark.Report report = Run();
+            Debug.Log(ToTable(report));
+            MarshallingBenchmark.WriteReport(report, nameof(StructMarshallingBenchmark));
+        }
+
+        /// <summary>
+        /// Runs every benchmark.
+        /// </summary>
+        public static MarshallingBenchmark.Report Run()
+        {
+            MarshallingBenchmark.Report report = MarshallingBenchmark.CreateReport();
+
+            Measure<LeaderboardRecordInternal>(report);
+            Measure<StatInternal>(report);
+
+            return report;
+        }
+
+        /// <summary>
+        /// Formats the results of a run as a table.
+        /// </summary>
+        public static string ToTable(MarshallingBenchmark.Report report)
+        {
+            return MarshallingBenchmark.ToTable(report, $"Struct marshalling, {ItemCount} items x {Iterations} iterations (ns per item is the median sample)");
+        }
+
+        private static void Measure<T>(MarshallingBenchmark.Report report) where T : struct
+        {
+            int itemSize = Marshal.SizeOf(typeof(T));
+            IntPtr buffer = Marshal.AllocHGlobal(itemSize * ItemCount);
+
+            try
+            {
+                T[] items = new T[ItemCount];
+                for (int i = 0; i < ItemCount; ++i)
+                {
+                    Marshal.StructureToPtr(items[i], new IntPtr(buffer.ToInt64() + i * itemSize), false);
+                }
+
+                string name = typeof(T).Name + (Helper.MarshalInfo<T>.IsBlittable ? "" : " (not blittable)");
+
+                report.results.Add(Measure($"{name} Read, Marshal", () => ReadLegacy(buffer, items, itemSize)));
+                report.results.Add(Measure($"{name} Read, Helper", () => ReadFast(buffer, items, itemSize)));
+                report.results.Add(Measure($"{name} Write, Marshal", () => WriteLegacy(buffer, items, itemSize)));
+                report.results.Add(Measure($"{name} Write, Helper", () => WriteFast(buffer, items, itemSize)));
+                report.results.Add(Measure($"{name} ReadArray, Marshal", () => ReadArrayLegacy<T>(buffer, itemSize)));
+                report.results.Add(Measure($"{name} ReadArray, Helper", () => ReadArrayFast<T>(buffer)));
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(buffer);
+            }
+        }
+
+        private static MarshallingBenchmark.BenchmarkResult Measure(string name, Action action)
+        {
+            return MarshallingBenchmark.Measure(name, action, WarmupIterations, Iterations, ItemCount);
+        }
+
+        private static void ReadLegacy<T>(IntPtr buffer, T[] items, int itemSize) where T : struct
+        {
+            for (int i = 0; i < items.Length; ++i)
+            {
+                items[i] = (T)Marshal.PtrToStructure(new IntPtr(buffer.ToInt64() + i * itemSize), typeof(T));
+            }
+        }
+
+        private static void ReadFast<T>(IntPtr buffer, T[] items, int itemSize) where T : struct
+        {
+            for (int i = 0; i < items.Length; ++i)
+            {
+                items[i] = Helper.ReadStructure<T>(new IntPtr(buffer.ToInt64() + i * itemSize));
+            }
+        }
+
+        private static void WriteLegacy<T>(IntPtr buffer, T[] items, int itemSize) where T : struct
+        {
+            for (int i = 0; i < items.Length; ++i)
+            {
+                Marshal.StructureToPtr(items[i], new IntPtr(buffer.ToInt64() + i * itemSize), false);
+            }
+        }
+
+        private static void WriteFast<T>(IntPtr buffer, T[] items, int itemSize) where T : struct
+        {
+            for (int i = 0; i < items.Length; ++i)
+            {
+                Helper.WriteStructure(ref items[i], new IntPtr(buffer.ToInt64() + i * itemSize));
+            }
+        }
+
+        private static void ReadArrayLegacy<T>(IntPtr buffer, int itemSize) where T : struct
+        {
+            T[] items = new T[ItemCount];
+            ReadLegacy(buffer, items, itemSize);
+        }
+
+        private static void ReadArrayFast<T>(IntPtr buffer) where T : struct
+        {
+            Helper.Get(buffer, out T[] _, ItemCount, false);
+        }
+    }
+}
+
+#endif
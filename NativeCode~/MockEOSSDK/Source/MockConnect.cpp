@@ -0,0 +1,343 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// Connect interface of the mock EOS SDK. Any credential logs in: the product
+// user id is derived from the credential, so the same device id or token
+// always logs in the same user, and users are created on first login.
+
+#include "MockEOSSDK.h"
+
+#include <algorithm>
+
+using namespace mock;
+
+namespace
+{
+    //-------------------------------------------------------------------------
+    void NotifyLoginStatusChanged(EOS_HPlatform platform, EOS_ProductUserId userId, EOS_ELoginStatus previous, EOS_ELoginStatus current)
+    {
+        Notify(platform, NotificationKind::ConnectLoginStatusChanged, nullptr, [userId, previous, current](const Notification& notification)
+        {
+            EOS_Connect_LoginStatusChangedCallbackInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LocalUserId = userId;
+            info.PreviousStatus = previous;
+            info.CurrentStatus = current;
+            reinterpret_cast<EOS_Connect_OnLoginStatusChangedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    bool IsLoggedIn(EOS_HPlatform platform, EOS_ProductUserId userId)
+    {
+        return std::find(platform->LoggedInUsers.begin(), platform->LoggedInUsers.end(), userId) != platform->LoggedInUsers.end();
+    }
+
+    //-------------------------------------------------------------------------
+    void RemoveLoggedInUser(EOS_HPlatform platform, EOS_ProductUserId userId)
+    {
+        std::vector<EOS_ProductUserId>& users = platform->LoggedInUsers;
+        users.erase(std::remove(users.begin(), users.end(), userId), users.end());
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_Login(EOS_HConnect Handle, const EOS_Connect_LoginOptions* Options, void* ClientData, const EOS_Connect_OnLoginCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->Credentials != nullptr;
+    EOS_EExternalCredentialType type = validOptions ? Options->Credentials->Type : EOS_EExternalCredentialType::EOS_ECT_EPIC;
+    std::string token = validOptions && Options->Credentials->Token ? Options->Credentials->Token : "";
+    std::string displayName = validOptions && Options->UserLoginInfo && Options->UserLoginInfo->DisplayName ? Options->UserLoginInfo->DisplayName : "";
+
+    PostRequest(platform, [platform, validOptions, type, token, displayName, ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_LoginCallbackInfo info = {};
+        info.ClientData = ClientData;
+        info.ResultCode = EOS_EResult::EOS_Success;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            std::string identity;
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else if (type == EOS_EExternalCredentialType::EOS_ECT_DEVICEID_ACCESS_TOKEN)
+            {
+                // Device ids belong to the cache directory they were created in
+                auto deviceId = backend.DeviceIds.find(platform->CacheDirectory);
+                if (deviceId == backend.DeviceIds.end())
+                {
+                    info.ResultCode = EOS_EResult::EOS_NotFound;
+                }
+                else
+                {
+                    identity = "device:" + deviceId->second;
+                }
+            }
+            else if (token.empty())
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else
+            {
+                identity = std::to_string(static_cast<int32_t>(type)) + ":" + token;
+            }
+
+            if (!identity.empty())
+            {
+                EOS_ProductUserId userId = InternProductUserId(backend, HashId(identity));
+                User& user = backend.Users[userId];
+
+                if (user.Platform != nullptr && user.Platform != platform)
+                {
+                    // P2P traffic and notifications can only be routed to one
+                    // platform, so the latest login takes the user over
+                    Log(EOS_ELogLevel::EOS_LOG_Warning, "User %s logged in on a second platform.", userId->Id.c_str());
+                    RemoveLoggedInUser(user.Platform, userId);
+                }
+
+                user.Id = userId;
+                user.Platform = platform;
+                user.DisplayName = displayName;
+                user.CredentialType = type;
+
+                if (!IsLoggedIn(platform, userId))
+                {
+                    platform->LoggedInUsers.push_back(userId);
+                    NotifyLoginStatusChanged(platform, userId, EOS_ELoginStatus::EOS_LS_NotLoggedIn, EOS_ELoginStatus::EOS_LS_LoggedIn);
+                }
+
+                info.LocalUserId = userId;
+            }
+        }
+
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_Logout(EOS_HConnect Handle, const EOS_Connect_LogoutOptions* Options, void* ClientData, const EOS_Connect_OnLogoutCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostRequest(platform, [platform, userId, ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_LogoutCallbackInfo info = {};
+        info.ClientData = ClientData;
+        info.LocalUserId = userId;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            if (userId == nullptr || !IsLoggedIn(platform, userId))
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidUser;
+            }
+            else
+            {
+                RemoveUserFromLobbies(backend, userId);
+
+                User* user = backend.FindUser(userId);
+                if (user != nullptr && user->Platform == platform)
+                {
+                    CloseUserConnections(backend, *user);
+                    backend.Users.erase(userId);
+                }
+
+                RemoveLoggedInUser(platform, userId);
+                NotifyLoginStatusChanged(platform, userId, EOS_ELoginStatus::EOS_LS_LoggedIn, EOS_ELoginStatus::EOS_LS_NotLoggedIn);
+                info.ResultCode = EOS_EResult::EOS_Success;
+            }
+        }
+
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_CreateDeviceId(EOS_HConnect Handle, const EOS_Connect_CreateDeviceIdOptions* Options, void* ClientData, const EOS_Connect_OnCreateDeviceIdCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->DeviceModel != nullptr;
+
+    PostRequest(platform, [platform, validOptions, ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_CreateDeviceIdCallbackInfo info = {};
+        info.ClientData = ClientData;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else if (backend.DeviceIds.count(platform->CacheDirectory) != 0)
+            {
+                info.ResultCode = EOS_EResult::EOS_DuplicateNotAllowed;
+            }
+            else
+            {
+                backend.DeviceIds[platform->CacheDirectory] = HashId("device:" + platform->CacheDirectory);
+                info.ResultCode = EOS_EResult::EOS_Success;
+            }
+        }
+
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_DeleteDeviceId(EOS_HConnect Handle, const EOS_Connect_DeleteDeviceIdOptions* Options, void* ClientData, const EOS_Connect_OnDeleteDeviceIdCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+
+    PostRequest(platform, [platform, ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_DeleteDeviceIdCallbackInfo info = {};
+        info.ClientData = ClientData;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+            info.ResultCode = backend.DeviceIds.erase(platform->CacheDirectory) != 0 ? EOS_EResult::EOS_Success : EOS_EResult::EOS_NotFound;
+        }
+
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(int32_t) EOS_Connect_GetLoggedInUsersCount(EOS_HConnect Handle)
+{
+    if (Handle == nullptr)
+    {
+        return 0;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    return static_cast<int32_t>(Handle->Platform->LoggedInUsers.size());
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_Connect_GetLoggedInUserByIndex(EOS_HConnect Handle, int32_t Index)
+{
+    if (Handle == nullptr || Index < 0)
+    {
+        return nullptr;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    const std::vector<EOS_ProductUserId>& users = Handle->Platform->LoggedInUsers;
+    return static_cast<size_t>(Index) < users.size() ? users[Index] : nullptr;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ELoginStatus) EOS_Connect_GetLoginStatus(EOS_HConnect Handle, EOS_ProductUserId LocalUserId)
+{
+    if (Handle == nullptr || LocalUserId == nullptr)
+    {
+        return EOS_ELoginStatus::EOS_LS_NotLoggedIn;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    return IsLoggedIn(Handle->Platform, LocalUserId) ? EOS_ELoginStatus::EOS_LS_LoggedIn : EOS_ELoginStatus::EOS_LS_NotLoggedIn;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Connect_AddNotifyLoginStatusChanged(EOS_HConnect Handle, const EOS_Connect_AddNotifyLoginStatusChangedOptions* Options, void* ClientData, const EOS_Connect_OnLoginStatusChangedCallback Notification)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    mock::Notification notification;
+    notification.Kind = NotificationKind::ConnectLoginStatusChanged;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(Notification);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_RemoveNotifyLoginStatusChanged(EOS_HConnect Handle, EOS_NotificationId InId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, InId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Connect_AddNotifyAuthExpiration(EOS_HConnect Handle, const EOS_Connect_AddNotifyAuthExpirationOptions* Options, void* ClientData, const EOS_Connect_OnAuthExpirationCallback Notification)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    // Logins never expire in the mock, so this is never called
+    mock::Notification notification;
+    notification.Kind = NotificationKind::ConnectAuthExpiration;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(Notification);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_RemoveNotifyAuthExpiration(EOS_HConnect Handle, EOS_NotificationId InId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, InId);
+    }
+}
@@ -0,0 +1,444 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// Shared state of the mock EOS SDK. The mock exports the same C API as the
+// EOS SDK, so that it can be loaded in its place, and keeps every platform,
+// user, P2P packet, lobby and session of the process in memory.
+//
+// Every call into the mock may come from the thread ticking any platform, so
+// the backend state is guarded by a single mutex. Callbacks and notifications
+// are queued on the platform they belong to, and run without the lock held
+// when that platform is ticked, like the real SDK.
+
+#pragma once
+
+#define EOS_BUILDING_SDK 1
+
+#include "eos_achievements.h"
+#include "eos_anticheatclient.h"
+#include "eos_anticheatserver.h"
+#include "eos_auth.h"
+#include "eos_common.h"
+#include "eos_connect.h"
+#include "eos_custominvites.h"
+#include "eos_ecom.h"
+#include "eos_friends.h"
+#include "eos_init.h"
+#include "eos_integratedplatform.h"
+#include "eos_kws.h"
+#include "eos_leaderboards.h"
+#include "eos_lobby.h"
+#include "eos_logging.h"
+#include "eos_metrics.h"
+#include "eos_mods.h"
+#include "eos_p2p.h"
+#include "eos_playerdatastorage.h"
+#include "eos_presence.h"
+#include "eos_progressionsnapshot.h"
+#include "eos_reports.h"
+#include "eos_rtc.h"
+#include "eos_rtc_admin.h"
+#include "eos_rtc_audio.h"
+#include "eos_rtc_data.h"
+#include "eos_sanctions.h"
+#include "eos_sdk.h"
+#include "eos_sessions.h"
+#include "eos_stats.h"
+#include "eos_titlestorage.h"
+#include "eos_ui.h"
+#include "eos_userinfo.h"
+#include "eos_version.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define MOCK_EXPORT(return_type) extern "C" __attribute__((visibility("default"))) return_type
+
+// Interfaces returned by the EOS_Platform_Get*Interface functions.
+#define MOCK_INTERFACES(X) \
+    X(Metrics) X(Auth) X(Connect) X(Ecom) X(UI) X(Friends) X(Presence) X(Sessions) X(Lobby) \
+    X(UserInfo) X(P2P) X(RTC) X(RTCAdmin) X(RTCAudio) X(RTCData) X(PlayerDataStorage) X(TitleStorage) \
+    X(Achievements) X(Stats) X(Leaderboards) X(Mods) X(AntiCheatClient) X(AntiCheatServer) \
+    X(ProgressionSnapshot) X(Reports) X(Sanctions) X(KWS) X(CustomInvites) X(IntegratedPlatform)
+
+//-------------------------------------------------------------------------
+// Every interface handle starts with the platform it belongs to, so that the
+// generated stubs of unimplemented functions can complete their callbacks.
+struct MockInterfaceHandle
+{
+    EOS_HPlatform Platform = nullptr;
+};
+
+#define MOCK_DECLARE_INTERFACE_HANDLE(Name) struct EOS_##Name##Handle : MockInterfaceHandle {};
+MOCK_INTERFACES(MOCK_DECLARE_INTERFACE_HANDLE)
+#undef MOCK_DECLARE_INTERFACE_HANDLE
+
+//-------------------------------------------------------------------------
+struct EOS_ProductUserIdDetails
+{
+    std::string Id;
+};
+
+struct EOS_EpicAccountIdDetails
+{
+    std::string Id;
+};
+
+namespace mock
+{
+    using Clock = std::chrono::steady_clock;
+
+    //-------------------------------------------------------------------------
+    enum class NotificationKind
+    {
+        ConnectLoginStatusChanged,
+        ConnectAuthExpiration,
+        P2PConnectionRequest,
+        P2PConnectionEstablished,
+        P2PConnectionInterrupted,
+        P2PConnectionClosed,
+        P2PIncomingPacketQueueFull,
+        LobbyUpdateReceived,
+        LobbyMemberUpdateReceived,
+        LobbyMemberStatusReceived
+    };
+
+    struct Notification
+    {
+        NotificationKind Kind;
+        void* ClientData = nullptr;
+        void* Function = nullptr;
+
+        // P2P notifications can be limited to a user and a socket
+        EOS_ProductUserId LocalUserId = nullptr;
+        bool HasSocketName = false;
+        std::string SocketName;
+    };
+
+    //-------------------------------------------------------------------------
+    // An attribute of a lobby, a lobby member, or a session.
+    struct Attribute
+    {
+        std::string Key;
+        EOS_EAttributeType Type = EOS_EAttributeType::EOS_AT_INT64;
+        int64_t AsInt64 = 0;
+        double AsDouble = 0;
+        bool AsBool = false;
+        std::string AsUtf8;
+
+        // Lobby visibility or session advertisement type
+        int32_t Visibility = 0;
+    };
+
+    // Lobby and session attribute data share the same layout.
+    template <typename TAttributeData>
+    Attribute ToAttribute(const TAttributeData* data, int32_t visibility)
+    {
+        Attribute attribute;
+        attribute.Key = data->Key ? data->Key : "";
+        attribute.Type = data->ValueType;
+        attribute.Visibility = visibility;
+
+        switch (data->ValueType)
+        {
+        case EOS_EAttributeType::EOS_AT_BOOLEAN: attribute.AsBool = data->Value.AsBool != EOS_FALSE; break;
+        case EOS_EAttributeType::EOS_AT_INT64: attribute.AsInt64 = data->Value.AsInt64; break;
+        case EOS_EAttributeType::EOS_AT_DOUBLE: attribute.AsDouble = data->Value.AsDouble; break;
+        case EOS_EAttributeType::EOS_AT_STRING: attribute.AsUtf8 = data->Value.AsUtf8 ? data->Value.AsUtf8 : ""; break;
+        }
+
+        return attribute;
+    }
+
+    // Allocates a copy of the attribute data, released with FreeAttributeData.
+    template <typename TAttributeData>
+    TAttributeData* CopyAttributeData(const Attribute& attribute)
+    {
+        TAttributeData* data = new TAttributeData();
+        data->ApiVersion = 1;
+        data->Key = strdup(attribute.Key.c_str());
+        data->ValueType = attribute.Type;
+
+        switch (attribute.Type)
+        {
+        case EOS_EAttributeType::EOS_AT_BOOLEAN: data->Value.AsBool = attribute.AsBool ? EOS_TRUE : EOS_FALSE; break;
+        case EOS_EAttributeType::EOS_AT_INT64: data->Value.AsInt64 = attribute.AsInt64; break;
+        case EOS_EAttributeType::EOS_AT_DOUBLE: data->Value.AsDouble = attribute.AsDouble; break;
+        case EOS_EAttributeType::EOS_AT_STRING: data->Value.AsUtf8 = strdup(attribute.AsUtf8.c_str()); break;
+        }
+
+        return data;
+    }
+
+    template <typename TAttributeData>
+    void FreeAttributeData(TAttributeData* data)
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+
+        free(const_cast<char*>(data->Key));
+        if (data->ValueType == EOS_EAttributeType::EOS_AT_STRING)
+        {
+            free(const_cast<char*>(data->Value.AsUtf8));
+        }
+        delete data;
+    }
+
+    // Sets the attribute with the same key, or adds it.
+    void SetAttribute(std::vector<Attribute>& attributes, const Attribute& attribute);
+    void RemoveAttribute(std::vector<Attribute>& attributes, const std::string& key);
+    const Attribute* FindAttribute(const std::vector<Attribute>& attributes, const char* key);
+
+    // Whether the attribute satisfies a search parameter.
+    bool MatchesParameter(const Attribute& attribute, const Attribute& parameter, EOS_EComparisonOp comparison);
+
+    //-------------------------------------------------------------------------
+    struct Packet
+    {
+        EOS_ProductUserId Peer = nullptr;
+        std::string SocketName;
+        uint8_t Channel = 0;
+        std::vector<uint8_t> Data;
+    };
+
+    struct InFlightPacket
+    {
+        Clock::time_point Due;
+        uint64_t Sequence = 0;
+        Packet Contents;
+
+        bool operator>(const InFlightPacket& other) const
+        {
+            return Due != other.Due ? Due > other.Due : Sequence > other.Sequence;
+        }
+    };
+
+    // One side of a P2P connection between two users on a socket.
+    struct Connection
+    {
+        bool Accepted = false;
+        bool Established = false;
+        bool RequestNotified = false;
+
+        // Packets that arrived before the connection was accepted
+        std::deque<Packet> Held;
+
+        // Arrival time of the last reliable ordered packet on each channel
+        std::map<uint8_t, Clock::time_point> LastOrderedDue;
+    };
+
+    using ConnectionKey = std::pair<EOS_ProductUserId, std::string>;
+
+    // A user logged in with the Connect interface of a platform.
+    struct User
+    {
+        EOS_ProductUserId Id = nullptr;
+        EOS_HPlatform Platform = nullptr;
+        std::string DisplayName;
+        EOS_EExternalCredentialType CredentialType = EOS_EExternalCredentialType::EOS_ECT_DEVICEID_ACCESS_TOKEN;
+
+        std::priority_queue<InFlightPacket, std::vector<InFlightPacket>, std::greater<InFlightPacket>> Inbound;
+        std::deque<Packet> Received;
+        uint64_t ReceivedBytes = 0;
+        std::map<ConnectionKey, Connection> Connections;
+    };
+
+    //-------------------------------------------------------------------------
+    struct LobbyMember
+    {
+        EOS_ProductUserId UserId = nullptr;
+        std::vector<Attribute> Attributes;
+    };
+
+    struct Lobby
+    {
+        std::string Id;
+        EOS_ProductUserId Owner = nullptr;
+        std::string BucketId;
+        uint32_t MaxMembers = 0;
+        EOS_ELobbyPermissionLevel PermissionLevel = EOS_ELobbyPermissionLevel::EOS_LPL_PUBLICADVERTISED;
+        bool AllowInvites = true;
+        bool PresenceEnabled = false;
+        bool AllowHostMigration = true;
+        bool AllowJoinById = true;
+        std::vector<Attribute> Attributes;
+        std::vector<LobbyMember> Members;
+
+        LobbyMember* FindMember(EOS_ProductUserId userId);
+    };
+
+    //-------------------------------------------------------------------------
+    struct Session
+    {
+        std::string Id;
+        std::string BucketId;
+        std::string HostAddress;
+        EOS_ProductUserId Owner = nullptr;
+        uint32_t MaxPlayers = 0;
+        EOS_EOnlineSessionPermissionLevel PermissionLevel = EOS_EOnlineSessionPermissionLevel::EOS_OSPF_PublicAdvertised;
+        bool AllowJoinInProgress = true;
+        bool InvitesAllowed = true;
+        bool InProgress = false;
+        std::vector<Attribute> Attributes;
+        std::vector<EOS_ProductUserId> RegisteredPlayers;
+    };
+
+    // A session created or joined by a platform, under the name it was given
+    // locally.
+    struct LocalSession
+    {
+        std::string SessionId;
+        EOS_ProductUserId LocalUserId = nullptr;
+        bool IsOwner = false;
+    };
+
+    //-------------------------------------------------------------------------
+    // Conditions simulated for P2P traffic. Read from the environment when the
+    // library is loaded, or set with EOSMock_SetNetworkConditions.
+    struct NetworkConditions
+    {
+        // One way latency of P2P packets
+        double LatencyMilliseconds = 0;
+        // Up to this much latency is added at random to each packet
+        double JitterMilliseconds = 0;
+        // Chance of an unreliable packet being dropped, or of a reliable packet
+        // being sent again
+        double LossRate = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // The state shared by all platforms of the process.
+    struct Backend
+    {
+        std::mutex Mutex;
+
+        NetworkConditions Conditions;
+
+        // Time for login, lobby and session requests to complete. Read without
+        // the lock, as requests are posted from either side of it.
+        std::atomic<double> RequestLatencyMilliseconds{ 0 };
+
+        std::mt19937_64 Random{ 1 };
+        uint64_t NextSequence = 0;
+        uint64_t NextId = 0;
+
+        std::unordered_map<EOS_ProductUserId, User> Users;
+        std::unordered_map<std::string, std::unique_ptr<EOS_ProductUserIdDetails>> ProductUserIds;
+        std::unordered_map<std::string, std::unique_ptr<EOS_EpicAccountIdDetails>> EpicAccountIds;
+
+        // Device ids created by each cache directory
+        std::map<std::string, std::string> DeviceIds;
+
+        std::map<std::string, Lobby> Lobbies;
+        std::map<std::string, Session> Sessions;
+
+        User* FindUser(EOS_ProductUserId userId);
+
+        // Returns a random number in [0, 1)
+        double NextRandom();
+
+        // Returns a new 32 character hexadecimal id
+        std::string NewId();
+    };
+
+    Backend& GetBackend();
+
+    EOS_ProductUserId InternProductUserId(Backend& backend, const std::string& id);
+
+    // Returns a 32 character hexadecimal hash of the given text.
+    std::string HashId(const std::string& text);
+
+    void Log(EOS_ELogLevel level, const char* format, ...);
+
+    //-------------------------------------------------------------------------
+    EOS_NotificationId AddNotification(EOS_HPlatform platform, Notification notification);
+    void RemoveNotification(EOS_HPlatform platform, EOS_NotificationId id);
+
+    // Queues a call to every notification of the given kind that passes the
+    // filter, to run on the next tick of the platform. Notifications removed
+    // before then are not called.
+    void Notify(EOS_HPlatform platform, NotificationKind kind,
+        std::function<bool(const Notification&)> filter,
+        std::function<void(const Notification&)> invoke);
+
+    void Post(EOS_HPlatform platform, Clock::time_point due, std::function<void()> callback);
+
+    // Completes an async call after the request latency. The backend lock may
+    // be held, but never the lock of a platform.
+    void PostRequest(EOS_HPlatform platform, std::function<void()> callback);
+    void PostRequest(const MockInterfaceHandle* handle, std::function<void()> callback);
+
+    //-------------------------------------------------------------------------
+    // Hooks called while a platform is ticked or released. All are called
+    // with the backend lock held.
+    void DeliverPackets(Backend& backend, EOS_HPlatform platform, Clock::time_point now);
+    void RemoveUserFromLobbies(Backend& backend, EOS_ProductUserId userId);
+    void RemoveUserFromSessions(Backend& backend, EOS_HPlatform platform);
+    void CloseUserConnections(Backend& backend, User& user);
+}
+
+//-------------------------------------------------------------------------
+struct EOS_PlatformHandle
+{
+#define MOCK_DECLARE_INTERFACE_MEMBER(Name) EOS_##Name##Handle Name;
+    MOCK_INTERFACES(MOCK_DECLARE_INTERFACE_MEMBER)
+#undef MOCK_DECLARE_INTERFACE_MEMBER
+
+    std::string ProductId;
+    std::string DeploymentId;
+    std::string CacheDirectory;
+    bool IsServer = false;
+
+    EOS_EApplicationStatus ApplicationStatus = EOS_EApplicationStatus::EOS_AS_Foreground;
+    EOS_ENetworkStatus NetworkStatus = EOS_ENetworkStatus::EOS_NS_Online;
+
+    // Guards the callbacks and notifications below; never held while a
+    // callback runs.
+    std::mutex Mutex;
+    std::multimap<mock::Clock::time_point, std::function<void()>> PendingCallbacks;
+    std::map<EOS_NotificationId, mock::Notification> Notifications;
+
+    // Written under the backend lock
+    std::vector<EOS_ProductUserId> LoggedInUsers;
+    std::map<std::string, mock::LocalSession> LocalSessions;
+    uint64_t IncomingQueueMaxBytes = EOS_P2P_MAX_QUEUE_SIZE_UNLIMITED;
+    uint64_t OutgoingQueueMaxBytes = EOS_P2P_MAX_QUEUE_SIZE_UNLIMITED;
+    EOS_ERelayControl RelayControl = EOS_ERelayControl::EOS_RC_AllowRelays;
+    uint16_t Port = 7777;
+    uint16_t MaxAdditionalPortsToTry = 99;
+    bool NATTypeQueried = false;
+};
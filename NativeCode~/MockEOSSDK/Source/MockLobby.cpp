@@ -0,0 +1,1338 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// Lobby interface of the mock EOS SDK. Lobbies are kept in memory and shared
+// by every platform of the process. Lobby details handles are snapshots of a
+// lobby taken when the handle is copied, as with the real SDK.
+
+#include "MockEOSSDK.h"
+
+#include <algorithm>
+#include <set>
+
+using namespace mock;
+
+//-------------------------------------------------------------------------
+struct EOS_LobbyModificationHandle
+{
+    EOS_HPlatform Platform = nullptr;
+    std::string LobbyId;
+    EOS_ProductUserId LocalUserId = nullptr;
+
+    // Changes that only the owner of the lobby may make
+    bool ChangesLobby = false;
+    bool HasBucketId = false;
+    std::string BucketId;
+    bool HasPermissionLevel = false;
+    EOS_ELobbyPermissionLevel PermissionLevel = EOS_ELobbyPermissionLevel::EOS_LPL_PUBLICADVERTISED;
+    bool HasMaxMembers = false;
+    uint32_t MaxMembers = 0;
+    bool HasInvitesAllowed = false;
+    bool InvitesAllowed = true;
+    std::vector<Attribute> AddedAttributes;
+    std::vector<std::string> RemovedAttributes;
+
+    std::vector<Attribute> AddedMemberAttributes;
+    std::vector<std::string> RemovedMemberAttributes;
+};
+
+//-------------------------------------------------------------------------
+struct EOS_LobbyDetailsHandle
+{
+    Lobby Snapshot;
+};
+
+//-------------------------------------------------------------------------
+struct EOS_LobbySearchHandle
+{
+    EOS_HPlatform Platform = nullptr;
+    uint32_t MaxResults = EOS_LOBBY_MAX_SEARCH_RESULTS;
+    std::string LobbyId;
+    EOS_ProductUserId TargetUserId = nullptr;
+    std::vector<std::pair<Attribute, EOS_EComparisonOp>> Parameters;
+
+    // Written by EOS_LobbySearch_Find under the backend lock
+    std::vector<Lobby> Results;
+};
+
+namespace mock
+{
+    //-------------------------------------------------------------------------
+    LobbyMember* Lobby::FindMember(EOS_ProductUserId userId)
+    {
+        for (LobbyMember& member : Members)
+        {
+            if (member.UserId == userId)
+            {
+                return &member;
+            }
+        }
+
+        return nullptr;
+    }
+}
+
+namespace
+{
+    //-------------------------------------------------------------------------
+    // Finds the platforms of the lobby members, other than the given one.
+    std::set<EOS_HPlatform> GetMemberPlatforms(Backend& backend, const Lobby& lobby, EOS_ProductUserId except)
+    {
+        std::set<EOS_HPlatform> platforms;
+        for (const LobbyMember& member : lobby.Members)
+        {
+            User* user = member.UserId != except ? backend.FindUser(member.UserId) : nullptr;
+            if (user != nullptr)
+            {
+                platforms.insert(user->Platform);
+            }
+        }
+
+        return platforms;
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyLobbyUpdated(EOS_HPlatform platform, const std::string& lobbyId)
+    {
+        Notify(platform, NotificationKind::LobbyUpdateReceived, nullptr, [lobbyId](const Notification& notification)
+        {
+            EOS_Lobby_LobbyUpdateReceivedCallbackInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LobbyId = lobbyId.c_str();
+            reinterpret_cast<EOS_Lobby_OnLobbyUpdateReceivedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyMemberUpdated(EOS_HPlatform platform, const std::string& lobbyId, EOS_ProductUserId targetUserId)
+    {
+        Notify(platform, NotificationKind::LobbyMemberUpdateReceived, nullptr, [lobbyId, targetUserId](const Notification& notification)
+        {
+            EOS_Lobby_LobbyMemberUpdateReceivedCallbackInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LobbyId = lobbyId.c_str();
+            info.TargetUserId = targetUserId;
+            reinterpret_cast<EOS_Lobby_OnLobbyMemberUpdateReceivedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyMemberStatus(EOS_HPlatform platform, const std::string& lobbyId, EOS_ProductUserId targetUserId, EOS_ELobbyMemberStatus status)
+    {
+        Notify(platform, NotificationKind::LobbyMemberStatusReceived, nullptr, [lobbyId, targetUserId, status](const Notification& notification)
+        {
+            EOS_Lobby_LobbyMemberStatusReceivedCallbackInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LobbyId = lobbyId.c_str();
+            info.TargetUserId = targetUserId;
+            info.CurrentStatus = status;
+            reinterpret_cast<EOS_Lobby_OnLobbyMemberStatusReceivedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyMembersOfStatus(Backend& backend, const Lobby& lobby, EOS_ProductUserId targetUserId, EOS_ELobbyMemberStatus status)
+    {
+        for (EOS_HPlatform platform : GetMemberPlatforms(backend, lobby, nullptr))
+        {
+            NotifyMemberStatus(platform, lobby.Id, targetUserId, status);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Closes a lobby, telling the remaining members.
+    void CloseLobby(Backend& backend, const std::string& lobbyId)
+    {
+        auto lobby = backend.Lobbies.find(lobbyId);
+        if (lobby == backend.Lobbies.end())
+        {
+            return;
+        }
+
+        for (const LobbyMember& member : lobby->second.Members)
+        {
+            User* user = backend.FindUser(member.UserId);
+            if (user != nullptr)
+            {
+                NotifyMemberStatus(user->Platform, lobbyId, member.UserId, EOS_ELobbyMemberStatus::EOS_LMS_CLOSED);
+            }
+        }
+
+        backend.Lobbies.erase(lobby);
+    }
+
+    //-------------------------------------------------------------------------
+    // Removes a member from a lobby, migrating the host or closing the lobby
+    // when the owner leaves.
+    void RemoveMember(Backend& backend, Lobby& lobby, EOS_ProductUserId userId, EOS_ELobbyMemberStatus status)
+    {
+        User* removedUser = backend.FindUser(userId);
+        lobby.Members.erase(std::remove_if(lobby.Members.begin(), lobby.Members.end(),
+            [userId](const LobbyMember& member) { return member.UserId == userId; }), lobby.Members.end());
+
+        if (removedUser != nullptr && status == EOS_ELobbyMemberStatus::EOS_LMS_KICKED)
+        {
+            NotifyMemberStatus(removedUser->Platform, lobby.Id, userId, status);
+        }
+
+        std::string lobbyId = lobby.Id;
+        if (lobby.Members.empty())
+        {
+            backend.Lobbies.erase(lobbyId);
+            return;
+        }
+
+        NotifyMembersOfStatus(backend, lobby, userId, status);
+
+        if (lobby.Owner == userId)
+        {
+            if (!lobby.AllowHostMigration)
+            {
+                CloseLobby(backend, lobbyId);
+                return;
+            }
+
+            lobby.Owner = lobby.Members.front().UserId;
+            NotifyMembersOfStatus(backend, lobby, lobby.Owner, EOS_ELobbyMemberStatus::EOS_LMS_PROMOTED);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bool IsLocalUser(Backend& backend, EOS_HPlatform platform, EOS_ProductUserId userId)
+    {
+        User* user = userId != nullptr ? backend.FindUser(userId) : nullptr;
+        return user != nullptr && user->Platform == platform;
+    }
+
+    //-------------------------------------------------------------------------
+    // Adds a user to a lobby, if there's room and the user may join.
+    EOS_EResult Join(Backend& backend, const std::string& lobbyId, EOS_ProductUserId userId, bool byId)
+    {
+        auto found = backend.Lobbies.find(lobbyId);
+        if (found == backend.Lobbies.end())
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        Lobby& lobby = found->second;
+        if (lobby.FindMember(userId) != nullptr)
+        {
+            return EOS_EResult::EOS_Success;
+        }
+
+        if (lobby.PermissionLevel == EOS_ELobbyPermissionLevel::EOS_LPL_INVITEONLY || (byId && !lobby.AllowJoinById))
+        {
+            return EOS_EResult::EOS_Lobby_NoPermission;
+        }
+
+        if (lobby.Members.size() >= lobby.MaxMembers)
+        {
+            return EOS_EResult::EOS_Lobby_TooManyPlayers;
+        }
+
+        LobbyMember member;
+        member.UserId = userId;
+        lobby.Members.push_back(member);
+
+        for (EOS_HPlatform platform : GetMemberPlatforms(backend, lobby, userId))
+        {
+            NotifyMemberStatus(platform, lobbyId, userId, EOS_ELobbyMemberStatus::EOS_LMS_JOINED);
+        }
+
+        return EOS_EResult::EOS_Success;
+    }
+
+    //-------------------------------------------------------------------------
+    bool MatchesSearch(const Lobby& lobby, const EOS_LobbySearchHandle& search)
+    {
+        if (!search.LobbyId.empty())
+        {
+            return lobby.Id == search.LobbyId;
+        }
+
+        if (search.TargetUserId != nullptr)
+        {
+            return std::any_of(lobby.Members.begin(), lobby.Members.end(),
+                [&search](const LobbyMember& member) { return member.UserId == search.TargetUserId; });
+        }
+
+        if (lobby.PermissionLevel != EOS_ELobbyPermissionLevel::EOS_LPL_PUBLICADVERTISED)
+        {
+            return false;
+        }
+
+        for (const auto& parameter : search.Parameters)
+        {
+            const Attribute& operand = parameter.first;
+            EOS_EComparisonOp comparison = parameter.second;
+
+            Attribute value;
+            if (strcasecmp(operand.Key.c_str(), EOS_LOBBY_SEARCH_BUCKET_ID) == 0)
+            {
+                value.Type = EOS_EAttributeType::EOS_AT_STRING;
+                value.AsUtf8 = lobby.BucketId;
+            }
+            else if (strcasecmp(operand.Key.c_str(), EOS_LOBBY_SEARCH_MINCURRENTMEMBERS) == 0)
+            {
+                value.AsInt64 = static_cast<int64_t>(lobby.Members.size());
+                comparison = EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL;
+            }
+            else if (strcasecmp(operand.Key.c_str(), EOS_LOBBY_SEARCH_MINSLOTSAVAILABLE) == 0)
+            {
+                value.AsInt64 = static_cast<int64_t>(lobby.MaxMembers - lobby.Members.size());
+                comparison = EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL;
+            }
+            else
+            {
+                const Attribute* attribute = FindAttribute(lobby.Attributes, operand.Key.c_str());
+                if (attribute == nullptr || attribute->Visibility != static_cast<int32_t>(EOS_ELobbyAttributeVisibility::EOS_LAT_PUBLIC))
+                {
+                    return false;
+                }
+                value = *attribute;
+            }
+
+            if (!MatchesParameter(value, operand, comparison))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_Lobby_Attribute* CopyLobbyAttribute(const Attribute& attribute)
+    {
+        EOS_Lobby_Attribute* copy = new EOS_Lobby_Attribute();
+        copy->ApiVersion = EOS_LOBBY_ATTRIBUTE_API_LATEST;
+        copy->Data = CopyAttributeData<EOS_Lobby_AttributeData>(attribute);
+        copy->Visibility = static_cast<EOS_ELobbyAttributeVisibility>(attribute.Visibility);
+        return copy;
+    }
+
+    //-------------------------------------------------------------------------
+    const LobbyMember* FindSnapshotMember(const Lobby& lobby, EOS_ProductUserId userId)
+    {
+        for (const LobbyMember& member : lobby.Members)
+        {
+            if (member.UserId == userId)
+            {
+                return &member;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    // Posts the completion of a lobby request whose callback info holds only a
+    // result and the lobby id.
+    template <typename TCallbackInfo, typename TCallback>
+    void PostLobbyResult(EOS_HPlatform platform, std::function<EOS_EResult(Backend&, std::string&)> request, void* clientData, TCallback completionDelegate)
+    {
+        PostRequest(platform, [request, clientData, completionDelegate]()
+        {
+            std::string lobbyId;
+            TCallbackInfo info = {};
+            info.ClientData = clientData;
+
+            {
+                Backend& backend = GetBackend();
+                std::lock_guard<std::mutex> lock(backend.Mutex);
+                info.ResultCode = request(backend, lobbyId);
+            }
+
+            info.LobbyId = lobbyId.c_str();
+            completionDelegate(&info);
+        });
+    }
+}
+
+namespace mock
+{
+    //-------------------------------------------------------------------------
+    void RemoveUserFromLobbies(Backend& backend, EOS_ProductUserId userId)
+    {
+        std::vector<std::string> lobbyIds;
+        for (const auto& lobby : backend.Lobbies)
+        {
+            if (std::any_of(lobby.second.Members.begin(), lobby.second.Members.end(),
+                [userId](const LobbyMember& member) { return member.UserId == userId; }))
+            {
+                lobbyIds.push_back(lobby.first);
+            }
+        }
+
+        for (const std::string& lobbyId : lobbyIds)
+        {
+            auto lobby = backend.Lobbies.find(lobbyId);
+            if (lobby != backend.Lobbies.end())
+            {
+                RemoveMember(backend, lobby->second, userId, EOS_ELobbyMemberStatus::EOS_LMS_DISCONNECTED);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_CreateLobby(EOS_HLobby Handle, const EOS_Lobby_CreateLobbyOptions* Options, void* ClientData, const EOS_Lobby_OnCreateLobbyCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->MaxLobbyMembers > 0 && Options->MaxLobbyMembers <= EOS_LOBBY_MAX_LOBBY_MEMBERS;
+
+    Lobby created;
+    if (validOptions)
+    {
+        created.Id = Options->LobbyId ? Options->LobbyId : "";
+        created.Owner = Options->LocalUserId;
+        created.BucketId = Options->BucketId ? Options->BucketId : "";
+        created.MaxMembers = Options->MaxLobbyMembers;
+        created.PermissionLevel = Options->PermissionLevel;
+        created.AllowInvites = Options->bAllowInvites != EOS_FALSE;
+        created.PresenceEnabled = Options->bPresenceEnabled != EOS_FALSE;
+        created.AllowHostMigration = Options->bDisableHostMigration == EOS_FALSE;
+        created.AllowJoinById = Options->bEnableJoinById != EOS_FALSE;
+
+        LobbyMember owner;
+        owner.UserId = Options->LocalUserId;
+        created.Members.push_back(owner);
+    }
+
+    PostLobbyResult<EOS_Lobby_CreateLobbyCallbackInfo>(platform, [platform, validOptions, created](Backend& backend, std::string& lobbyId) mutable
+    {
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        if (!IsLocalUser(backend, platform, created.Owner))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        if (created.Id.empty())
+        {
+            created.Id = backend.NewId();
+        }
+        else if (backend.Lobbies.count(created.Id) != 0)
+        {
+            return EOS_EResult::EOS_Lobby_LobbyAlreadyExists;
+        }
+
+        lobbyId = created.Id;
+        backend.Lobbies[lobbyId] = created;
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_DestroyLobby(EOS_HLobby Handle, const EOS_Lobby_DestroyLobbyOptions* Options, void* ClientData, const EOS_Lobby_OnDestroyLobbyCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string requestedId = Options != nullptr && Options->LobbyId ? Options->LobbyId : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_DestroyLobbyCallbackInfo>(platform, [platform, requestedId, userId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        auto lobby = backend.Lobbies.find(requestedId);
+        if (lobby == backend.Lobbies.end())
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (lobby->second.Owner != userId)
+        {
+            return EOS_EResult::EOS_Lobby_NotOwner;
+        }
+
+        // The owner destroying the lobby isn't told it closed
+        lobby->second.Members.erase(std::remove_if(lobby->second.Members.begin(), lobby->second.Members.end(),
+            [userId](const LobbyMember& member) { return member.UserId == userId; }), lobby->second.Members.end());
+        CloseLobby(backend, requestedId);
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_JoinLobby(EOS_HLobby Handle, const EOS_Lobby_JoinLobbyOptions* Options, void* ClientData, const EOS_Lobby_OnJoinLobbyCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->LobbyDetailsHandle != nullptr;
+    std::string requestedId = validOptions ? Options->LobbyDetailsHandle->Snapshot.Id : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_JoinLobbyCallbackInfo>(platform, [platform, validOptions, requestedId, userId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        return Join(backend, requestedId, userId, false);
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_JoinLobbyById(EOS_HLobby Handle, const EOS_Lobby_JoinLobbyByIdOptions* Options, void* ClientData, const EOS_Lobby_OnJoinLobbyByIdCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->LobbyId != nullptr;
+    std::string requestedId = validOptions ? Options->LobbyId : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_JoinLobbyByIdCallbackInfo>(platform, [platform, validOptions, requestedId, userId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        return Join(backend, requestedId, userId, true);
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_LeaveLobby(EOS_HLobby Handle, const EOS_Lobby_LeaveLobbyOptions* Options, void* ClientData, const EOS_Lobby_OnLeaveLobbyCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string requestedId = Options != nullptr && Options->LobbyId ? Options->LobbyId : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_LeaveLobbyCallbackInfo>(platform, [platform, requestedId, userId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        auto lobby = backend.Lobbies.find(requestedId);
+        if (lobby == backend.Lobbies.end() || lobby->second.FindMember(userId) == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        RemoveMember(backend, lobby->second, userId, EOS_ELobbyMemberStatus::EOS_LMS_LEFT);
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_PromoteMember(EOS_HLobby Handle, const EOS_Lobby_PromoteMemberOptions* Options, void* ClientData, const EOS_Lobby_OnPromoteMemberCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string requestedId = Options != nullptr && Options->LobbyId ? Options->LobbyId : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+    EOS_ProductUserId targetUserId = Options != nullptr ? Options->TargetUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_PromoteMemberCallbackInfo>(platform, [platform, requestedId, userId, targetUserId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        auto lobby = backend.Lobbies.find(requestedId);
+        if (lobby == backend.Lobbies.end() || lobby->second.FindMember(targetUserId) == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (lobby->second.Owner != userId)
+        {
+            return EOS_EResult::EOS_Lobby_NotOwner;
+        }
+
+        lobby->second.Owner = targetUserId;
+        NotifyMembersOfStatus(backend, lobby->second, targetUserId, EOS_ELobbyMemberStatus::EOS_LMS_PROMOTED);
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_KickMember(EOS_HLobby Handle, const EOS_Lobby_KickMemberOptions* Options, void* ClientData, const EOS_Lobby_OnKickMemberCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string requestedId = Options != nullptr && Options->LobbyId ? Options->LobbyId : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+    EOS_ProductUserId targetUserId = Options != nullptr ? Options->TargetUserId : nullptr;
+
+    PostLobbyResult<EOS_Lobby_KickMemberCallbackInfo>(platform, [platform, requestedId, userId, targetUserId](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = requestedId;
+        if (!IsLocalUser(backend, platform, userId))
+        {
+            return EOS_EResult::EOS_InvalidUser;
+        }
+
+        auto lobby = backend.Lobbies.find(requestedId);
+        if (lobby == backend.Lobbies.end() || lobby->second.FindMember(targetUserId) == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (lobby->second.Owner != userId || targetUserId == userId)
+        {
+            return EOS_EResult::EOS_Lobby_NotOwner;
+        }
+
+        RemoveMember(backend, lobby->second, targetUserId, EOS_ELobbyMemberStatus::EOS_LMS_KICKED);
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_UpdateLobbyModification(EOS_HLobby Handle, const EOS_Lobby_UpdateLobbyModificationOptions* Options, EOS_HLobbyModification* OutLobbyModificationHandle)
+{
+    if (Handle == nullptr || Options == nullptr || Options->LobbyId == nullptr || OutLobbyModificationHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    if (!IsLocalUser(backend, Handle->Platform, Options->LocalUserId))
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    auto lobby = backend.Lobbies.find(Options->LobbyId);
+    if (lobby == backend.Lobbies.end() || lobby->second.FindMember(Options->LocalUserId) == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    EOS_HLobbyModification modification = new EOS_LobbyModificationHandle();
+    modification->Platform = Handle->Platform;
+    modification->LobbyId = Options->LobbyId;
+    modification->LocalUserId = Options->LocalUserId;
+    *OutLobbyModificationHandle = modification;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_UpdateLobby(EOS_HLobby Handle, const EOS_Lobby_UpdateLobbyOptions* Options, void* ClientData, const EOS_Lobby_OnUpdateLobbyCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->LobbyModificationHandle != nullptr;
+
+    // The modification handle may be released as soon as this returns
+    EOS_LobbyModificationHandle modification;
+    if (validOptions)
+    {
+        modification = *Options->LobbyModificationHandle;
+    }
+
+    PostLobbyResult<EOS_Lobby_UpdateLobbyCallbackInfo>(platform, [validOptions, modification](Backend& backend, std::string& lobbyId)
+    {
+        lobbyId = modification.LobbyId;
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        auto found = backend.Lobbies.find(modification.LobbyId);
+        if (found == backend.Lobbies.end())
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        Lobby& lobby = found->second;
+        LobbyMember* member = lobby.FindMember(modification.LocalUserId);
+        if (member == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (modification.ChangesLobby && lobby.Owner != modification.LocalUserId)
+        {
+            return EOS_EResult::EOS_Lobby_NotOwner;
+        }
+
+        if (modification.HasMaxMembers && modification.MaxMembers < lobby.Members.size())
+        {
+            return EOS_EResult::EOS_Lobby_TooManyPlayers;
+        }
+
+        if (modification.HasBucketId) lobby.BucketId = modification.BucketId;
+        if (modification.HasPermissionLevel) lobby.PermissionLevel = modification.PermissionLevel;
+        if (modification.HasMaxMembers) lobby.MaxMembers = modification.MaxMembers;
+        if (modification.HasInvitesAllowed) lobby.AllowInvites = modification.InvitesAllowed;
+        for (const std::string& key : modification.RemovedAttributes) RemoveAttribute(lobby.Attributes, key);
+        for (const Attribute& attribute : modification.AddedAttributes) SetAttribute(lobby.Attributes, attribute);
+        for (const std::string& key : modification.RemovedMemberAttributes) RemoveAttribute(member->Attributes, key);
+        for (const Attribute& attribute : modification.AddedMemberAttributes) SetAttribute(member->Attributes, attribute);
+
+        bool changesMember = !modification.AddedMemberAttributes.empty() || !modification.RemovedMemberAttributes.empty();
+        for (EOS_HPlatform platform : GetMemberPlatforms(backend, lobby, modification.LocalUserId))
+        {
+            if (modification.ChangesLobby)
+            {
+                NotifyLobbyUpdated(platform, lobby.Id);
+            }
+            if (changesMember)
+            {
+                NotifyMemberUpdated(platform, lobby.Id, modification.LocalUserId);
+            }
+        }
+
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_CopyLobbyDetailsHandle(EOS_HLobby Handle, const EOS_Lobby_CopyLobbyDetailsHandleOptions* Options, EOS_HLobbyDetails* OutLobbyDetailsHandle)
+{
+    if (Handle == nullptr || Options == nullptr || Options->LobbyId == nullptr || OutLobbyDetailsHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    auto lobby = backend.Lobbies.find(Options->LobbyId);
+    if (lobby == backend.Lobbies.end() || lobby->second.FindMember(Options->LocalUserId) == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutLobbyDetailsHandle = new EOS_LobbyDetailsHandle{ lobby->second };
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_CreateLobbySearch(EOS_HLobby Handle, const EOS_Lobby_CreateLobbySearchOptions* Options, EOS_HLobbySearch* OutLobbySearchHandle)
+{
+    if (Handle == nullptr || Options == nullptr || OutLobbySearchHandle == nullptr
+        || Options->MaxResults == 0 || Options->MaxResults > EOS_LOBBY_MAX_SEARCH_RESULTS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    EOS_HLobbySearch search = new EOS_LobbySearchHandle();
+    search->Platform = Handle->Platform;
+    search->MaxResults = Options->MaxResults;
+    *OutLobbySearchHandle = search;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyUpdateReceived(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyUpdateReceivedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyUpdateReceivedCallback NotificationFn)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    Notification notification;
+    notification.Kind = NotificationKind::LobbyUpdateReceived;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(NotificationFn);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyUpdateReceived(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, InId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyMemberUpdateReceived(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyMemberUpdateReceivedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyMemberUpdateReceivedCallback NotificationFn)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    Notification notification;
+    notification.Kind = NotificationKind::LobbyMemberUpdateReceived;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(NotificationFn);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyMemberUpdateReceived(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, InId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyMemberStatusReceived(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyMemberStatusReceivedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyMemberStatusReceivedCallback NotificationFn)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    Notification notification;
+    notification.Kind = NotificationKind::LobbyMemberStatusReceived;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(NotificationFn);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyMemberStatusReceived(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, InId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_SetBucketId(EOS_HLobbyModification Handle, const EOS_LobbyModification_SetBucketIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->BucketId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    Handle->HasBucketId = true;
+    Handle->BucketId = Options->BucketId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_SetPermissionLevel(EOS_HLobbyModification Handle, const EOS_LobbyModification_SetPermissionLevelOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    Handle->HasPermissionLevel = true;
+    Handle->PermissionLevel = Options->PermissionLevel;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_SetMaxMembers(EOS_HLobbyModification Handle, const EOS_LobbyModification_SetMaxMembersOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->MaxMembers == 0 || Options->MaxMembers > EOS_LOBBY_MAX_LOBBY_MEMBERS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    Handle->HasMaxMembers = true;
+    Handle->MaxMembers = Options->MaxMembers;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_SetInvitesAllowed(EOS_HLobbyModification Handle, const EOS_LobbyModification_SetInvitesAllowedOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    Handle->HasInvitesAllowed = true;
+    Handle->InvitesAllowed = Options->bInvitesAllowed != EOS_FALSE;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_AddAttribute(EOS_HLobbyModification Handle, const EOS_LobbyModification_AddAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Attribute == nullptr || Options->Attribute->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    SetAttribute(Handle->AddedAttributes, ToAttribute(Options->Attribute, static_cast<int32_t>(Options->Visibility)));
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_RemoveAttribute(EOS_HLobbyModification Handle, const EOS_LobbyModification_RemoveAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ChangesLobby = true;
+    RemoveAttribute(Handle->AddedAttributes, Options->Key);
+    Handle->RemovedAttributes.push_back(Options->Key);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_AddMemberAttribute(EOS_HLobbyModification Handle, const EOS_LobbyModification_AddMemberAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Attribute == nullptr || Options->Attribute->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    SetAttribute(Handle->AddedMemberAttributes, ToAttribute(Options->Attribute, static_cast<int32_t>(Options->Visibility)));
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_RemoveMemberAttribute(EOS_HLobbyModification Handle, const EOS_LobbyModification_RemoveMemberAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    RemoveAttribute(Handle->AddedMemberAttributes, Options->Key);
+    Handle->RemovedMemberAttributes.push_back(Options->Key);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyModification_SetAllowedPlatformIds(EOS_HLobbyModification Handle, const EOS_LobbyModification_SetAllowedPlatformIdsOptions* Options)
+{
+    // Every platform is allowed in the mock
+    return Handle != nullptr && Options != nullptr ? EOS_EResult::EOS_Success : EOS_EResult::EOS_InvalidParameters;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbyModification_Release(EOS_HLobbyModification LobbyModificationHandle)
+{
+    delete LobbyModificationHandle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_LobbyDetails_GetLobbyOwner(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_GetLobbyOwnerOptions* Options)
+{
+    return Handle != nullptr && Options != nullptr ? Handle->Snapshot.Owner : nullptr;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyInfo(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyInfoOptions* Options, EOS_LobbyDetails_Info ** OutLobbyDetailsInfo)
+{
+    if (Handle == nullptr || Options == nullptr || OutLobbyDetailsInfo == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const Lobby& lobby = Handle->Snapshot;
+    EOS_LobbyDetails_Info* info = new EOS_LobbyDetails_Info();
+    info->ApiVersion = EOS_LOBBYDETAILS_INFO_API_LATEST;
+    info->LobbyId = strdup(lobby.Id.c_str());
+    info->LobbyOwnerUserId = lobby.Owner;
+    info->PermissionLevel = lobby.PermissionLevel;
+    info->AvailableSlots = lobby.MaxMembers - static_cast<uint32_t>(lobby.Members.size());
+    info->MaxMembers = lobby.MaxMembers;
+    info->bAllowInvites = lobby.AllowInvites ? EOS_TRUE : EOS_FALSE;
+    info->BucketId = strdup(lobby.BucketId.c_str());
+    info->bAllowHostMigration = lobby.AllowHostMigration ? EOS_TRUE : EOS_FALSE;
+    info->bAllowJoinById = lobby.AllowJoinById ? EOS_TRUE : EOS_FALSE;
+    info->bPresenceEnabled = lobby.PresenceEnabled ? EOS_TRUE : EOS_FALSE;
+    *OutLobbyDetailsInfo = info;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbyDetails_Info_Release(EOS_LobbyDetails_Info* LobbyDetailsInfo)
+{
+    if (LobbyDetailsInfo != nullptr)
+    {
+        free(const_cast<char*>(LobbyDetailsInfo->LobbyId));
+        free(const_cast<char*>(LobbyDetailsInfo->BucketId));
+        delete LobbyDetailsInfo;
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_LobbyDetails_GetAttributeCount(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_GetAttributeCountOptions* Options)
+{
+    return Handle != nullptr && Options != nullptr ? static_cast<uint32_t>(Handle->Snapshot.Attributes.size()) : 0;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyAttributeByIndex(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyAttributeByIndexOptions* Options, EOS_Lobby_Attribute ** OutAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutAttribute == nullptr || Options->AttrIndex >= Handle->Snapshot.Attributes.size())
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    *OutAttribute = CopyLobbyAttribute(Handle->Snapshot.Attributes[Options->AttrIndex]);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyAttributeByKey(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyAttributeByKeyOptions* Options, EOS_Lobby_Attribute ** OutAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutAttribute == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const Attribute* attribute = FindAttribute(Handle->Snapshot.Attributes, Options->AttrKey);
+    if (attribute == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutAttribute = CopyLobbyAttribute(*attribute);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_LobbyDetails_GetMemberCount(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_GetMemberCountOptions* Options)
+{
+    return Handle != nullptr && Options != nullptr ? static_cast<uint32_t>(Handle->Snapshot.Members.size()) : 0;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_LobbyDetails_GetMemberByIndex(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_GetMemberByIndexOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->MemberIndex >= Handle->Snapshot.Members.size())
+    {
+        return nullptr;
+    }
+
+    return Handle->Snapshot.Members[Options->MemberIndex].UserId;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_LobbyDetails_GetMemberAttributeCount(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_GetMemberAttributeCountOptions* Options)
+{
+    const LobbyMember* member = Handle != nullptr && Options != nullptr ? FindSnapshotMember(Handle->Snapshot, Options->TargetUserId) : nullptr;
+    return member != nullptr ? static_cast<uint32_t>(member->Attributes.size()) : 0;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyMemberAttributeByIndex(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyMemberAttributeByIndexOptions* Options, EOS_Lobby_Attribute ** OutAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutAttribute == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const LobbyMember* member = FindSnapshotMember(Handle->Snapshot, Options->TargetUserId);
+    if (member == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    if (Options->AttrIndex >= member->Attributes.size())
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    *OutAttribute = CopyLobbyAttribute(member->Attributes[Options->AttrIndex]);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyMemberAttributeByKey(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyMemberAttributeByKeyOptions* Options, EOS_Lobby_Attribute ** OutAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutAttribute == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const LobbyMember* member = FindSnapshotMember(Handle->Snapshot, Options->TargetUserId);
+    const Attribute* attribute = member != nullptr ? FindAttribute(member->Attributes, Options->AttrKey) : nullptr;
+    if (attribute == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutAttribute = CopyLobbyAttribute(*attribute);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbyDetails_CopyMemberInfo(EOS_HLobbyDetails Handle, const EOS_LobbyDetails_CopyMemberInfoOptions* Options, EOS_LobbyDetails_MemberInfo ** OutLobbyDetailsMemberInfo)
+{
+    if (Handle == nullptr || Options == nullptr || OutLobbyDetailsMemberInfo == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const LobbyMember* member = FindSnapshotMember(Handle->Snapshot, Options->TargetUserId);
+    if (member == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    EOS_LobbyDetails_MemberInfo* info = new EOS_LobbyDetails_MemberInfo();
+    info->ApiVersion = EOS_LOBBYDETAILS_MEMBERINFO_API_LATEST;
+    info->UserId = member->UserId;
+    info->bAllowsCrossplay = EOS_TRUE;
+    *OutLobbyDetailsMemberInfo = info;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbyDetails_MemberInfo_Release(EOS_LobbyDetails_MemberInfo* LobbyDetailsMemberInfo)
+{
+    delete LobbyDetailsMemberInfo;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_Attribute_Release(EOS_Lobby_Attribute* LobbyAttribute)
+{
+    if (LobbyAttribute != nullptr)
+    {
+        FreeAttributeData(LobbyAttribute->Data);
+        delete LobbyAttribute;
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbyDetails_Release(EOS_HLobbyDetails LobbyHandle)
+{
+    delete LobbyHandle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbySearch_Find(EOS_HLobbySearch Handle, const EOS_LobbySearch_FindOptions* Options, void* ClientData, const EOS_LobbySearch_OnFindCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    // Results are written to the search handle, which must not be released
+    // before the search completes
+    bool validOptions = Options != nullptr && Options->LocalUserId != nullptr;
+    PostRequest(Handle->Platform, [Handle, validOptions, ClientData, CompletionDelegate]()
+    {
+        EOS_LobbySearch_FindCallbackInfo info = {};
+        info.ClientData = ClientData;
+        info.ResultCode = EOS_EResult::EOS_Success;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            Handle->Results.clear();
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else
+            {
+                for (const auto& lobby : backend.Lobbies)
+                {
+                    if (Handle->Results.size() >= Handle->MaxResults)
+                    {
+                        break;
+                    }
+
+                    if (MatchesSearch(lobby.second, *Handle))
+                    {
+                        Handle->Results.push_back(lobby.second);
+                    }
+                }
+
+                if (Handle->Results.empty() && !Handle->LobbyId.empty())
+                {
+                    info.ResultCode = EOS_EResult::EOS_NotFound;
+                }
+            }
+        }
+
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_SetLobbyId(EOS_HLobbySearch Handle, const EOS_LobbySearch_SetLobbyIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->LobbyId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->LobbyId = Options->LobbyId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_SetTargetUserId(EOS_HLobbySearch Handle, const EOS_LobbySearch_SetTargetUserIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->TargetUserId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->TargetUserId = Options->TargetUserId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_SetParameter(EOS_HLobbySearch Handle, const EOS_LobbySearch_SetParameterOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Parameter == nullptr || Options->Parameter->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->Parameters.emplace_back(ToAttribute(Options->Parameter, 0), Options->ComparisonOp);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_RemoveParameter(EOS_HLobbySearch Handle, const EOS_LobbySearch_RemoveParameterOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    std::string key = Options->Key;
+    EOS_EComparisonOp comparison = Options->ComparisonOp;
+    auto& parameters = Handle->Parameters;
+    size_t count = parameters.size();
+    parameters.erase(std::remove_if(parameters.begin(), parameters.end(),
+        [&key, comparison](const std::pair<Attribute, EOS_EComparisonOp>& parameter)
+        {
+            return parameter.first.Key == key && parameter.second == comparison;
+        }), parameters.end());
+
+    return parameters.size() != count ? EOS_EResult::EOS_Success : EOS_EResult::EOS_NotFound;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_SetMaxResults(EOS_HLobbySearch Handle, const EOS_LobbySearch_SetMaxResultsOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->MaxResults == 0 || Options->MaxResults > EOS_LOBBY_MAX_SEARCH_RESULTS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->MaxResults = Options->MaxResults;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_LobbySearch_GetSearchResultCount(EOS_HLobbySearch Handle, const EOS_LobbySearch_GetSearchResultCountOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return 0;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    return static_cast<uint32_t>(Handle->Results.size());
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_LobbySearch_CopySearchResultByIndex(EOS_HLobbySearch Handle, const EOS_LobbySearch_CopySearchResultByIndexOptions* Options, EOS_HLobbyDetails* OutLobbyDetailsHandle)
+{
+    if (Handle == nullptr || Options == nullptr || OutLobbyDetailsHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    if (Options->LobbyIndex >= Handle->Results.size())
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutLobbyDetailsHandle = new EOS_LobbyDetailsHandle{ Handle->Results[Options->LobbyIndex] };
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_LobbySearch_Release(EOS_HLobbySearch LobbySearchHandle)
+{
+    delete LobbySearchHandle;
+}
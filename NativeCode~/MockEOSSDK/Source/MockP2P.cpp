@@ -0,0 +1,825 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// P2P interface of the mock EOS SDK. Packets are passed between the users of
+// the process in memory, arriving after the simulated latency and jitter, and
+// unreliable packets are dropped at the simulated loss rate. Reliable packets
+// are never dropped; each simulated loss delays them by a round trip instead,
+// as a retransmission would.
+
+#include "MockEOSSDK.h"
+
+#include <algorithm>
+
+using namespace mock;
+
+namespace
+{
+    // Resends of a reliable packet are given up on after this many losses
+    // and it is delivered anyway, so that loss rates close to 1 still end.
+    const int MaxRetransmissions = 10;
+
+    //-------------------------------------------------------------------------
+    bool IsValidSocketId(const EOS_P2P_SocketId* socketId)
+    {
+        return socketId != nullptr && socketId->SocketName[0] != '\0'
+            && memchr(socketId->SocketName, '\0', EOS_P2P_SOCKETID_SOCKETNAME_SIZE) != nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_P2P_SocketId ToSocketId(const std::string& socketName)
+    {
+        EOS_P2P_SocketId socketId = {};
+        socketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
+        strncpy(socketId.SocketName, socketName.c_str(), EOS_P2P_SOCKETID_SOCKETNAME_SIZE - 1);
+        return socketId;
+    }
+
+    //-------------------------------------------------------------------------
+    // Notification filter for the notifications added for a user, and
+    // optionally a socket.
+    std::function<bool(const Notification&)> ForUserAndSocket(EOS_ProductUserId userId, const std::string& socketName)
+    {
+        return [userId, socketName](const Notification& notification)
+        {
+            return notification.LocalUserId == userId && (!notification.HasSocketName || notification.SocketName == socketName);
+        };
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_NotificationId AddSocketNotification(EOS_HP2P handle, NotificationKind kind, EOS_ProductUserId localUserId,
+        const EOS_P2P_SocketId* socketId, void* clientData, void* function)
+    {
+        if (handle == nullptr || localUserId == nullptr)
+        {
+            return EOS_INVALID_NOTIFICATIONID;
+        }
+
+        Notification notification;
+        notification.Kind = kind;
+        notification.ClientData = clientData;
+        notification.Function = function;
+        notification.LocalUserId = localUserId;
+        notification.HasSocketName = socketId != nullptr;
+        if (socketId != nullptr)
+        {
+            notification.SocketName = socketId->SocketName;
+        }
+
+        return AddNotification(handle->Platform, notification);
+    }
+
+    //-------------------------------------------------------------------------
+    // Finds a user logged in on the platform of the handle.
+    User* FindLocalUser(Backend& backend, EOS_HP2P handle, EOS_ProductUserId userId)
+    {
+        User* user = backend.FindUser(userId);
+        return user != nullptr && user->Platform == handle->Platform ? user : nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    uint64_t GetIncomingQueueBytes(Backend& backend, EOS_HPlatform platform)
+    {
+        uint64_t bytes = 0;
+        for (EOS_ProductUserId userId : platform->LoggedInUsers)
+        {
+            User* user = backend.FindUser(userId);
+            if (user != nullptr && user->Platform == platform)
+            {
+                bytes += user->ReceivedBytes;
+            }
+        }
+
+        return bytes;
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyConnectionClosed(User& user, EOS_ProductUserId remoteUserId, const std::string& socketName, EOS_EConnectionClosedReason reason)
+    {
+        EOS_ProductUserId localUserId = user.Id;
+        Notify(user.Platform, NotificationKind::P2PConnectionClosed, ForUserAndSocket(localUserId, socketName),
+            [localUserId, remoteUserId, socketName, reason](const Notification& notification)
+        {
+            EOS_P2P_SocketId socketId = ToSocketId(socketName);
+            EOS_P2P_OnRemoteConnectionClosedInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LocalUserId = localUserId;
+            info.RemoteUserId = remoteUserId;
+            info.SocketId = &socketId;
+            info.Reason = reason;
+            reinterpret_cast<EOS_P2P_OnRemoteConnectionClosedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    void NotifyConnectionEstablished(User& user, EOS_ProductUserId remoteUserId, const std::string& socketName)
+    {
+        EOS_ProductUserId localUserId = user.Id;
+        Notify(user.Platform, NotificationKind::P2PConnectionEstablished, ForUserAndSocket(localUserId, socketName),
+            [localUserId, remoteUserId, socketName](const Notification& notification)
+        {
+            EOS_P2P_SocketId socketId = ToSocketId(socketName);
+            EOS_P2P_OnPeerConnectionEstablishedInfo info = {};
+            info.ClientData = notification.ClientData;
+            info.LocalUserId = localUserId;
+            info.RemoteUserId = remoteUserId;
+            info.SocketId = &socketId;
+            info.ConnectionType = EOS_EConnectionEstablishedType::EOS_CET_NewConnection;
+            info.NetworkType = EOS_ENetworkConnectionType::EOS_NCT_DirectConnection;
+            reinterpret_cast<EOS_P2P_OnPeerConnectionEstablishedCallback>(notification.Function)(&info);
+        });
+    }
+
+    //-------------------------------------------------------------------------
+    // Adds a packet to the received queue of a user, unless that would go over
+    // the incoming queue size of its platform.
+    void ReceiveOrDrop(Backend& backend, User& user, Packet packet)
+    {
+        EOS_HPlatform platform = user.Platform;
+        uint64_t size = packet.Data.size();
+        uint64_t maxBytes = platform->IncomingQueueMaxBytes;
+        uint64_t currentBytes = GetIncomingQueueBytes(backend, platform);
+
+        if (maxBytes != EOS_P2P_MAX_QUEUE_SIZE_UNLIMITED && currentBytes + size > maxBytes)
+        {
+            EOS_ProductUserId localUserId = user.Id;
+            uint8_t channel = packet.Channel;
+            Notify(platform, NotificationKind::P2PIncomingPacketQueueFull, nullptr,
+                [maxBytes, currentBytes, localUserId, channel, size](const Notification& notification)
+            {
+                EOS_P2P_OnIncomingPacketQueueFullInfo info = {};
+                info.ClientData = notification.ClientData;
+                info.PacketQueueMaxSizeBytes = maxBytes;
+                info.PacketQueueCurrentSizeBytes = currentBytes;
+                info.OverflowPacketLocalUserId = localUserId;
+                info.OverflowPacketChannel = channel;
+                info.OverflowPacketSizeBytes = static_cast<uint32_t>(size);
+                reinterpret_cast<EOS_P2P_OnIncomingPacketQueueFullCallback>(notification.Function)(&info);
+            });
+            return;
+        }
+
+        user.ReceivedBytes += size;
+        user.Received.push_back(std::move(packet));
+    }
+
+    //-------------------------------------------------------------------------
+    // Establishes the connection between two users once both have accepted it.
+    void UpdateEstablished(Backend& backend, User& user, EOS_ProductUserId remoteUserId, const std::string& socketName)
+    {
+        User* remoteUser = backend.FindUser(remoteUserId);
+        if (remoteUser == nullptr)
+        {
+            return;
+        }
+
+        auto local = user.Connections.find(ConnectionKey(remoteUserId, socketName));
+        auto remote = remoteUser->Connections.find(ConnectionKey(user.Id, socketName));
+        if (local == user.Connections.end() || remote == remoteUser->Connections.end()
+            || !local->second.Accepted || !remote->second.Accepted || local->second.Established)
+        {
+            return;
+        }
+
+        local->second.Established = true;
+        remote->second.Established = true;
+        NotifyConnectionEstablished(user, remoteUserId, socketName);
+        NotifyConnectionEstablished(*remoteUser, user.Id, socketName);
+    }
+
+    //-------------------------------------------------------------------------
+    // Accepts a connection, receiving the packets that were held back until
+    // it was.
+    void Accept(Backend& backend, User& user, EOS_ProductUserId remoteUserId, const std::string& socketName)
+    {
+        Connection& connection = user.Connections[ConnectionKey(remoteUserId, socketName)];
+        if (!connection.Accepted)
+        {
+            connection.Accepted = true;
+            while (!connection.Held.empty())
+            {
+                ReceiveOrDrop(backend, user, std::move(connection.Held.front()));
+                connection.Held.pop_front();
+            }
+        }
+
+        UpdateEstablished(backend, user, remoteUserId, socketName);
+    }
+
+    //-------------------------------------------------------------------------
+    // Closes the connection of a user to a remote user, and the connection of
+    // the remote user back to it.
+    void Close(Backend& backend, User& user, EOS_ProductUserId remoteUserId, const std::string& socketName)
+    {
+        user.Connections.erase(ConnectionKey(remoteUserId, socketName));
+
+        User* remoteUser = backend.FindUser(remoteUserId);
+        if (remoteUser != nullptr && remoteUser->Connections.erase(ConnectionKey(user.Id, socketName)) != 0)
+        {
+            NotifyConnectionClosed(*remoteUser, user.Id, socketName, EOS_EConnectionClosedReason::EOS_CCR_ClosedByPeer);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    Clock::duration ToDuration(double milliseconds)
+    {
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(milliseconds));
+    }
+}
+
+namespace mock
+{
+    //-------------------------------------------------------------------------
+    void DeliverPackets(Backend& backend, EOS_HPlatform platform, Clock::time_point now)
+    {
+        for (EOS_ProductUserId userId : platform->LoggedInUsers)
+        {
+            User* user = backend.FindUser(userId);
+            if (user == nullptr || user->Platform != platform)
+            {
+                continue;
+            }
+
+            while (!user->Inbound.empty() && user->Inbound.top().Due <= now)
+            {
+                Packet packet = std::move(const_cast<InFlightPacket&>(user->Inbound.top()).Contents);
+                user->Inbound.pop();
+
+                Connection& connection = user->Connections[ConnectionKey(packet.Peer, packet.SocketName)];
+                if (connection.Accepted)
+                {
+                    ReceiveOrDrop(backend, *user, std::move(packet));
+                    continue;
+                }
+
+                if (!connection.RequestNotified)
+                {
+                    connection.RequestNotified = true;
+
+                    EOS_ProductUserId remoteUserId = packet.Peer;
+                    std::string socketName = packet.SocketName;
+                    Notify(platform, NotificationKind::P2PConnectionRequest, ForUserAndSocket(userId, socketName),
+                        [userId, remoteUserId, socketName](const Notification& notification)
+                    {
+                        EOS_P2P_SocketId socketId = ToSocketId(socketName);
+                        EOS_P2P_OnIncomingConnectionRequestInfo info = {};
+                        info.ClientData = notification.ClientData;
+                        info.LocalUserId = userId;
+                        info.RemoteUserId = remoteUserId;
+                        info.SocketId = &socketId;
+                        reinterpret_cast<EOS_P2P_OnIncomingConnectionRequestCallback>(notification.Function)(&info);
+                    });
+                }
+
+                connection.Held.push_back(std::move(packet));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void CloseUserConnections(Backend& backend, User& user)
+    {
+        std::vector<ConnectionKey> keys;
+        for (const auto& connection : user.Connections)
+        {
+            keys.push_back(connection.first);
+        }
+
+        for (const ConnectionKey& key : keys)
+        {
+            Close(backend, user, key.first, key.second);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_SendPacket(EOS_HP2P Handle, const EOS_P2P_SendPacketOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->RemoteUserId == nullptr || !IsValidSocketId(Options->SocketId)
+        || Options->DataLengthBytes > EOS_P2P_MAX_PACKET_SIZE || (Options->DataLengthBytes > 0 && Options->Data == nullptr))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    std::string socketName = Options->SocketId->SocketName;
+    if (Options->bDisableAutoAcceptConnection == EOS_FALSE)
+    {
+        Accept(backend, *user, Options->RemoteUserId, socketName);
+    }
+
+    Connection& connection = user->Connections[ConnectionKey(Options->RemoteUserId, socketName)];
+
+    User* remoteUser = backend.FindUser(Options->RemoteUserId);
+    if (remoteUser == nullptr)
+    {
+        // Nobody to deliver to; the real SDK would keep trying to connect
+        return EOS_EResult::EOS_Success;
+    }
+
+    const NetworkConditions& conditions = backend.Conditions;
+    bool reliable = Options->Reliability != EOS_EPacketReliability::EOS_PR_UnreliableUnordered;
+
+    double delay = conditions.LatencyMilliseconds + conditions.JitterMilliseconds * backend.NextRandom();
+    if (conditions.LossRate > 0)
+    {
+        if (!reliable)
+        {
+            if (backend.NextRandom() < conditions.LossRate)
+            {
+                return EOS_EResult::EOS_Success;
+            }
+        }
+        else
+        {
+            for (int attempt = 0; attempt < MaxRetransmissions && backend.NextRandom() < conditions.LossRate; ++attempt)
+            {
+                delay += std::max(2 * conditions.LatencyMilliseconds, 1.0);
+            }
+        }
+    }
+
+    InFlightPacket packet;
+    packet.Due = Clock::now() + ToDuration(delay);
+    packet.Sequence = backend.NextSequence++;
+    packet.Contents.Peer = user->Id;
+    packet.Contents.SocketName = socketName;
+    packet.Contents.Channel = Options->Channel;
+
+    const uint8_t* data = static_cast<const uint8_t*>(Options->Data);
+    packet.Contents.Data.assign(data, data + Options->DataLengthBytes);
+
+    if (Options->Reliability == EOS_EPacketReliability::EOS_PR_ReliableOrdered)
+    {
+        // Never arrive before an ordered packet sent earlier on the channel
+        Clock::time_point& lastDue = connection.LastOrderedDue[Options->Channel];
+        packet.Due = std::max(packet.Due, lastDue);
+        lastDue = packet.Due;
+    }
+
+    remoteUser->Inbound.push(std::move(packet));
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_GetNextReceivedPacketSize(EOS_HP2P Handle, const EOS_P2P_GetNextReceivedPacketSizeOptions* Options, uint32_t* OutPacketSizeBytes)
+{
+    if (Handle == nullptr || Options == nullptr || OutPacketSizeBytes == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    for (const Packet& packet : user->Received)
+    {
+        if (Options->RequestedChannel == nullptr || packet.Channel == *Options->RequestedChannel)
+        {
+            *OutPacketSizeBytes = static_cast<uint32_t>(packet.Data.size());
+            return EOS_EResult::EOS_Success;
+        }
+    }
+
+    return EOS_EResult::EOS_NotFound;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_ReceivePacket(EOS_HP2P Handle, const EOS_P2P_ReceivePacketOptions* Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten)
+{
+    if (Handle == nullptr || Options == nullptr || OutPeerId == nullptr || OutSocketId == nullptr || OutChannel == nullptr
+        || OutBytesWritten == nullptr || (OutData == nullptr && Options->MaxDataSizeBytes > 0))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    for (auto packet = user->Received.begin(); packet != user->Received.end(); ++packet)
+    {
+        if (Options->RequestedChannel != nullptr && packet->Channel != *Options->RequestedChannel)
+        {
+            continue;
+        }
+
+        // Data that doesn't fit in the buffer is lost, as with the real SDK
+        uint32_t bytes = std::min(static_cast<uint32_t>(packet->Data.size()), Options->MaxDataSizeBytes);
+        if (bytes > 0)
+        {
+            memcpy(OutData, packet->Data.data(), bytes);
+        }
+
+        *OutPeerId = packet->Peer;
+        *OutSocketId = ToSocketId(packet->SocketName);
+        *OutChannel = packet->Channel;
+        *OutBytesWritten = bytes;
+
+        user->ReceivedBytes -= packet->Data.size();
+        user->Received.erase(packet);
+        return EOS_EResult::EOS_Success;
+    }
+
+    return EOS_EResult::EOS_NotFound;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_AcceptConnection(EOS_HP2P Handle, const EOS_P2P_AcceptConnectionOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->RemoteUserId == nullptr || !IsValidSocketId(Options->SocketId))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    Accept(backend, *user, Options->RemoteUserId, Options->SocketId->SocketName);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_CloseConnection(EOS_HP2P Handle, const EOS_P2P_CloseConnectionOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->RemoteUserId == nullptr
+        || (Options->SocketId != nullptr && !IsValidSocketId(Options->SocketId)))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    // Without a socket, connections on every socket to the remote user close
+    std::vector<ConnectionKey> keys;
+    for (const auto& connection : user->Connections)
+    {
+        if (connection.first.first == Options->RemoteUserId
+            && (Options->SocketId == nullptr || connection.first.second == Options->SocketId->SocketName))
+        {
+            keys.push_back(connection.first);
+        }
+    }
+
+    for (const ConnectionKey& key : keys)
+    {
+        Close(backend, *user, key.first, key.second);
+    }
+
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_CloseConnections(EOS_HP2P Handle, const EOS_P2P_CloseConnectionsOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || !IsValidSocketId(Options->SocketId))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    std::vector<ConnectionKey> keys;
+    for (const auto& connection : user->Connections)
+    {
+        if (connection.first.second == Options->SocketId->SocketName)
+        {
+            keys.push_back(connection.first);
+        }
+    }
+
+    for (const ConnectionKey& key : keys)
+    {
+        Close(backend, *user, key.first, key.second);
+    }
+
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_ClearPacketQueue(EOS_HP2P Handle, const EOS_P2P_ClearPacketQueueOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->RemoteUserId == nullptr || !IsValidSocketId(Options->SocketId))
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    User* user = FindLocalUser(backend, Handle, Options->LocalUserId);
+    if (user == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    std::string socketName = Options->SocketId->SocketName;
+    for (auto packet = user->Received.begin(); packet != user->Received.end();)
+    {
+        if (packet->Peer == Options->RemoteUserId && packet->SocketName == socketName)
+        {
+            user->ReceivedBytes -= packet->Data.size();
+            packet = user->Received.erase(packet);
+        }
+        else
+        {
+            ++packet;
+        }
+    }
+
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_SetPacketQueueSize(EOS_HP2P Handle, const EOS_P2P_SetPacketQueueSizeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    Handle->Platform->IncomingQueueMaxBytes = Options->IncomingPacketQueueMaxSizeBytes;
+    Handle->Platform->OutgoingQueueMaxBytes = Options->OutgoingPacketQueueMaxSizeBytes;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_GetPacketQueueInfo(EOS_HP2P Handle, const EOS_P2P_GetPacketQueueInfoOptions* Options, EOS_P2P_PacketQueueInfo* OutPacketQueueInfo)
+{
+    if (Handle == nullptr || Options == nullptr || OutPacketQueueInfo == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    EOS_HPlatform platform = Handle->Platform;
+
+    uint64_t packetCount = 0;
+    for (EOS_ProductUserId userId : platform->LoggedInUsers)
+    {
+        User* user = backend.FindUser(userId);
+        if (user != nullptr && user->Platform == platform)
+        {
+            packetCount += user->Received.size();
+        }
+    }
+
+    // Sent packets leave the outgoing queue straight away
+    *OutPacketQueueInfo = {};
+    OutPacketQueueInfo->IncomingPacketQueueMaxSizeBytes = platform->IncomingQueueMaxBytes;
+    OutPacketQueueInfo->IncomingPacketQueueCurrentSizeBytes = GetIncomingQueueBytes(backend, platform);
+    OutPacketQueueInfo->IncomingPacketQueueCurrentPacketCount = packetCount;
+    OutPacketQueueInfo->OutgoingPacketQueueMaxSizeBytes = platform->OutgoingQueueMaxBytes;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_QueryNATType(EOS_HP2P Handle, const EOS_P2P_QueryNATTypeOptions* Options, void* ClientData, const EOS_P2P_OnQueryNATTypeCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    {
+        Backend& backend = GetBackend();
+        std::lock_guard<std::mutex> lock(backend.Mutex);
+        Handle->Platform->NATTypeQueried = true;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_P2P_OnQueryNATTypeCompleteInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_Success;
+        info.ClientData = ClientData;
+        info.NATType = EOS_ENATType::EOS_NAT_Open;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_GetNATType(EOS_HP2P Handle, const EOS_P2P_GetNATTypeOptions* Options, EOS_ENATType* OutNATType)
+{
+    if (Handle == nullptr || Options == nullptr || OutNATType == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    if (!Handle->Platform->NATTypeQueried)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutNATType = EOS_ENATType::EOS_NAT_Open;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_SetRelayControl(EOS_HP2P Handle, const EOS_P2P_SetRelayControlOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    Handle->Platform->RelayControl = Options->RelayControl;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_GetRelayControl(EOS_HP2P Handle, const EOS_P2P_GetRelayControlOptions* Options, EOS_ERelayControl* OutRelayControl)
+{
+    if (Handle == nullptr || Options == nullptr || OutRelayControl == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    *OutRelayControl = Handle->Platform->RelayControl;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_SetPortRange(EOS_HP2P Handle, const EOS_P2P_SetPortRangeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Port == 0)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    Handle->Platform->Port = Options->Port;
+    Handle->Platform->MaxAdditionalPortsToTry = Options->MaxAdditionalPortsToTry;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_P2P_GetPortRange(EOS_HP2P Handle, const EOS_P2P_GetPortRangeOptions* Options, uint16_t* OutPort, uint16_t* OutNumAdditionalPortsToTry)
+{
+    if (Handle == nullptr || Options == nullptr || OutPort == nullptr || OutNumAdditionalPortsToTry == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    *OutPort = Handle->Platform->Port;
+    *OutNumAdditionalPortsToTry = Handle->Platform->MaxAdditionalPortsToTry;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_P2P_AddNotifyPeerConnectionRequest(EOS_HP2P Handle, const EOS_P2P_AddNotifyPeerConnectionRequestOptions* Options, void* ClientData, EOS_P2P_OnIncomingConnectionRequestCallback ConnectionRequestHandler)
+{
+    return Options == nullptr ? EOS_INVALID_NOTIFICATIONID : AddSocketNotification(Handle, NotificationKind::P2PConnectionRequest,
+        Options->LocalUserId, Options->SocketId, ClientData, reinterpret_cast<void*>(ConnectionRequestHandler));
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_RemoveNotifyPeerConnectionRequest(EOS_HP2P Handle, EOS_NotificationId NotificationId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, NotificationId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_P2P_AddNotifyPeerConnectionEstablished(EOS_HP2P Handle, const EOS_P2P_AddNotifyPeerConnectionEstablishedOptions* Options, void* ClientData, EOS_P2P_OnPeerConnectionEstablishedCallback ConnectionEstablishedHandler)
+{
+    return Options == nullptr ? EOS_INVALID_NOTIFICATIONID : AddSocketNotification(Handle, NotificationKind::P2PConnectionEstablished,
+        Options->LocalUserId, Options->SocketId, ClientData, reinterpret_cast<void*>(ConnectionEstablishedHandler));
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_RemoveNotifyPeerConnectionEstablished(EOS_HP2P Handle, EOS_NotificationId NotificationId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, NotificationId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_P2P_AddNotifyPeerConnectionInterrupted(EOS_HP2P Handle, const EOS_P2P_AddNotifyPeerConnectionInterruptedOptions* Options, void* ClientData, EOS_P2P_OnPeerConnectionInterruptedCallback ConnectionInterruptedHandler)
+{
+    // Connections are never interrupted in the mock, so this is never called
+    return Options == nullptr ? EOS_INVALID_NOTIFICATIONID : AddSocketNotification(Handle, NotificationKind::P2PConnectionInterrupted,
+        Options->LocalUserId, Options->SocketId, ClientData, reinterpret_cast<void*>(ConnectionInterruptedHandler));
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_RemoveNotifyPeerConnectionInterrupted(EOS_HP2P Handle, EOS_NotificationId NotificationId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, NotificationId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_P2P_AddNotifyPeerConnectionClosed(EOS_HP2P Handle, const EOS_P2P_AddNotifyPeerConnectionClosedOptions* Options, void* ClientData, EOS_P2P_OnRemoteConnectionClosedCallback ConnectionClosedHandler)
+{
+    return Options == nullptr ? EOS_INVALID_NOTIFICATIONID : AddSocketNotification(Handle, NotificationKind::P2PConnectionClosed,
+        Options->LocalUserId, Options->SocketId, ClientData, reinterpret_cast<void*>(ConnectionClosedHandler));
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_RemoveNotifyPeerConnectionClosed(EOS_HP2P Handle, EOS_NotificationId NotificationId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, NotificationId);
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_P2P_AddNotifyIncomingPacketQueueFull(EOS_HP2P Handle, const EOS_P2P_AddNotifyIncomingPacketQueueFullOptions* Options, void* ClientData, EOS_P2P_OnIncomingPacketQueueFullCallback IncomingPacketQueueFullHandler)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_INVALID_NOTIFICATIONID;
+    }
+
+    Notification notification;
+    notification.Kind = NotificationKind::P2PIncomingPacketQueueFull;
+    notification.ClientData = ClientData;
+    notification.Function = reinterpret_cast<void*>(IncomingPacketQueueFullHandler);
+    return AddNotification(Handle->Platform, notification);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_P2P_RemoveNotifyIncomingPacketQueueFull(EOS_HP2P Handle, EOS_NotificationId NotificationId)
+{
+    if (Handle != nullptr)
+    {
+        RemoveNotification(Handle->Platform, NotificationId);
+    }
+}
@@ -0,0 +1,729 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// Platform lifetime, ticking, logging and the id types of the mock EOS SDK,
+// along with the functions that configure the simulated network.
+
+#include "MockEOSSDK.h"
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+    std::atomic<bool> s_Initialized{ false };
+    std::atomic<EOS_NotificationId> s_NextNotificationId{ 1 };
+
+    std::mutex s_LogMutex;
+    EOS_LogMessageFunc s_LogCallback = nullptr;
+    EOS_ELogLevel s_LogLevel = EOS_ELogLevel::EOS_LOG_Info;
+
+    //-------------------------------------------------------------------------
+    double ReadEnvironment(const char* name, double defaultValue)
+    {
+        const char* value = getenv(name);
+        return value != nullptr && value[0] != '\0' ? atof(value) : defaultValue;
+    }
+
+    //-------------------------------------------------------------------------
+    // Copies a string to a buffer the way the EOS SDK does, reporting the
+    // length needed when the buffer is too small.
+    EOS_EResult CopyToBuffer(const std::string& value, char* outBuffer, int32_t* inOutBufferLength)
+    {
+        if (inOutBufferLength == nullptr)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        int32_t length = static_cast<int32_t>(value.size()) + 1;
+        if (outBuffer == nullptr || *inOutBufferLength < length)
+        {
+            *inOutBufferLength = length;
+            return EOS_EResult::EOS_LimitExceeded;
+        }
+
+        memcpy(outBuffer, value.c_str(), length);
+        *inOutBufferLength = length;
+        return EOS_EResult::EOS_Success;
+    }
+}
+
+namespace mock
+{
+    //-------------------------------------------------------------------------
+    Backend& GetBackend()
+    {
+        static Backend* backend = []()
+        {
+            Backend* created = new Backend();
+            created->Conditions.LatencyMilliseconds = ReadEnvironment("EOS_MOCK_P2P_LATENCY_MS", 0);
+            created->Conditions.JitterMilliseconds = ReadEnvironment("EOS_MOCK_P2P_JITTER_MS", 0);
+            created->Conditions.LossRate = ReadEnvironment("EOS_MOCK_P2P_LOSS", 0);
+            created->RequestLatencyMilliseconds = ReadEnvironment("EOS_MOCK_REQUEST_LATENCY_MS", 0);
+            created->Random.seed(static_cast<uint64_t>(ReadEnvironment("EOS_MOCK_SEED", 1)));
+            return created;
+        }();
+
+        // Never destroyed, so that platforms released during process exit
+        // still find it
+        return *backend;
+    }
+
+    //-------------------------------------------------------------------------
+    User* Backend::FindUser(EOS_ProductUserId userId)
+    {
+        auto found = Users.find(userId);
+        return found != Users.end() ? &found->second : nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    double Backend::NextRandom()
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(Random);
+    }
+
+    //-------------------------------------------------------------------------
+    std::string Backend::NewId()
+    {
+        // Derived from a counter rather than the random source, so that ids
+        // don't change how packets are dropped
+        return HashId("mock-id-" + std::to_string(++NextId));
+    }
+
+    //-------------------------------------------------------------------------
+    std::string HashId(const std::string& text)
+    {
+        // Two 64 bit FNV-1a hashes with different offsets
+        uint64_t high = 14695981039346656037ULL;
+        uint64_t low = 14695981039346656037ULL ^ 0x9E3779B97F4A7C15ULL;
+        for (unsigned char c : text)
+        {
+            high = (high ^ c) * 1099511628211ULL;
+            low = (low ^ c) * 1099511628211ULL;
+        }
+
+        char buffer[33];
+        snprintf(buffer, sizeof(buffer), "%016llx%016llx", static_cast<unsigned long long>(high), static_cast<unsigned long long>(low));
+        return buffer;
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_ProductUserId InternProductUserId(Backend& backend, const std::string& id)
+    {
+        // Ids are never freed, so that handles held by the application stay
+        // valid and can be compared by address
+        std::unique_ptr<EOS_ProductUserIdDetails>& details = backend.ProductUserIds[id];
+        if (!details)
+        {
+            details.reset(new EOS_ProductUserIdDetails{ id });
+        }
+
+        return details.get();
+    }
+
+    //-------------------------------------------------------------------------
+    void Log(EOS_ELogLevel level, const char* format, ...)
+    {
+        std::lock_guard<std::mutex> lock(s_LogMutex);
+        if (s_LogCallback == nullptr || level > s_LogLevel)
+        {
+            return;
+        }
+
+        char message[1024];
+        va_list arguments;
+        va_start(arguments, format);
+        vsnprintf(message, sizeof(message), format, arguments);
+        va_end(arguments);
+
+        EOS_LogMessage logMessage = {};
+        logMessage.Category = "LogEOSMock";
+        logMessage.Message = message;
+        logMessage.Level = level;
+        s_LogCallback(&logMessage);
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_NotificationId AddNotification(EOS_HPlatform platform, Notification notification)
+    {
+        if (platform == nullptr || notification.Function == nullptr)
+        {
+            return EOS_INVALID_NOTIFICATIONID;
+        }
+
+        EOS_NotificationId id = s_NextNotificationId++;
+        std::lock_guard<std::mutex> lock(platform->Mutex);
+        platform->Notifications.emplace(id, std::move(notification));
+        return id;
+    }
+
+    //-------------------------------------------------------------------------
+    void RemoveNotification(EOS_HPlatform platform, EOS_NotificationId id)
+    {
+        if (platform == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(platform->Mutex);
+        platform->Notifications.erase(id);
+    }
+
+    //-------------------------------------------------------------------------
+    void Notify(EOS_HPlatform platform, NotificationKind kind,
+        std::function<bool(const Notification&)> filter,
+        std::function<void(const Notification&)> invoke)
+    {
+        if (platform == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(platform->Mutex);
+        Clock::time_point now = Clock::now();
+        for (const auto& entry : platform->Notifications)
+        {
+            if (entry.second.Kind != kind || (filter && !filter(entry.second)))
+            {
+                continue;
+            }
+
+            EOS_NotificationId id = entry.first;
+            platform->PendingCallbacks.emplace(now, [platform, id, invoke]()
+            {
+                Notification notification;
+                {
+                    std::lock_guard<std::mutex> lock(platform->Mutex);
+                    auto found = platform->Notifications.find(id);
+                    if (found == platform->Notifications.end())
+                    {
+                        return;
+                    }
+                    notification = found->second;
+                }
+
+                invoke(notification);
+            });
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void Post(EOS_HPlatform platform, Clock::time_point due, std::function<void()> callback)
+    {
+        if (platform == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(platform->Mutex);
+        platform->PendingCallbacks.emplace(due, std::move(callback));
+    }
+
+    //-------------------------------------------------------------------------
+    void PostRequest(EOS_HPlatform platform, std::function<void()> callback)
+    {
+        double latency = GetBackend().RequestLatencyMilliseconds.load();
+        Clock::time_point due = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(latency));
+        Post(platform, due, std::move(callback));
+    }
+
+    //-------------------------------------------------------------------------
+    void PostRequest(const MockInterfaceHandle* handle, std::function<void()> callback)
+    {
+        if (handle != nullptr)
+        {
+            PostRequest(handle->Platform, std::move(callback));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void SetAttribute(std::vector<Attribute>& attributes, const Attribute& attribute)
+    {
+        for (Attribute& existing : attributes)
+        {
+            if (existing.Key == attribute.Key)
+            {
+                existing = attribute;
+                return;
+            }
+        }
+
+        attributes.push_back(attribute);
+    }
+
+    //-------------------------------------------------------------------------
+    void RemoveAttribute(std::vector<Attribute>& attributes, const std::string& key)
+    {
+        attributes.erase(std::remove_if(attributes.begin(), attributes.end(),
+            [&key](const Attribute& attribute) { return attribute.Key == key; }), attributes.end());
+    }
+
+    //-------------------------------------------------------------------------
+    const Attribute* FindAttribute(const std::vector<Attribute>& attributes, const char* key)
+    {
+        if (key == nullptr)
+        {
+            return nullptr;
+        }
+
+        for (const Attribute& attribute : attributes)
+        {
+            // Attribute keys are case insensitive
+            if (strcasecmp(attribute.Key.c_str(), key) == 0)
+            {
+                return &attribute;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    bool MatchesParameter(const Attribute& attribute, const Attribute& parameter, EOS_EComparisonOp comparison)
+    {
+        if (attribute.Type == EOS_EAttributeType::EOS_AT_STRING)
+        {
+            if (parameter.Type != EOS_EAttributeType::EOS_AT_STRING)
+            {
+                return false;
+            }
+
+            const std::string& value = attribute.AsUtf8;
+            const std::string& operand = parameter.AsUtf8;
+            switch (comparison)
+            {
+            case EOS_EComparisonOp::EOS_CO_EQUAL: return value == operand;
+            case EOS_EComparisonOp::EOS_CO_NOTEQUAL: return value != operand;
+            case EOS_EComparisonOp::EOS_CO_CONTAINS: return value.find(operand) != std::string::npos;
+            case EOS_EComparisonOp::EOS_CO_ANYOF:
+            case EOS_EComparisonOp::EOS_CO_NOTANYOF:
+            {
+                // The operand is a list of values separated by semicolons
+                bool found = false;
+                size_t start = 0;
+                while (!found && start <= operand.size())
+                {
+                    size_t end = operand.find(';', start);
+                    if (end == std::string::npos)
+                    {
+                        end = operand.size();
+                    }
+                    found = operand.compare(start, end - start, value) == 0;
+                    start = end + 1;
+                }
+                return comparison == EOS_EComparisonOp::EOS_CO_ANYOF ? found : !found;
+            }
+            default: return false;
+            }
+        }
+
+        if (attribute.Type == EOS_EAttributeType::EOS_AT_BOOLEAN)
+        {
+            if (parameter.Type != EOS_EAttributeType::EOS_AT_BOOLEAN)
+            {
+                return false;
+            }
+
+            switch (comparison)
+            {
+            case EOS_EComparisonOp::EOS_CO_EQUAL: return attribute.AsBool == parameter.AsBool;
+            case EOS_EComparisonOp::EOS_CO_NOTEQUAL: return attribute.AsBool != parameter.AsBool;
+            default: return false;
+            }
+        }
+
+        double value = attribute.Type == EOS_EAttributeType::EOS_AT_DOUBLE ? attribute.AsDouble : static_cast<double>(attribute.AsInt64);
+        double operand;
+        switch (parameter.Type)
+        {
+        case EOS_EAttributeType::EOS_AT_DOUBLE: operand = parameter.AsDouble; break;
+        case EOS_EAttributeType::EOS_AT_INT64: operand = static_cast<double>(parameter.AsInt64); break;
+        default: return false;
+        }
+
+        switch (comparison)
+        {
+        case EOS_EComparisonOp::EOS_CO_EQUAL: return value == operand;
+        case EOS_EComparisonOp::EOS_CO_NOTEQUAL: return value != operand;
+        case EOS_EComparisonOp::EOS_CO_GREATERTHAN: return value > operand;
+        case EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL: return value >= operand;
+        case EOS_EComparisonOp::EOS_CO_LESSTHAN: return value < operand;
+        case EOS_EComparisonOp::EOS_CO_LESSTHANOREQUAL: return value <= operand;
+        case EOS_EComparisonOp::EOS_CO_DISTANCE: return true;
+        default: return false;
+        }
+    }
+}
+
+using namespace mock;
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Initialize(const EOS_InitializeOptions* Options)
+{
+    if (Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    if (s_Initialized.exchange(true))
+    {
+        return EOS_EResult::EOS_AlreadyConfigured;
+    }
+
+    GetBackend();
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Shutdown()
+{
+    if (!s_Initialized.exchange(false))
+    {
+        return EOS_EResult::EOS_NotConfigured;
+    }
+
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HPlatform) EOS_Platform_Create(const EOS_Platform_Options* Options)
+{
+    if (!s_Initialized || Options == nullptr)
+    {
+        return nullptr;
+    }
+
+    EOS_HPlatform platform = new EOS_PlatformHandle();
+#define MOCK_SET_INTERFACE_PLATFORM(Name) platform->Name.Platform = platform;
+    MOCK_INTERFACES(MOCK_SET_INTERFACE_PLATFORM)
+#undef MOCK_SET_INTERFACE_PLATFORM
+
+    platform->ProductId = Options->ProductId ? Options->ProductId : "";
+    platform->DeploymentId = Options->DeploymentId ? Options->DeploymentId : "";
+    platform->CacheDirectory = Options->CacheDirectory ? Options->CacheDirectory : "";
+    platform->IsServer = Options->bIsServer != EOS_FALSE;
+
+    Log(EOS_ELogLevel::EOS_LOG_Info, "Created mock platform for product %s with cache directory '%s'.",
+        platform->ProductId.c_str(), platform->CacheDirectory.c_str());
+    return platform;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Platform_Release(EOS_HPlatform Handle)
+{
+    if (Handle == nullptr)
+    {
+        return;
+    }
+
+    {
+        Backend& backend = GetBackend();
+        std::lock_guard<std::mutex> lock(backend.Mutex);
+
+        for (EOS_ProductUserId userId : Handle->LoggedInUsers)
+        {
+            RemoveUserFromLobbies(backend, userId);
+
+            User* user = backend.FindUser(userId);
+            if (user != nullptr && user->Platform == Handle)
+            {
+                CloseUserConnections(backend, *user);
+                backend.Users.erase(userId);
+            }
+        }
+
+        RemoveUserFromSessions(backend, Handle);
+    }
+
+    delete Handle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Platform_Tick(EOS_HPlatform Handle)
+{
+    if (Handle == nullptr)
+    {
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+
+    {
+        Backend& backend = GetBackend();
+        std::lock_guard<std::mutex> lock(backend.Mutex);
+        DeliverPackets(backend, Handle, now);
+    }
+
+    std::vector<std::function<void()>> due;
+    {
+        std::lock_guard<std::mutex> lock(Handle->Mutex);
+        auto end = Handle->PendingCallbacks.upper_bound(now);
+        for (auto pending = Handle->PendingCallbacks.begin(); pending != end; ++pending)
+        {
+            due.push_back(std::move(pending->second));
+        }
+        Handle->PendingCallbacks.erase(Handle->PendingCallbacks.begin(), end);
+    }
+
+    // Callbacks may call back into the SDK, so none of the locks are held
+    for (std::function<void()>& callback : due)
+    {
+        callback();
+    }
+}
+
+//-------------------------------------------------------------------------
+#define MOCK_DEFINE_INTERFACE_GETTER(Name) \
+    MOCK_EXPORT(EOS_H##Name) EOS_Platform_Get##Name##Interface(EOS_HPlatform Handle) \
+    { \
+        return Handle != nullptr ? &Handle->Name : nullptr; \
+    }
+#define MOCK_PLATFORM_INTERFACES(X) \
+    X(Metrics) X(Auth) X(Connect) X(Ecom) X(UI) X(Friends) X(Presence) X(Sessions) X(Lobby) \
+    X(UserInfo) X(P2P) X(RTC) X(RTCAdmin) X(PlayerDataStorage) X(TitleStorage) X(Achievements) \
+    X(Stats) X(Leaderboards) X(Mods) X(AntiCheatClient) X(AntiCheatServer) X(ProgressionSnapshot) \
+    X(Reports) X(Sanctions) X(KWS) X(CustomInvites) X(IntegratedPlatform)
+MOCK_PLATFORM_INTERFACES(MOCK_DEFINE_INTERFACE_GETTER)
+#undef MOCK_PLATFORM_INTERFACES
+#undef MOCK_DEFINE_INTERFACE_GETTER
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HRTCAudio) EOS_RTC_GetAudioInterface(EOS_HRTC Handle)
+{
+    return Handle != nullptr ? &Handle->Platform->RTCAudio : nullptr;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HRTCData) EOS_RTC_GetDataInterface(EOS_HRTC Handle)
+{
+    return Handle != nullptr ? &Handle->Platform->RTCData : nullptr;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_CheckForLauncherAndRestart(EOS_HPlatform Handle)
+{
+    // Never restart through a launcher
+    return EOS_EResult::EOS_NoChange;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_SetApplicationStatus(EOS_HPlatform Handle, const EOS_EApplicationStatus NewStatus)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->ApplicationStatus = NewStatus;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EApplicationStatus) EOS_Platform_GetApplicationStatus(EOS_HPlatform Handle)
+{
+    return Handle != nullptr ? Handle->ApplicationStatus : EOS_EApplicationStatus::EOS_AS_Foreground;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_SetNetworkStatus(EOS_HPlatform Handle, const EOS_ENetworkStatus NewStatus)
+{
+    if (Handle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->NetworkStatus = NewStatus;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ENetworkStatus) EOS_Platform_GetNetworkStatus(EOS_HPlatform Handle)
+{
+    return Handle != nullptr ? Handle->NetworkStatus : EOS_ENetworkStatus::EOS_NS_Online;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Logging_SetCallback(EOS_LogMessageFunc Callback)
+{
+    std::lock_guard<std::mutex> lock(s_LogMutex);
+    s_LogCallback = Callback;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Logging_SetLogLevel(EOS_ELogCategory LogCategory, EOS_ELogLevel LogLevel)
+{
+    // The mock logs under a single category, so any category sets its level
+    std::lock_guard<std::mutex> lock(s_LogMutex);
+    s_LogLevel = LogLevel;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const char*) EOS_GetVersion(void)
+{
+    return EOS_VERSION_STRING "-mock";
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const char*) EOS_EResult_ToString(EOS_EResult Result)
+{
+    switch (Result)
+    {
+#undef EOS_RESULT_VALUE
+#undef EOS_RESULT_VALUE_LAST
+#define EOS_RESULT_VALUE(Name, Value) case EOS_EResult::Name: return #Name;
+#define EOS_RESULT_VALUE_LAST(Name, Value) case EOS_EResult::Name: return #Name;
+#include "eos_result.h"
+#undef EOS_RESULT_VALUE
+#undef EOS_RESULT_VALUE_LAST
+    default: return "EOS_UnknownError";
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_EResult_IsOperationComplete(EOS_EResult Result)
+{
+    return Result != EOS_EResult::EOS_OperationWillRetry ? EOS_TRUE : EOS_FALSE;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ByteArray_ToString(const uint8_t* ByteArray, const uint32_t Length, char* OutBuffer, uint32_t* InOutBufferLength)
+{
+    if (ByteArray == nullptr || InOutBufferLength == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    uint32_t needed = Length * 2 + 1;
+    if (OutBuffer == nullptr || *InOutBufferLength < needed)
+    {
+        *InOutBufferLength = needed;
+        return EOS_EResult::EOS_LimitExceeded;
+    }
+
+    static const char digits[] = "0123456789ABCDEF";
+    for (uint32_t index = 0; index < Length; ++index)
+    {
+        OutBuffer[index * 2] = digits[ByteArray[index] >> 4];
+        OutBuffer[index * 2 + 1] = digits[ByteArray[index] & 0xF];
+    }
+    OutBuffer[Length * 2] = '\0';
+    *InOutBufferLength = needed;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_ProductUserId_IsValid(EOS_ProductUserId AccountId)
+{
+    return AccountId != nullptr && !AccountId->Id.empty() ? EOS_TRUE : EOS_FALSE;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ProductUserId_ToString(EOS_ProductUserId AccountId, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    if (AccountId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    return CopyToBuffer(AccountId->Id, OutBuffer, InOutBufferLength);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_ProductUserId_FromString(const char* ProductUserIdString)
+{
+    if (ProductUserIdString == nullptr || ProductUserIdString[0] == '\0')
+    {
+        return nullptr;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    return InternProductUserId(backend, ProductUserIdString);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_EpicAccountId_IsValid(EOS_EpicAccountId AccountId)
+{
+    return AccountId != nullptr && !AccountId->Id.empty() ? EOS_TRUE : EOS_FALSE;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_EpicAccountId_ToString(EOS_EpicAccountId AccountId, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    if (AccountId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidUser;
+    }
+
+    return CopyToBuffer(AccountId->Id, OutBuffer, InOutBufferLength);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EpicAccountId) EOS_EpicAccountId_FromString(const char* AccountIdString)
+{
+    if (AccountIdString == nullptr || AccountIdString[0] == '\0')
+    {
+        return nullptr;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    std::unique_ptr<EOS_EpicAccountIdDetails>& details = backend.EpicAccountIds[AccountIdString];
+    if (!details)
+    {
+        details.reset(new EOS_EpicAccountIdDetails{ AccountIdString });
+    }
+
+    return details.get();
+}
+
+//-------------------------------------------------------------------------
+// Sets the one way latency, the jitter added to it, and the loss rate of P2P
+// packets sent from now on.
+MOCK_EXPORT(void) EOSMock_SetNetworkConditions(double LatencyMilliseconds, double JitterMilliseconds, double LossRate)
+{
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    backend.Conditions.LatencyMilliseconds = std::max(0.0, LatencyMilliseconds);
+    backend.Conditions.JitterMilliseconds = std::max(0.0, JitterMilliseconds);
+    backend.Conditions.LossRate = std::min(std::max(0.0, LossRate), 0.99);
+}
+
+//-------------------------------------------------------------------------
+// Sets the time taken by login, lobby and session requests to complete.
+MOCK_EXPORT(void) EOSMock_SetRequestLatency(double LatencyMilliseconds)
+{
+    GetBackend().RequestLatencyMilliseconds = std::max(0.0, LatencyMilliseconds);
+}
+
+//-------------------------------------------------------------------------
+// Restarts the random source that decides packet loss and jitter.
+MOCK_EXPORT(void) EOSMock_SetSeed(uint64_t Seed)
+{
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    backend.Random.seed(Seed);
+}
@@ -0,0 +1,1125 @@
+/*
+* Copyright (c) 2024 PlayEveryWare
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+
+// Sessions interface of the mock EOS SDK. Sessions are kept in memory and
+// shared by every platform of the process; each platform knows the sessions
+// it created or joined by their local names. Session details handles are
+// snapshots of a session taken when the handle is copied.
+
+#include "MockEOSSDK.h"
+
+#include <algorithm>
+
+using namespace mock;
+
+//-------------------------------------------------------------------------
+struct EOS_SessionModificationHandle
+{
+    std::string SessionName;
+    EOS_ProductUserId LocalUserId = nullptr;
+
+    // Whether this creates the session rather than updating it
+    bool IsCreate = false;
+    std::string SessionId;
+
+    bool HasBucketId = false;
+    std::string BucketId;
+    bool HasHostAddress = false;
+    std::string HostAddress;
+    bool HasMaxPlayers = false;
+    uint32_t MaxPlayers = 0;
+    bool HasPermissionLevel = false;
+    EOS_EOnlineSessionPermissionLevel PermissionLevel = EOS_EOnlineSessionPermissionLevel::EOS_OSPF_PublicAdvertised;
+    bool HasJoinInProgressAllowed = false;
+    bool JoinInProgressAllowed = true;
+    bool HasInvitesAllowed = false;
+    bool InvitesAllowed = true;
+    std::vector<Attribute> AddedAttributes;
+    std::vector<std::string> RemovedAttributes;
+};
+
+//-------------------------------------------------------------------------
+struct EOS_SessionDetailsHandle
+{
+    Session Snapshot;
+};
+
+//-------------------------------------------------------------------------
+struct EOS_ActiveSessionHandle
+{
+    std::string SessionName;
+    EOS_ProductUserId LocalUserId = nullptr;
+    Session Snapshot;
+};
+
+//-------------------------------------------------------------------------
+struct EOS_SessionSearchHandle
+{
+    EOS_HPlatform Platform = nullptr;
+    uint32_t MaxResults = EOS_SESSIONS_MAX_SEARCH_RESULTS;
+    std::string SessionId;
+    EOS_ProductUserId TargetUserId = nullptr;
+    std::vector<std::pair<Attribute, EOS_EComparisonOp>> Parameters;
+
+    // Written by EOS_SessionSearch_Find under the backend lock
+    std::vector<Session> Results;
+};
+
+namespace
+{
+    //-------------------------------------------------------------------------
+    void ApplyModification(Session& session, const EOS_SessionModificationHandle& modification)
+    {
+        if (modification.HasBucketId) session.BucketId = modification.BucketId;
+        if (modification.HasHostAddress) session.HostAddress = modification.HostAddress;
+        if (modification.HasMaxPlayers) session.MaxPlayers = modification.MaxPlayers;
+        if (modification.HasPermissionLevel) session.PermissionLevel = modification.PermissionLevel;
+        if (modification.HasJoinInProgressAllowed) session.AllowJoinInProgress = modification.JoinInProgressAllowed;
+        if (modification.HasInvitesAllowed) session.InvitesAllowed = modification.InvitesAllowed;
+        for (const std::string& key : modification.RemovedAttributes) RemoveAttribute(session.Attributes, key);
+        for (const Attribute& attribute : modification.AddedAttributes) SetAttribute(session.Attributes, attribute);
+    }
+
+    //-------------------------------------------------------------------------
+    // Finds the session a platform knows by the given local name.
+    Session* FindLocalSession(Backend& backend, EOS_HPlatform platform, const std::string& sessionName, LocalSession** outLocalSession = nullptr)
+    {
+        auto local = platform->LocalSessions.find(sessionName);
+        if (local == platform->LocalSessions.end())
+        {
+            return nullptr;
+        }
+
+        if (outLocalSession != nullptr)
+        {
+            *outLocalSession = &local->second;
+        }
+
+        auto session = backend.Sessions.find(local->second.SessionId);
+        return session != backend.Sessions.end() ? &session->second : nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+    bool IsRegistered(const Session& session, EOS_ProductUserId userId)
+    {
+        return std::find(session.RegisteredPlayers.begin(), session.RegisteredPlayers.end(), userId) != session.RegisteredPlayers.end();
+    }
+
+    //-------------------------------------------------------------------------
+    bool MatchesSearch(const Session& session, const EOS_SessionSearchHandle& search)
+    {
+        if (!search.SessionId.empty())
+        {
+            return session.Id == search.SessionId;
+        }
+
+        if (search.TargetUserId != nullptr)
+        {
+            return IsRegistered(session, search.TargetUserId);
+        }
+
+        if (session.PermissionLevel != EOS_EOnlineSessionPermissionLevel::EOS_OSPF_PublicAdvertised
+            || (session.InProgress && !session.AllowJoinInProgress))
+        {
+            return false;
+        }
+
+        for (const auto& parameter : search.Parameters)
+        {
+            const Attribute& operand = parameter.first;
+            EOS_EComparisonOp comparison = parameter.second;
+            const char* key = operand.Key.c_str();
+
+            Attribute value;
+            if (strcasecmp(key, EOS_SESSIONS_SEARCH_BUCKET_ID) == 0)
+            {
+                value.Type = EOS_EAttributeType::EOS_AT_STRING;
+                value.AsUtf8 = session.BucketId;
+            }
+            else if (strcasecmp(key, EOS_SESSIONS_SEARCH_EMPTY_SERVERS_ONLY) == 0)
+            {
+                if (!session.RegisteredPlayers.empty())
+                {
+                    return false;
+                }
+                continue;
+            }
+            else if (strcasecmp(key, EOS_SESSIONS_SEARCH_NONEMPTY_SERVERS_ONLY) == 0)
+            {
+                if (session.RegisteredPlayers.empty())
+                {
+                    return false;
+                }
+                continue;
+            }
+            else if (strcasecmp(key, EOS_SESSIONS_SEARCH_MINSLOTSAVAILABLE) == 0)
+            {
+                value.AsInt64 = static_cast<int64_t>(session.MaxPlayers) - static_cast<int64_t>(session.RegisteredPlayers.size());
+                comparison = EOS_EComparisonOp::EOS_CO_GREATERTHANOREQUAL;
+            }
+            else
+            {
+                const Attribute* attribute = FindAttribute(session.Attributes, key);
+                if (attribute == nullptr || attribute->Visibility != static_cast<int32_t>(EOS_ESessionAttributeAdvertisementType::EOS_SAAT_Advertise))
+                {
+                    return false;
+                }
+                value = *attribute;
+            }
+
+            if (!MatchesParameter(value, operand, comparison))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_SessionDetails_Info* CopySessionInfo(const Session& session)
+    {
+        EOS_SessionDetails_Settings* settings = new EOS_SessionDetails_Settings();
+        settings->ApiVersion = EOS_SESSIONDETAILS_SETTINGS_API_LATEST;
+        settings->BucketId = strdup(session.BucketId.c_str());
+        settings->NumPublicConnections = session.MaxPlayers;
+        settings->bAllowJoinInProgress = session.AllowJoinInProgress ? EOS_TRUE : EOS_FALSE;
+        settings->PermissionLevel = session.PermissionLevel;
+        settings->bInvitesAllowed = session.InvitesAllowed ? EOS_TRUE : EOS_FALSE;
+
+        EOS_SessionDetails_Info* info = new EOS_SessionDetails_Info();
+        info->ApiVersion = EOS_SESSIONDETAILS_INFO_API_LATEST;
+        info->SessionId = strdup(session.Id.c_str());
+        info->HostAddress = strdup(session.HostAddress.c_str());
+        info->NumOpenPublicConnections = session.MaxPlayers - std::min(session.MaxPlayers, static_cast<uint32_t>(session.RegisteredPlayers.size()));
+        info->Settings = settings;
+        info->OwnerUserId = session.Owner;
+        return info;
+    }
+
+    //-------------------------------------------------------------------------
+    void FreeSessionInfo(const EOS_SessionDetails_Info* info)
+    {
+        if (info == nullptr)
+        {
+            return;
+        }
+
+        if (info->Settings != nullptr)
+        {
+            free(const_cast<char*>(info->Settings->BucketId));
+            delete info->Settings;
+        }
+
+        free(const_cast<char*>(info->SessionId));
+        free(const_cast<char*>(info->HostAddress));
+        delete info;
+    }
+
+    //-------------------------------------------------------------------------
+    EOS_SessionDetails_Attribute* CopySessionAttribute(const Attribute& attribute)
+    {
+        EOS_SessionDetails_Attribute* copy = new EOS_SessionDetails_Attribute();
+        copy->ApiVersion = EOS_SESSIONDETAILS_ATTRIBUTE_API_LATEST;
+        copy->Data = CopyAttributeData<EOS_Sessions_AttributeData>(attribute);
+        copy->AdvertisementType = static_cast<EOS_ESessionAttributeAdvertisementType>(attribute.Visibility);
+        return copy;
+    }
+
+    //-------------------------------------------------------------------------
+    // Posts the completion of a session request whose callback info holds only
+    // a result.
+    template <typename TCallbackInfo, typename TCallback>
+    void PostSessionResult(EOS_HPlatform platform, std::function<EOS_EResult(Backend&)> request, void* clientData, TCallback completionDelegate)
+    {
+        PostRequest(platform, [request, clientData, completionDelegate]()
+        {
+            TCallbackInfo info = {};
+            info.ClientData = clientData;
+
+            {
+                Backend& backend = GetBackend();
+                std::lock_guard<std::mutex> lock(backend.Mutex);
+                info.ResultCode = request(backend);
+            }
+
+            completionDelegate(&info);
+        });
+    }
+}
+
+namespace mock
+{
+    //-------------------------------------------------------------------------
+    void RemoveUserFromSessions(Backend& backend, EOS_HPlatform platform)
+    {
+        for (const auto& local : platform->LocalSessions)
+        {
+            if (local.second.IsOwner)
+            {
+                backend.Sessions.erase(local.second.SessionId);
+            }
+        }
+
+        platform->LocalSessions.clear();
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CreateSessionModification(EOS_HSessions Handle, const EOS_Sessions_CreateSessionModificationOptions* Options, EOS_HSessionModification* OutSessionModificationHandle)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionModificationHandle == nullptr || Options->SessionName == nullptr
+        || Options->BucketId == nullptr || Options->MaxPlayers == 0 || Options->MaxPlayers > EOS_SESSIONS_MAXREGISTEREDPLAYERS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    EOS_HSessionModification modification = new EOS_SessionModificationHandle();
+    modification->SessionName = Options->SessionName;
+    modification->LocalUserId = Options->LocalUserId;
+    modification->IsCreate = true;
+    modification->SessionId = Options->SessionId ? Options->SessionId : "";
+    modification->HasBucketId = true;
+    modification->BucketId = Options->BucketId;
+    modification->HasMaxPlayers = true;
+    modification->MaxPlayers = Options->MaxPlayers;
+    *OutSessionModificationHandle = modification;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_UpdateSessionModification(EOS_HSessions Handle, const EOS_Sessions_UpdateSessionModificationOptions* Options, EOS_HSessionModification* OutSessionModificationHandle)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionName == nullptr || OutSessionModificationHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    LocalSession* local = nullptr;
+    if (FindLocalSession(backend, Handle->Platform, Options->SessionName, &local) == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    EOS_HSessionModification modification = new EOS_SessionModificationHandle();
+    modification->SessionName = Options->SessionName;
+    modification->LocalUserId = local->LocalUserId;
+    *OutSessionModificationHandle = modification;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_UpdateSession(EOS_HSessions Handle, const EOS_Sessions_UpdateSessionOptions* Options, void* ClientData, const EOS_Sessions_OnUpdateSessionCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->SessionModificationHandle != nullptr;
+
+    // The modification handle may be released as soon as this returns
+    EOS_SessionModificationHandle modification;
+    if (validOptions)
+    {
+        modification = *Options->SessionModificationHandle;
+    }
+
+    PostRequest(platform, [platform, validOptions, modification, ClientData, CompletionDelegate]()
+    {
+        std::string sessionId;
+        EOS_Sessions_UpdateSessionCallbackInfo info = {};
+        info.ClientData = ClientData;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            LocalSession* local = nullptr;
+            Session* existing = validOptions ? FindLocalSession(backend, platform, modification.SessionName, &local) : nullptr;
+
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else if (modification.IsCreate)
+            {
+                if (local != nullptr || (!modification.SessionId.empty() && backend.Sessions.count(modification.SessionId) != 0))
+                {
+                    info.ResultCode = EOS_EResult::EOS_Sessions_SessionAlreadyExists;
+                }
+                else
+                {
+                    Session session;
+                    session.Id = modification.SessionId.empty() ? backend.NewId() : modification.SessionId;
+                    session.Owner = modification.LocalUserId;
+                    session.HostAddress = modification.LocalUserId != nullptr ? modification.LocalUserId->Id : session.Id;
+                    ApplyModification(session, modification);
+
+                    LocalSession& created = platform->LocalSessions[modification.SessionName];
+                    created.SessionId = session.Id;
+                    created.LocalUserId = modification.LocalUserId;
+                    created.IsOwner = true;
+
+                    sessionId = session.Id;
+                    backend.Sessions[session.Id] = session;
+                    info.ResultCode = EOS_EResult::EOS_Success;
+                }
+            }
+            else if (existing == nullptr)
+            {
+                info.ResultCode = EOS_EResult::EOS_NotFound;
+            }
+            else if (!local->IsOwner)
+            {
+                info.ResultCode = EOS_EResult::EOS_Sessions_NoPermission;
+            }
+            else if (modification.HasMaxPlayers && modification.MaxPlayers < existing->RegisteredPlayers.size())
+            {
+                info.ResultCode = EOS_EResult::EOS_Sessions_TooManyPlayers;
+            }
+            else
+            {
+                ApplyModification(*existing, modification);
+                sessionId = existing->Id;
+                info.ResultCode = EOS_EResult::EOS_Success;
+            }
+        }
+
+        info.SessionName = modification.SessionName.c_str();
+        info.SessionId = sessionId.c_str();
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_DestroySession(EOS_HSessions Handle, const EOS_Sessions_DestroySessionOptions* Options, void* ClientData, const EOS_Sessions_OnDestroySessionCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string sessionName = Options != nullptr && Options->SessionName ? Options->SessionName : "";
+
+    PostSessionResult<EOS_Sessions_DestroySessionCallbackInfo>(platform, [platform, sessionName](Backend& backend)
+    {
+        auto local = platform->LocalSessions.find(sessionName);
+        if (local == platform->LocalSessions.end())
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (local->second.IsOwner)
+        {
+            backend.Sessions.erase(local->second.SessionId);
+        }
+
+        platform->LocalSessions.erase(local);
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_JoinSession(EOS_HSessions Handle, const EOS_Sessions_JoinSessionOptions* Options, void* ClientData, const EOS_Sessions_OnJoinSessionCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->SessionName != nullptr && Options->SessionHandle != nullptr;
+    std::string sessionName = validOptions ? Options->SessionName : "";
+    std::string sessionId = validOptions ? Options->SessionHandle->Snapshot.Id : "";
+    EOS_ProductUserId userId = Options != nullptr ? Options->LocalUserId : nullptr;
+
+    PostSessionResult<EOS_Sessions_JoinSessionCallbackInfo>(platform, [platform, validOptions, sessionName, sessionId, userId](Backend& backend)
+    {
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        if (platform->LocalSessions.count(sessionName) != 0)
+        {
+            return EOS_EResult::EOS_Sessions_SessionAlreadyExists;
+        }
+
+        auto session = backend.Sessions.find(sessionId);
+        if (session == backend.Sessions.end())
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        if (session->second.InProgress && !session->second.AllowJoinInProgress)
+        {
+            return EOS_EResult::EOS_Sessions_SessionInProgress;
+        }
+
+        LocalSession& joined = platform->LocalSessions[sessionName];
+        joined.SessionId = sessionId;
+        joined.LocalUserId = userId;
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_StartSession(EOS_HSessions Handle, const EOS_Sessions_StartSessionOptions* Options, void* ClientData, const EOS_Sessions_OnStartSessionCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string sessionName = Options != nullptr && Options->SessionName ? Options->SessionName : "";
+
+    PostSessionResult<EOS_Sessions_StartSessionCallbackInfo>(platform, [platform, sessionName](Backend& backend)
+    {
+        Session* session = FindLocalSession(backend, platform, sessionName);
+        if (session == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        session->InProgress = true;
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_EndSession(EOS_HSessions Handle, const EOS_Sessions_EndSessionOptions* Options, void* ClientData, const EOS_Sessions_OnEndSessionCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    std::string sessionName = Options != nullptr && Options->SessionName ? Options->SessionName : "";
+
+    PostSessionResult<EOS_Sessions_EndSessionCallbackInfo>(platform, [platform, sessionName](Backend& backend)
+    {
+        Session* session = FindLocalSession(backend, platform, sessionName);
+        if (session == nullptr)
+        {
+            return EOS_EResult::EOS_NotFound;
+        }
+
+        session->InProgress = false;
+        return EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RegisterPlayers(EOS_HSessions Handle, const EOS_Sessions_RegisterPlayersOptions* Options, void* ClientData, const EOS_Sessions_OnRegisterPlayersCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->SessionName != nullptr
+        && (Options->PlayersToRegisterCount == 0 || Options->PlayersToRegister != nullptr);
+    std::string sessionName = validOptions ? Options->SessionName : "";
+    std::vector<EOS_ProductUserId> players;
+    if (validOptions)
+    {
+        players.assign(Options->PlayersToRegister, Options->PlayersToRegister + Options->PlayersToRegisterCount);
+    }
+
+    PostRequest(platform, [platform, validOptions, sessionName, players, ClientData, CompletionDelegate]()
+    {
+        std::vector<EOS_ProductUserId> registered;
+        EOS_Sessions_RegisterPlayersCallbackInfo info = {};
+        info.ClientData = ClientData;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            Session* session = validOptions ? FindLocalSession(backend, platform, sessionName) : nullptr;
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else if (session == nullptr)
+            {
+                info.ResultCode = EOS_EResult::EOS_NotFound;
+            }
+            else
+            {
+                for (EOS_ProductUserId player : players)
+                {
+                    if (player != nullptr && !IsRegistered(*session, player)
+                        && std::find(registered.begin(), registered.end(), player) == registered.end())
+                    {
+                        registered.push_back(player);
+                    }
+                }
+
+                if (session->RegisteredPlayers.size() + registered.size() > session->MaxPlayers)
+                {
+                    registered.clear();
+                    info.ResultCode = EOS_EResult::EOS_Sessions_TooManyPlayers;
+                }
+                else
+                {
+                    session->RegisteredPlayers.insert(session->RegisteredPlayers.end(), registered.begin(), registered.end());
+                    info.ResultCode = EOS_EResult::EOS_Success;
+                }
+            }
+        }
+
+        info.RegisteredPlayers = registered.data();
+        info.RegisteredPlayersCount = static_cast<uint32_t>(registered.size());
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_UnregisterPlayers(EOS_HSessions Handle, const EOS_Sessions_UnregisterPlayersOptions* Options, void* ClientData, const EOS_Sessions_OnUnregisterPlayersCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HPlatform platform = Handle->Platform;
+    bool validOptions = Options != nullptr && Options->SessionName != nullptr
+        && (Options->PlayersToUnregisterCount == 0 || Options->PlayersToUnregister != nullptr);
+    std::string sessionName = validOptions ? Options->SessionName : "";
+    std::vector<EOS_ProductUserId> players;
+    if (validOptions)
+    {
+        players.assign(Options->PlayersToUnregister, Options->PlayersToUnregister + Options->PlayersToUnregisterCount);
+    }
+
+    PostRequest(platform, [platform, validOptions, sessionName, players, ClientData, CompletionDelegate]()
+    {
+        std::vector<EOS_ProductUserId> unregistered;
+        EOS_Sessions_UnregisterPlayersCallbackInfo info = {};
+        info.ClientData = ClientData;
+
+        {
+            Backend& backend = GetBackend();
+            std::lock_guard<std::mutex> lock(backend.Mutex);
+
+            Session* session = validOptions ? FindLocalSession(backend, platform, sessionName) : nullptr;
+            if (!validOptions)
+            {
+                info.ResultCode = EOS_EResult::EOS_InvalidParameters;
+            }
+            else if (session == nullptr)
+            {
+                info.ResultCode = EOS_EResult::EOS_NotFound;
+            }
+            else
+            {
+                for (EOS_ProductUserId player : players)
+                {
+                    auto found = std::find(session->RegisteredPlayers.begin(), session->RegisteredPlayers.end(), player);
+                    if (found != session->RegisteredPlayers.end())
+                    {
+                        session->RegisteredPlayers.erase(found);
+                        unregistered.push_back(player);
+                    }
+                }
+
+                info.ResultCode = EOS_EResult::EOS_Success;
+            }
+        }
+
+        info.UnregisteredPlayers = unregistered.data();
+        info.UnregisteredPlayersCount = static_cast<uint32_t>(unregistered.size());
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_IsUserInSession(EOS_HSessions Handle, const EOS_Sessions_IsUserInSessionOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionName == nullptr || Options->TargetUserId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    Session* session = FindLocalSession(backend, Handle->Platform, Options->SessionName);
+    return session != nullptr && IsRegistered(*session, Options->TargetUserId) ? EOS_EResult::EOS_Success : EOS_EResult::EOS_NotFound;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_DumpSessionState(EOS_HSessions Handle, const EOS_Sessions_DumpSessionStateOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionName == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    Session* session = FindLocalSession(backend, Handle->Platform, Options->SessionName);
+    if (session == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    Log(EOS_ELogLevel::EOS_LOG_Info, "Session %s (%s): bucket '%s', %u of %u players registered, %s.",
+        Options->SessionName, session->Id.c_str(), session->BucketId.c_str(),
+        static_cast<unsigned>(session->RegisteredPlayers.size()), session->MaxPlayers,
+        session->InProgress ? "in progress" : "pending");
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CopyActiveSessionHandle(EOS_HSessions Handle, const EOS_Sessions_CopyActiveSessionHandleOptions* Options, EOS_HActiveSession* OutSessionHandle)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionName == nullptr || OutSessionHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    LocalSession* local = nullptr;
+    Session* session = FindLocalSession(backend, Handle->Platform, Options->SessionName, &local);
+    if (session == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    EOS_HActiveSession activeSession = new EOS_ActiveSessionHandle();
+    activeSession->SessionName = Options->SessionName;
+    activeSession->LocalUserId = local->LocalUserId;
+    activeSession->Snapshot = *session;
+    *OutSessionHandle = activeSession;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CreateSessionSearch(EOS_HSessions Handle, const EOS_Sessions_CreateSessionSearchOptions* Options, EOS_HSessionSearch* OutSessionSearchHandle)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionSearchHandle == nullptr
+        || Options->MaxSearchResults == 0 || Options->MaxSearchResults > EOS_SESSIONS_MAX_SEARCH_RESULTS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    EOS_HSessionSearch search = new EOS_SessionSearchHandle();
+    search->Platform = Handle->Platform;
+    search->MaxResults = Options->MaxSearchResults;
+    *OutSessionSearchHandle = search;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetBucketId(EOS_HSessionModification Handle, const EOS_SessionModification_SetBucketIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->BucketId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasBucketId = true;
+    Handle->BucketId = Options->BucketId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetHostAddress(EOS_HSessionModification Handle, const EOS_SessionModification_SetHostAddressOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->HostAddress == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasHostAddress = true;
+    Handle->HostAddress = Options->HostAddress;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetPermissionLevel(EOS_HSessionModification Handle, const EOS_SessionModification_SetPermissionLevelOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasPermissionLevel = true;
+    Handle->PermissionLevel = Options->PermissionLevel;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetJoinInProgressAllowed(EOS_HSessionModification Handle, const EOS_SessionModification_SetJoinInProgressAllowedOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasJoinInProgressAllowed = true;
+    Handle->JoinInProgressAllowed = Options->bAllowJoinInProgress != EOS_FALSE;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetMaxPlayers(EOS_HSessionModification Handle, const EOS_SessionModification_SetMaxPlayersOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->MaxPlayers == 0 || Options->MaxPlayers > EOS_SESSIONS_MAXREGISTEREDPLAYERS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasMaxPlayers = true;
+    Handle->MaxPlayers = Options->MaxPlayers;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetInvitesAllowed(EOS_HSessionModification Handle, const EOS_SessionModification_SetInvitesAllowedOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->HasInvitesAllowed = true;
+    Handle->InvitesAllowed = Options->bInvitesAllowed != EOS_FALSE;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_SetAllowedPlatformIds(EOS_HSessionModification Handle, const EOS_SessionModification_SetAllowedPlatformIdsOptions* Options)
+{
+    // Every platform is allowed in the mock
+    return Handle != nullptr && Options != nullptr ? EOS_EResult::EOS_Success : EOS_EResult::EOS_InvalidParameters;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_AddAttribute(EOS_HSessionModification Handle, const EOS_SessionModification_AddAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionAttribute == nullptr || Options->SessionAttribute->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    SetAttribute(Handle->AddedAttributes, ToAttribute(Options->SessionAttribute, static_cast<int32_t>(Options->AdvertisementType)));
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionModification_RemoveAttribute(EOS_HSessionModification Handle, const EOS_SessionModification_RemoveAttributeOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    RemoveAttribute(Handle->AddedAttributes, Options->Key);
+    Handle->RemovedAttributes.push_back(Options->Key);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionModification_Release(EOS_HSessionModification SessionModificationHandle)
+{
+    delete SessionModificationHandle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ActiveSession_CopyInfo(EOS_HActiveSession Handle, const EOS_ActiveSession_CopyInfoOptions* Options, EOS_ActiveSession_Info ** OutActiveSessionInfo)
+{
+    if (Handle == nullptr || Options == nullptr || OutActiveSessionInfo == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    EOS_ActiveSession_Info* info = new EOS_ActiveSession_Info();
+    info->ApiVersion = EOS_ACTIVESESSION_INFO_API_LATEST;
+    info->SessionName = strdup(Handle->SessionName.c_str());
+    info->LocalUserId = Handle->LocalUserId;
+    info->State = Handle->Snapshot.InProgress ? EOS_EOnlineSessionState::EOS_OSS_InProgress : EOS_EOnlineSessionState::EOS_OSS_Pending;
+    info->SessionDetails = CopySessionInfo(Handle->Snapshot);
+    *OutActiveSessionInfo = info;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_ActiveSession_Info_Release(EOS_ActiveSession_Info* ActiveSessionInfo)
+{
+    if (ActiveSessionInfo != nullptr)
+    {
+        free(const_cast<char*>(ActiveSessionInfo->SessionName));
+        FreeSessionInfo(ActiveSessionInfo->SessionDetails);
+        delete ActiveSessionInfo;
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_ActiveSession_GetRegisteredPlayerCount(EOS_HActiveSession Handle, const EOS_ActiveSession_GetRegisteredPlayerCountOptions* Options)
+{
+    return Handle != nullptr && Options != nullptr ? static_cast<uint32_t>(Handle->Snapshot.RegisteredPlayers.size()) : 0;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_ActiveSession_GetRegisteredPlayerByIndex(EOS_HActiveSession Handle, const EOS_ActiveSession_GetRegisteredPlayerByIndexOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->PlayerIndex >= Handle->Snapshot.RegisteredPlayers.size())
+    {
+        return nullptr;
+    }
+
+    return Handle->Snapshot.RegisteredPlayers[Options->PlayerIndex];
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_ActiveSession_Release(EOS_HActiveSession ActiveSessionHandle)
+{
+    delete ActiveSessionHandle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionDetails_CopyInfo(EOS_HSessionDetails Handle, const EOS_SessionDetails_CopyInfoOptions* Options, EOS_SessionDetails_Info ** OutSessionInfo)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionInfo == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    *OutSessionInfo = CopySessionInfo(Handle->Snapshot);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionDetails_Info_Release(EOS_SessionDetails_Info* SessionInfo)
+{
+    FreeSessionInfo(SessionInfo);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_SessionDetails_GetSessionAttributeCount(EOS_HSessionDetails Handle, const EOS_SessionDetails_GetSessionAttributeCountOptions* Options)
+{
+    return Handle != nullptr && Options != nullptr ? static_cast<uint32_t>(Handle->Snapshot.Attributes.size()) : 0;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionDetails_CopySessionAttributeByIndex(EOS_HSessionDetails Handle, const EOS_SessionDetails_CopySessionAttributeByIndexOptions* Options, EOS_SessionDetails_Attribute ** OutSessionAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionAttribute == nullptr || Options->AttrIndex >= Handle->Snapshot.Attributes.size())
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    *OutSessionAttribute = CopySessionAttribute(Handle->Snapshot.Attributes[Options->AttrIndex]);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionDetails_CopySessionAttributeByKey(EOS_HSessionDetails Handle, const EOS_SessionDetails_CopySessionAttributeByKeyOptions* Options, EOS_SessionDetails_Attribute ** OutSessionAttribute)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionAttribute == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    const Attribute* attribute = FindAttribute(Handle->Snapshot.Attributes, Options->AttrKey);
+    if (attribute == nullptr)
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    *OutSessionAttribute = CopySessionAttribute(*attribute);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionDetails_Attribute_Release(EOS_SessionDetails_Attribute* SessionAttribute)
+{
+    if (SessionAttribute != nullptr)
+    {
+        FreeAttributeData(SessionAttribute->Data);
+        delete SessionAttribute;
+    }
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionDetails_Release(EOS_HSessionDetails SessionHandle)
+{
+    delete SessionHandle;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_SetSessionId(EOS_HSessionSearch Handle, const EOS_SessionSearch_SetSessionIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->SessionId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->SessionId = Options->SessionId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_SetTargetUserId(EOS_HSessionSearch Handle, const EOS_SessionSearch_SetTargetUserIdOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->TargetUserId == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->TargetUserId = Options->TargetUserId;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_SetParameter(EOS_HSessionSearch Handle, const EOS_SessionSearch_SetParameterOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Parameter == nullptr || Options->Parameter->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->Parameters.emplace_back(ToAttribute(Options->Parameter, 0), Options->ComparisonOp);
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_RemoveParameter(EOS_HSessionSearch Handle, const EOS_SessionSearch_RemoveParameterOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->Key == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    auto& parameters = Handle->Parameters;
+    const char* key = Options->Key;
+    EOS_EComparisonOp comparison = Options->ComparisonOp;
+    parameters.erase(std::remove_if(parameters.begin(), parameters.end(), [key, comparison](const std::pair<Attribute, EOS_EComparisonOp>& parameter)
+    {
+        return parameter.second == comparison && strcasecmp(parameter.first.Key.c_str(), key) == 0;
+    }), parameters.end());
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_SetMaxResults(EOS_HSessionSearch Handle, const EOS_SessionSearch_SetMaxResultsOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr || Options->MaxSearchResults == 0 || Options->MaxSearchResults > EOS_SESSIONS_MAX_SEARCH_RESULTS)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Handle->MaxResults = Options->MaxSearchResults;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionSearch_Find(EOS_HSessionSearch Handle, const EOS_SessionSearch_FindOptions* Options, void* ClientData, const EOS_SessionSearch_OnFindCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    EOS_HSessionSearch search = Handle;
+    bool validOptions = Options != nullptr && Options->LocalUserId != nullptr;
+
+    PostSessionResult<EOS_SessionSearch_FindCallbackInfo>(search->Platform, [search, validOptions](Backend& backend)
+    {
+        if (!validOptions)
+        {
+            return EOS_EResult::EOS_InvalidParameters;
+        }
+
+        search->Results.clear();
+        for (const auto& session : backend.Sessions)
+        {
+            if (search->Results.size() >= search->MaxResults)
+            {
+                break;
+            }
+
+            if (MatchesSearch(session.second, *search))
+            {
+                search->Results.push_back(session.second);
+            }
+        }
+
+        return search->Results.empty() && !search->SessionId.empty() ? EOS_EResult::EOS_NotFound : EOS_EResult::EOS_Success;
+    }, ClientData, CompletionDelegate);
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_SessionSearch_GetSearchResultCount(EOS_HSessionSearch Handle, const EOS_SessionSearch_GetSearchResultCountOptions* Options)
+{
+    if (Handle == nullptr || Options == nullptr)
+    {
+        return 0;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+    return static_cast<uint32_t>(Handle->Results.size());
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_SessionSearch_CopySearchResultByIndex(EOS_HSessionSearch Handle, const EOS_SessionSearch_CopySearchResultByIndexOptions* Options, EOS_HSessionDetails* OutSessionHandle)
+{
+    if (Handle == nullptr || Options == nullptr || OutSessionHandle == nullptr)
+    {
+        return EOS_EResult::EOS_InvalidParameters;
+    }
+
+    Backend& backend = GetBackend();
+    std::lock_guard<std::mutex> lock(backend.Mutex);
+
+    if (Options->SessionIndex >= Handle->Results.size())
+    {
+        return EOS_EResult::EOS_NotFound;
+    }
+
+    EOS_HSessionDetails details = new EOS_SessionDetailsHandle();
+    details->Snapshot = Handle->Results[Options->SessionIndex];
+    *OutSessionHandle = details;
+    return EOS_EResult::EOS_Success;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_SessionSearch_Release(EOS_HSessionSearch SessionSearchHandle)
+{
+    delete SessionSearchHandle;
+}
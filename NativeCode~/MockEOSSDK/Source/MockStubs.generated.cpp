@@ -0,0 +1,3561 @@
+// Generated by generate_stubs.py. Do not edit.
+
+#include "MockEOSSDK.h"
+
+using namespace mock;
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Achievements_AddNotifyAchievementsUnlocked(EOS_HAchievements Handle, const EOS_Achievements_AddNotifyAchievementsUnlockedOptions* Options, void* ClientData, const EOS_Achievements_OnAchievementsUnlockedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Achievements_AddNotifyAchievementsUnlockedV2(EOS_HAchievements Handle, const EOS_Achievements_AddNotifyAchievementsUnlockedV2Options* Options, void* ClientData, const EOS_Achievements_OnAchievementsUnlockedCallbackV2 NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyAchievementDefinitionByAchievementId(EOS_HAchievements Handle, const EOS_Achievements_CopyAchievementDefinitionByAchievementIdOptions* Options, EOS_Achievements_Definition ** OutDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyAchievementDefinitionByIndex(EOS_HAchievements Handle, const EOS_Achievements_CopyAchievementDefinitionByIndexOptions* Options, EOS_Achievements_Definition ** OutDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyAchievementDefinitionV2ByAchievementId(EOS_HAchievements Handle, const EOS_Achievements_CopyAchievementDefinitionV2ByAchievementIdOptions* Options, EOS_Achievements_DefinitionV2 ** OutDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyAchievementDefinitionV2ByIndex(EOS_HAchievements Handle, const EOS_Achievements_CopyAchievementDefinitionV2ByIndexOptions* Options, EOS_Achievements_DefinitionV2 ** OutDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyPlayerAchievementByAchievementId(EOS_HAchievements Handle, const EOS_Achievements_CopyPlayerAchievementByAchievementIdOptions* Options, EOS_Achievements_PlayerAchievement ** OutAchievement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyPlayerAchievementByIndex(EOS_HAchievements Handle, const EOS_Achievements_CopyPlayerAchievementByIndexOptions* Options, EOS_Achievements_PlayerAchievement ** OutAchievement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyUnlockedAchievementByAchievementId(EOS_HAchievements Handle, const EOS_Achievements_CopyUnlockedAchievementByAchievementIdOptions* Options, EOS_Achievements_UnlockedAchievement ** OutAchievement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Achievements_CopyUnlockedAchievementByIndex(EOS_HAchievements Handle, const EOS_Achievements_CopyUnlockedAchievementByIndexOptions* Options, EOS_Achievements_UnlockedAchievement ** OutAchievement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_DefinitionV2_Release(EOS_Achievements_DefinitionV2* AchievementDefinition)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_Definition_Release(EOS_Achievements_Definition* AchievementDefinition)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Achievements_GetAchievementDefinitionCount(EOS_HAchievements Handle, const EOS_Achievements_GetAchievementDefinitionCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Achievements_GetPlayerAchievementCount(EOS_HAchievements Handle, const EOS_Achievements_GetPlayerAchievementCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Achievements_GetUnlockedAchievementCount(EOS_HAchievements Handle, const EOS_Achievements_GetUnlockedAchievementCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_PlayerAchievement_Release(EOS_Achievements_PlayerAchievement* Achievement)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_QueryDefinitions(EOS_HAchievements Handle, const EOS_Achievements_QueryDefinitionsOptions* Options, void* ClientData, const EOS_Achievements_OnQueryDefinitionsCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Achievements_OnQueryDefinitionsCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_QueryPlayerAchievements(EOS_HAchievements Handle, const EOS_Achievements_QueryPlayerAchievementsOptions* Options, void* ClientData, const EOS_Achievements_OnQueryPlayerAchievementsCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Achievements_OnQueryPlayerAchievementsCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_RemoveNotifyAchievementsUnlocked(EOS_HAchievements Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_UnlockAchievements(EOS_HAchievements Handle, const EOS_Achievements_UnlockAchievementsOptions* Options, void* ClientData, const EOS_Achievements_OnUnlockAchievementsCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Achievements_OnUnlockAchievementsCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Achievements_UnlockedAchievement_Release(EOS_Achievements_UnlockedAchievement* Achievement)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_AddExternalIntegrityCatalog(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddExternalIntegrityCatalogOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatClient_AddNotifyClientIntegrityViolated(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddNotifyClientIntegrityViolatedOptions* Options, void* ClientData, EOS_AntiCheatClient_OnClientIntegrityViolatedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatClient_AddNotifyMessageToPeer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddNotifyMessageToPeerOptions* Options, void* ClientData, EOS_AntiCheatClient_OnMessageToPeerCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatClient_AddNotifyMessageToServer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddNotifyMessageToServerOptions* Options, void* ClientData, EOS_AntiCheatClient_OnMessageToServerCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatClient_AddNotifyPeerActionRequired(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddNotifyPeerActionRequiredOptions* Options, void* ClientData, EOS_AntiCheatClient_OnPeerActionRequiredCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatClient_AddNotifyPeerAuthStatusChanged(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_AddNotifyPeerAuthStatusChangedOptions* Options, void* ClientData, EOS_AntiCheatClient_OnPeerAuthStatusChangedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_BeginSession(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_BeginSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_EndSession(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_EndSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_GetModuleBuildId(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_GetModuleBuildIdOptions* Options, uint32_t* OutModuleBuildId)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_GetProtectMessageOutputLength(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_GetProtectMessageOutputLengthOptions* Options, uint32_t* OutBufferSizeBytes)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_PollStatus(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_PollStatusOptions* Options, EOS_EAntiCheatClientViolationType* OutViolationType, char* OutMessage)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_ProtectMessage(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_ProtectMessageOptions* Options, void* OutBuffer, uint32_t* OutBytesWritten)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_ReceiveMessageFromPeer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_ReceiveMessageFromPeerOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_ReceiveMessageFromServer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_ReceiveMessageFromServerOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_RegisterPeer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_RegisterPeerOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatClient_RemoveNotifyClientIntegrityViolated(EOS_HAntiCheatClient Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatClient_RemoveNotifyMessageToPeer(EOS_HAntiCheatClient Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatClient_RemoveNotifyMessageToServer(EOS_HAntiCheatClient Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatClient_RemoveNotifyPeerActionRequired(EOS_HAntiCheatClient Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatClient_RemoveNotifyPeerAuthStatusChanged(EOS_HAntiCheatClient Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_Reserved01(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_Reserved01Options* Options, int32_t* OutValue)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_Reserved02(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_Reserved02Options* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_UnprotectMessage(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_UnprotectMessageOptions* Options, void* OutBuffer, uint32_t* OutBytesWritten)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatClient_UnregisterPeer(EOS_HAntiCheatClient Handle, const EOS_AntiCheatClient_UnregisterPeerOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatServer_AddNotifyClientActionRequired(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_AddNotifyClientActionRequiredOptions* Options, void* ClientData, EOS_AntiCheatServer_OnClientActionRequiredCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatServer_AddNotifyClientAuthStatusChanged(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_AddNotifyClientAuthStatusChangedOptions* Options, void* ClientData, EOS_AntiCheatServer_OnClientAuthStatusChangedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_AntiCheatServer_AddNotifyMessageToClient(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_AddNotifyMessageToClientOptions* Options, void* ClientData, EOS_AntiCheatServer_OnMessageToClientCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_BeginSession(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_BeginSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_EndSession(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_EndSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_GetProtectMessageOutputLength(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_GetProtectMessageOutputLengthOptions* Options, uint32_t* OutBufferSizeBytes)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogEvent(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogEventOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogGameRoundEnd(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogGameRoundEndOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogGameRoundStart(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogGameRoundStartOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerDespawn(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerDespawnOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerRevive(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerReviveOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerSpawn(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerSpawnOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerTakeDamage(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerTakeDamageOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerTick(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerTickOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerUseAbility(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerUseAbilityOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_LogPlayerUseWeapon(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_LogPlayerUseWeaponOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_ProtectMessage(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_ProtectMessageOptions* Options, void* OutBuffer, uint32_t* OutBytesWritten)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_ReceiveMessageFromClient(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_ReceiveMessageFromClientOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_RegisterClient(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_RegisterClientOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_RegisterEvent(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_RegisterEventOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatServer_RemoveNotifyClientActionRequired(EOS_HAntiCheatServer Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatServer_RemoveNotifyClientAuthStatusChanged(EOS_HAntiCheatServer Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_AntiCheatServer_RemoveNotifyMessageToClient(EOS_HAntiCheatServer Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_SetClientDetails(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_SetClientDetailsOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_SetClientNetworkState(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_SetClientNetworkStateOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_SetGameSessionId(EOS_HAntiCheatServer Handle, const EOS_AntiCheatCommon_SetGameSessionIdOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_UnprotectMessage(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_UnprotectMessageOptions* Options, void* OutBuffer, uint32_t* OutBytesWritten)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_AntiCheatServer_UnregisterClient(EOS_HAntiCheatServer Handle, const EOS_AntiCheatServer_UnregisterClientOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Auth_AddNotifyLoginStatusChanged(EOS_HAuth Handle, const EOS_Auth_AddNotifyLoginStatusChangedOptions* Options, void* ClientData, const EOS_Auth_OnLoginStatusChangedCallback Notification)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Auth_CopyIdToken(EOS_HAuth Handle, const EOS_Auth_CopyIdTokenOptions* Options, EOS_Auth_IdToken ** OutIdToken)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Auth_CopyUserAuthToken(EOS_HAuth Handle, const EOS_Auth_CopyUserAuthTokenOptions* Options, EOS_EpicAccountId LocalUserId, EOS_Auth_Token ** OutUserAuthToken)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_DeletePersistentAuth(EOS_HAuth Handle, const EOS_Auth_DeletePersistentAuthOptions* Options, void* ClientData, const EOS_Auth_OnDeletePersistentAuthCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_DeletePersistentAuthCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EpicAccountId) EOS_Auth_GetLoggedInAccountByIndex(EOS_HAuth Handle, int32_t Index)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(int32_t) EOS_Auth_GetLoggedInAccountsCount(EOS_HAuth Handle)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ELoginStatus) EOS_Auth_GetLoginStatus(EOS_HAuth Handle, EOS_EpicAccountId LocalUserId)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EpicAccountId) EOS_Auth_GetMergedAccountByIndex(EOS_HAuth Handle, const EOS_EpicAccountId LocalUserId, const uint32_t Index)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Auth_GetMergedAccountsCount(EOS_HAuth Handle, const EOS_EpicAccountId LocalUserId)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Auth_GetSelectedAccountId(EOS_HAuth Handle, const EOS_EpicAccountId LocalUserId, EOS_EpicAccountId* OutSelectedAccountId)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_IdToken_Release(EOS_Auth_IdToken* IdToken)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_LinkAccount(EOS_HAuth Handle, const EOS_Auth_LinkAccountOptions* Options, void* ClientData, const EOS_Auth_OnLinkAccountCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_LinkAccountCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_Login(EOS_HAuth Handle, const EOS_Auth_LoginOptions* Options, void* ClientData, const EOS_Auth_OnLoginCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_LoginCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_Logout(EOS_HAuth Handle, const EOS_Auth_LogoutOptions* Options, void* ClientData, const EOS_Auth_OnLogoutCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_LogoutCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_QueryIdToken(EOS_HAuth Handle, const EOS_Auth_QueryIdTokenOptions* Options, void* ClientData, const EOS_Auth_OnQueryIdTokenCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_QueryIdTokenCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_RemoveNotifyLoginStatusChanged(EOS_HAuth Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_Token_Release(EOS_Auth_Token* AuthToken)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_VerifyIdToken(EOS_HAuth Handle, const EOS_Auth_VerifyIdTokenOptions* Options, void* ClientData, const EOS_Auth_OnVerifyIdTokenCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_VerifyIdTokenCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Auth_VerifyUserAuth(EOS_HAuth Handle, const EOS_Auth_VerifyUserAuthOptions* Options, void* ClientData, const EOS_Auth_OnVerifyUserAuthCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Auth_VerifyUserAuthCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_CopyIdToken(EOS_HConnect Handle, const EOS_Connect_CopyIdTokenOptions* Options, EOS_Connect_IdToken ** OutIdToken)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_CopyProductUserExternalAccountByAccountId(EOS_HConnect Handle, const EOS_Connect_CopyProductUserExternalAccountByAccountIdOptions* Options, EOS_Connect_ExternalAccountInfo ** OutExternalAccountInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_CopyProductUserExternalAccountByAccountType(EOS_HConnect Handle, const EOS_Connect_CopyProductUserExternalAccountByAccountTypeOptions* Options, EOS_Connect_ExternalAccountInfo ** OutExternalAccountInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_CopyProductUserExternalAccountByIndex(EOS_HConnect Handle, const EOS_Connect_CopyProductUserExternalAccountByIndexOptions* Options, EOS_Connect_ExternalAccountInfo ** OutExternalAccountInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_CopyProductUserInfo(EOS_HConnect Handle, const EOS_Connect_CopyProductUserInfoOptions* Options, EOS_Connect_ExternalAccountInfo ** OutExternalAccountInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_CreateUser(EOS_HConnect Handle, const EOS_Connect_CreateUserOptions* Options, void* ClientData, const EOS_Connect_OnCreateUserCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_CreateUserCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_ExternalAccountInfo_Release(EOS_Connect_ExternalAccountInfo* ExternalAccountInfo)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_ProductUserId) EOS_Connect_GetExternalAccountMapping(EOS_HConnect Handle, const EOS_Connect_GetExternalAccountMappingsOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Connect_GetProductUserExternalAccountCount(EOS_HConnect Handle, const EOS_Connect_GetProductUserExternalAccountCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Connect_GetProductUserIdMapping(EOS_HConnect Handle, const EOS_Connect_GetProductUserIdMappingOptions* Options, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_IdToken_Release(EOS_Connect_IdToken* IdToken)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_LinkAccount(EOS_HConnect Handle, const EOS_Connect_LinkAccountOptions* Options, void* ClientData, const EOS_Connect_OnLinkAccountCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_LinkAccountCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_QueryExternalAccountMappings(EOS_HConnect Handle, const EOS_Connect_QueryExternalAccountMappingsOptions* Options, void* ClientData, const EOS_Connect_OnQueryExternalAccountMappingsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_QueryExternalAccountMappingsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_QueryProductUserIdMappings(EOS_HConnect Handle, const EOS_Connect_QueryProductUserIdMappingsOptions* Options, void* ClientData, const EOS_Connect_OnQueryProductUserIdMappingsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_QueryProductUserIdMappingsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_TransferDeviceIdAccount(EOS_HConnect Handle, const EOS_Connect_TransferDeviceIdAccountOptions* Options, void* ClientData, const EOS_Connect_OnTransferDeviceIdAccountCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_TransferDeviceIdAccountCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_UnlinkAccount(EOS_HConnect Handle, const EOS_Connect_UnlinkAccountOptions* Options, void* ClientData, const EOS_Connect_OnUnlinkAccountCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_UnlinkAccountCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Connect_VerifyIdToken(EOS_HConnect Handle, const EOS_Connect_VerifyIdTokenOptions* Options, void* ClientData, const EOS_Connect_OnVerifyIdTokenCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Connect_VerifyIdTokenCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ContinuanceToken_ToString(EOS_ContinuanceToken ContinuanceToken, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_AcceptRequestToJoin(EOS_HCustomInvites Handle, const EOS_CustomInvites_AcceptRequestToJoinOptions* Options, void* ClientData, const EOS_CustomInvites_OnAcceptRequestToJoinCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_CustomInvites_AcceptRequestToJoinCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyCustomInviteAccepted(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyCustomInviteAcceptedOptions* Options, void* ClientData, const EOS_CustomInvites_OnCustomInviteAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyCustomInviteReceived(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyCustomInviteReceivedOptions* Options, void* ClientData, const EOS_CustomInvites_OnCustomInviteReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyCustomInviteRejected(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyCustomInviteRejectedOptions* Options, void* ClientData, const EOS_CustomInvites_OnCustomInviteRejectedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyRequestToJoinAccepted(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyRequestToJoinAcceptedOptions* Options, void* ClientData, const EOS_CustomInvites_OnRequestToJoinAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyRequestToJoinReceived(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyRequestToJoinReceivedOptions* Options, void* ClientData, const EOS_CustomInvites_OnRequestToJoinReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyRequestToJoinRejected(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyRequestToJoinRejectedOptions* Options, void* ClientData, const EOS_CustomInvites_OnRequestToJoinRejectedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifyRequestToJoinResponseReceived(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifyRequestToJoinResponseReceivedOptions* Options, void* ClientData, const EOS_CustomInvites_OnRequestToJoinResponseReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_CustomInvites_AddNotifySendCustomNativeInviteRequested(EOS_HCustomInvites Handle, const EOS_CustomInvites_AddNotifySendCustomNativeInviteRequestedOptions* Options, void* ClientData, const EOS_CustomInvites_OnSendCustomNativeInviteRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_CustomInvites_FinalizeInvite(EOS_HCustomInvites Handle, const EOS_CustomInvites_FinalizeInviteOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RejectRequestToJoin(EOS_HCustomInvites Handle, const EOS_CustomInvites_RejectRequestToJoinOptions* Options, void* ClientData, const EOS_CustomInvites_OnRejectRequestToJoinCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_CustomInvites_RejectRequestToJoinCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyCustomInviteAccepted(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyCustomInviteReceived(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyCustomInviteRejected(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyRequestToJoinAccepted(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyRequestToJoinReceived(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyRequestToJoinRejected(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifyRequestToJoinResponseReceived(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_RemoveNotifySendCustomNativeInviteRequested(EOS_HCustomInvites Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_SendCustomInvite(EOS_HCustomInvites Handle, const EOS_CustomInvites_SendCustomInviteOptions* Options, void* ClientData, const EOS_CustomInvites_OnSendCustomInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_CustomInvites_SendCustomInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_CustomInvites_SendRequestToJoin(EOS_HCustomInvites Handle, const EOS_CustomInvites_SendRequestToJoinOptions* Options, void* ClientData, const EOS_CustomInvites_OnSendRequestToJoinCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_CustomInvites_SendRequestToJoinCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_CustomInvites_SetCustomInvite(EOS_HCustomInvites Handle, const EOS_CustomInvites_SetCustomInviteOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const char*) EOS_EApplicationStatus_ToString(EOS_EApplicationStatus ApplicationStatus)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const char*) EOS_ENetworkStatus_ToString(EOS_ENetworkStatus NetworkStatus)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_CatalogItem_Release(EOS_Ecom_CatalogItem* CatalogItem)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_CatalogOffer_Release(EOS_Ecom_CatalogOffer* CatalogOffer)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_CatalogRelease_Release(EOS_Ecom_CatalogRelease* CatalogRelease)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_Checkout(EOS_HEcom Handle, const EOS_Ecom_CheckoutOptions* Options, void* ClientData, const EOS_Ecom_OnCheckoutCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_CheckoutCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyEntitlementById(EOS_HEcom Handle, const EOS_Ecom_CopyEntitlementByIdOptions* Options, EOS_Ecom_Entitlement ** OutEntitlement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyEntitlementByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyEntitlementByIndexOptions* Options, EOS_Ecom_Entitlement ** OutEntitlement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyEntitlementByNameAndIndex(EOS_HEcom Handle, const EOS_Ecom_CopyEntitlementByNameAndIndexOptions* Options, EOS_Ecom_Entitlement ** OutEntitlement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyItemById(EOS_HEcom Handle, const EOS_Ecom_CopyItemByIdOptions* Options, EOS_Ecom_CatalogItem ** OutItem)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyItemImageInfoByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyItemImageInfoByIndexOptions* Options, EOS_Ecom_KeyImageInfo ** OutImageInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyItemReleaseByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyItemReleaseByIndexOptions* Options, EOS_Ecom_CatalogRelease ** OutRelease)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyLastRedeemEntitlementsResultByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyLastRedeemEntitlementsResultByIndexOptions* Options, char* OutEntitlementId, int32_t* InOutEntitlementIdLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyLastRedeemedEntitlementByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyLastRedeemedEntitlementByIndexOptions* Options, char* OutRedeemedEntitlementId, int32_t* InOutRedeemedEntitlementIdLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyOfferById(EOS_HEcom Handle, const EOS_Ecom_CopyOfferByIdOptions* Options, EOS_Ecom_CatalogOffer ** OutOffer)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyOfferByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyOfferByIndexOptions* Options, EOS_Ecom_CatalogOffer ** OutOffer)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyOfferImageInfoByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyOfferImageInfoByIndexOptions* Options, EOS_Ecom_KeyImageInfo ** OutImageInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyOfferItemByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyOfferItemByIndexOptions* Options, EOS_Ecom_CatalogItem ** OutItem)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyTransactionById(EOS_HEcom Handle, const EOS_Ecom_CopyTransactionByIdOptions* Options, EOS_Ecom_HTransaction* OutTransaction)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_CopyTransactionByIndex(EOS_HEcom Handle, const EOS_Ecom_CopyTransactionByIndexOptions* Options, EOS_Ecom_HTransaction* OutTransaction)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_Entitlement_Release(EOS_Ecom_Entitlement* Entitlement)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetEntitlementsByNameCount(EOS_HEcom Handle, const EOS_Ecom_GetEntitlementsByNameCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetEntitlementsCount(EOS_HEcom Handle, const EOS_Ecom_GetEntitlementsCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetItemImageInfoCount(EOS_HEcom Handle, const EOS_Ecom_GetItemImageInfoCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetItemReleaseCount(EOS_HEcom Handle, const EOS_Ecom_GetItemReleaseCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetLastRedeemEntitlementsResultCount(EOS_HEcom Handle, const EOS_Ecom_GetLastRedeemEntitlementsResultCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetLastRedeemedEntitlementsCount(EOS_HEcom Handle, const EOS_Ecom_GetLastRedeemedEntitlementsCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetOfferCount(EOS_HEcom Handle, const EOS_Ecom_GetOfferCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetOfferImageInfoCount(EOS_HEcom Handle, const EOS_Ecom_GetOfferImageInfoCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetOfferItemCount(EOS_HEcom Handle, const EOS_Ecom_GetOfferItemCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_GetTransactionCount(EOS_HEcom Handle, const EOS_Ecom_GetTransactionCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_KeyImageInfo_Release(EOS_Ecom_KeyImageInfo* KeyImageInfo)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryEntitlementToken(EOS_HEcom Handle, const EOS_Ecom_QueryEntitlementTokenOptions* Options, void* ClientData, const EOS_Ecom_OnQueryEntitlementTokenCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryEntitlementTokenCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryEntitlements(EOS_HEcom Handle, const EOS_Ecom_QueryEntitlementsOptions* Options, void* ClientData, const EOS_Ecom_OnQueryEntitlementsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryEntitlementsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryOffers(EOS_HEcom Handle, const EOS_Ecom_QueryOffersOptions* Options, void* ClientData, const EOS_Ecom_OnQueryOffersCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryOffersCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryOwnership(EOS_HEcom Handle, const EOS_Ecom_QueryOwnershipOptions* Options, void* ClientData, const EOS_Ecom_OnQueryOwnershipCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryOwnershipCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryOwnershipBySandboxIds(EOS_HEcom Handle, const EOS_Ecom_QueryOwnershipBySandboxIdsOptions* Options, void* ClientData, const EOS_Ecom_OnQueryOwnershipBySandboxIdsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryOwnershipBySandboxIdsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_QueryOwnershipToken(EOS_HEcom Handle, const EOS_Ecom_QueryOwnershipTokenOptions* Options, void* ClientData, const EOS_Ecom_OnQueryOwnershipTokenCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_QueryOwnershipTokenCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_RedeemEntitlements(EOS_HEcom Handle, const EOS_Ecom_RedeemEntitlementsOptions* Options, void* ClientData, const EOS_Ecom_OnRedeemEntitlementsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Ecom_RedeemEntitlementsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_Transaction_CopyEntitlementByIndex(EOS_Ecom_HTransaction Handle, const EOS_Ecom_Transaction_CopyEntitlementByIndexOptions* Options, EOS_Ecom_Entitlement ** OutEntitlement)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Ecom_Transaction_GetEntitlementsCount(EOS_Ecom_HTransaction Handle, const EOS_Ecom_Transaction_GetEntitlementsCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Ecom_Transaction_GetTransactionId(EOS_Ecom_HTransaction Handle, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Ecom_Transaction_Release(EOS_Ecom_HTransaction Transaction)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_AcceptInvite(EOS_HFriends Handle, const EOS_Friends_AcceptInviteOptions* Options, void* ClientData, const EOS_Friends_OnAcceptInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Friends_AcceptInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Friends_AddNotifyBlockedUsersUpdate(EOS_HFriends Handle, const EOS_Friends_AddNotifyBlockedUsersUpdateOptions* Options, void* ClientData, const EOS_Friends_OnBlockedUsersUpdateCallback BlockedUsersUpdateHandler)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Friends_AddNotifyFriendsUpdate(EOS_HFriends Handle, const EOS_Friends_AddNotifyFriendsUpdateOptions* Options, void* ClientData, const EOS_Friends_OnFriendsUpdateCallback FriendsUpdateHandler)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EpicAccountId) EOS_Friends_GetBlockedUserAtIndex(EOS_HFriends Handle, const EOS_Friends_GetBlockedUserAtIndexOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(int32_t) EOS_Friends_GetBlockedUsersCount(EOS_HFriends Handle, const EOS_Friends_GetBlockedUsersCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EpicAccountId) EOS_Friends_GetFriendAtIndex(EOS_HFriends Handle, const EOS_Friends_GetFriendAtIndexOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(int32_t) EOS_Friends_GetFriendsCount(EOS_HFriends Handle, const EOS_Friends_GetFriendsCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EFriendsStatus) EOS_Friends_GetStatus(EOS_HFriends Handle, const EOS_Friends_GetStatusOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_QueryFriends(EOS_HFriends Handle, const EOS_Friends_QueryFriendsOptions* Options, void* ClientData, const EOS_Friends_OnQueryFriendsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Friends_QueryFriendsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_RejectInvite(EOS_HFriends Handle, const EOS_Friends_RejectInviteOptions* Options, void* ClientData, const EOS_Friends_OnRejectInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Friends_RejectInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_RemoveNotifyBlockedUsersUpdate(EOS_HFriends Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_RemoveNotifyFriendsUpdate(EOS_HFriends Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Friends_SendInvite(EOS_HFriends Handle, const EOS_Friends_SendInviteOptions* Options, void* ClientData, const EOS_Friends_OnSendInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Friends_SendInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_IntegratedPlatformOptionsContainer_Add(EOS_HIntegratedPlatformOptionsContainer Handle, const EOS_IntegratedPlatformOptionsContainer_AddOptions* InOptions)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_IntegratedPlatformOptionsContainer_Release(EOS_HIntegratedPlatformOptionsContainer IntegratedPlatformOptionsContainerHandle)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_IntegratedPlatform_AddNotifyUserLoginStatusChanged(EOS_HIntegratedPlatform Handle, const EOS_IntegratedPlatform_AddNotifyUserLoginStatusChangedOptions* Options, void* ClientData, const EOS_IntegratedPlatform_OnUserLoginStatusChangedCallback CallbackFunction)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_IntegratedPlatform_ClearUserPreLogoutCallback(EOS_HIntegratedPlatform Handle, const EOS_IntegratedPlatform_ClearUserPreLogoutCallbackOptions* Options)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_IntegratedPlatform_CreateIntegratedPlatformOptionsContainer(const EOS_IntegratedPlatform_CreateIntegratedPlatformOptionsContainerOptions* Options, EOS_HIntegratedPlatformOptionsContainer* OutIntegratedPlatformOptionsContainerHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_IntegratedPlatform_FinalizeDeferredUserLogout(EOS_HIntegratedPlatform Handle, const EOS_IntegratedPlatform_FinalizeDeferredUserLogoutOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_IntegratedPlatform_RemoveNotifyUserLoginStatusChanged(EOS_HIntegratedPlatform Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_IntegratedPlatform_SetUserLoginStatus(EOS_HIntegratedPlatform Handle, const EOS_IntegratedPlatform_SetUserLoginStatusOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_IntegratedPlatform_SetUserPreLogoutCallback(EOS_HIntegratedPlatform Handle, const EOS_IntegratedPlatform_SetUserPreLogoutCallbackOptions* Options, void* ClientData, EOS_IntegratedPlatform_OnUserPreLogoutCallback CallbackFunction)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_KWS_AddNotifyPermissionsUpdateReceived(EOS_HKWS Handle, const EOS_KWS_AddNotifyPermissionsUpdateReceivedOptions* Options, void* ClientData, const EOS_KWS_OnPermissionsUpdateReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_KWS_CopyPermissionByIndex(EOS_HKWS Handle, const EOS_KWS_CopyPermissionByIndexOptions* Options, EOS_KWS_PermissionStatus ** OutPermission)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_CreateUser(EOS_HKWS Handle, const EOS_KWS_CreateUserOptions* Options, void* ClientData, const EOS_KWS_OnCreateUserCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_KWS_CreateUserCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_KWS_GetPermissionByKey(EOS_HKWS Handle, const EOS_KWS_GetPermissionByKeyOptions* Options, EOS_EKWSPermissionStatus* OutPermission)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(int32_t) EOS_KWS_GetPermissionsCount(EOS_HKWS Handle, const EOS_KWS_GetPermissionsCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_PermissionStatus_Release(EOS_KWS_PermissionStatus* PermissionStatus)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_QueryAgeGate(EOS_HKWS Handle, const EOS_KWS_QueryAgeGateOptions* Options, void* ClientData, const EOS_KWS_OnQueryAgeGateCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_KWS_QueryAgeGateCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_QueryPermissions(EOS_HKWS Handle, const EOS_KWS_QueryPermissionsOptions* Options, void* ClientData, const EOS_KWS_OnQueryPermissionsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_KWS_QueryPermissionsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_RemoveNotifyPermissionsUpdateReceived(EOS_HKWS Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_RequestPermissions(EOS_HKWS Handle, const EOS_KWS_RequestPermissionsOptions* Options, void* ClientData, const EOS_KWS_OnRequestPermissionsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_KWS_RequestPermissionsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_KWS_UpdateParentEmail(EOS_HKWS Handle, const EOS_KWS_UpdateParentEmailOptions* Options, void* ClientData, const EOS_KWS_OnUpdateParentEmailCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_KWS_UpdateParentEmailCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardDefinitionByIndex(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardDefinitionByIndexOptions* Options, EOS_Leaderboards_Definition ** OutLeaderboardDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardDefinitionByLeaderboardId(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardDefinitionByLeaderboardIdOptions* Options, EOS_Leaderboards_Definition ** OutLeaderboardDefinition)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardRecordByIndex(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardRecordByIndexOptions* Options, EOS_Leaderboards_LeaderboardRecord ** OutLeaderboardRecord)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardRecordByUserId(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardRecordByUserIdOptions* Options, EOS_Leaderboards_LeaderboardRecord ** OutLeaderboardRecord)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardUserScoreByIndex(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardUserScoreByIndexOptions* Options, EOS_Leaderboards_LeaderboardUserScore ** OutLeaderboardUserScore)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Leaderboards_CopyLeaderboardUserScoreByUserId(EOS_HLeaderboards Handle, const EOS_Leaderboards_CopyLeaderboardUserScoreByUserIdOptions* Options, EOS_Leaderboards_LeaderboardUserScore ** OutLeaderboardUserScore)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_Definition_Release(EOS_Leaderboards_Definition* LeaderboardDefinition)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Leaderboards_GetLeaderboardDefinitionCount(EOS_HLeaderboards Handle, const EOS_Leaderboards_GetLeaderboardDefinitionCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Leaderboards_GetLeaderboardRecordCount(EOS_HLeaderboards Handle, const EOS_Leaderboards_GetLeaderboardRecordCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Leaderboards_GetLeaderboardUserScoreCount(EOS_HLeaderboards Handle, const EOS_Leaderboards_GetLeaderboardUserScoreCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_LeaderboardDefinition_Release(EOS_Leaderboards_Definition* LeaderboardDefinition)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_LeaderboardRecord_Release(EOS_Leaderboards_LeaderboardRecord* LeaderboardRecord)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_LeaderboardUserScore_Release(EOS_Leaderboards_LeaderboardUserScore* LeaderboardUserScore)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_QueryLeaderboardDefinitions(EOS_HLeaderboards Handle, const EOS_Leaderboards_QueryLeaderboardDefinitionsOptions* Options, void* ClientData, const EOS_Leaderboards_OnQueryLeaderboardDefinitionsCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Leaderboards_OnQueryLeaderboardDefinitionsCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_QueryLeaderboardRanks(EOS_HLeaderboards Handle, const EOS_Leaderboards_QueryLeaderboardRanksOptions* Options, void* ClientData, const EOS_Leaderboards_OnQueryLeaderboardRanksCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Leaderboards_OnQueryLeaderboardRanksCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Leaderboards_QueryLeaderboardUserScores(EOS_HLeaderboards Handle, const EOS_Leaderboards_QueryLeaderboardUserScoresOptions* Options, void* ClientData, const EOS_Leaderboards_OnQueryLeaderboardUserScoresCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Leaderboards_OnQueryLeaderboardUserScoresCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyJoinLobbyAccepted(EOS_HLobby Handle, const EOS_Lobby_AddNotifyJoinLobbyAcceptedOptions* Options, void* ClientData, const EOS_Lobby_OnJoinLobbyAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLeaveLobbyRequested(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLeaveLobbyRequestedOptions* Options, void* ClientData, const EOS_Lobby_OnLeaveLobbyRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyInviteAccepted(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyInviteAcceptedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyInviteAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyInviteReceived(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyInviteReceivedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyInviteReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyLobbyInviteRejected(EOS_HLobby Handle, const EOS_Lobby_AddNotifyLobbyInviteRejectedOptions* Options, void* ClientData, const EOS_Lobby_OnLobbyInviteRejectedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifyRTCRoomConnectionChanged(EOS_HLobby Handle, const EOS_Lobby_AddNotifyRTCRoomConnectionChangedOptions* Options, void* ClientData, const EOS_Lobby_OnRTCRoomConnectionChangedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Lobby_AddNotifySendLobbyNativeInviteRequested(EOS_HLobby Handle, const EOS_Lobby_AddNotifySendLobbyNativeInviteRequestedOptions* Options, void* ClientData, const EOS_Lobby_OnSendLobbyNativeInviteRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_CopyLobbyDetailsHandleByInviteId(EOS_HLobby Handle, const EOS_Lobby_CopyLobbyDetailsHandleByInviteIdOptions* Options, EOS_HLobbyDetails* OutLobbyDetailsHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_CopyLobbyDetailsHandleByUiEventId(EOS_HLobby Handle, const EOS_Lobby_CopyLobbyDetailsHandleByUiEventIdOptions* Options, EOS_HLobbyDetails* OutLobbyDetailsHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_GetConnectString(EOS_HLobby Handle, const EOS_Lobby_GetConnectStringOptions* Options, char* OutBuffer, uint32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Lobby_GetInviteCount(EOS_HLobby Handle, const EOS_Lobby_GetInviteCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_GetInviteIdByIndex(EOS_HLobby Handle, const EOS_Lobby_GetInviteIdByIndexOptions* Options, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_GetRTCRoomName(EOS_HLobby Handle, const EOS_Lobby_GetRTCRoomNameOptions* Options, char* OutBuffer, uint32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_HardMuteMember(EOS_HLobby Handle, const EOS_Lobby_HardMuteMemberOptions* Options, void* ClientData, const EOS_Lobby_OnHardMuteMemberCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_HardMuteMemberCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_IsRTCRoomConnected(EOS_HLobby Handle, const EOS_Lobby_IsRTCRoomConnectedOptions* Options, EOS_Bool* bOutIsConnected)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_JoinRTCRoom(EOS_HLobby Handle, const EOS_Lobby_JoinRTCRoomOptions* Options, void* ClientData, const EOS_Lobby_OnJoinRTCRoomCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_JoinRTCRoomCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_LeaveRTCRoom(EOS_HLobby Handle, const EOS_Lobby_LeaveRTCRoomOptions* Options, void* ClientData, const EOS_Lobby_OnLeaveRTCRoomCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_LeaveRTCRoomCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Lobby_ParseConnectString(EOS_HLobby Handle, const EOS_Lobby_ParseConnectStringOptions* Options, char* OutBuffer, uint32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_QueryInvites(EOS_HLobby Handle, const EOS_Lobby_QueryInvitesOptions* Options, void* ClientData, const EOS_Lobby_OnQueryInvitesCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_QueryInvitesCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RejectInvite(EOS_HLobby Handle, const EOS_Lobby_RejectInviteOptions* Options, void* ClientData, const EOS_Lobby_OnRejectInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_RejectInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyJoinLobbyAccepted(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLeaveLobbyRequested(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyInviteAccepted(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyInviteReceived(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyLobbyInviteRejected(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifyRTCRoomConnectionChanged(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_RemoveNotifySendLobbyNativeInviteRequested(EOS_HLobby Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Lobby_SendInvite(EOS_HLobby Handle, const EOS_Lobby_SendInviteOptions* Options, void* ClientData, const EOS_Lobby_OnSendInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Lobby_SendInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Metrics_BeginPlayerSession(EOS_HMetrics Handle, const EOS_Metrics_BeginPlayerSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Metrics_EndPlayerSession(EOS_HMetrics Handle, const EOS_Metrics_EndPlayerSessionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Mods_CopyModInfo(EOS_HMods Handle, const EOS_Mods_CopyModInfoOptions* Options, EOS_Mods_ModInfo ** OutEnumeratedMods)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Mods_EnumerateMods(EOS_HMods Handle, const EOS_Mods_EnumerateModsOptions* Options, void* ClientData, const EOS_Mods_OnEnumerateModsCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Mods_InstallMod(EOS_HMods Handle, const EOS_Mods_InstallModOptions* Options, void* ClientData, const EOS_Mods_OnInstallModCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Mods_ModInfo_Release(EOS_Mods_ModInfo* ModInfo)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Mods_UninstallMod(EOS_HMods Handle, const EOS_Mods_UninstallModOptions* Options, void* ClientData, const EOS_Mods_OnUninstallModCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Mods_UpdateMod(EOS_HMods Handle, const EOS_Mods_UpdateModOptions* Options, void* ClientData, const EOS_Mods_OnUpdateModCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_GetActiveCountryCode(EOS_HPlatform Handle, EOS_EpicAccountId LocalUserId, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_GetActiveLocaleCode(EOS_HPlatform Handle, EOS_EpicAccountId LocalUserId, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_GetDesktopCrossplayStatus(EOS_HPlatform Handle, const EOS_Platform_GetDesktopCrossplayStatusOptions* Options, EOS_Platform_DesktopCrossplayStatusInfo* OutDesktopCrossplayStatusInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_GetOverrideCountryCode(EOS_HPlatform Handle, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_GetOverrideLocaleCode(EOS_HPlatform Handle, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_SetOverrideCountryCode(EOS_HPlatform Handle, const char* NewCountryCode)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Platform_SetOverrideLocaleCode(EOS_HPlatform Handle, const char* NewLocaleCode)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorageFileTransferRequest_CancelRequest(EOS_HPlayerDataStorageFileTransferRequest Handle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorageFileTransferRequest_GetFileRequestState(EOS_HPlayerDataStorageFileTransferRequest Handle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorageFileTransferRequest_GetFilename(EOS_HPlayerDataStorageFileTransferRequest Handle, uint32_t FilenameStringBufferSizeBytes, char* OutStringBuffer, int32_t* OutStringLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorageFileTransferRequest_Release(EOS_HPlayerDataStorageFileTransferRequest PlayerDataStorageFileTransferHandle)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorage_CopyFileMetadataAtIndex(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_CopyFileMetadataAtIndexOptions* CopyFileMetadataOptions, EOS_PlayerDataStorage_FileMetadata ** OutMetadata)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorage_CopyFileMetadataByFilename(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_CopyFileMetadataByFilenameOptions* CopyFileMetadataOptions, EOS_PlayerDataStorage_FileMetadata ** OutMetadata)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorage_DeleteCache(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_DeleteCacheOptions* Options, void* ClientData, const EOS_PlayerDataStorage_OnDeleteCacheCompleteCallback CompletionCallback)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorage_DeleteFile(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_DeleteFileOptions* DeleteOptions, void* ClientData, const EOS_PlayerDataStorage_OnDeleteFileCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorage_DuplicateFile(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_DuplicateFileOptions* DuplicateOptions, void* ClientData, const EOS_PlayerDataStorage_OnDuplicateFileCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorage_FileMetadata_Release(EOS_PlayerDataStorage_FileMetadata* FileMetadata)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PlayerDataStorage_GetFileMetadataCount(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_GetFileMetadataCountOptions* GetFileMetadataCountOptions, int32_t* OutFileMetadataCount)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorage_QueryFile(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_QueryFileOptions* QueryFileOptions, void* ClientData, const EOS_PlayerDataStorage_OnQueryFileCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PlayerDataStorage_QueryFileList(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_QueryFileListOptions* QueryFileListOptions, void* ClientData, const EOS_PlayerDataStorage_OnQueryFileListCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HPlayerDataStorageFileTransferRequest) EOS_PlayerDataStorage_ReadFile(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_ReadFileOptions* ReadOptions, void* ClientData, const EOS_PlayerDataStorage_OnReadFileCompleteCallback CompletionCallback)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HPlayerDataStorageFileTransferRequest) EOS_PlayerDataStorage_WriteFile(EOS_HPlayerDataStorage Handle, const EOS_PlayerDataStorage_WriteFileOptions* WriteOptions, void* ClientData, const EOS_PlayerDataStorage_OnWriteFileCompleteCallback CompletionCallback)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_DeleteData(EOS_HPresenceModification Handle, const EOS_PresenceModification_DeleteDataOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_PresenceModification_Release(EOS_HPresenceModification PresenceModificationHandle)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetData(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetDataOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetJoinInfo(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetJoinInfoOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetRawRichText(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetRawRichTextOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetStatus(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetStatusOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetTemplateData(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetTemplateDataOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_PresenceModification_SetTemplateId(EOS_HPresenceModification Handle, const EOS_PresenceModification_SetTemplateIdOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Presence_AddNotifyJoinGameAccepted(EOS_HPresence Handle, const EOS_Presence_AddNotifyJoinGameAcceptedOptions* Options, void* ClientData, const EOS_Presence_OnJoinGameAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Presence_AddNotifyOnPresenceChanged(EOS_HPresence Handle, const EOS_Presence_AddNotifyOnPresenceChangedOptions* Options, void* ClientData, const EOS_Presence_OnPresenceChangedCallback NotificationHandler)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Presence_CopyPresence(EOS_HPresence Handle, const EOS_Presence_CopyPresenceOptions* Options, EOS_Presence_Info ** OutPresence)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Presence_CreatePresenceModification(EOS_HPresence Handle, const EOS_Presence_CreatePresenceModificationOptions* Options, EOS_HPresenceModification* OutPresenceModificationHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Presence_GetJoinInfo(EOS_HPresence Handle, const EOS_Presence_GetJoinInfoOptions* Options, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_Presence_HasPresence(EOS_HPresence Handle, const EOS_Presence_HasPresenceOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Presence_Info_Release(EOS_Presence_Info* PresenceInfo)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Presence_QueryPresence(EOS_HPresence Handle, const EOS_Presence_QueryPresenceOptions* Options, void* ClientData, const EOS_Presence_OnQueryPresenceCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Presence_QueryPresenceCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Presence_RemoveNotifyJoinGameAccepted(EOS_HPresence Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Presence_RemoveNotifyOnPresenceChanged(EOS_HPresence Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Presence_SetPresence(EOS_HPresence Handle, const EOS_Presence_SetPresenceOptions* Options, void* ClientData, const EOS_Presence_SetPresenceCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Presence_SetPresenceCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ProgressionSnapshot_AddProgression(EOS_HProgressionSnapshot Handle, const EOS_ProgressionSnapshot_AddProgressionOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ProgressionSnapshot_BeginSnapshot(EOS_HProgressionSnapshot Handle, const EOS_ProgressionSnapshot_BeginSnapshotOptions* Options, uint32_t* OutSnapshotId)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_ProgressionSnapshot_DeleteSnapshot(EOS_HProgressionSnapshot Handle, const EOS_ProgressionSnapshot_DeleteSnapshotOptions* Options, void* ClientData, const EOS_ProgressionSnapshot_OnDeleteSnapshotCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_ProgressionSnapshot_EndSnapshot(EOS_HProgressionSnapshot Handle, const EOS_ProgressionSnapshot_EndSnapshotOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_ProgressionSnapshot_SubmitSnapshot(EOS_HProgressionSnapshot Handle, const EOS_ProgressionSnapshot_SubmitSnapshotOptions* Options, void* ClientData, const EOS_ProgressionSnapshot_OnSubmitSnapshotCallback CompletionDelegate)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAdmin_CopyUserTokenByIndex(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_CopyUserTokenByIndexOptions* Options, EOS_RTCAdmin_UserToken ** OutUserToken)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAdmin_CopyUserTokenByUserId(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_CopyUserTokenByUserIdOptions* Options, EOS_RTCAdmin_UserToken ** OutUserToken)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAdmin_Kick(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_KickOptions* Options, void* ClientData, const EOS_RTCAdmin_OnKickCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAdmin_KickCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAdmin_QueryJoinRoomToken(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_QueryJoinRoomTokenOptions* Options, void* ClientData, const EOS_RTCAdmin_OnQueryJoinRoomTokenCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAdmin_QueryJoinRoomTokenCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAdmin_SetParticipantHardMute(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_SetParticipantHardMuteOptions* Options, void* ClientData, const EOS_RTCAdmin_OnSetParticipantHardMuteCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAdmin_SetParticipantHardMuteCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAdmin_UserToken_Release(EOS_RTCAdmin_UserToken* UserToken)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyAudioBeforeRender(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyAudioBeforeRenderOptions* Options, void* ClientData, const EOS_RTCAudio_OnAudioBeforeRenderCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyAudioBeforeSend(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyAudioBeforeSendOptions* Options, void* ClientData, const EOS_RTCAudio_OnAudioBeforeSendCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyAudioDevicesChanged(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyAudioDevicesChangedOptions* Options, void* ClientData, const EOS_RTCAudio_OnAudioDevicesChangedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyAudioInputState(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyAudioInputStateOptions* Options, void* ClientData, const EOS_RTCAudio_OnAudioInputStateCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyAudioOutputState(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyAudioOutputStateOptions* Options, void* ClientData, const EOS_RTCAudio_OnAudioOutputStateCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCAudio_AddNotifyParticipantUpdated(EOS_HRTCAudio Handle, const EOS_RTCAudio_AddNotifyParticipantUpdatedOptions* Options, void* ClientData, const EOS_RTCAudio_OnParticipantUpdatedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_CopyInputDeviceInformationByIndex(EOS_HRTCAudio Handle, const EOS_RTCAudio_CopyInputDeviceInformationByIndexOptions* Options, EOS_RTCAudio_InputDeviceInformation ** OutInputDeviceInformation)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_CopyOutputDeviceInformationByIndex(EOS_HRTCAudio Handle, const EOS_RTCAudio_CopyOutputDeviceInformationByIndexOptions* Options, EOS_RTCAudio_OutputDeviceInformation ** OutOutputDeviceInformation)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const EOS_RTCAudio_AudioInputDeviceInfo *) EOS_RTCAudio_GetAudioInputDeviceByIndex(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetAudioInputDeviceByIndexOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_RTCAudio_GetAudioInputDevicesCount(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetAudioInputDevicesCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(const EOS_RTCAudio_AudioOutputDeviceInfo *) EOS_RTCAudio_GetAudioOutputDeviceByIndex(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetAudioOutputDeviceByIndexOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_RTCAudio_GetAudioOutputDevicesCount(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetAudioOutputDevicesCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_RTCAudio_GetInputDevicesCount(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetInputDevicesCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_RTCAudio_GetOutputDevicesCount(EOS_HRTCAudio Handle, const EOS_RTCAudio_GetOutputDevicesCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_InputDeviceInformation_Release(EOS_RTCAudio_InputDeviceInformation* DeviceInformation)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_OutputDeviceInformation_Release(EOS_RTCAudio_OutputDeviceInformation* DeviceInformation)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_QueryInputDevicesInformation(EOS_HRTCAudio Handle, const EOS_RTCAudio_QueryInputDevicesInformationOptions* Options, void* ClientData, const EOS_RTCAudio_OnQueryInputDevicesInformationCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnQueryInputDevicesInformationCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_QueryOutputDevicesInformation(EOS_HRTCAudio Handle, const EOS_RTCAudio_QueryOutputDevicesInformationOptions* Options, void* ClientData, const EOS_RTCAudio_OnQueryOutputDevicesInformationCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnQueryOutputDevicesInformationCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_RegisterPlatformAudioUser(EOS_HRTCAudio Handle, const EOS_RTCAudio_RegisterPlatformAudioUserOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RegisterPlatformUser(EOS_HRTCAudio Handle, const EOS_RTCAudio_RegisterPlatformUserOptions* Options, void* ClientData, const EOS_RTCAudio_OnRegisterPlatformUserCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnRegisterPlatformUserCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyAudioBeforeRender(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyAudioBeforeSend(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyAudioDevicesChanged(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyAudioInputState(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyAudioOutputState(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_RemoveNotifyParticipantUpdated(EOS_HRTCAudio Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_SendAudio(EOS_HRTCAudio Handle, const EOS_RTCAudio_SendAudioOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_SetAudioInputSettings(EOS_HRTCAudio Handle, const EOS_RTCAudio_SetAudioInputSettingsOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_SetAudioOutputSettings(EOS_HRTCAudio Handle, const EOS_RTCAudio_SetAudioOutputSettingsOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_SetInputDeviceSettings(EOS_HRTCAudio Handle, const EOS_RTCAudio_SetInputDeviceSettingsOptions* Options, void* ClientData, const EOS_RTCAudio_OnSetInputDeviceSettingsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnSetInputDeviceSettingsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_SetOutputDeviceSettings(EOS_HRTCAudio Handle, const EOS_RTCAudio_SetOutputDeviceSettingsOptions* Options, void* ClientData, const EOS_RTCAudio_OnSetOutputDeviceSettingsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnSetOutputDeviceSettingsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCAudio_UnregisterPlatformAudioUser(EOS_HRTCAudio Handle, const EOS_RTCAudio_UnregisterPlatformAudioUserOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UnregisterPlatformUser(EOS_HRTCAudio Handle, const EOS_RTCAudio_UnregisterPlatformUserOptions* Options, void* ClientData, const EOS_RTCAudio_OnUnregisterPlatformUserCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_OnUnregisterPlatformUserCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UpdateParticipantVolume(EOS_HRTCAudio Handle, const EOS_RTCAudio_UpdateParticipantVolumeOptions* Options, void* ClientData, const EOS_RTCAudio_OnUpdateParticipantVolumeCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_UpdateParticipantVolumeCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UpdateReceiving(EOS_HRTCAudio Handle, const EOS_RTCAudio_UpdateReceivingOptions* Options, void* ClientData, const EOS_RTCAudio_OnUpdateReceivingCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_UpdateReceivingCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UpdateReceivingVolume(EOS_HRTCAudio Handle, const EOS_RTCAudio_UpdateReceivingVolumeOptions* Options, void* ClientData, const EOS_RTCAudio_OnUpdateReceivingVolumeCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_UpdateReceivingVolumeCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UpdateSending(EOS_HRTCAudio Handle, const EOS_RTCAudio_UpdateSendingOptions* Options, void* ClientData, const EOS_RTCAudio_OnUpdateSendingCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_UpdateSendingCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCAudio_UpdateSendingVolume(EOS_HRTCAudio Handle, const EOS_RTCAudio_UpdateSendingVolumeOptions* Options, void* ClientData, const EOS_RTCAudio_OnUpdateSendingVolumeCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCAudio_UpdateSendingVolumeCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCData_AddNotifyDataReceived(EOS_HRTCData Handle, const EOS_RTCData_AddNotifyDataReceivedOptions* Options, void* ClientData, const EOS_RTCData_OnDataReceivedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTCData_AddNotifyParticipantUpdated(EOS_HRTCData Handle, const EOS_RTCData_AddNotifyParticipantUpdatedOptions* Options, void* ClientData, const EOS_RTCData_OnParticipantUpdatedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCData_RemoveNotifyDataReceived(EOS_HRTCData Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCData_RemoveNotifyParticipantUpdated(EOS_HRTCData Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTCData_SendData(EOS_HRTCData Handle, const EOS_RTCData_SendDataOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCData_UpdateReceiving(EOS_HRTCData Handle, const EOS_RTCData_UpdateReceivingOptions* Options, void* ClientData, const EOS_RTCData_OnUpdateReceivingCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCData_UpdateReceivingCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTCData_UpdateSending(EOS_HRTCData Handle, const EOS_RTCData_UpdateSendingOptions* Options, void* ClientData, const EOS_RTCData_OnUpdateSendingCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTCData_UpdateSendingCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTC_AddNotifyDisconnected(EOS_HRTC Handle, const EOS_RTC_AddNotifyDisconnectedOptions* Options, void* ClientData, const EOS_RTC_OnDisconnectedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTC_AddNotifyParticipantStatusChanged(EOS_HRTC Handle, const EOS_RTC_AddNotifyParticipantStatusChangedOptions* Options, void* ClientData, const EOS_RTC_OnParticipantStatusChangedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTC_AddNotifyRoomBeforeJoin(EOS_HRTC Handle, const EOS_RTC_AddNotifyRoomBeforeJoinOptions* Options, void* ClientData, const EOS_RTC_OnRoomBeforeJoinCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_RTC_AddNotifyRoomStatisticsUpdated(EOS_HRTC Handle, const EOS_RTC_AddNotifyRoomStatisticsUpdatedOptions* Options, void* ClientData, const EOS_RTC_OnRoomStatisticsUpdatedCallback CompletionDelegate)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_BlockParticipant(EOS_HRTC Handle, const EOS_RTC_BlockParticipantOptions* Options, void* ClientData, const EOS_RTC_OnBlockParticipantCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTC_BlockParticipantCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_JoinRoom(EOS_HRTC Handle, const EOS_RTC_JoinRoomOptions* Options, void* ClientData, const EOS_RTC_OnJoinRoomCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTC_JoinRoomCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_LeaveRoom(EOS_HRTC Handle, const EOS_RTC_LeaveRoomOptions* Options, void* ClientData, const EOS_RTC_OnLeaveRoomCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_RTC_LeaveRoomCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_RemoveNotifyDisconnected(EOS_HRTC Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_RemoveNotifyParticipantStatusChanged(EOS_HRTC Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_RemoveNotifyRoomBeforeJoin(EOS_HRTC Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_RTC_RemoveNotifyRoomStatisticsUpdated(EOS_HRTC Handle, EOS_NotificationId NotificationId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTC_SetRoomSetting(EOS_HRTC Handle, const EOS_RTC_SetRoomSettingOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_RTC_SetSetting(EOS_HRTC Handle, const EOS_RTC_SetSettingOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Reports_SendPlayerBehaviorReport(EOS_HReports Handle, const EOS_Reports_SendPlayerBehaviorReportOptions* Options, void* ClientData, const EOS_Reports_OnSendPlayerBehaviorReportCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Reports_SendPlayerBehaviorReportCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sanctions_CopyPlayerSanctionByIndex(EOS_HSanctions Handle, const EOS_Sanctions_CopyPlayerSanctionByIndexOptions* Options, EOS_Sanctions_PlayerSanction ** OutSanction)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sanctions_CreatePlayerSanctionAppeal(EOS_HSanctions Handle, const EOS_Sanctions_CreatePlayerSanctionAppealOptions* Options, void* ClientData, const EOS_Sanctions_CreatePlayerSanctionAppealCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Sanctions_CreatePlayerSanctionAppealCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Sanctions_GetPlayerSanctionCount(EOS_HSanctions Handle, const EOS_Sanctions_GetPlayerSanctionCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sanctions_PlayerSanction_Release(EOS_Sanctions_PlayerSanction* Sanction)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sanctions_QueryActivePlayerSanctions(EOS_HSanctions Handle, const EOS_Sanctions_QueryActivePlayerSanctionsOptions* Options, void* ClientData, const EOS_Sanctions_OnQueryActivePlayerSanctionsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Sanctions_QueryActivePlayerSanctionsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifyJoinSessionAccepted(EOS_HSessions Handle, const EOS_Sessions_AddNotifyJoinSessionAcceptedOptions* Options, void* ClientData, const EOS_Sessions_OnJoinSessionAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifyLeaveSessionRequested(EOS_HSessions Handle, const EOS_Sessions_AddNotifyLeaveSessionRequestedOptions* Options, void* ClientData, const EOS_Sessions_OnLeaveSessionRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifySendSessionNativeInviteRequested(EOS_HSessions Handle, const EOS_Sessions_AddNotifySendSessionNativeInviteRequestedOptions* Options, void* ClientData, const EOS_Sessions_OnSendSessionNativeInviteRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifySessionInviteAccepted(EOS_HSessions Handle, const EOS_Sessions_AddNotifySessionInviteAcceptedOptions* Options, void* ClientData, const EOS_Sessions_OnSessionInviteAcceptedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifySessionInviteReceived(EOS_HSessions Handle, const EOS_Sessions_AddNotifySessionInviteReceivedOptions* Options, void* ClientData, const EOS_Sessions_OnSessionInviteReceivedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_Sessions_AddNotifySessionInviteRejected(EOS_HSessions Handle, const EOS_Sessions_AddNotifySessionInviteRejectedOptions* Options, void* ClientData, const EOS_Sessions_OnSessionInviteRejectedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CopySessionHandleByInviteId(EOS_HSessions Handle, const EOS_Sessions_CopySessionHandleByInviteIdOptions* Options, EOS_HSessionDetails* OutSessionHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CopySessionHandleByUiEventId(EOS_HSessions Handle, const EOS_Sessions_CopySessionHandleByUiEventIdOptions* Options, EOS_HSessionDetails* OutSessionHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_CopySessionHandleForPresence(EOS_HSessions Handle, const EOS_Sessions_CopySessionHandleForPresenceOptions* Options, EOS_HSessionDetails* OutSessionHandle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Sessions_GetInviteCount(EOS_HSessions Handle, const EOS_Sessions_GetInviteCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Sessions_GetInviteIdByIndex(EOS_HSessions Handle, const EOS_Sessions_GetInviteIdByIndexOptions* Options, char* OutBuffer, int32_t* InOutBufferLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_QueryInvites(EOS_HSessions Handle, const EOS_Sessions_QueryInvitesOptions* Options, void* ClientData, const EOS_Sessions_OnQueryInvitesCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Sessions_QueryInvitesCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RejectInvite(EOS_HSessions Handle, const EOS_Sessions_RejectInviteOptions* Options, void* ClientData, const EOS_Sessions_OnRejectInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Sessions_RejectInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifyJoinSessionAccepted(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifyLeaveSessionRequested(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifySendSessionNativeInviteRequested(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifySessionInviteAccepted(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifySessionInviteReceived(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_RemoveNotifySessionInviteRejected(EOS_HSessions Handle, EOS_NotificationId InId)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Sessions_SendInvite(EOS_HSessions Handle, const EOS_Sessions_SendInviteOptions* Options, void* ClientData, const EOS_Sessions_OnSendInviteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Sessions_SendInviteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Stats_CopyStatByIndex(EOS_HStats Handle, const EOS_Stats_CopyStatByIndexOptions* Options, EOS_Stats_Stat ** OutStat)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_Stats_CopyStatByName(EOS_HStats Handle, const EOS_Stats_CopyStatByNameOptions* Options, EOS_Stats_Stat ** OutStat)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_Stats_GetStatsCount(EOS_HStats Handle, const EOS_Stats_GetStatCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Stats_IngestStat(EOS_HStats Handle, const EOS_Stats_IngestStatOptions* Options, void* ClientData, const EOS_Stats_OnIngestStatCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Stats_IngestStatCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Stats_QueryStats(EOS_HStats Handle, const EOS_Stats_QueryStatsOptions* Options, void* ClientData, const EOS_Stats_OnQueryStatsCompleteCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_Stats_OnQueryStatsCompleteCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_Stats_Stat_Release(EOS_Stats_Stat* Stat)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorageFileTransferRequest_CancelRequest(EOS_HTitleStorageFileTransferRequest Handle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorageFileTransferRequest_GetFileRequestState(EOS_HTitleStorageFileTransferRequest Handle)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorageFileTransferRequest_GetFilename(EOS_HTitleStorageFileTransferRequest Handle, uint32_t FilenameStringBufferSizeBytes, char* OutStringBuffer, int32_t* OutStringLength)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_TitleStorageFileTransferRequest_Release(EOS_HTitleStorageFileTransferRequest TitleStorageFileTransferHandle)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorage_CopyFileMetadataAtIndex(EOS_HTitleStorage Handle, const EOS_TitleStorage_CopyFileMetadataAtIndexOptions* Options, EOS_TitleStorage_FileMetadata ** OutMetadata)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorage_CopyFileMetadataByFilename(EOS_HTitleStorage Handle, const EOS_TitleStorage_CopyFileMetadataByFilenameOptions* Options, EOS_TitleStorage_FileMetadata ** OutMetadata)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_TitleStorage_DeleteCache(EOS_HTitleStorage Handle, const EOS_TitleStorage_DeleteCacheOptions* Options, void* ClientData, const EOS_TitleStorage_OnDeleteCacheCompleteCallback CompletionCallback)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_TitleStorage_FileMetadata_Release(EOS_TitleStorage_FileMetadata* FileMetadata)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_TitleStorage_GetFileMetadataCount(EOS_HTitleStorage Handle, const EOS_TitleStorage_GetFileMetadataCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_TitleStorage_QueryFile(EOS_HTitleStorage Handle, const EOS_TitleStorage_QueryFileOptions* Options, void* ClientData, const EOS_TitleStorage_OnQueryFileCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_TitleStorage_QueryFileList(EOS_HTitleStorage Handle, const EOS_TitleStorage_QueryFileListOptions* Options, void* ClientData, const EOS_TitleStorage_OnQueryFileListCompleteCallback CompletionCallback)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_HTitleStorageFileTransferRequest) EOS_TitleStorage_ReadFile(EOS_HTitleStorage Handle, const EOS_TitleStorage_ReadFileOptions* Options, void* ClientData, const EOS_TitleStorage_OnReadFileCompleteCallback CompletionCallback)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_AcknowledgeEventId(EOS_HUI Handle, const EOS_UI_AcknowledgeEventIdOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_UI_AddNotifyDisplaySettingsUpdated(EOS_HUI Handle, const EOS_UI_AddNotifyDisplaySettingsUpdatedOptions* Options, void* ClientData, const EOS_UI_OnDisplaySettingsUpdatedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_UI_AddNotifyMemoryMonitor(EOS_HUI Handle, const EOS_UI_AddNotifyMemoryMonitorOptions* Options, void* ClientData, const EOS_UI_OnMemoryMonitorCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_NotificationId) EOS_UI_AddNotifyOnScreenKeyboardRequested(EOS_HUI Handle, const EOS_UI_AddNotifyOnScreenKeyboardRequestedOptions* Options, void* ClientData, const EOS_UI_OnScreenKeyboardRequestedCallback NotificationFn)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_ConfigureOnScreenKeyboard(EOS_HUI Handle, const EOS_UI_ConfigureOnScreenKeyboardOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_UI_GetFriendsExclusiveInput(EOS_HUI Handle, const EOS_UI_GetFriendsExclusiveInputOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_UI_GetFriendsVisible(EOS_HUI Handle, const EOS_UI_GetFriendsVisibleOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_UI_ENotificationLocation) EOS_UI_GetNotificationLocationPreference(EOS_HUI Handle)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_UI_EInputStateButtonFlags) EOS_UI_GetToggleFriendsButton(EOS_HUI Handle, const EOS_UI_GetToggleFriendsButtonOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_UI_EKeyCombination) EOS_UI_GetToggleFriendsKey(EOS_HUI Handle, const EOS_UI_GetToggleFriendsKeyOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_HideFriends(EOS_HUI Handle, const EOS_UI_HideFriendsOptions* Options, void* ClientData, const EOS_UI_OnHideFriendsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UI_HideFriendsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_UI_IsSocialOverlayPaused(EOS_HUI Handle, const EOS_UI_IsSocialOverlayPausedOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_UI_IsValidButtonCombination(EOS_HUI Handle, EOS_UI_EInputStateButtonFlags ButtonCombination)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_Bool) EOS_UI_IsValidKeyCombination(EOS_HUI Handle, EOS_UI_EKeyCombination KeyCombination)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_PauseSocialOverlay(EOS_HUI Handle, const EOS_UI_PauseSocialOverlayOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_PrePresent(EOS_HUI Handle, const EOS_UI_PrePresentOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_RemoveNotifyDisplaySettingsUpdated(EOS_HUI Handle, EOS_NotificationId Id)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_RemoveNotifyMemoryMonitor(EOS_HUI Handle, EOS_NotificationId Id)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_RemoveNotifyOnScreenKeyboardRequested(EOS_HUI Handle, EOS_NotificationId Id)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_ReportInputState(EOS_HUI Handle, const EOS_UI_ReportInputStateOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_SetDisplayPreference(EOS_HUI Handle, const EOS_UI_SetDisplayPreferenceOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_SetToggleFriendsButton(EOS_HUI Handle, const EOS_UI_SetToggleFriendsButtonOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UI_SetToggleFriendsKey(EOS_HUI Handle, const EOS_UI_SetToggleFriendsKeyOptions* Options)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_ShowBlockPlayer(EOS_HUI Handle, const EOS_UI_ShowBlockPlayerOptions* Options, void* ClientData, const EOS_UI_OnShowBlockPlayerCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UI_OnShowBlockPlayerCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_ShowFriends(EOS_HUI Handle, const EOS_UI_ShowFriendsOptions* Options, void* ClientData, const EOS_UI_OnShowFriendsCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UI_ShowFriendsCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_ShowNativeProfile(EOS_HUI Handle, const EOS_UI_ShowNativeProfileOptions* Options, void* ClientData, const EOS_UI_OnShowNativeProfileCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UI_ShowNativeProfileCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UI_ShowReportPlayer(EOS_HUI Handle, const EOS_UI_ShowReportPlayerOptions* Options, void* ClientData, const EOS_UI_OnShowReportPlayerCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UI_OnShowReportPlayerCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_BestDisplayName_Release(EOS_UserInfo_BestDisplayName* BestDisplayName)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyBestDisplayName(EOS_HUserInfo Handle, const EOS_UserInfo_CopyBestDisplayNameOptions* Options, EOS_UserInfo_BestDisplayName ** OutBestDisplayName)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyBestDisplayNameWithPlatform(EOS_HUserInfo Handle, const EOS_UserInfo_CopyBestDisplayNameWithPlatformOptions* Options, EOS_UserInfo_BestDisplayName ** OutBestDisplayName)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyExternalUserInfoByAccountId(EOS_HUserInfo Handle, const EOS_UserInfo_CopyExternalUserInfoByAccountIdOptions* Options, EOS_UserInfo_ExternalUserInfo ** OutExternalUserInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyExternalUserInfoByAccountType(EOS_HUserInfo Handle, const EOS_UserInfo_CopyExternalUserInfoByAccountTypeOptions* Options, EOS_UserInfo_ExternalUserInfo ** OutExternalUserInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyExternalUserInfoByIndex(EOS_HUserInfo Handle, const EOS_UserInfo_CopyExternalUserInfoByIndexOptions* Options, EOS_UserInfo_ExternalUserInfo ** OutExternalUserInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_EResult) EOS_UserInfo_CopyUserInfo(EOS_HUserInfo Handle, const EOS_UserInfo_CopyUserInfoOptions* Options, EOS_UserInfo ** OutUserInfo)
+{
+    return EOS_EResult::EOS_NotConfigured;
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_ExternalUserInfo_Release(EOS_UserInfo_ExternalUserInfo* ExternalUserInfo)
+{
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(uint32_t) EOS_UserInfo_GetExternalUserInfoCount(EOS_HUserInfo Handle, const EOS_UserInfo_GetExternalUserInfoCountOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(EOS_OnlinePlatformType) EOS_UserInfo_GetLocalPlatformType(EOS_HUserInfo Handle, const EOS_UserInfo_GetLocalPlatformTypeOptions* Options)
+{
+    return {};
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_QueryUserInfo(EOS_HUserInfo Handle, const EOS_UserInfo_QueryUserInfoOptions* Options, void* ClientData, const EOS_UserInfo_OnQueryUserInfoCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UserInfo_QueryUserInfoCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_QueryUserInfoByDisplayName(EOS_HUserInfo Handle, const EOS_UserInfo_QueryUserInfoByDisplayNameOptions* Options, void* ClientData, const EOS_UserInfo_OnQueryUserInfoByDisplayNameCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UserInfo_QueryUserInfoByDisplayNameCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_QueryUserInfoByExternalAccount(EOS_HUserInfo Handle, const EOS_UserInfo_QueryUserInfoByExternalAccountOptions* Options, void* ClientData, const EOS_UserInfo_OnQueryUserInfoByExternalAccountCallback CompletionDelegate)
+{
+    if (Handle == nullptr || CompletionDelegate == nullptr)
+    {
+        return;
+    }
+
+    PostRequest(Handle, [ClientData, CompletionDelegate]()
+    {
+        EOS_UserInfo_QueryUserInfoByExternalAccountCallbackInfo info = {};
+        info.ResultCode = EOS_EResult::EOS_NotConfigured;
+        info.ClientData = ClientData;
+        CompletionDelegate(&info);
+    });
+}
+
+//-------------------------------------------------------------------------
+MOCK_EXPORT(void) EOS_UserInfo_Release(EOS_UserInfo* UserInfo)
+{
+}
@@ -0,0 +1,167 @@
+# Copyright (c) 2024 PlayEveryWare
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""
+Generates Source/MockStubs.generated.cpp, which defines every EOS SDK function
+that the mock backend does not implement itself.
+
+The C# bindings resolve every SDK function when the library is loaded, so the
+mock has to export all of them. Stubbed functions return EOS_NotConfigured (or
+a zero value), and asynchronous functions on an interface handle complete with
+EOS_NotConfigured on the next tick so that callers waiting on them don't hang.
+
+Usage: python3 generate_stubs.py [path to the EOS SDK headers]
+"""
+
+import os
+import re
+import sys
+
+SCRIPT_DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_HEADER_DIRECTORY = os.path.join(SCRIPT_DIRECTORY, "..", "..", "Runtime", "iOS", "EOSSDK.framework", "Headers")
+SOURCE_DIRECTORY = os.path.join(SCRIPT_DIRECTORY, "Source")
+OUTPUT_PATH = os.path.join(SOURCE_DIRECTORY, "MockStubs.generated.cpp")
+
+FUNCTION_PATTERN = re.compile(r"EOS_DECLARE_FUNC\(([^)]*)\)\s*(EOS_\w+)\s*\(([^;]*?)\)\s*;")
+CALLBACK_PATTERN = re.compile(r"EOS_DECLARE_CALLBACK\(\s*(\w+)\s*,\s*const\s+(\w+)\s*\*\s*\w+\s*\)")
+STRUCT_PATTERN = re.compile(r"EOS_STRUCT\(\s*(\w+)\s*,\s*\(\s*(\w+)\s+(\w+)\s*;\s*void\s*\*\s*(\w+)\s*;")
+IMPLEMENTED_PATTERN = re.compile(r"MOCK_EXPORT\([^)]*\)\s*(EOS_\w+)\s*\(")
+INTERFACE_LIST_PATTERN = re.compile(r"#define MOCK_(?:PLATFORM_)?INTERFACES\(X\)((?:[^\n]*\\\n)*[^\n]*)")
+
+
+def read_headers(header_directory):
+    text = []
+    for name in sorted(os.listdir(header_directory)):
+        if name.endswith(".h") or name.endswith(".inl"):
+            with open(os.path.join(header_directory, name), encoding="utf-8") as header:
+                text.append(header.read())
+
+    # Strip comments so that documented examples are not picked up as declarations
+    source = "\n".join(text)
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+    return re.sub(r"//[^\n]*", "", source)
+
+
+def read_interface_list(path):
+    with open(path, encoding="utf-8") as source:
+        match = INTERFACE_LIST_PATTERN.search(source.read())
+    return re.findall(r"X\((\w+)\)", match.group(1))
+
+
+def read_implemented_functions():
+    implemented = set()
+    for name in os.listdir(SOURCE_DIRECTORY):
+        if name.endswith(".cpp") and not name.endswith(".generated.cpp"):
+            with open(os.path.join(SOURCE_DIRECTORY, name), encoding="utf-8") as source:
+                implemented.update(IMPLEMENTED_PATTERN.findall(source.read()))
+
+    # The platform interface getters are defined through a macro
+    getters = read_interface_list(os.path.join(SOURCE_DIRECTORY, "MockPlatform.cpp"))
+    implemented.update("EOS_Platform_Get{0}Interface".format(name) for name in getters)
+    return implemented
+
+
+def split_parameters(parameters):
+    parameters = " ".join(parameters.split())
+    if parameters in ("", "void"):
+        return []
+    return [parameter.strip() for parameter in parameters.split(",")]
+
+
+def parameter_name(parameter):
+    return re.findall(r"\w+", parameter)[-1]
+
+
+def parameter_type(parameter):
+    return parameter[:parameter.rfind(parameter_name(parameter))].replace("const", "").strip()
+
+
+def generate_stub(return_type, name, parameters, callback_infos, interface_handles):
+    lines = ["//-------------------------------------------------------------------------"]
+    lines.append("MOCK_EXPORT({0}) {1}({2})".format(return_type, name, ", ".join(parameters)))
+    lines.append("{")
+
+    handle_type = parameter_type(parameters[0]) if parameters else None
+    completion = parameters[-1] if parameters and parameter_name(parameters[-1]) == "CompletionDelegate" else None
+    callback_info = callback_infos.get(parameter_type(completion)) if completion else None
+
+    if return_type == "void" and handle_type in interface_handles and callback_info is not None and "ClientData" in map(parameter_name, parameters):
+        handle = parameter_name(parameters[0])
+        lines.append("    if ({0} == nullptr || CompletionDelegate == nullptr)".format(handle))
+        lines.append("    {")
+        lines.append("        return;")
+        lines.append("    }")
+        lines.append("")
+        lines.append("    PostRequest({0}, [ClientData, CompletionDelegate]()".format(handle))
+        lines.append("    {")
+        lines.append("        {0} info = {{}};".format(callback_info))
+        lines.append("        info.ResultCode = EOS_EResult::EOS_NotConfigured;")
+        lines.append("        info.ClientData = ClientData;")
+        lines.append("        CompletionDelegate(&info);")
+        lines.append("    });")
+    elif return_type == "EOS_EResult":
+        lines.append("    return EOS_EResult::EOS_NotConfigured;")
+    elif return_type != "void":
+        lines.append("    return {};")
+
+    lines.append("}")
+    return lines
+
+
+def main():
+    header_directory = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_HEADER_DIRECTORY
+    source = read_headers(header_directory)
+    implemented = read_implemented_functions()
+    interface_handles = {"EOS_H" + name for name in read_interface_list(os.path.join(SOURCE_DIRECTORY, "MockEOSSDK.h"))}
+
+    results = {name: (result, client_data) for name, _, result, client_data in STRUCT_PATTERN.findall(source)}
+    callback_infos = {}
+    for callback, info in CALLBACK_PATTERN.findall(source):
+        if results.get(info) == ("ResultCode", "ClientData"):
+            callback_infos[callback] = info
+
+    functions = {}
+    for return_type, name, parameters in FUNCTION_PATTERN.findall(source):
+        if name not in implemented and name not in functions:
+            functions[name] = (" ".join(return_type.split()), split_parameters(parameters))
+
+    lines = [
+        "// Generated by generate_stubs.py. Do not edit.",
+        "",
+        "#include \"MockEOSSDK.h\"",
+        "",
+        "using namespace mock;",
+        "",
+        "#pragma GCC diagnostic ignored \"-Wunused-parameter\"",
+    ]
+
+    for name in sorted(functions):
+        return_type, parameters = functions[name]
+        lines.append("")
+        lines.extend(generate_stub(return_type, name, parameters, callback_infos, interface_handles))
+
+    with open(OUTPUT_PATH, "w", encoding="utf-8", newline="\n") as output:
+        output.write("\n".join(lines) + "\n")
+
+    print("Generated {0} stubs ({1} functions implemented by the mock).".format(len(functions), len(implemented)))
+
+
+if __name__ == "__main__":
+    main()
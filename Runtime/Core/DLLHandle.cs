@@ -138,6 +138,12 @@ namespace PlayEveryWare.EpicOnlineServices
             }
 
             Log("Trying to load with entry " + libraryPath);
+            return LoadDynamicLibraryAtPath(libraryPath);
+        }
+
+        //-------------------------------------------------------------------------
+        public static DLLHandle LoadDynamicLibraryAtPath(string libraryPath)
+        {
             IntPtr libraryHandle = SystemDynamicLibrary.Instance.LoadLibraryAtPath(libraryPath);
 
             if (IntPtr.Zero == libraryHandle)
@@ -143,6 +143,9 @@ namespace PlayEveryWare.EpicOnlineServices
         /// <value>List of application shutdown callbacks</value>
         private static List<Action> s_onApplicationShutdownCallbacks = new List<Action>();
 
+        /// <value>Pools of platforms that must be released before the SDK shuts down</value>
+        private static List<PlatformPool> s_platformPools = new List<PlatformPool>();
+
         /// <value>True if EOS Overlay is visible and has exclusive input.</value>
         private static bool s_isOverlayVisible;
 
@@ -200,6 +203,23 @@ namespace PlayEveryWare.EpicOnlineServices
             // Setting it twice will cause an exception
             static bool hasSetLoggingCallback;
 
+            /// <summary>
+            /// When set, SDK log messages are copied into a ring buffer and
+            /// forwarded to the Unity log in batches during <see cref="Tick"/>
+            /// instead of being formatted inside the SDK log callback.
+            /// </summary>
+            static private EOSBufferedLogSink s_bufferedLogSink;
+
+            /// <summary>
+            /// When set, decides how many times the platform is ticked each
+            /// frame, instead of ticking it exactly once.
+            /// </summary>
+            static private EOSTickBudgetController s_tickBudgetController
+#if EOS_ADAPTIVE_TICK
+                = new EOSTickBudgetController()
+#endif
+                ;
+
             // Need to keep track for shutting down EOS after a successful platform initialization
             static private bool s_hasInitializedPlatform;
 
@@ -368,6 +388,42 @@ namespace PlayEveryWare.EpicOnlineServices
                 s_onApplicationShutdownCallbacks.Add(listener);
             }
 
+            internal void RegisterPlatformPool(PlatformPool pool)
+            {
+                lock (s_platformPools)
+                {
+                    s_platformPools.Add(pool);
+                }
+            }
+
+            internal void UnregisterPlatformPool(PlatformPool pool)
+            {
+                lock (s_platformPools)
+                {
+                    s_platformPools.Remove(pool);
+                }
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Disposes every live <see cref="PlatformPool"/>, so that their
+            /// workers are stopped and their platforms are released while the
+            /// SDK is still loaded.
+            /// </summary>
+            private void ReleasePlatformPools()
+            {
+                PlatformPool[] pools;
+                lock (s_platformPools)
+                {
+                    pools = s_platformPools.ToArray();
+                }
+
+                foreach (PlatformPool pool in pools)
+                {
+                    pool.Dispose();
+                }
+            }
+
             public void RemoveConnectLoginListener(IEOSOnConnectLogin connectLogin)
             {
                 OnConnectLogin -= connectLogin.OnConnectLogin;
@@ -599,7 +655,7 @@ namespace PlayEveryWare.EpicOnlineServices
 
                     if (!hasSetLoggingCallback)
                     {
-                        LoggingInterface.SetCallback(SimplePrintCallback);
+                        SetLoggingCallback();
                         hasSetLoggingCallback = true;
                     }
 
@@ -665,7 +721,7 @@ namespace PlayEveryWare.EpicOnlineServices
 
                 s_hasInitializedPlatform = true;
 
-                LoggingInterface.SetCallback(SimplePrintCallback);
+                SetLoggingCallback();
 
 
                 var eosPlatformInterface = CreatePlatformInterface();
@@ -698,6 +754,122 @@ namespace PlayEveryWare.EpicOnlineServices
                 }
             }
 
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Routes SDK log messages through a <see cref="EOSBufferedLogSink"/>
+            /// instead of formatting each message in the SDK log callback. Can
+            /// be called before or after <see cref="Init"/>. Defining
+            /// EOS_BUFFERED_LOGGING enables this with default settings.
+            /// </summary>
+            /// <param name="settings">
+            /// Buffering, filtering and rate limiting settings, or null for the
+            /// defaults.
+            /// </param>
+            public void EnableBufferedLogging(EOSBufferedLogSink.Settings settings = null)
+            {
+                // Flush whatever the previous sink still holds before it is replaced.
+                s_bufferedLogSink?.Dispose();
+                s_bufferedLogSink = new EOSBufferedLogSink(settings);
+
+                if (s_hasInitializedPlatform || GetEOSPlatformInterface() != null)
+                {
+                    SetLoggingCallback();
+                    hasSetLoggingCallback = true;
+                }
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Ticks the platform adaptively: extra times on frames with time
+            /// to spare under the target frame time, and not at all on frames
+            /// that are already over it. See <see cref="EOSTickBudgetController"/>.
+            /// Defining EOS_ADAPTIVE_TICK enables this with default settings.
+            /// </summary>
+            /// <param name="settings">
+            /// Target frame time and limits, or null for the defaults.
+            /// </param>
+            public void EnableAdaptiveTick(EOSTickBudgetController.Settings settings = null)
+            {
+                s_tickBudgetController = new EOSTickBudgetController(settings);
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Goes back to ticking the platform exactly once per frame.
+            /// </summary>
+            public void DisableAdaptiveTick()
+            {
+                s_tickBudgetController = null;
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// The controller used to tick the platform adaptively, with the
+            /// statistics of how many ticks were added or deferred, or null if
+            /// the platform is ticked once per frame.
+            /// </summary>
+            public EOSTickBudgetController GetTickBudgetController()
+            {
+                return s_tickBudgetController;
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Writes SDK log messages to a compact binary capture file instead
+            /// of the Unity log (errors are still printed). Captures can be
+            /// decoded and filtered offline with <see cref="EOSLogCaptureReader"/>
+            /// or the "EOS Plugin/Advanced/Decode Log Capture" editor window.
+            /// Passing "-EOSLogCapture &lt;path&gt;" on the command line does the
+            /// same thing at startup.
+            /// </summary>
+            /// <param name="path">Path of the capture file to create.</param>
+            /// <param name="forwardToUnityLog">
+            /// If true, messages are printed to the Unity log as well.
+            /// </param>
+            public void EnableLogCapture(string path, bool forwardToUnityLog = false)
+            {
+                EnableBufferedLogging(new EOSBufferedLogSink.Settings
+                {
+                    CaptureFilePath = path,
+                    ForwardToUnityLog = forwardToUnityLog
+                });
+            }
+
+            //-------------------------------------------------------------------------
+            private static string GetLogCapturePathFromCommandLine()
+            {
+                return CommandLineUtility.GetValue("-EOSLogCapture");
+            }
+
+            //-------------------------------------------------------------------------
+            private void SetLoggingCallback()
+            {
+                if (s_bufferedLogSink == null)
+                {
+                    string capturePath = GetLogCapturePathFromCommandLine();
+                    if (!string.IsNullOrEmpty(capturePath))
+                    {
+                        s_bufferedLogSink = new EOSBufferedLogSink(new EOSBufferedLogSink.Settings
+                        {
+                            CaptureFilePath = capturePath,
+                            ForwardToUnityLog = false
+                        });
+                    }
+                }
+
+#if EOS_BUFFERED_LOGGING
+                s_bufferedLogSink ??= new EOSBufferedLogSink();
+#endif
+                if (s_bufferedLogSink != null)
+                {
+                    s_bufferedLogSink.Register();
+                }
+                else
+                {
+                    LoggingInterface.SetCallback(SimplePrintCallback);
+                }
+            }
+
             //-------------------------------------------------------------------------
             [MonoPInvokeCallback(typeof(string))]
             private static void SimplePrintStringCallback(string str)
@@ -1534,6 +1706,7 @@ namespace PlayEveryWare.EpicOnlineServices
             public void Tick()
             {
                 ExecuteQueuedMainThreadTasks();
+                s_bufferedLogSink?.Drain();
                 if (GetEOSPlatformInterface() != null)
                 {
                     // Poll for any application constrained state change that didn't
@@ -1545,7 +1718,17 @@ namespace PlayEveryWare.EpicOnlineServices
                     if (s_state != EOSState.Suspended)
                     {
                         // Only tick if awake?
-                        GetEOSPlatformInterface().Tick();
+                        // Always tick once while suspending, so the SDK
+                        // processes the state change straight away
+                        if (s_tickBudgetController != null && s_state != EOSState.Suspending)
+                        {
+                            s_tickBudgetController.Tick(GetEOSPlatformInterface());
+                        }
+                        else
+                        {
+                            GetEOSPlatformInterface().Tick();
+                        }
+
                         if (s_state == EOSState.Suspending)
                         {
                             // do anything needed to inform EOS systems they need to suspend
@@ -1602,6 +1785,13 @@ namespace PlayEveryWare.EpicOnlineServices
                 {
                     s_state = EOSState.ShuttingDown;
                     Log("Shutting down eos and releasing handles");
+
+                    if (s_platformPools.Count > 0)
+                    {
+                        Log("Releasing the platform pools.");
+                        ReleasePlatformPools();
+                    }
+
                     // Not doing this in the editor, because it doesn't seem to be an issue there
 #if !UNITY_EDITOR_OSX
 #if !UNITY_EDITOR
@@ -1631,7 +1821,11 @@ namespace PlayEveryWare.EpicOnlineServices
                         UnloadAllLibraries();
                     }
 #endif
+                    // Native ids are only valid for the platform that created them
+                    Helper.ClearInternedHandles();
+
                     Log("Finished shutdown.");
+                    s_bufferedLogSink?.Dispose();
                     s_state = EOSState.Shutdown;
                 }
             }
@@ -143,6 +143,57 @@ namespace PlayEveryWare.EpicOnlineServices
                 }
             }
 
+            //-------------------------------------------------------------------------
+            static public DLLHandle LoadDynamicLibraryAtPath(string libraryPath)
+            {
+                if (LoadedDLLs.ContainsKey(libraryPath))
+                {
+                    Log("Found existing handle for " + libraryPath);
+                    return LoadedDLLs[libraryPath];
+                }
+                else
+                {
+                    var libraryHandle = DLLHandle.LoadDynamicLibraryAtPath(libraryPath);
+
+                    // Don't remember failures, so that a corrected path can be loaded later
+                    if (libraryHandle != null && !libraryHandle.IsInvalid)
+                    {
+                        LoadedDLLs[libraryPath] = libraryHandle;
+                    }
+
+                    return libraryHandle;
+                }
+            }
+
+            //-------------------------------------------------------------------------
+            /// <summary>
+            /// Returns the path of an EOS SDK library to bind to instead of the one that ships with the plugin,
+            /// given with <c>-EOSLibraryPath path</c> on the command line or the <c>EOS_LIBRARY_PATH</c> environment
+            /// variable. Used to run against the mock SDK in NativeCode~/MockEOSSDK.
+            /// Only honoured in the editor and in development builds, or when
+            /// <c>EOS_ALLOW_LIBRARY_PATH_OVERRIDE</c> is defined, so that a shipping build can't be made to load
+            /// another library.
+            /// </summary>
+            /// <returns>The path of the library, or null to use the plugin's library.</returns>
+            static public string GetLibraryPathOverride()
+            {
+#if UNITY_EDITOR || DEVELOPMENT_BUILD || EOS_ALLOW_LIBRARY_PATH_OVERRIDE
+                string[] arguments = Environment.GetCommandLineArgs();
+                for (int i = 0; i < arguments.Length - 1; ++i)
+                {
+                    if (string.Equals(arguments[i], "-EOSLibraryPath", StringComparison.OrdinalIgnoreCase))
+                    {
+                        return arguments[i + 1];
+                    }
+                }
+
+                string libraryPath = Environment.GetEnvironmentVariable("EOS_LIBRARY_PATH");
+                return string.IsNullOrEmpty(libraryPath) ? null : libraryPath;
+#else
+                return null;
+#endif
+            }
+
             //-------------------------------------------------------------------------
             // This doesn't do anything smart to make sure the delegates aren't being used, so 
             // be mindful to only do this at the very end of the app usage
@@ -162,8 +213,18 @@ namespace PlayEveryWare.EpicOnlineServices
             static public void LoadDelegatesWithEOSBindingAPI()
             {
 #if EOS_DYNAMIC_BINDINGS
-                Log($"Loading EOS binary {EOSBinaryName}");
-                var eosLibraryHandle = LoadDynamicLibrary(EOSBinaryName);
+                DLLHandle eosLibraryHandle;
+                string libraryPathOverride = GetLibraryPathOverride();
+                if (libraryPathOverride != null)
+                {
+                    Log($"Loading EOS binary from {libraryPathOverride} instead of {EOSBinaryName}");
+                    eosLibraryHandle = LoadDynamicLibraryAtPath(libraryPathOverride);
+                }
+                else
+                {
+                    Log($"Loading EOS binary {EOSBinaryName}");
+                    eosLibraryHandle = LoadDynamicLibrary(EOSBinaryName);
+                }
 
                 Epic.OnlineServices.Bindings.Hook<DLLHandle>(eosLibraryHandle, (DLLHandle handle, string functionName) => {
                 // TODO: Add conditions for all flags (unless OSX is the only one that's weird?)
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using Epic.OnlineServices.Platform;
+    using UnityEngine;
+    using UnityEngine.LowLevel;
+    using UnityEngine.PlayerLoop;
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Decides how many times the EOS platform is ticked each frame, based on
+    /// how much of the frame is left when <see cref="EOSManager"/> ticks.
+    ///
+    /// The tick budget given to the SDK when the platform is created cannot
+    /// be changed afterwards, so instead of resizing it this ticks the
+    /// platform again while there is headroom left under the target frame
+    /// time (for instance on a loading screen), and skips ticks on frames
+    /// that are already over it, deferring the SDK work to a later frame. A
+    /// tick is never skipped for more than
+    /// <see cref="Settings.MaxConsecutiveSkippedFrames"/> frames in a row, so
+    /// the SDK keeps making progress on frames that are always busy.
+    ///
+    /// The time spent in a frame is measured with a single Stopwatch, from a
+    /// timestamp taken by a system inserted at the start of the player loop.
+    /// </summary>
+    public class EOSTickBudgetController
+    {
+        /// <summary>
+        /// Settings that control how much of each frame the SDK can use.
+        /// </summary>
+        public class Settings
+        {
+            /// <summary>
+            /// Target frame time in milliseconds. Zero or less derives it from
+            /// the refresh rate of the screen and QualitySettings.vSyncCount
+            /// when vertical sync is on, or else from
+            /// Application.targetFrameRate, or else from the refresh rate. If
+            /// none of these is known, 60 frames per second is used.
+            /// </summary>
+            public float TargetFrameTimeMilliseconds = 0;
+
+            /// <summary>
+            /// Milliseconds kept free at the end of each frame for the work
+            /// that happens after the EOSManager ticks, such as rendering.
+            /// Never more than <see cref="MaxReservedFrameFraction"/> of the
+            /// target frame time.
+            /// </summary>
+            public float ReservedFrameTimeMilliseconds = 4.0f;
+
+            /// <summary>
+            /// Largest fraction of the target frame time that is reserved, so
+            /// that high frame rates still leave the SDK a budget. At 240 Hz,
+            /// for instance, a 4 ms reserve would leave under 0.2 ms.
+            /// </summary>
+            public float MaxReservedFrameFraction = 0.5f;
+
+            /// <summary>
+            /// Maximum number of times the platform is ticked in one frame.
+            /// </summary>
+            public int MaxTicksPerFrame = 4;
+
+            /// <summary>
+            /// Maximum number of frames in a row without a tick.
+            /// </summary>
+            public int MaxConsecutiveSkippedFrames = 2;
+        }
+
+        /// <summary>
+        /// Counters since the controller was created or
+        /// <see cref="ResetStatistics"/> was last called.
+        /// </summary>
+        public struct Statistics
+        {
+            /// <summary>
+            /// Number of frames the controller has been asked to tick.
+            /// </summary>
+            public long Frames;
+
+            /// <summary>
+            /// Number of times the platform has been ticked.
+            /// </summary>
+            public long Ticks;
+
+            /// <summary>
+            /// Number of ticks beyond one per frame, made with idle time.
+            /// </summary>
+            public long ExtraTicks;
+
+            /// <summary>
+            /// Number of frames on which the tick was skipped.
+            /// </summary>
+            public long SkippedFrames;
+
+            /// <summary>
+            /// Estimated milliseconds of SDK work moved off busy frames, based
+            /// on the average duration of a tick.
+            /// </summary>
+            public double DeferredMilliseconds;
+
+            /// <summary>
+            /// Average duration of a tick in milliseconds.
+            /// </summary>
+            public double AverageTickMilliseconds;
+
+            /// <summary>
+            /// Number of times the platform was ticked in the last frame.
+            /// </summary>
+            public int LastFrameTicks;
+        }
+
+        // Weight of the latest tick in the moving average of tick durations
+        private const double TickDurationSmoothing = 0.1;
+
+        private const float DefaultTargetFrameRate = 60.0f;
+
+        // Clock that frame start times and elapsed frame times are read from
+        private static readonly Stopwatch s_frameClock = Stopwatch.StartNew();
+        private static long s_frameStartTicks;
+        private static bool s_frameStartInstalled;
+
+        // Frame stamped by the fallback when the player loop system is missing
+        private static int s_fallbackFrame = -1;
+
+        private readonly Settings _settings;
+        private readonly Stopwatch _tickStopwatch = new();
+        private Statistics _statistics;
+        private int _consecutiveSkippedFrames;
+        private bool _loggedNoBudget;
+
+        public EOSTickBudgetController(Settings settings = null)
+        {
+            _settings = settings ?? new Settings();
+        }
+
+        public Statistics CurrentStatistics
+        {
+            get
+            {
+                return _statistics;
+            }
+        }
+
+        public void ResetStatistics()
+        {
+            double averageTickMilliseconds = _statistics.AverageTickMilliseconds;
+            _statistics = new Statistics { AverageTickMilliseconds = averageTickMilliseconds };
+        }
+
+        /// <summary>
+        /// Ticks the platform as many times as the remaining frame time
+        /// allows, which can be none.
+        /// </summary>
+        /// <param name="platform">The platform to tick.</param>
+        /// <returns>The number of times the platform was ticked.</returns>
+        public int Tick(PlatformInterface platform)
+        {
+            double budget = GetBudgetMilliseconds();
+            int ticks = 0;
+
+            _statistics.Frames++;
+
+            if (!HasHeadroom(budget) && _consecutiveSkippedFrames < _settings.MaxConsecutiveSkippedFrames)
+            {
+                _consecutiveSkippedFrames++;
+                _statistics.SkippedFrames++;
+                _statistics.DeferredMilliseconds += _statistics.AverageTickMilliseconds;
+                _statistics.LastFrameTicks = 0;
+                return 0;
+            }
+
+            _consecutiveSkippedFrames = 0;
+
+            do
+            {
+                _tickStopwatch.Restart();
+                platform.Tick();
+                _tickStopwatch.Stop();
+
+                double tickMilliseconds = _tickStopwatch.Elapsed.TotalMilliseconds;
+                _statistics.AverageTickMilliseconds = _statistics.Ticks == 0
+                    ? tickMilliseconds
+                    : _statistics.AverageTickMilliseconds + (tickMilliseconds - _statistics.AverageTickMilliseconds) * TickDurationSmoothing;
+
+                _statistics.Ticks++;
+                ticks++;
+            }
+            while (ticks < _settings.MaxTicksPerFrame && HasHeadroom(budget));
+
+            _statistics.ExtraTicks += ticks - 1;
+            _statistics.LastFrameTicks = ticks;
+
+            return ticks;
+        }
+
+        /// <summary>
+        /// Milliseconds of the frame, from its start, that the SDK can be
+        /// ticked in.
+        /// </summary>
+        private double GetBudgetMilliseconds()
+        {
+            double frameMilliseconds = GetTargetFrameTimeMilliseconds();
+            double reservedMilliseconds = Math.Min(_settings.ReservedFrameTimeMilliseconds, frameMilliseconds * _settings.MaxReservedFrameFraction);
+            double budget = frameMilliseconds - reservedMilliseconds;
+
+            // Every frame would then be skipped as far as allowed, and ticked
+            // once only after that
+            if (budget <= 0 && !_loggedNoBudget)
+            {
+                _loggedNoBudget = true;
+                Debug.LogWarning($"{nameof(EOSTickBudgetController)}: No tick budget is left in a target frame time of {frameMilliseconds:F2} ms " +
+                    $"after reserving {reservedMilliseconds:F2} ms. The platform will only be ticked every {_settings.MaxConsecutiveSkippedFrames + 1} frames. " +
+                    $"Lower {nameof(Settings.ReservedFrameTimeMilliseconds)} or {nameof(Settings.MaxReservedFrameFraction)}.");
+            }
+
+            return budget;
+        }
+
+        /// <summary>
+        /// Whether another tick of average duration fits in the frame.
+        /// </summary>
+        private bool HasHeadroom(double budgetMilliseconds)
+        {
+            // Without the player loop system, such as in edit mode, the frame
+            // is taken to start with its first tick
+            if (!s_frameStartInstalled && s_fallbackFrame != Time.frameCount)
+            {
+                s_fallbackFrame = Time.frameCount;
+                s_frameStartTicks = s_frameClock.ElapsedTicks;
+            }
+
+            double elapsedMilliseconds = Math.Max(0.0, (s_frameClock.ElapsedTicks - s_frameStartTicks) * 1000.0 / Stopwatch.Frequency);
+
+            return elapsedMilliseconds + _statistics.AverageTickMilliseconds <= budgetMilliseconds;
+        }
+
+        private double GetTargetFrameTimeMilliseconds()
+        {
+            if (_settings.TargetFrameTimeMilliseconds > 0)
+            {
+                return _settings.TargetFrameTimeMilliseconds;
+            }
+
+#if UNITY_2022_2_OR_NEWER
+            double refreshRate = Screen.currentResolution.refreshRateRatio.value;
+#else
+            double refreshRate = Screen.currentResolution.refreshRate;
+#endif
+
+            double frameRate;
+
+            // Mobile platforms ignore vSyncCount, others ignore the target
+            // frame rate while it is set
+            if (QualitySettings.vSyncCount > 0 && !Application.isMobilePlatform)
+            {
+                frameRate = refreshRate / QualitySettings.vSyncCount;
+            }
+            else if (Application.targetFrameRate > 0)
+            {
+                frameRate = Application.targetFrameRate;
+            }
+            else
+            {
+                frameRate = refreshRate;
+            }
+
+            return 1000.0 / (frameRate > 0 ? frameRate : DefaultTargetFrameRate);
+        }
+
+        /// <summary>
+        /// Marks the player loop system that stamps the start of each frame.
+        /// </summary>
+        private struct EOSFrameStart
+        {
+        }
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+        private static void InstallFrameStart()
+        {
+            PlayerLoopSystem playerLoop = PlayerLoop.GetCurrentPlayerLoop();
+            if (playerLoop.subSystemList == null)
+            {
+                return;
+            }
+
+            for (int i = 0; i < playerLoop.subSystemList.Length; ++i)
+            {
+                PlayerLoopSystem phase = playerLoop.subSystemList[i];
+                if (phase.type != typeof(Initialization))
+                {
+                    continue;
+                }
+
+                // A system left by a previous play session in the editor is
+                // replaced, as its delegate may belong to an unloaded domain
+                List<PlayerLoopSystem> systems = new(phase.subSystemList ?? Array.Empty<PlayerLoopSystem>());
+                systems.RemoveAll(system => system.type == typeof(EOSFrameStart));
+                systems.Insert(0, new PlayerLoopSystem
+                {
+                    type = typeof(EOSFrameStart),
+                    updateDelegate = OnFrameStart
+                });
+
+                phase.subSystemList = systems.ToArray();
+                playerLoop.subSystemList[i] = phase;
+                PlayerLoop.SetPlayerLoop(playerLoop);
+
+                s_frameStartInstalled = true;
+                return;
+            }
+        }
+
+        private static void OnFrameStart()
+        {
+            s_frameStartTicks = s_frameClock.ElapsedTicks;
+        }
+    }
+}
+
+#endif
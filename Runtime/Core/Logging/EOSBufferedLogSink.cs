@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Text;
+    using Epic.OnlineServices.Logging;
+    using UnityEngine;
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Receives EOS SDK log messages through a <see cref="LogRingBuffer"/>
+    /// and forwards them to the Unity log in batches.
+    ///
+    /// The SDK log callback only copies raw bytes into the ring buffer, so
+    /// the cost of decoding, formatting and calling into
+    /// <see cref="Debug"/> is paid in <see cref="Drain"/>, and only for
+    /// messages that survive filtering and rate limiting.
+    /// </summary>
+    public class EOSBufferedLogSink : IDisposable
+    {
+        /// <summary>
+        /// Settings that control buffering, filtering, and rate limiting.
+        /// </summary>
+        public class Settings
+        {
+            /// <summary>
+            /// Number of messages the ring buffer can hold between drains.
+            /// </summary>
+            public int Capacity = LogRingBuffer.DefaultCapacity;
+
+            /// <summary>
+            /// Number of message bytes kept per log message; longer messages
+            /// are truncated.
+            /// </summary>
+            public int MaxMessageLength = LogRingBuffer.DefaultMaxMessageLength;
+
+            /// <summary>
+            /// Messages that are more verbose than this level are discarded
+            /// when drained.
+            /// </summary>
+            public LogLevel MaximumLevel = LogLevel.VeryVerbose;
+
+            /// <summary>
+            /// Categories (for instance "LogEOSP2P") whose messages are
+            /// discarded when drained. Errors and fatals are never discarded.
+            /// </summary>
+            public List<string> ExcludedCategories = new();
+
+            /// <summary>
+            /// Maximum number of messages forwarded to the Unity log per
+            /// second. Zero or less disables rate limiting. Errors and fatals
+            /// are never rate limited.
+            /// </summary>
+            public int MaxMessagesPerSecond = 0;
+
+            /// <summary>
+            /// Maximum number of messages read out of the ring buffer per
+            /// call to <see cref="Drain"/>. Zero or less (the default) drains
+            /// until the buffer is empty. A limit below
+            /// <see cref="Capacity"/> leaves messages behind during bursts,
+            /// and they are dropped if the buffer fills up before the next
+            /// drain.
+            /// </summary>
+            public int MaxMessagesPerDrain = 0;
+
+            /// <summary>
+            /// If set, every message that passes the level and category
+            /// filters is also written to a binary capture file at this path.
+            /// See <see cref="EOSLogCaptureWriter"/>.
+            /// </summary>
+            public string CaptureFilePath;
+
+            /// <summary>
+            /// Whether messages are forwarded to the Unity log. Turning this
+            /// off while capturing keeps verbose logging cheap enough to
+            /// leave on in production. Errors and fatals are always forwarded.
+            /// </summary>
+            public bool ForwardToUnityLog = true;
+        }
+
+        private readonly Settings _settings;
+        private readonly LogRingBuffer _ringBuffer;
+        private readonly LogCategoryMap<bool> _excludedCategories = new();
+
+        /// <summary>
+        /// Decoded category names, so that each category is only decoded
+        /// once.
+        /// </summary>
+        private readonly LogCategoryMap<string> _categoryNames = new();
+
+        private readonly StringBuilder _batch = new();
+        private char[] _decodeBuffer;
+        private LogType _batchType;
+        private int _batchCount;
+
+        private readonly DateTime _startTime;
+        private readonly long _startTimestamp;
+
+        private long _rateWindowStart;
+        private int _rateWindowCount;
+        private long _rateLimitedCount;
+        private long _reportedRateLimitedCount;
+        private long _reportedDroppedCount;
+
+        private readonly LogRingBuffer.LogRecordHandler _recordHandler;
+
+        private EOSLogCaptureWriter _captureWriter;
+
+        public EOSBufferedLogSink(Settings settings = null)
+        {
+            _settings = settings ?? new Settings();
+            _ringBuffer = new LogRingBuffer(_settings.Capacity, _settings.MaxMessageLength);
+            _decodeBuffer = new char[_settings.MaxMessageLength];
+
+            if (_settings.ExcludedCategories != null)
+            {
+                foreach (string category in _settings.ExcludedCategories)
+                {
+                    _excludedCategories.Add(category, true);
+                }
+            }
+
+            _startTime = DateTime.Now;
+            _startTimestamp = Stopwatch.GetTimestamp();
+            _rateWindowStart = _startTimestamp;
+
+            // Cache the delegate so that draining does not allocate.
+            _recordHandler = OnRecord;
+
+            if (!string.IsNullOrEmpty(_settings.CaptureFilePath))
+            {
+                try
+                {
+                    _captureWriter = new EOSLogCaptureWriter(_settings.CaptureFilePath);
+                    Debug.Log($"{nameof(EOSBufferedLogSink)}: Capturing EOS SDK log to \"{_captureWriter.FilePath}\".");
+                }
+                catch (Exception exception)
+                {
+                    Debug.LogException(exception);
+                    Debug.LogWarning($"{nameof(EOSBufferedLogSink)}: Unable to create log capture file \"{_settings.CaptureFilePath}\".");
+                }
+            }
+        }
+
+        /// <summary>
+        /// The ring buffer that SDK log messages are written into.
+        /// </summary>
+        public LogRingBuffer RingBuffer
+        {
+            get { return _ringBuffer; }
+        }
+
+        /// <summary>
+        /// Registers the ring buffer with the EOS SDK as the log callback.
+        /// </summary>
+        /// <returns>The result of setting the log callback.</returns>
+        public Epic.OnlineServices.Result Register()
+        {
+            return LoggingInterface.SetCallback(_ringBuffer);
+        }
+
+        /// <summary>
+        /// Forwards buffered log messages to the Unity log. Should be called
+        /// once per frame from the main thread.
+        /// </summary>
+        /// <param name="drainAll">
+        /// If true, ignores the per drain limit and empties the buffer (used
+        /// on shutdown).
+        /// </param>
+        public void Drain(bool drainAll = false)
+        {
+            int maxRecords = drainAll || _settings.MaxMessagesPerDrain <= 0 ? -1 : _settings.MaxMessagesPerDrain;
+
+            _ringBuffer.Drain(_recordHandler, maxRecords);
+            FlushBatch();
+            ReportLostMessages();
+            _captureWriter?.Flush();
+        }
+
+        /// <summary>
+        /// Drains any remaining messages and closes the capture file, if
+        /// there is one.
+        /// </summary>
+        public void Dispose()
+        {
+            Drain(true);
+
+            _captureWriter?.Dispose();
+            _captureWriter = null;
+        }
+
+        private void OnRecord(in LogRecord record)
+        {
+            bool isError = record.Level <= LogLevel.Error;
+
+            if (!isError && (record.Level > _settings.MaximumLevel ||
+                             _excludedCategories.TryGetValue(in record, out _)))
+            {
+                return;
+            }
+
+            // Captures are not rate limited; the point is to keep everything.
+            _captureWriter?.Write(in record);
+
+            if (!isError && (!_settings.ForwardToUnityLog || IsRateLimited(record.Timestamp)))
+            {
+                return;
+            }
+
+            LogType type = GetLogType(record.Level);
+            if (_batchCount > 0 && type != _batchType)
+            {
+                FlushBatch();
+            }
+
+            _batchType = type;
+
+            if (_batchCount > 0)
+            {
+                _batch.Append('\n');
+            }
+
+            // Matches the format used by EOSManager.SimplePrintCallback.
+            DateTime time = _startTime.AddTicks(
+                (long)((record.Timestamp - _startTimestamp) * ((double)TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+
+            _batch.Append(time.ToString("O", System.Globalization.DateTimeFormatInfo.InvariantInfo));
+            _batch.Append(' ');
+            _batch.Append(GetCategoryName(record));
+            _batch.Append('(');
+            _batch.Append(GetLevelName(record.Level));
+            _batch.Append("): ");
+            AppendUTF8(record.Message);
+
+            if (record.IsTruncated)
+            {
+                _batch.Append("...");
+            }
+
+            ++_batchCount;
+        }
+
+        private bool IsRateLimited(long timestamp)
+        {
+            if (_settings.MaxMessagesPerSecond <= 0)
+            {
+                return false;
+            }
+
+            if (timestamp - _rateWindowStart >= Stopwatch.Frequency)
+            {
+                _rateWindowStart = timestamp;
+                _rateWindowCount = 0;
+            }
+
+            if (_rateWindowCount >= _settings.MaxMessagesPerSecond)
+            {
+                ++_rateLimitedCount;
+                return true;
+            }
+
+            ++_rateWindowCount;
+            return false;
+        }
+
+        private string GetCategoryName(in LogRecord record)
+        {
+            if (!_categoryNames.TryGetValue(in record, out string name))
+            {
+                ArraySegment<byte> category = record.Category;
+                name = category.Count == 0 ? string.Empty : Encoding.UTF8.GetString(category.Array, category.Offset, category.Count);
+                _categoryNames.Add(in record, name);
+            }
+
+            return name;
+        }
+
+        private void AppendUTF8(ArraySegment<byte> bytes)
+        {
+            if (bytes.Count == 0)
+            {
+                return;
+            }
+
+            int maxCharCount = Encoding.UTF8.GetMaxCharCount(bytes.Count);
+            if (_decodeBuffer.Length < maxCharCount)
+            {
+                _decodeBuffer = new char[maxCharCount];
+            }
+
+            int charCount = Encoding.UTF8.GetChars(bytes.Array, bytes.Offset, bytes.Count, _decodeBuffer, 0);
+            _batch.Append(_decodeBuffer, 0, charCount);
+        }
+
+        private void FlushBatch()
+        {
+            if (_batchCount == 0)
+            {
+                return;
+            }
+
+            Debug.LogFormat(_batchType, LogOption.NoStacktrace, null, "{0}", _batch.ToString());
+
+            _batch.Clear();
+            _batchCount = 0;
+        }
+
+        private void ReportLostMessages()
+        {
+            long dropped = _ringBuffer.DroppedCount;
+            if (dropped == _reportedDroppedCount && _rateLimitedCount == _reportedRateLimitedCount)
+            {
+                return;
+            }
+
+            _captureWriter?.WriteDropped(dropped - _reportedDroppedCount);
+
+            if (_settings.ForwardToUnityLog)
+            {
+                Debug.LogWarning(
+                    $"{nameof(EOSBufferedLogSink)}: {dropped - _reportedDroppedCount} EOS log message(s) " +
+                    $"dropped because the buffer was full, {_rateLimitedCount - _reportedRateLimitedCount} " +
+                    $"suppressed by rate limiting.");
+            }
+
+            _reportedDroppedCount = dropped;
+            _reportedRateLimitedCount = _rateLimitedCount;
+        }
+
+        private static string GetLevelName(LogLevel level)
+        {
+            // Avoids the allocation of Enum.ToString for every message.
+            return level switch
+            {
+                LogLevel.Fatal => nameof(LogLevel.Fatal),
+                LogLevel.Error => nameof(LogLevel.Error),
+                LogLevel.Warning => nameof(LogLevel.Warning),
+                LogLevel.Info => nameof(LogLevel.Info),
+                LogLevel.Verbose => nameof(LogLevel.Verbose),
+                LogLevel.VeryVerbose => nameof(LogLevel.VeryVerbose),
+                _ => level.ToString(),
+            };
+        }
+
+        private static LogType GetLogType(LogLevel level)
+        {
+            if (level < LogLevel.Warning)
+            {
+                return LogType.Error;
+            }
+
+            if (level > LogLevel.Warning)
+            {
+                return LogType.Log;
+            }
+
+            return LogType.Warning;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+    using System.IO;
+    using System.Text;
+    using Epic.OnlineServices.Logging;
+
+    /// <summary>
+    /// A single decoded entry of an EOS log capture file.
+    /// </summary>
+    public struct EOSLogCaptureEntry
+    {
+        public DateTime Time;
+        public string Category;
+        public LogLevel Level;
+        public string Message;
+
+        /// <summary>
+        /// Whether the message was cut short to fit the log ring buffer.
+        /// </summary>
+        public bool IsTruncated;
+
+        /// <summary>
+        /// Formats the entry the same way EOSManager prints SDK log messages.
+        /// </summary>
+        public override string ToString()
+        {
+            return $"{Time.ToString("O", DateTimeFormatInfo.InvariantInfo)} {Category}({Level}): {Message}{(IsTruncated ? "..." : string.Empty)}";
+        }
+    }
+
+    /// <summary>
+    /// Selects which entries of a capture file are returned by
+    /// <see cref="EOSLogCaptureReader.ReadEntries"/>.
+    /// </summary>
+    public class EOSLogCaptureFilter
+    {
+        /// <summary>
+        /// Entries more verbose than this level are skipped.
+        /// </summary>
+        public LogLevel MaximumLevel = LogLevel.VeryVerbose;
+
+        /// <summary>
+        /// If not empty, only entries in one of these categories are returned.
+        /// </summary>
+        public List<string> Categories = new();
+
+        /// <summary>
+        /// If not empty, only entries whose message contains this text
+        /// (ignoring case) are returned.
+        /// </summary>
+        public string MessageContains;
+
+        /// <summary>
+        /// If set, entries logged before this time (local) are skipped.
+        /// </summary>
+        public DateTime? From;
+
+        /// <summary>
+        /// If set, entries logged after this time (local) are skipped.
+        /// </summary>
+        public DateTime? To;
+
+        public bool Matches(DateTime time, string category, LogLevel level)
+        {
+            if (level > MaximumLevel)
+            {
+                return false;
+            }
+
+            if (Categories is { Count: > 0 } && !Categories.Contains(category))
+            {
+                return false;
+            }
+
+            if (From.HasValue && time < From.Value)
+            {
+                return false;
+            }
+
+            if (To.HasValue && time > To.Value)
+            {
+                return false;
+            }
+
+            return true;
+        }
+
+        public bool Matches(string message)
+        {
+            return string.IsNullOrEmpty(MessageContains) ||
+                   message.IndexOf(MessageContains, StringComparison.OrdinalIgnoreCase) >= 0;
+        }
+    }
+
+    /// <summary>
+    /// Decodes capture files written by <see cref="EOSLogCaptureWriter"/>.
+    /// Has no dependency on the EOS SDK being loaded, so it can be used
+    /// offline (for instance from the editor, or a batch mode invocation) to
+    /// inspect captures pulled from a production machine.
+    ///
+    /// The file is streamed while entries are enumerated rather than read
+    /// into memory, so captures of long sessions can be decoded with a small,
+    /// fixed amount of memory.
+    /// </summary>
+    public sealed class EOSLogCaptureReader
+    {
+        private const int StreamBufferSize = 64 * 1024;
+
+        private readonly string _path;
+        private readonly ushort _version;
+        private readonly long _dataLength;
+        private readonly long _frequency;
+        private readonly long _startTimestamp;
+        private readonly int _headerSize;
+
+        private byte[] _scratch = new byte[LogRingBuffer.DefaultMaxMessageLength];
+
+        /// <summary>
+        /// Local time at which the capture was started.
+        /// </summary>
+        public DateTime StartTime { get; }
+
+        /// <summary>
+        /// Total number of messages that were lost before they could be
+        /// captured. Valid after the entries have been enumerated.
+        /// </summary>
+        public long DroppedCount { get; private set; }
+
+        public EOSLogCaptureReader(string path)
+        {
+            _path = path;
+
+            using FileStream stream = OpenRead(path, EOSLogCaptureFormat.HeaderSize);
+            using BinaryReader reader = new(stream);
+
+            if (stream.Length < EOSLogCaptureFormat.HeaderSize ||
+                reader.ReadUInt32() != EOSLogCaptureFormat.Magic)
+            {
+                throw new InvalidDataException($"\"{path}\" is not an EOS log capture file.");
+            }
+
+            _version = reader.ReadUInt16();
+            if (_version > EOSLogCaptureFormat.Version)
+            {
+                throw new InvalidDataException($"\"{path}\" has unsupported capture version {_version}.");
+            }
+
+            _headerSize = reader.ReadUInt16();
+            StartTime = new DateTime(reader.ReadInt64(), DateTimeKind.Utc).ToLocalTime();
+            _frequency = reader.ReadInt64();
+            _startTimestamp = reader.ReadInt64();
+
+            // The length in the header only covers fully flushed records,
+            // which matters for captures of processes that crashed.
+            _dataLength = Math.Min(_headerSize + reader.ReadInt64(), stream.Length);
+        }
+
+        /// <summary>
+        /// Decodes the entries of the capture, in the order they were logged.
+        /// </summary>
+        /// <param name="filter">Optional filter; null returns everything.</param>
+        public IEnumerable<EOSLogCaptureEntry> ReadEntries(EOSLogCaptureFilter filter = null)
+        {
+            Dictionary<ulong, string> categories = new();
+            long timestamp = _startTimestamp;
+            DroppedCount = 0;
+
+            using FileStream file = OpenRead(_path, 0);
+            using BufferedStream stream = new(file, StreamBufferSize);
+            using BinaryReader reader = new(stream, Encoding.UTF8);
+
+            stream.Position = _headerSize;
+            long position = _headerSize;
+
+            while (position < _dataLength)
+            {
+                byte type = reader.ReadByte();
+                ++position;
+
+                switch (type)
+                {
+                    case EOSLogCaptureFormat.CategoryRecord:
+                    {
+                        ulong id = ReadVarint(reader, ref position);
+                        categories[id] = ReadString(reader, ref position);
+                        break;
+                    }
+                    case EOSLogCaptureFormat.MessageRecord:
+                    {
+                        timestamp += (long)ReadVarint(reader, ref position);
+                        ulong categoryId = ReadVarint(reader, ref position);
+                        byte levelByte = reader.ReadByte();
+                        ++position;
+                        int length = (int)ReadVarint(reader, ref position);
+
+                        bool isTruncated = false;
+                        if (_version >= 2)
+                        {
+                            isTruncated = (levelByte & EOSLogCaptureFormat.TruncatedFlag) != 0;
+                            levelByte &= unchecked((byte)~EOSLogCaptureFormat.TruncatedFlag);
+                        }
+
+                        LogLevel level = (LogLevel)(levelByte * 100);
+                        DateTime time = StartTime.AddTicks(
+                            (long)((timestamp - _startTimestamp) * ((double)TimeSpan.TicksPerSecond / _frequency)));
+                        categories.TryGetValue(categoryId, out string category);
+
+                        // The bytes are read either way, so that skipping a
+                        // message does not discard the stream buffer.
+                        ReadBytes(reader, length, ref position);
+
+                        if (filter != null && !filter.Matches(time, category, level))
+                        {
+                            break;
+                        }
+
+                        string message = Encoding.UTF8.GetString(_scratch, 0, length);
+
+                        if (filter != null && !filter.Matches(message))
+                        {
+                            break;
+                        }
+
+                        yield return new EOSLogCaptureEntry
+                        {
+                            Time = time,
+                            Category = category ?? string.Empty,
+                            Level = level,
+                            Message = message,
+                            IsTruncated = isTruncated
+                        };
+                        break;
+                    }
+                    case EOSLogCaptureFormat.DroppedRecord:
+                        DroppedCount += (long)ReadVarint(reader, ref position);
+                        break;
+                    default:
+                        throw new InvalidDataException($"Unknown record type {type} at offset {position - 1}.");
+                }
+            }
+        }
+
+        /// <summary>
+        /// Decodes a capture file into the plain text format printed by
+        /// EOSManager.
+        /// </summary>
+        /// <param name="inputPath">Path of the capture file.</param>
+        /// <param name="outputPath">Path of the text file to write.</param>
+        /// <param name="filter">Optional filter; null writes everything.</param>
+        /// <returns>The number of entries written.</returns>
+        public static int DecodeToText(string inputPath, string outputPath, EOSLogCaptureFilter filter = null)
+        {
+            EOSLogCaptureReader reader = new(inputPath);
+            int count = 0;
+
+            using (StreamWriter writer = new(outputPath, false, new UTF8Encoding(false)))
+            {
+                foreach (EOSLogCaptureEntry entry in reader.ReadEntries(filter))
+                {
+                    writer.WriteLine(entry.ToString());
+                    ++count;
+                }
+
+                if (reader.DroppedCount > 0)
+                {
+                    writer.WriteLine($"[{reader.DroppedCount} message(s) were dropped during capture]");
+                }
+            }
+
+            return count;
+        }
+
+        private static FileStream OpenRead(string path, int bufferSize)
+        {
+            // Captures are shared for reading while they are being written.
+            return new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete, Math.Max(1, bufferSize));
+        }
+
+        private static ulong ReadVarint(BinaryReader reader, ref long position)
+        {
+            ulong value = 0;
+            int shift = 0;
+            byte current;
+
+            do
+            {
+                current = reader.ReadByte();
+                ++position;
+                value |= (ulong)(current & 0x7F) << shift;
+                shift += 7;
+            } while ((current & 0x80) != 0);
+
+            return value;
+        }
+
+        /// <summary>
+        /// Reads <paramref name="length"/> bytes into the scratch buffer.
+        /// </summary>
+        private void ReadBytes(BinaryReader reader, int length, ref long position)
+        {
+            if (length < 0 || position + length > _dataLength)
+            {
+                throw new InvalidDataException($"Record at offset {position} extends past the end of the capture.");
+            }
+
+            if (_scratch.Length < length)
+            {
+                _scratch = new byte[length];
+            }
+
+            int offset = 0;
+            while (offset < length)
+            {
+                int read = reader.Read(_scratch, offset, length - offset);
+                if (read <= 0)
+                {
+                    throw new EndOfStreamException();
+                }
+
+                offset += read;
+            }
+
+            position += length;
+        }
+
+        private string ReadString(BinaryReader reader, ref long position)
+        {
+            int length = (int)ReadVarint(reader, ref position);
+            ReadBytes(reader, length, ref position);
+            return Encoding.UTF8.GetString(_scratch, 0, length);
+        }
+    }
+}
+
+#endif
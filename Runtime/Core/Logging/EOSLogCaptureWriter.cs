@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Diagnostics;
+    using System.IO;
+    using System.IO.MemoryMappedFiles;
+    using Epic.OnlineServices.Logging;
+
+    /// <summary>
+    /// Describes the layout of an EOS log capture file.
+    ///
+    /// A capture file is a fixed size header followed by an append-only
+    /// stream of records. All integers are little-endian, and variable length
+    /// integers are LEB128 encoded.
+    ///
+    /// <code>
+    /// Header (64 bytes):
+    ///     u32 magic ("EOSL"), u16 version, u16 header size,
+    ///     i64 start time (UTC DateTime ticks),
+    ///     i64 Stopwatch frequency, i64 Stopwatch timestamp at start,
+    ///     i64 length of the record stream in bytes, reserved padding.
+    /// Category record:  u8 type (1), varint id, varint length, UTF-8 bytes.
+    /// Message record:   u8 type (2), varint timestamp delta (Stopwatch ticks
+    ///                   since the previous message), varint category id,
+    ///                   u8 level / 100 (bit 7 set if the message was
+    ///                   truncated), varint length, UTF-8 bytes.
+    /// Dropped record:   u8 type (3), varint number of messages lost.
+    /// </code>
+    ///
+    /// Version 1 files have no truncation bit.
+    /// </summary>
+    public static class EOSLogCaptureFormat
+    {
+        public const uint Magic = 0x4C534F45; // "EOSL"
+        public const ushort Version = 2;
+        public const int HeaderSize = 64;
+        public const int DataLengthOffset = 32;
+
+        public const byte CategoryRecord = 1;
+        public const byte MessageRecord = 2;
+        public const byte DroppedRecord = 3;
+
+        /// <summary>
+        /// Set in the level byte of a message record when the message was
+        /// truncated to fit the ring buffer.
+        /// </summary>
+        public const byte TruncatedFlag = 0x80;
+
+        /// <summary>
+        /// Extension used for capture files.
+        /// </summary>
+        public const string FileExtension = ".eoslog";
+    }
+
+    /// <summary>
+    /// Writes EOS SDK log records to a compact, append-only binary capture
+    /// file through a memory-mapped view. Records are staged in memory and
+    /// copied into the mapped view on <see cref="Flush"/>, which leaves
+    /// writing the pages to disk to the operating system, so the data
+    /// survives a crash of the process without the cost of a synchronous
+    /// write per message.
+    /// </summary>
+    public sealed class EOSLogCaptureWriter : IDisposable
+    {
+        private const long InitialCapacity = 4 * 1024 * 1024;
+        private const int StagingBufferSize = 64 * 1024;
+
+        private readonly string _path;
+        private MemoryMappedFile _file;
+        private MemoryMappedViewAccessor _view;
+        private long _capacity;
+
+        /// <summary>
+        /// Position of the next record, relative to the start of the file.
+        /// </summary>
+        private long _position = EOSLogCaptureFormat.HeaderSize;
+
+        private byte[] _staging = new byte[StagingBufferSize];
+        private int _stagingLength;
+
+        private long _previousTimestamp;
+        private readonly LogCategoryMap<int> _categoryIds = new();
+
+        public EOSLogCaptureWriter(string path)
+        {
+            _path = path;
+
+            string directory = Path.GetDirectoryName(Path.GetFullPath(path));
+            if (!string.IsNullOrEmpty(directory))
+            {
+                Directory.CreateDirectory(directory);
+            }
+
+            // Each capture starts a fresh file.
+            if (File.Exists(path))
+            {
+                File.Delete(path);
+            }
+
+            Map(InitialCapacity);
+
+            _previousTimestamp = Stopwatch.GetTimestamp();
+
+            _view.Write(0, EOSLogCaptureFormat.Magic);
+            _view.Write(4, EOSLogCaptureFormat.Version);
+            _view.Write(6, (ushort)EOSLogCaptureFormat.HeaderSize);
+            _view.Write(8, DateTime.UtcNow.Ticks);
+            _view.Write(16, Stopwatch.Frequency);
+            _view.Write(24, _previousTimestamp);
+            _view.Write(EOSLogCaptureFormat.DataLengthOffset, 0L);
+        }
+
+        /// <summary>
+        /// Path of the capture file.
+        /// </summary>
+        public string FilePath
+        {
+            get { return _path; }
+        }
+
+        /// <summary>
+        /// Number of bytes of records written so far.
+        /// </summary>
+        public long Length
+        {
+            get { return _position + _stagingLength - EOSLogCaptureFormat.HeaderSize; }
+        }
+
+        /// <summary>
+        /// Appends a log record. The category is written to the file the
+        /// first time it is seen, after which it is referred to by id.
+        /// </summary>
+        /// <param name="record">The record to write.</param>
+        public void Write(in LogRecord record)
+        {
+            if (!_categoryIds.TryGetValue(in record, out int categoryId))
+            {
+                categoryId = _categoryIds.Count;
+                _categoryIds.Add(in record, categoryId);
+
+                ArraySegment<byte> category = record.Category;
+                Reserve(1 + 5 + 5 + category.Count);
+                WriteByte(EOSLogCaptureFormat.CategoryRecord);
+                WriteVarint((ulong)categoryId);
+                WriteBytes(category);
+            }
+
+            ArraySegment<byte> message = record.Message;
+            Reserve(1 + 10 + 5 + 1 + 5 + message.Count);
+
+            long delta = Math.Max(0, record.Timestamp - _previousTimestamp);
+            _previousTimestamp = Math.Max(_previousTimestamp, record.Timestamp);
+
+            WriteByte(EOSLogCaptureFormat.MessageRecord);
+            WriteVarint((ulong)delta);
+            WriteVarint((ulong)categoryId);
+            byte level = (byte)((int)record.Level / 100);
+            WriteByte(record.IsTruncated ? (byte)(level | EOSLogCaptureFormat.TruncatedFlag) : level);
+            WriteBytes(message);
+        }
+
+        /// <summary>
+        /// Records that messages were lost before they reached the writer.
+        /// </summary>
+        /// <param name="count">The number of lost messages.</param>
+        public void WriteDropped(long count)
+        {
+            if (count <= 0)
+            {
+                return;
+            }
+
+            Reserve(1 + 10);
+            WriteByte(EOSLogCaptureFormat.DroppedRecord);
+            WriteVarint((ulong)count);
+        }
+
+        /// <summary>
+        /// Copies staged records into the mapped view and publishes the new
+        /// length in the header.
+        /// </summary>
+        public void Flush()
+        {
+            if (_stagingLength == 0 || _view == null)
+            {
+                return;
+            }
+
+            long required = _position + _stagingLength;
+            if (required > _capacity)
+            {
+                long capacity = _capacity;
+                while (capacity < required)
+                {
+                    capacity *= 2;
+                }
+
+                Map(capacity);
+            }
+
+            _view.WriteArray(_position, _staging, 0, _stagingLength);
+            _position += _stagingLength;
+            _stagingLength = 0;
+
+            // Written last, so that a reader never sees a length that covers
+            // partially written records.
+            _view.Write(EOSLogCaptureFormat.DataLengthOffset, _position - EOSLogCaptureFormat.HeaderSize);
+        }
+
+        /// <summary>
+        /// Flushes, unmaps, and trims the file to the length of the data.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_view == null)
+            {
+                return;
+            }
+
+            Flush();
+            _view.Flush();
+            Unmap();
+
+            using FileStream stream = new(_path, FileMode.Open, FileAccess.Write, FileShare.Read);
+            stream.SetLength(_position);
+        }
+
+        private void Map(long capacity)
+        {
+            Unmap();
+
+            _file = MemoryMappedFile.CreateFromFile(_path, FileMode.OpenOrCreate, null, capacity, MemoryMappedFileAccess.ReadWrite);
+            _view = _file.CreateViewAccessor(0, capacity, MemoryMappedFileAccess.ReadWrite);
+            _capacity = capacity;
+        }
+
+        private void Unmap()
+        {
+            _view?.Dispose();
+            _view = null;
+            _file?.Dispose();
+            _file = null;
+        }
+
+        private void Reserve(int count)
+        {
+            if (_stagingLength + count <= _staging.Length)
+            {
+                return;
+            }
+
+            Flush();
+
+            if (count > _staging.Length)
+            {
+                _staging = new byte[count];
+            }
+        }
+
+        private void WriteByte(byte value)
+        {
+            _staging[_stagingLength++] = value;
+        }
+
+        private void WriteVarint(ulong value)
+        {
+            while (value >= 0x80)
+            {
+                _staging[_stagingLength++] = (byte)(value | 0x80);
+                value >>= 7;
+            }
+
+            _staging[_stagingLength++] = (byte)value;
+        }
+
+        private void WriteBytes(ArraySegment<byte> bytes)
+        {
+            WriteVarint((ulong)bytes.Count);
+
+            if (bytes.Count > 0)
+            {
+                Buffer.BlockCopy(bytes.Array, bytes.Offset, _staging, _stagingLength, bytes.Count);
+                _stagingLength += bytes.Count;
+            }
+        }
+    }
+}
+
+#endif
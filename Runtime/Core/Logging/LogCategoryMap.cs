@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Text;
+    using Epic.OnlineServices.Logging;
+
+    /// <summary>
+    /// Maps EOS log categories to values, looking them up by the
+    /// <see cref="LogRecord.CategoryHash"/> of a record without decoding the
+    /// category. The hash only selects a bucket; the category bytes are
+    /// compared on every hit, so two categories whose hashes collide are
+    /// never confused.
+    /// </summary>
+    /// <typeparam name="TValue">Type of the value stored per category.</typeparam>
+    internal sealed class LogCategoryMap<TValue>
+    {
+        private sealed class Node
+        {
+            public byte[] Name;
+            public TValue Value;
+            public Node Next;
+        }
+
+        private readonly Dictionary<int, Node> _buckets = new();
+
+        /// <summary>
+        /// Number of categories in the map.
+        /// </summary>
+        public int Count { get; private set; }
+
+        /// <summary>
+        /// Looks up the value stored for the category of a record.
+        /// </summary>
+        public bool TryGetValue(in LogRecord record, out TValue value)
+        {
+            ArraySegment<byte> category = record.Category;
+
+            if (_buckets.TryGetValue(record.CategoryHash, out Node node))
+            {
+                for (; node != null; node = node.Next)
+                {
+                    if (NameEquals(node.Name, category))
+                    {
+                        value = node.Value;
+                        return true;
+                    }
+                }
+            }
+
+            value = default;
+            return false;
+        }
+
+        /// <summary>
+        /// Stores a value for the category of a record. The category must
+        /// not already be in the map.
+        /// </summary>
+        public void Add(in LogRecord record, TValue value)
+        {
+            ArraySegment<byte> category = record.Category;
+            byte[] name = new byte[category.Count];
+            if (category.Count > 0)
+            {
+                Buffer.BlockCopy(category.Array, category.Offset, name, 0, category.Count);
+            }
+
+            Add(record.CategoryHash, name, value);
+        }
+
+        /// <summary>
+        /// Stores a value for a category given by name, for instance
+        /// "LogEOSP2P". The category must not already be in the map.
+        /// </summary>
+        public void Add(string category, TValue value)
+        {
+            byte[] name = string.IsNullOrEmpty(category) ? Array.Empty<byte>() : Encoding.UTF8.GetBytes(category);
+
+            // Records only keep this many bytes of the category.
+            if (name.Length > LogRingBuffer.MaxCategoryLength)
+            {
+                Array.Resize(ref name, LogRingBuffer.MaxCategoryLength);
+            }
+
+            Add(LogRingBuffer.ComputeCategoryHash(category), name, value);
+        }
+
+        private void Add(int hash, byte[] name, TValue value)
+        {
+            _buckets.TryGetValue(hash, out Node next);
+            _buckets[hash] = new Node { Name = name, Value = value, Next = next };
+            ++Count;
+        }
+
+        private static bool NameEquals(byte[] name, ArraySegment<byte> category)
+        {
+            if (name.Length != category.Count)
+            {
+                return false;
+            }
+
+            for (int index = 0; index < name.Length; ++index)
+            {
+                if (name[index] != category.Array[category.Offset + index])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+}
+
+#endif
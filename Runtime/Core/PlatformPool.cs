@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.IO;
+    using System.Threading;
+    using Epic.OnlineServices.Platform;
+    using Utility;
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Creates and ticks many EOS platforms in one process, each with its own
+    /// users, P2P sockets and callbacks. Used for load testing, and for
+    /// servers hosting several matches per process.
+    ///
+    /// The platforms are independent of the one owned by
+    /// <see cref="EOSManager"/>, but the SDK must have been initialized by it
+    /// before the pool is created. Platforms are either ticked one after
+    /// another on the thread calling <see cref="Tick"/>, in a rotating order
+    /// so that a time budget is shared fairly between them, or in parallel
+    /// on a set of worker threads. In parallel mode each platform is always
+    /// ticked by the same worker, so its callbacks always run on that worker.
+    /// </summary>
+    public class PlatformPool : IDisposable
+    {
+        public enum TickMode
+        {
+            /// <summary>
+            /// Platforms are ticked on the thread calling
+            /// <see cref="PlatformPool.Tick"/>, one after another.
+            /// </summary>
+            RoundRobin,
+
+            /// <summary>
+            /// Platforms are ticked on worker threads, and
+            /// <see cref="PlatformPool.Tick"/> waits for all of them.
+            /// </summary>
+            Parallel
+        }
+
+        /// <summary>
+        /// Settings that control how the platforms of the pool are ticked.
+        /// </summary>
+        public class Settings
+        {
+            public TickMode Mode = TickMode.RoundRobin;
+
+            /// <summary>
+            /// In round robin mode, the time after which a call to
+            /// <see cref="PlatformPool.Tick"/> stops ticking platforms; the
+            /// next call carries on from the next platform. Zero or less
+            /// ticks every platform on every call.
+            /// </summary>
+            public float RoundRobinBudgetMilliseconds = 0;
+
+            /// <summary>
+            /// In parallel mode, the number of worker threads. Zero or less
+            /// uses one less than the number of processors.
+            /// </summary>
+            public int WorkerCount = 0;
+        }
+
+        private readonly Settings _settings;
+        private readonly List<PooledPlatform> _platforms = new();
+        private readonly Stopwatch _roundRobinStopwatch = new();
+        private int _nextRoundRobinIndex;
+
+        private Thread[] _workers;
+        private AutoResetEvent[] _workerSignals;
+        private CountdownEvent _pendingWorkers;
+        private volatile bool _disposed;
+
+        /// <summary>
+        /// The platforms of the pool.
+        /// </summary>
+        public IReadOnlyList<PooledPlatform> Platforms
+        {
+            get
+            {
+                return _platforms;
+            }
+        }
+
+        private PlatformPool(Settings settings)
+        {
+            _settings = settings ?? new Settings();
+        }
+
+        /// <summary>
+        /// Creates a pool of platforms.
+        /// </summary>
+        /// <param name="count">Number of platforms to create.</param>
+        /// <param name="settings">
+        /// How the platforms are ticked, or null for the defaults.
+        /// </param>
+        /// <param name="getCreateOptions">
+        /// Returns the options to create the platform with the given index.
+        /// If null, the options of the EOSManager platform are used, with
+        /// the overlay disabled and a cache directory for each platform.
+        /// </param>
+        /// <returns>
+        /// The pool, or null if the SDK hasn't been initialized or a platform
+        /// couldn't be created.
+        /// </returns>
+        public static PlatformPool Create(int count, Settings settings = null, Func<int, EOSCreateOptions> getCreateOptions = null)
+        {
+            if (EOSManager.Instance.GetEOSPlatformInterface() == null)
+            {
+                Debug.LogError("PlatformPool: The EOS SDK must be initialized by the EOSManager before creating a pool of platforms.");
+                return null;
+            }
+
+            PlatformPool pool = new(settings);
+            getCreateOptions ??= GetDefaultCreateOptions;
+
+            for (int i = 0; i < count; ++i)
+            {
+                EOSCreateOptions createOptions = getCreateOptions(i);
+                PlatformInterface platform = PlatformInterface.Create(ref createOptions.options);
+
+#if !(UNITY_STANDALONE_WIN || UNITY_EDITOR_WIN || UNITY_STANDALONE_LINUX || UNITY_EDITOR_LINUX || UNITY_STANDALONE_OSX || UNITY_EDITOR_OSX)
+                createOptions.options.IntegratedPlatformOptionsContainerHandle?.Release();
+#endif
+
+                if (platform == null)
+                {
+                    Debug.LogError($"PlatformPool: Failed to create platform {i} of {count}.");
+                    pool.Dispose();
+                    return null;
+                }
+
+                pool._platforms.Add(new PooledPlatform(i, platform));
+            }
+
+            if (pool._settings.Mode == TickMode.Parallel)
+            {
+                pool.StartWorkers();
+            }
+
+            // The pool must be released before the EOSManager shuts the SDK down
+            EOSManager.Instance.RegisterPlatformPool(pool);
+
+            return pool;
+        }
+
+        /// <summary>
+        /// Gets the create options of the EOSManager platform, adjusted so
+        /// that several platforms can run side by side.
+        /// </summary>
+        public static EOSCreateOptions GetDefaultCreateOptions(int index)
+        {
+            EOSCreateOptions createOptions = ConfigurationUtility.GetEOSCreateOptions();
+
+            // Separate caches keep the persisted state of each platform apart
+            createOptions.options.CacheDirectory = Path.Combine(createOptions.options.CacheDirectory, "PlatformPool", index.ToString());
+            createOptions.options.Flags |= PlatformFlags.DisableOverlay | PlatformFlags.DisableSocialOverlay;
+
+            return createOptions;
+        }
+
+        /// <summary>
+        /// Ticks the platforms of the pool. Must not be called again before
+        /// it returns.
+        /// </summary>
+        public void Tick()
+        {
+            if (_disposed || _platforms.Count == 0)
+            {
+                return;
+            }
+
+            if (_workers != null)
+            {
+                _pendingWorkers.Reset(_workers.Length);
+                foreach (AutoResetEvent signal in _workerSignals)
+                {
+                    signal.Set();
+                }
+                _pendingWorkers.Wait();
+                return;
+            }
+
+            _roundRobinStopwatch.Restart();
+
+            for (int ticked = 0; ticked < _platforms.Count; ++ticked)
+            {
+                _platforms[_nextRoundRobinIndex].Tick();
+                _nextRoundRobinIndex = (_nextRoundRobinIndex + 1) % _platforms.Count;
+
+                if (_settings.RoundRobinBudgetMilliseconds > 0 &&
+                    _roundRobinStopwatch.Elapsed.TotalMilliseconds >= _settings.RoundRobinBudgetMilliseconds)
+                {
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// The counters of all the platforms of the pool added together.
+        /// </summary>
+        public PooledPlatform.Statistics GetTotalStatistics()
+        {
+            PooledPlatform.Statistics total = new();
+
+            foreach (PooledPlatform platform in _platforms)
+            {
+                PooledPlatform.Statistics statistics = platform.CurrentStatistics;
+                total.Ticks += statistics.Ticks;
+                total.TotalTickMilliseconds += statistics.TotalTickMilliseconds;
+                total.LastTickMilliseconds += statistics.LastTickMilliseconds;
+                total.MaxTickMilliseconds = Math.Max(total.MaxTickMilliseconds, statistics.MaxTickMilliseconds);
+                total.AllocatedManagedBytes += statistics.AllocatedManagedBytes;
+                total.PostedActions += statistics.PostedActions;
+            }
+
+            return total;
+        }
+
+        /// <summary>
+        /// Stops the workers and releases every platform of the pool. The
+        /// EOSManager calls this for every pool that is still alive when it
+        /// shuts down, after which this does nothing.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            _disposed = true;
+            EOSManager.Instance.UnregisterPlatformPool(this);
+
+            if (_workers != null)
+            {
+                foreach (AutoResetEvent signal in _workerSignals)
+                {
+                    signal.Set();
+                }
+
+                foreach (Thread worker in _workers)
+                {
+                    worker.Join();
+                }
+
+                foreach (AutoResetEvent signal in _workerSignals)
+                {
+                    signal.Dispose();
+                }
+
+                _pendingWorkers.Dispose();
+                _workers = null;
+            }
+
+            foreach (PooledPlatform platform in _platforms)
+            {
+                platform.Release();
+            }
+
+            _platforms.Clear();
+        }
+
+        private void StartWorkers()
+        {
+            int workerCount = _settings.WorkerCount > 0 ? _settings.WorkerCount : Environment.ProcessorCount - 1;
+            workerCount = Math.Max(1, Math.Min(workerCount, _platforms.Count));
+
+            _workers = new Thread[workerCount];
+            _workerSignals = new AutoResetEvent[workerCount];
+            _pendingWorkers = new CountdownEvent(workerCount);
+
+            for (int i = 0; i < workerCount; ++i)
+            {
+                int workerIndex = i;
+                _workerSignals[i] = new AutoResetEvent(false);
+                _workers[i] = new Thread(() => RunWorker(workerIndex))
+                {
+                    IsBackground = true,
+                    Name = $"EOS PlatformPool {workerIndex}"
+                };
+                _workers[i].Start();
+            }
+        }
+
+        private void RunWorker(int workerIndex)
+        {
+            int workerCount = _workers.Length;
+
+            while (true)
+            {
+                _workerSignals[workerIndex].WaitOne();
+
+                if (_disposed)
+                {
+                    return;
+                }
+
+                try
+                {
+                    // Each platform always belongs to the same worker
+                    for (int i = workerIndex; i < _platforms.Count; i += workerCount)
+                    {
+                        _platforms[i].Tick();
+                    }
+                }
+                catch (Exception e)
+                {
+                    Debug.LogException(e);
+                }
+                finally
+                {
+                    _pendingWorkers.Signal();
+                }
+            }
+        }
+    }
+}
+
+#endif
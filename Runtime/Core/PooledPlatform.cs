@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !EOS_DISABLE
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Concurrent;
+    using System.Diagnostics;
+    using Epic.OnlineServices.Platform;
+
+    /// <summary>
+    /// One of the platforms created by a <see cref="PlatformPool"/>, with its
+    /// own users, sockets and callbacks, and its own tick accounting.
+    ///
+    /// All the calls to the platform must be made from the thread that ticks
+    /// it, which is also the thread its callbacks run on. Code running
+    /// elsewhere can get onto that thread with <see cref="Post"/>.
+    /// </summary>
+    public class PooledPlatform
+    {
+        /// <summary>
+        /// Tick time and allocation counters of a platform.
+        /// </summary>
+        public struct Statistics
+        {
+            /// <summary>
+            /// Number of times the platform has been ticked.
+            /// </summary>
+            public long Ticks;
+
+            /// <summary>
+            /// Total time spent ticking the platform and running the actions
+            /// posted to it, in milliseconds.
+            /// </summary>
+            public double TotalTickMilliseconds;
+
+            /// <summary>
+            /// Duration of the last tick in milliseconds.
+            /// </summary>
+            public double LastTickMilliseconds;
+
+            /// <summary>
+            /// Duration of the longest tick in milliseconds.
+            /// </summary>
+            public double MaxTickMilliseconds;
+
+            /// <summary>
+            /// Managed memory allocated while ticking the platform, which
+            /// includes the allocations of its callbacks. The native memory of
+            /// the SDK goes through allocators shared by every platform in
+            /// the process, so can't be split by platform.
+            /// </summary>
+            public long AllocatedManagedBytes;
+
+            /// <summary>
+            /// Number of actions posted to the platform that have run.
+            /// </summary>
+            public long PostedActions;
+        }
+
+        /// <summary>
+        /// Index of the platform in its pool.
+        /// </summary>
+        public int Index { get; }
+
+        /// <summary>
+        /// The platform. Only call it from the thread that ticks it.
+        /// </summary>
+        public PlatformInterface Platform { get; private set; }
+
+        /// <summary>
+        /// Free for the owner of the pool to associate its own state, such as
+        /// the user logged in on the platform, with the platform.
+        /// </summary>
+        public object UserData { get; set; }
+
+        /// <summary>
+        /// Invoked on the ticking thread after each tick of the platform.
+        /// </summary>
+        public event Action<PooledPlatform> Ticked;
+
+        private readonly ConcurrentQueue<Action<PooledPlatform>> _postedActions = new();
+        private readonly Stopwatch _stopwatch = new();
+        private Statistics _statistics;
+        private readonly object _statisticsLock = new();
+
+        internal PooledPlatform(int index, PlatformInterface platform)
+        {
+            Index = index;
+            Platform = platform;
+        }
+
+        /// <summary>
+        /// A copy of the counters of the platform. Safe to call from any
+        /// thread.
+        /// </summary>
+        public Statistics CurrentStatistics
+        {
+            get
+            {
+                lock (_statisticsLock)
+                {
+                    return _statistics;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Runs an action on the thread that ticks the platform, before its
+        /// next tick. Safe to call from any thread.
+        /// </summary>
+        public void Post(Action<PooledPlatform> action)
+        {
+            _postedActions.Enqueue(action);
+        }
+
+        /// <summary>
+        /// Runs the posted actions and ticks the platform.
+        /// </summary>
+        internal void Tick()
+        {
+            if (Platform == null)
+            {
+                return;
+            }
+
+            long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+            long postedActions = 0;
+            _stopwatch.Restart();
+
+            while (_postedActions.TryDequeue(out Action<PooledPlatform> action))
+            {
+                try
+                {
+                    action(this);
+                }
+                catch (Exception e)
+                {
+                    UnityEngine.Debug.LogException(e);
+                }
+                postedActions++;
+            }
+
+            Platform.Tick();
+
+            try
+            {
+                Ticked?.Invoke(this);
+            }
+            catch (Exception e)
+            {
+                UnityEngine.Debug.LogException(e);
+            }
+
+            _stopwatch.Stop();
+            double tickMilliseconds = _stopwatch.Elapsed.TotalMilliseconds;
+            long allocated = GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+
+            lock (_statisticsLock)
+            {
+                _statistics.Ticks++;
+                _statistics.TotalTickMilliseconds += tickMilliseconds;
+                _statistics.LastTickMilliseconds = tickMilliseconds;
+                _statistics.MaxTickMilliseconds = Math.Max(_statistics.MaxTickMilliseconds, tickMilliseconds);
+                _statistics.AllocatedManagedBytes += allocated;
+                _statistics.PostedActions += postedActions;
+            }
+        }
+
+        internal void Release()
+        {
+            Platform?.Release();
+            Platform = null;
+        }
+    }
+}
+
+#endif
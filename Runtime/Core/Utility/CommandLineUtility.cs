@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Utility
+{
+    using System;
+
+    /// <summary>
+    /// Reads options given on the command line as <c>-Name value</c>.
+    /// Names are matched ignoring case.
+    /// </summary>
+    public static class CommandLineUtility
+    {
+        /// <summary>
+        /// Looks for an option on the command line.
+        /// </summary>
+        /// <param name="name">Name of the option, with its leading dash.</param>
+        /// <param name="value">
+        /// The argument following the option, or null if there is none or if
+        /// it is another option.
+        /// </param>
+        /// <returns>False if the option isn't on the command line.</returns>
+        public static bool TryGetValue(string name, out string value)
+        {
+            string[] arguments = Environment.GetCommandLineArgs();
+            for (int i = 0; i < arguments.Length; ++i)
+            {
+                if (string.Equals(arguments[i], name, StringComparison.OrdinalIgnoreCase))
+                {
+                    value = i + 1 < arguments.Length && !arguments[i + 1].StartsWith("-") ? arguments[i + 1] : null;
+                    return true;
+                }
+            }
+
+            value = null;
+            return false;
+        }
+
+        /// <summary>
+        /// Gets the value of an option on the command line.
+        /// </summary>
+        /// <param name="name">Name of the option, with its leading dash.</param>
+        /// <returns>
+        /// The argument following the option, or null if the option or its
+        /// value is missing.
+        /// </returns>
+        public static string GetValue(string name)
+        {
+            TryGetValue(name, out string value);
+            return value;
+        }
+    }
+}
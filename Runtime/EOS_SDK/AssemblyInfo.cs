@@ -0,0 +1,6 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System.Runtime.CompilerServices;
+
+// Lets the editor benchmarks measure the internal marshalling helpers directly.
+[assembly: InternalsVisibleTo("com.playeveryware.eos-Editor")]
@@ -0,0 +1,233 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Epic.OnlineServices
+{
+	// See Helper.cs, IntPtr keys may allocate on comparison in some runtimes.
+	using PointerType = UInt64;
+
+	public sealed partial class Helper
+	{
+		/// <summary>
+		/// Writes a structure to native memory.
+		/// </summary>
+		private delegate void StructureWriter<T>(ref T value, IntPtr destination);
+
+		/// <summary>
+		/// Per type marshalling information, computed once per <typeparamref name="T"/>.
+		/// Blittable types have the same layout in managed and native memory, so they can be copied directly
+		/// rather than going through <see cref="Marshal.PtrToStructure(IntPtr, Type)" /> and <see cref="Marshal.StructureToPtr(object, IntPtr, bool)" />,
+		/// which look up the layout by reflection and box the value on every call.
+		/// </summary>
+		/// <typeparam name="T">The type to marshal.</typeparam>
+		internal static class MarshalInfo<T>
+		{
+			/// <summary>
+			/// Whether <typeparamref name="T"/> can be copied directly to and from native memory.
+			/// </summary>
+			public static readonly bool IsBlittable;
+
+			/// <summary>
+			/// The native size of <typeparamref name="T"/>, or 0 if it is not a value type.
+			/// </summary>
+			public static readonly int Size;
+
+			static MarshalInfo()
+			{
+				Type type = typeof(T);
+				if (!type.IsValueType)
+				{
+					return;
+				}
+
+				Size = Marshal.SizeOf(type.IsEnum ? Enum.GetUnderlyingType(type) : type);
+
+				// The runtime only pins blittable values, which makes this the cheapest reliable way to ask.
+				try
+				{
+					GCHandle handle = GCHandle.Alloc(default(T), GCHandleType.Pinned);
+					handle.Free();
+					IsBlittable = true;
+				}
+				catch (ArgumentException)
+				{
+					IsBlittable = false;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Cached delegates over the struct constrained fast paths, so generic code without the constraint can be handed them.
+		/// </summary>
+		private static class StructureAccess<T>
+			where T : struct
+		{
+			public static readonly StructureWriter<T> Write = WriteStructure;
+		}
+
+		/// <summary>
+		/// Reads a <typeparamref name="T"/> from native memory, directly if it is blittable.
+		/// </summary>
+		internal static T ReadStructure<T>(IntPtr source)
+			where T : struct
+		{
+			if (MarshalInfo<T>.IsBlittable)
+			{
+				unsafe
+				{
+					return MemoryMarshal.Read<T>(new ReadOnlySpan<byte>(source.ToPointer(), MarshalInfo<T>.Size));
+				}
+			}
+
+			if (typeof(T).IsEnum)
+			{
+				return (T)Marshal.PtrToStructure(source, Enum.GetUnderlyingType(typeof(T)));
+			}
+
+			return (T)Marshal.PtrToStructure(source, typeof(T));
+		}
+
+		/// <summary>
+		/// Writes a <typeparamref name="T"/> to native memory, directly if it is blittable.
+		/// </summary>
+		internal static void WriteStructure<T>(ref T value, IntPtr destination)
+			where T : struct
+		{
+			if (MarshalInfo<T>.IsBlittable)
+			{
+				unsafe
+				{
+					MemoryMarshal.Write(new Span<byte>(destination.ToPointer(), MarshalInfo<T>.Size), ref value);
+				}
+
+				return;
+			}
+
+			Marshal.StructureToPtr(value, destination, false);
+		}
+
+		/// <summary>
+		/// Allocates native memory for a single structure and writes it, keeping <paramref name="value"/> as the allocation's cache.
+		/// </summary>
+		private static IntPtr AddStructAllocation<T>(T value)
+			where T : struct
+		{
+			int size = MarshalInfo<T>.Size;
+			if (size == 0)
+			{
+				return IntPtr.Zero;
+			}
+
+			IntPtr pointer = Marshal.AllocHGlobal(size);
+			WriteStructure(ref value, pointer);
+
+			lock (s_Allocations)
+			{
+				s_Allocations.Add((PointerType)pointer, new Allocation(size, value));
+			}
+
+			return pointer;
+		}
+
+		/// <summary>
+		/// Allocates native memory for an array of structures.
+		/// Blittable arrays that are not item allocated are written with a single copy.
+		/// </summary>
+		private static IntPtr AddStructArrayAllocation<T>(T[] array, bool isArrayItemAllocated)
+			where T : struct
+		{
+			if (array == null)
+			{
+				return IntPtr.Zero;
+			}
+
+			if (isArrayItemAllocated)
+			{
+				return AddContiguousAllocation(array, StructureAccess<T>.Write);
+			}
+
+			if (!MarshalInfo<T>.IsBlittable)
+			{
+				return AddAllocation(array, false);
+			}
+
+			IntPtr newArrayPointer = AddAllocation(array.Length * MarshalInfo<T>.Size, array, false);
+			if (newArrayPointer != IntPtr.Zero)
+			{
+				unsafe
+				{
+					MemoryMarshal.AsBytes(new ReadOnlySpan<T>(array)).CopyTo(new Span<byte>(newArrayPointer.ToPointer(), array.Length * MarshalInfo<T>.Size));
+				}
+			}
+
+			return newArrayPointer;
+		}
+
+		/// <summary>
+		/// Reads an array of structures from native memory.
+		/// Blittable arrays that are not item allocated are read with a single copy.
+		/// </summary>
+		private static void GetStructArrayAllocation<T>(IntPtr from, out T[] to, int arrayLength, bool isArrayItemAllocated)
+			where T : struct
+		{
+			to = null;
+
+			if (from == IntPtr.Zero)
+			{
+				return;
+			}
+
+			// If this is an allocation containing cached data, we should be able to fetch it from the cache
+			object allocationCache;
+			if (TryGetAllocationCache(from, out allocationCache) && allocationCache != null)
+			{
+				if (allocationCache.GetType() != typeof(T[]))
+				{
+					throw new CachedTypeAllocationException(from, allocationCache.GetType(), typeof(T[]));
+				}
+
+				var cachedArray = (T[])allocationCache;
+				if (cachedArray.Length != arrayLength)
+				{
+					throw new CachedArrayAllocationException(from, cachedArray.Length, arrayLength);
+				}
+
+				to = cachedArray;
+				return;
+			}
+
+			to = new T[arrayLength];
+
+			if (isArrayItemAllocated)
+			{
+				int pointerSize = IntPtr.Size;
+				for (int itemIndex = 0; itemIndex < arrayLength; ++itemIndex)
+				{
+					IntPtr itemPointer = Marshal.ReadIntPtr(from, itemIndex * pointerSize);
+					if (itemPointer != IntPtr.Zero)
+					{
+						to[itemIndex] = ReadStructure<T>(itemPointer);
+					}
+				}
+			}
+			else if (MarshalInfo<T>.IsBlittable)
+			{
+				unsafe
+				{
+					var sourceBytes = new ReadOnlySpan<byte>(from.ToPointer(), arrayLength * MarshalInfo<T>.Size);
+					MemoryMarshal.Cast<byte, T>(sourceBytes).CopyTo(to);
+				}
+			}
+			else
+			{
+				int itemSize = MarshalInfo<T>.Size;
+				for (int itemIndex = 0; itemIndex < arrayLength; ++itemIndex)
+				{
+					to[itemIndex] = ReadStructure<T>(new IntPtr(from.ToInt64() + itemIndex * itemSize));
+				}
+			}
+		}
+	}
+}
@@ -10,6 +10,7 @@ namespace Epic.OnlineServices
 	{
 		/// <summary>
 		/// Converts an <see cref="IntPtr" /> to a <see cref="Handle" /> of the specified <typeparamref name="THandle"/>.
+		/// <see cref="ProductUserId" /> and <see cref="EpicAccountId" /> are interned, so the same native id yields the same instance.
 		/// </summary>
 		/// <typeparam name="THandle">The type of <see cref="Handle" /> to convert to.</typeparam>
 		/// <param name="from">The value to convert from.</param>
@@ -19,11 +20,19 @@ namespace Epic.OnlineServices
 		{
 			to = null;
 
-			if (from != IntPtr.Zero)
+			if (from == IntPtr.Zero)
 			{
-				to = new THandle();
-				to.InnerHandle = from;
+				return;
+			}
+
+			if (InternedHandles<THandle>.IsEnabled)
+			{
+				to = InternedHandles<THandle>.Get(from);
+				return;
 			}
+
+			to = new THandle();
+			to.InnerHandle = from;
 		}
 
 		/// <summary>
@@ -55,11 +64,36 @@ namespace Epic.OnlineServices
 				return;
 			}
 
-			to = Encoding.ASCII.GetString(from, 0, GetAnsiStringLength(from));
+			// Copy the bytes up to the terminator rather than round tripping through a string
+			int length = GetAnsiStringLength(from);
+			byte[] bytes = new byte[length + 1];
+			Buffer.BlockCopy(from, 0, bytes, 0, length);
+
+			to = new Utf8String(bytes);
+		}
+
+		/// <summary>
+		/// Converts from a <see cref="Utf8String" /> to a <see cref="byte" />[] of the specified length, for fixed size character fields.
+		/// Uses the already encoded bytes instead of decoding and re-encoding the string, truncating to leave room for the null terminator.
+		/// </summary>
+		/// <param name="from">The value to convert from.</param>
+		/// <param name="to">The converted value.</param>
+		/// <param name="fromLength">The length of the fixed size field, including the null terminator.</param>
+		private static void Convert(Utf8String from, out byte[] to, int fromLength)
+		{
+			ReadOnlySpan<byte> bytes = default;
+
+			if (from != null && from.ReadOnlyBytes != null && fromLength > 0)
+			{
+				bytes = new ReadOnlySpan<byte>(from.ReadOnlyBytes, 0, Math.Min(from.Length, fromLength - 1));
+			}
+
+			to = GetFixedString(bytes, fromLength);
 		}
 
 		/// <summary>
 		/// Converts from a <see cref="string" /> of the specified length to a <see cref="byte" />[].
+		/// The string is encoded on the stack, and truncated to leave room for the null terminator.
 		/// </summary>
 		/// <param name="from">The value to convert from.</param>
 		/// <param name="fromLength">The length to convert from.</param>
@@ -71,9 +105,71 @@ namespace Epic.OnlineServices
 				from = "";
 			}
 
-			to = new byte[fromLength];
-			ASCIIEncoding.ASCII.GetBytes(from, 0, from.Length, to, 0);
-			to[from.Length] = 0;  //  Null terminator at the end'\0'
+			int length = Math.Max(0, Math.Min(from.Length, fromLength - 1));
+			Span<byte> bytes = length <= FixedStringMaxStackLength ? stackalloc byte[length] : new byte[length];
+			ASCIIEncoding.ASCII.GetBytes(from.AsSpan(0, length), bytes);
+
+			to = GetFixedString(bytes, fromLength);
+		}
+
+		/// <summary>
+		/// An array for a fixed size character field kept by <see cref="s_FixedStringCache" />.
+		/// Immutable, so it can be published to other threads without a lock.
+		/// </summary>
+		private sealed class FixedStringEntry
+		{
+			public readonly byte[] Bytes;
+			public readonly int Length;
+
+			public FixedStringEntry(byte[] bytes, int length)
+			{
+				Bytes = bytes;
+				Length = length;
+			}
+		}
+
+		// Fixed size fields (socket names) are only ever read once filled in, by the marshaller, so every conversion of the same text to the
+		// same field size can share one array. Direct mapped by content, since the same few names are converted on every P2P call.
+		private const int FixedStringCacheSize = 64;
+		private const int FixedStringMaxStackLength = 256;
+		private static readonly FixedStringEntry[] s_FixedStringCache = new FixedStringEntry[FixedStringCacheSize];
+
+		/// <summary>
+		/// Gets a null padded array of <paramref name="fieldLength" /> bytes holding <paramref name="content" />, which must be shorter than the field.
+		/// The array is shared and must not be modified.
+		/// </summary>
+		private static byte[] GetFixedString(ReadOnlySpan<byte> content, int fieldLength)
+		{
+			if (fieldLength <= 0)
+			{
+				return Array.Empty<byte>();
+			}
+
+			uint hash = 2166136261;
+			unchecked
+			{
+				for (int index = 0; index < content.Length; ++index)
+				{
+					hash = (hash ^ content[index]) * 16777619;
+				}
+
+				hash = (hash ^ (uint)fieldLength) * 16777619;
+			}
+
+			int slot = (int)(hash & (FixedStringCacheSize - 1));
+			FixedStringEntry entry = s_FixedStringCache[slot];
+
+			if (entry != null && entry.Bytes.Length == fieldLength && entry.Length == content.Length &&
+				content.SequenceEqual(new ReadOnlySpan<byte>(entry.Bytes, 0, entry.Length)))
+			{
+				return entry.Bytes;
+			}
+
+			byte[] bytes = new byte[fieldLength];
+			content.CopyTo(bytes);
+			s_FixedStringCache[slot] = new FixedStringEntry(bytes, content.Length);
+
+			return bytes;
 		}
 
 		/// <summary>
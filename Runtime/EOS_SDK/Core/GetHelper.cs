@@ -90,13 +90,13 @@ namespace Epic.OnlineServices
 		internal static void Get<T>(IntPtr from, out T[] to, uint arrayLength, bool isArrayItemAllocated)
 			where T : struct
 		{
-			GetAllocation(from, out to, (int)arrayLength, isArrayItemAllocated);
+			GetStructArrayAllocation(from, out to, (int)arrayLength, isArrayItemAllocated);
 		}
 
 		internal static void Get<T>(IntPtr from, out T[] to, int arrayLength, bool isArrayItemAllocated)
 			where T : struct
 		{
-			GetAllocation(from, out to, arrayLength, isArrayItemAllocated);
+			GetStructArrayAllocation(from, out to, arrayLength, isArrayItemAllocated);
 		}
 
 		internal static void Get<THandle>(IntPtr from, out THandle to)
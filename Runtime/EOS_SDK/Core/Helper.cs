@@ -65,11 +65,17 @@ namespace Epic.OnlineServices
 
 			public bool? IsArrayItemAllocated { get; private set; }
 
-			public Allocation(int size, object cache, bool? isArrayItemAllocated = null)
+			/// <summary>
+			/// Whether the items of an allocated array live in the same block as its pointer table, rather than in allocations of their own.
+			/// </summary>
+			public bool IsContiguous { get; private set; }
+
+			public Allocation(int size, object cache, bool? isArrayItemAllocated = null, bool isContiguous = false)
 			{
 				Size = size;
 				Cache = cache;
 				IsArrayItemAllocated = isArrayItemAllocated;
+				IsContiguous = isContiguous;
 			}
 		}
 		private struct PinnedBuffer
@@ -164,7 +170,34 @@ namespace Epic.OnlineServices
 
 		private static int GetAnsiStringLength(IntPtr pointer)
 		{
+			const long LowBits = 0x0101010101010101;
+			const long HighBits = unchecked((long)0x8080808080808080);
+
 			int length = 0;
+
+			// Read byte by byte until aligned, aligned word reads can't cross into an unmapped page
+			while (((pointer.ToInt64() + length) & (sizeof(long) - 1)) != 0)
+			{
+				if (Marshal.ReadByte(pointer, length) == 0)
+				{
+					return length;
+				}
+
+				++length;
+			}
+
+			// Then a word at a time until a word contains a zero byte
+			while (true)
+			{
+				long word = Marshal.ReadInt64(pointer, length);
+				if (((word - LowBits) & ~word & HighBits) != 0)
+				{
+					break;
+				}
+
+				length += sizeof(long);
+			}
+
 			while (Marshal.ReadByte(pointer, length) != 0)
 			{
 				++length;
@@ -198,6 +231,16 @@ namespace Epic.OnlineServices
 				}
 			}
 
+			if (MarshalInfo<T>.IsBlittable)
+			{
+				unsafe
+				{
+					target = new ReadOnlySpan<T>(source.ToPointer(), 1)[0];
+				}
+
+				return;
+			}
+
 			target = (T)Marshal.PtrToStructure(source, typeof(T));
 		}
 
@@ -229,14 +272,7 @@ namespace Epic.OnlineServices
 				}
 			}
 
-			if (typeof(T).IsEnum)
-			{
-				target = (T)Marshal.PtrToStructure(source, Enum.GetUnderlyingType(typeof(T)));
-			}
-			else
-			{
-				target = (T?)Marshal.PtrToStructure(source, typeof(T));
-			}
+			target = ReadStructure<T>(source);
 		}
 
 		private static void GetAllocation<THandle>(IntPtr source, out THandle[] target, int arrayLength)
@@ -376,6 +412,8 @@ namespace Epic.OnlineServices
 			int length = GetAnsiStringLength(source);
 
 			// +1 byte for the null terminator.
+			// Native strings are only valid for the duration of the call, so the bytes are copied here,
+			// but decoding them to a string is deferred until the Utf8String is first read.
 			byte[] bytes = new byte[length + 1];
 			Marshal.Copy(source, bytes, 0, length + 1);
 
@@ -405,7 +443,7 @@ namespace Epic.OnlineServices
 			return AddAllocation((int)size);
 		}
 
-		private static IntPtr AddAllocation<T>(int size, T cache)
+		private static IntPtr AddAllocation<T>(int size, T[] cache, bool? isArrayItemAllocated, bool isContiguous = false)
 		{
 			if (size == 0 || cache == null)
 			{
@@ -413,32 +451,51 @@ namespace Epic.OnlineServices
 			}
 
 			IntPtr pointer = Marshal.AllocHGlobal(size);
-			Marshal.StructureToPtr(cache, pointer, false);
+			Marshal.WriteByte(pointer, 0, 0);
 
 			lock (s_Allocations)
 			{
-				s_Allocations.Add((PointerType)pointer, new Allocation(size, cache));
+				s_Allocations.Add((PointerType)pointer, new Allocation(size, cache, isArrayItemAllocated, isContiguous));
 			}
 
 			return pointer;
 		}
 
-		private static IntPtr AddAllocation<T>(int size, T[] cache, bool? isArrayItemAllocated)
+		/// <summary>
+		/// Allocates an array of pointers to items, with the pointer table and every item in a single block and a single registry entry.
+		/// The block is laid out as the pointer table followed by the items, each item aligned to the pointer size.
+		/// </summary>
+		/// <param name="array">The items to allocate.</param>
+		/// <param name="write">Writes an item to native memory. Items are written with <see cref="Marshal.StructureToPtr(object, IntPtr, bool)" /> if <see langword="null" />.</param>
+		private static IntPtr AddContiguousAllocation<T>(T[] array, StructureWriter<T> write = null)
 		{
-			if (size == 0 || cache == null)
+			int pointerSize = Marshal.SizeOf(typeof(IntPtr));
+			int itemSize = Marshal.SizeOf(typeof(T));
+			int itemStride = (itemSize + pointerSize - 1) / pointerSize * pointerSize;
+			int tableSize = array.Length * pointerSize;
+
+			IntPtr newArrayPointer = AddAllocation(tableSize + array.Length * itemStride, array, true, true);
+			if (newArrayPointer == IntPtr.Zero)
 			{
 				return IntPtr.Zero;
 			}
 
-			IntPtr pointer = Marshal.AllocHGlobal(size);
-			Marshal.WriteByte(pointer, 0, 0);
-
-			lock (s_Allocations)
+			long itemsStart = newArrayPointer.ToInt64() + tableSize;
+			for (int itemIndex = 0; itemIndex < array.Length; ++itemIndex)
 			{
-				s_Allocations.Add((PointerType)pointer, new Allocation(size, cache, isArrayItemAllocated));
+				IntPtr newItemPointer = new IntPtr(itemsStart + itemIndex * itemStride);
+				if (write != null)
+				{
+					write(ref array[itemIndex], newItemPointer);
+				}
+				else
+				{
+					Marshal.StructureToPtr(array[itemIndex], newItemPointer, false);
+				}
+				Marshal.WriteIntPtr(newArrayPointer, itemIndex * pointerSize, newItemPointer);
 			}
 
-			return pointer;
+			return newArrayPointer;
 		}
 
 		private static IntPtr AddAllocation<T>(T[] array, bool isArrayItemAllocated)
@@ -448,6 +505,13 @@ namespace Epic.OnlineServices
 				return IntPtr.Zero;
 			}
 
+			// Allocated struct items share one block with the pointer table, so the array costs one allocation rather than one per item.
+			// Strings are pinned in place rather than allocated, so they keep a table of their own.
+			if (isArrayItemAllocated && typeof(T) != typeof(Utf8String))
+			{
+				return AddContiguousAllocation(array);
+			}
+
 			int itemSize;
 			if (isArrayItemAllocated || typeof(T).BaseType == typeof(Handle))
 			{
@@ -462,19 +526,12 @@ namespace Epic.OnlineServices
 
 			for (int itemIndex = 0; itemIndex < array.Length; ++itemIndex)
 			{
-				var item = (T)array.GetValue(itemIndex);
+				var item = array[itemIndex];
 
 				if (isArrayItemAllocated)
 				{
-					IntPtr newItemPointer;
-					if (typeof(T) == typeof(Utf8String))
-					{
-						newItemPointer = AddPinnedBuffer((Utf8String)(object)item);
-					}
-					else
-					{
-						newItemPointer = AddAllocation(Marshal.SizeOf(typeof(T)), item);
-					}
+					// Only strings reach here, other allocated items are laid out by AddContiguousAllocation
+					IntPtr newItemPointer = AddPinnedBuffer((Utf8String)(object)item);
 
 					// Copy the item's pointer into the array
 					IntPtr itemPointer = new IntPtr(newArrayPointer.ToInt64() + itemIndex * itemSize);
@@ -534,7 +591,7 @@ namespace Epic.OnlineServices
 				var array = allocation.Cache as Array;
 				for (int itemIndex = 0; itemIndex < array.Length; ++itemIndex)
 				{
-					if (allocation.IsArrayItemAllocated.Value)
+					if (allocation.IsArrayItemAllocated.Value && !allocation.IsContiguous)
 					{
 						var itemPointer = new IntPtr(pointer.ToInt64() + itemIndex * itemSize);
 						itemPointer = Marshal.ReadIntPtr(itemPointer);
@@ -604,6 +661,10 @@ namespace Epic.OnlineServices
 					PinnedBuffer pinned = s_PinnedBuffers[pointer];
 					pinned.RefCount++;
 					s_PinnedBuffers[pointer] = pinned;
+
+					// The existing handle keeps the buffer pinned, and is the one freed with the last reference.
+					// Buffers are commonly pinned more than once, as converted strings share their encoded bytes.
+					handle.Free();
 				}
 				else
 				{
@@ -616,12 +677,12 @@ namespace Epic.OnlineServices
 
 		private static IntPtr AddPinnedBuffer(Utf8String str)
 		{
-			if (str == null || str.Bytes == null)
+			if (str == null || str.ReadOnlyBytes == null)
 			{
 				return IntPtr.Zero;
 			}
 
-			return AddPinnedBuffer(str.Bytes, 0);
+			return AddPinnedBuffer(str.ReadOnlyBytes, 0);
 		}
 
 		internal static IntPtr AddPinnedBuffer(ArraySegment<byte> array)
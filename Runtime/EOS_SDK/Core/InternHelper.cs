@@ -0,0 +1,112 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System;
+using System.Collections.Generic;
+
+namespace Epic.OnlineServices
+{
+	// See Helper.cs, IntPtr keys may allocate on comparison in some runtimes.
+	using PointerType = UInt64;
+
+	public sealed partial class Helper
+	{
+		/// <summary>
+		/// Maximum number of handles kept per interned handle type before the oldest generation is dropped.
+		/// </summary>
+		private const int InternedHandleGenerationCapacity = 2048;
+
+		/// <summary>
+		/// Interning table for one <see cref="Handle" /> type.
+		/// The SDK hands out the same native pointer for the same <see cref="ProductUserId" /> or <see cref="EpicAccountId" />
+		/// for the lifetime of the platform, so the managed wrapper for a pointer can be shared instead of allocated per call.
+		///
+		/// Entries live in two generations. Lookups hit the current generation, or promote from the previous one;
+		/// once the current generation is full it becomes the previous one, and whatever was not used since is dropped.
+		/// Dropping an entry is always safe, as <see cref="Handle" /> equality is by <see cref="Handle.InnerHandle" />.
+		/// </summary>
+		/// <typeparam name="THandle">The type of <see cref="Handle" /> to intern.</typeparam>
+		private static class InternedHandles<THandle>
+			where THandle : Handle, new()
+		{
+			/// <summary>
+			/// Only id handles are interned. Other handles are released by their owner, after which the SDK may reuse the pointer.
+			/// </summary>
+			public static readonly bool IsEnabled = typeof(THandle) == typeof(ProductUserId) || typeof(THandle) == typeof(EpicAccountId);
+
+			private static readonly object s_Lock = new object();
+			private static Dictionary<PointerType, THandle> s_Current = new Dictionary<PointerType, THandle>();
+			private static Dictionary<PointerType, THandle> s_Previous = new Dictionary<PointerType, THandle>();
+
+			public static THandle Get(IntPtr from)
+			{
+				PointerType key = (PointerType)from.ToInt64();
+
+				lock (s_Lock)
+				{
+					THandle handle;
+					if (s_Current.TryGetValue(key, out handle))
+					{
+						return handle;
+					}
+
+					if (!s_Previous.TryGetValue(key, out handle))
+					{
+						handle = new THandle();
+						handle.InnerHandle = from;
+					}
+
+					if (s_Current.Count >= InternedHandleGenerationCapacity)
+					{
+						Dictionary<PointerType, THandle> recycled = s_Previous;
+						s_Previous = s_Current;
+						recycled.Clear();
+						s_Current = recycled;
+					}
+
+					s_Current[key] = handle;
+					return handle;
+				}
+			}
+
+			public static int Count
+			{
+				get
+				{
+					lock (s_Lock)
+					{
+						return s_Current.Count + s_Previous.Count;
+					}
+				}
+			}
+
+			public static void Clear()
+			{
+				lock (s_Lock)
+				{
+					s_Current.Clear();
+					s_Previous.Clear();
+				}
+			}
+		}
+
+		/// <summary>
+		/// Gets the number of <see cref="ProductUserId" /> and <see cref="EpicAccountId" /> wrappers currently interned.
+		/// </summary>
+		/// <returns>The number of interned handles.</returns>
+		public static int GetInternedHandleCount()
+		{
+			return InternedHandles<ProductUserId>.Count + InternedHandles<EpicAccountId>.Count;
+		}
+
+		/// <summary>
+		/// Drops all interned <see cref="ProductUserId" /> and <see cref="EpicAccountId" /> wrappers.
+		/// Call this when the platform is released, as native id pointers are not valid beyond the platform that created them.
+		/// Wrappers already handed out keep working, but are no longer shared with new lookups.
+		/// </summary>
+		public static void ClearInternedHandles()
+		{
+			InternedHandles<ProductUserId>.Clear();
+			InternedHandles<EpicAccountId>.Clear();
+		}
+	}
+}
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Epic.OnlineServices.Logging
+{
+	/// <summary>
+	/// The native layout of <see cref="LogMessageInternal" />, with its fields exposed so the log callback can read the raw
+	/// category and message pointers without converting them to strings. Kept outside of the generated code so that it
+	/// survives SDK upgrades; it must be kept in step with the fields of <see cref="LogMessageInternal" />.
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	internal struct LogMessageView
+	{
+		/// <summary>
+		/// The native pointer to the null terminated, UTF-8 encoded category.
+		/// Only valid for the duration of the log callback.
+		/// </summary>
+		public IntPtr Category;
+
+		/// <summary>
+		/// The native pointer to the null terminated, UTF-8 encoded message.
+		/// Only valid for the duration of the log callback.
+		/// </summary>
+		public IntPtr Message;
+
+		/// <summary>
+		/// The log level associated with the message.
+		/// </summary>
+		public LogLevel Level;
+	}
+}
@@ -0,0 +1,334 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace Epic.OnlineServices.Logging
+{
+	/// <summary>
+	/// A single log record read out of a <see cref="LogRingBuffer" />.
+	/// The byte segments point directly into the ring buffer storage, and are only valid for the
+	/// duration of the <see cref="LogRingBuffer.LogRecordHandler" /> they were passed to.
+	/// </summary>
+	public readonly struct LogRecord
+	{
+		/// <summary>
+		/// The value of <see cref="Stopwatch.GetTimestamp" /> when the SDK emitted the message.
+		/// </summary>
+		public long Timestamp { get; }
+
+		/// <summary>
+		/// The log level associated with the message.
+		/// </summary>
+		public LogLevel Level { get; }
+
+		/// <summary>
+		/// FNV-1a hash of the category bytes. Useful for caching decoded category names and for filtering without decoding.
+		/// </summary>
+		public int CategoryHash { get; }
+
+		/// <summary>
+		/// The UTF-8 bytes of the category, without a null terminator.
+		/// </summary>
+		public ArraySegment<byte> Category { get; }
+
+		/// <summary>
+		/// The UTF-8 bytes of the message, without a null terminator.
+		/// </summary>
+		public ArraySegment<byte> Message { get; }
+
+		/// <summary>
+		/// True if the message was longer than the slot size of the ring buffer and has been cut short.
+		/// </summary>
+		public bool IsTruncated { get; }
+
+		internal LogRecord(long timestamp, LogLevel level, int categoryHash, ArraySegment<byte> category, ArraySegment<byte> message, bool isTruncated)
+		{
+			Timestamp = timestamp;
+			Level = level;
+			CategoryHash = categoryHash;
+			Category = category;
+			Message = message;
+			IsTruncated = isTruncated;
+		}
+	}
+
+	/// <summary>
+	/// A bounded, lock-free, multi-producer single-consumer ring buffer of raw SDK log messages.
+	/// 
+	/// When registered with <see cref="LoggingInterface.SetCallback(LogRingBuffer)" /> the SDK log callback does nothing but copy the
+	/// category, level and message bytes straight out of native memory into preallocated storage. No managed strings are created
+	/// and no locks are taken on the SDK thread, so formatting and output can be deferred to <see cref="Drain" />.
+	/// 
+	/// When the buffer is full new messages are dropped rather than blocking the SDK, and counted in <see cref="DroppedCount" />.
+	/// </summary>
+	public sealed class LogRingBuffer
+	{
+		public const int DefaultCapacity = 1024;
+		public const int DefaultMaxMessageLength = 1024;
+		public const int MaxCategoryLength = 64;
+
+		/// <summary>
+		/// Receives records from <see cref="Drain" />.
+		/// </summary>
+		/// <param name="record">The record. Only valid for the duration of the call.</param>
+		public delegate void LogRecordHandler(in LogRecord record);
+
+		private readonly int m_Capacity;
+		private readonly int m_Mask;
+		private readonly int m_MaxMessageLength;
+
+		// Per slot sequence numbers, see "Bounded MPMC queue" by Dmitry Vyukov.
+		// A slot is writable by the producer at position p when its sequence is p,
+		// and readable by the consumer at position p when its sequence is p + 1.
+		private readonly long[] m_Sequences;
+		private readonly long[] m_Timestamps;
+		private readonly LogLevel[] m_Levels;
+		private readonly int[] m_CategoryHashes;
+		private readonly int[] m_CategoryLengths;
+		private readonly int[] m_MessageLengths;
+		private readonly bool[] m_Truncated;
+		private readonly byte[] m_CategoryBytes;
+		private readonly byte[] m_MessageBytes;
+
+		private long m_EnqueuePosition;
+		private long m_DequeuePosition;
+		private long m_DroppedCount;
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="LogRingBuffer" /> class.
+		/// </summary>
+		/// <param name="capacity">The number of messages the buffer can hold. Rounded up to a power of two.</param>
+		/// <param name="maxMessageLength">The number of message bytes stored per slot. Longer messages are truncated.</param>
+		public LogRingBuffer(int capacity = DefaultCapacity, int maxMessageLength = DefaultMaxMessageLength)
+		{
+			if (capacity <= 0)
+			{
+				throw new ArgumentOutOfRangeException("capacity");
+			}
+
+			if (maxMessageLength <= 0)
+			{
+				throw new ArgumentOutOfRangeException("maxMessageLength");
+			}
+
+			m_Capacity = 1;
+			while (m_Capacity < capacity)
+			{
+				m_Capacity <<= 1;
+			}
+
+			m_Mask = m_Capacity - 1;
+			m_MaxMessageLength = maxMessageLength;
+
+			m_Sequences = new long[m_Capacity];
+			m_Timestamps = new long[m_Capacity];
+			m_Levels = new LogLevel[m_Capacity];
+			m_CategoryHashes = new int[m_Capacity];
+			m_CategoryLengths = new int[m_Capacity];
+			m_MessageLengths = new int[m_Capacity];
+			m_Truncated = new bool[m_Capacity];
+			m_CategoryBytes = new byte[m_Capacity * MaxCategoryLength];
+			m_MessageBytes = new byte[m_Capacity * m_MaxMessageLength];
+
+			for (int index = 0; index < m_Capacity; ++index)
+			{
+				m_Sequences[index] = index;
+			}
+		}
+
+		/// <summary>
+		/// The number of messages the buffer can hold.
+		/// </summary>
+		public int Capacity
+		{
+			get { return m_Capacity; }
+		}
+
+		/// <summary>
+		/// The total number of messages that were dropped because the buffer was full.
+		/// </summary>
+		public long DroppedCount
+		{
+			get { return Interlocked.Read(ref m_DroppedCount); }
+		}
+
+		/// <summary>
+		/// The approximate number of messages waiting to be drained.
+		/// </summary>
+		public int Count
+		{
+			get
+			{
+				long count = Interlocked.Read(ref m_EnqueuePosition) - Interlocked.Read(ref m_DequeuePosition);
+				return (int)Math.Max(0, Math.Min(count, m_Capacity));
+			}
+		}
+
+		/// <summary>
+		/// Copies a native log message into the buffer. Safe to call from any number of threads concurrently.
+		/// </summary>
+		/// <param name="level">The log level of the message.</param>
+		/// <param name="category">Pointer to a null terminated UTF-8 category.</param>
+		/// <param name="message">Pointer to a null terminated UTF-8 message.</param>
+		/// <returns>False if the buffer was full and the message was dropped.</returns>
+		internal bool TryWrite(LogLevel level, IntPtr category, IntPtr message)
+		{
+			long position = Volatile.Read(ref m_EnqueuePosition);
+			int index;
+
+			while (true)
+			{
+				index = (int)(position & m_Mask);
+				long sequence = Volatile.Read(ref m_Sequences[index]);
+				long difference = sequence - position;
+
+				if (difference == 0)
+				{
+					if (Interlocked.CompareExchange(ref m_EnqueuePosition, position + 1, position) == position)
+					{
+						break;
+					}
+
+					position = Volatile.Read(ref m_EnqueuePosition);
+				}
+				else if (difference < 0)
+				{
+					// The consumer has not caught up yet, the buffer is full.
+					Interlocked.Increment(ref m_DroppedCount);
+					return false;
+				}
+				else
+				{
+					// Another producer claimed this position first.
+					position = Volatile.Read(ref m_EnqueuePosition);
+				}
+			}
+
+			m_Timestamps[index] = Stopwatch.GetTimestamp();
+			m_Levels[index] = level;
+
+			bool categoryTruncated;
+			int categoryLength = CopyNativeString(category, m_CategoryBytes, index * MaxCategoryLength, MaxCategoryLength, out categoryTruncated);
+			m_CategoryLengths[index] = categoryLength;
+			m_CategoryHashes[index] = ComputeHash(m_CategoryBytes, index * MaxCategoryLength, categoryLength);
+
+			bool messageTruncated;
+			m_MessageLengths[index] = CopyNativeString(message, m_MessageBytes, index * m_MaxMessageLength, m_MaxMessageLength, out messageTruncated);
+			m_Truncated[index] = messageTruncated;
+
+			// Publish the slot to the consumer.
+			Volatile.Write(ref m_Sequences[index], position + 1);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Reads up to <paramref name="maxRecords" /> messages out of the buffer, in the order they were written.
+		/// Must only be called from one thread at a time.
+		/// </summary>
+		/// <param name="handler">Called once per record.</param>
+		/// <param name="maxRecords">The maximum number of records to read, or a negative value to read until the buffer is empty.</param>
+		/// <returns>The number of records read.</returns>
+		public int Drain(LogRecordHandler handler, int maxRecords = -1)
+		{
+			int recordCount = 0;
+
+			while (maxRecords < 0 || recordCount < maxRecords)
+			{
+				long position = m_DequeuePosition;
+				int index = (int)(position & m_Mask);
+				long sequence = Volatile.Read(ref m_Sequences[index]);
+
+				if (sequence - (position + 1) < 0)
+				{
+					// Nothing has been published at this position yet.
+					break;
+				}
+
+				if (handler != null)
+				{
+					var record = new LogRecord(
+						m_Timestamps[index],
+						m_Levels[index],
+						m_CategoryHashes[index],
+						new ArraySegment<byte>(m_CategoryBytes, index * MaxCategoryLength, m_CategoryLengths[index]),
+						new ArraySegment<byte>(m_MessageBytes, index * m_MaxMessageLength, m_MessageLengths[index]),
+						m_Truncated[index]);
+
+					handler(in record);
+				}
+
+				// Hand the slot back to the producers for the next lap around the buffer.
+				Volatile.Write(ref m_DequeuePosition, position + 1);
+				Volatile.Write(ref m_Sequences[index], position + m_Capacity);
+
+				++recordCount;
+			}
+
+			return recordCount;
+		}
+
+		/// <summary>
+		/// Computes the same hash that is stored in <see cref="LogRecord.CategoryHash" /> for a category name.
+		/// </summary>
+		/// <param name="category">The category name, for instance "LogEOSAuth".</param>
+		/// <returns>The hash of the UTF-8 bytes of the category name.</returns>
+		public static int ComputeCategoryHash(string category)
+		{
+			if (string.IsNullOrEmpty(category))
+			{
+				return ComputeHash(null, 0, 0);
+			}
+
+			byte[] bytes = System.Text.Encoding.UTF8.GetBytes(category);
+			return ComputeHash(bytes, 0, Math.Min(bytes.Length, MaxCategoryLength));
+		}
+
+		private static int ComputeHash(byte[] bytes, int offset, int length)
+		{
+			unchecked
+			{
+				uint hash = 2166136261;
+				for (int index = 0; index < length; ++index)
+				{
+					hash ^= bytes[offset + index];
+					hash *= 16777619;
+				}
+
+				return (int)hash;
+			}
+		}
+
+		private static int CopyNativeString(IntPtr source, byte[] destination, int offset, int maxLength, out bool isTruncated)
+		{
+			isTruncated = false;
+
+			if (source == IntPtr.Zero)
+			{
+				return 0;
+			}
+
+			// Bounded strlen, so that a long message is never walked past the slot size.
+			int length = 0;
+			while (length < maxLength && Marshal.ReadByte(source, length) != 0)
+			{
+				++length;
+			}
+
+			if (length == maxLength && Marshal.ReadByte(source, length) != 0)
+			{
+				isTruncated = true;
+			}
+
+			if (length > 0)
+			{
+				Marshal.Copy(source, destination, offset, length);
+			}
+
+			return length;
+		}
+	}
+}
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using System;
+
+namespace Epic.OnlineServices.Logging
+{
+	public sealed partial class LoggingInterface
+	{
+		private static LogRingBuffer s_RingBuffer;
+
+		/// <summary>
+		/// Routes SDK log messages into the given <see cref="LogRingBuffer" /> instead of a <see cref="LogMessageFunc" />.
+		/// The native log callback only copies the raw category, level and message bytes into the buffer; no managed strings
+		/// are created until the buffer is drained. Any previously set callback will no longer be called.
+		/// </summary>
+		/// <param name="ringBuffer">
+		/// the buffer to write SDK log messages into
+		/// </param>
+		/// <returns>
+		/// <see cref="Result.Success" /> is returned if the buffer will be used for future log messages.
+		/// <see cref="Result.NotConfigured" /> is returned if the SDK has not yet been initialized, or if it has been shut down
+		/// </returns>
+		public static Result SetCallback(LogRingBuffer ringBuffer)
+		{
+			if (ringBuffer == null)
+			{
+				throw new ArgumentNullException("ringBuffer");
+			}
+
+			s_RingBuffer = ringBuffer;
+
+			var callResult = Bindings.EOS_Logging_SetCallback(LogRingBufferImplementation.Delegate);
+
+			return callResult;
+		}
+
+		internal static class LogRingBufferImplementation
+		{
+			private static LogMessageFuncInternal s_Delegate;
+			public static LogMessageFuncInternal Delegate
+			{
+				get
+				{
+					if (s_Delegate == null)
+					{
+						s_Delegate = new LogMessageFuncInternal(EntryPoint);
+					}
+
+					return s_Delegate;
+				}
+			}
+
+			[MonoPInvokeCallback(typeof(LogMessageFuncInternal))]
+			public static void EntryPoint(ref LogMessageInternal message)
+			{
+				LogRingBuffer ringBuffer = s_RingBuffer;
+				if (ringBuffer != null)
+				{
+					unsafe
+					{
+						fixed (LogMessageInternal* messagePointer = &message)
+						{
+							LogMessageView* view = (LogMessageView*)messagePointer;
+							ringBuffer.TryWrite(view->Level, view->Category, view->Message);
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -34,16 +34,12 @@ namespace Epic.OnlineServices.P2P
 				outBytesWritten = 0;
 				var funcResult = Bindings.EOS_P2P_ReceivePacket(InnerHandle, ref optionsInternal, out outPeerIdAddress, outSocketIdAddr, out outChannel, outDataAddress, out outBytesWritten);
 
-				if (outPeerId == null)
+				if (outPeerId == null || outPeerId.InnerHandle != outPeerIdAddress)
 				{
-					// Note: Will allocate a new ProductUserId(), to avoid continual allocation of a peer id object, pass a non null reference.
+					// Optimization Note: ProductUserIds are interned, so this returns the shared instance for the peer rather than allocating a new one.
+					// The passed in reference is replaced rather than mutated, as it may be shared with other callers.
 					Helper.Get(outPeerIdAddress, out outPeerId);
 				}
-				else if (outPeerId.InnerHandle != outPeerIdAddress)
-				{
-					// Optimization Note: clients can pass the same ProductUserId object to avoid continually allocating a new object but will need to pay attention to InnerHandler changes
-					outPeerId.InnerHandle = outPeerIdAddress;
-				}
 
 				// Optimization Note: this will check if socket ID bytes were unchanged to allow using previous cached string and avoid a new allocation.
 				outSocketId.CheckIfChanged(wasCacheValid);
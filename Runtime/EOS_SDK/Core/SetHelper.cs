@@ -45,10 +45,9 @@ namespace Epic.OnlineServices
 		internal static void Set<T>(T from, ref IntPtr to)
 			where T : struct
         {
-            Dispose(ref to);
+			Dispose(ref to);
 
-            to = AddAllocation(Marshal.SizeOf(typeof(T)), from);
-			Marshal.StructureToPtr(from, to, false);
+			to = AddStructAllocation(from);
 		}
 
 		internal static void Set<T>(T? from, ref IntPtr to)
@@ -58,8 +57,7 @@ namespace Epic.OnlineServices
 
 			if (from.HasValue)
 			{
-				to = AddAllocation(Marshal.SizeOf(typeof(T)), from);
-				Marshal.StructureToPtr(from.Value, to, false);
+				to = AddStructAllocation(from.Value);
 			}
 		}
 
@@ -120,6 +118,11 @@ namespace Epic.OnlineServices
 			Convert(from, out to, stringLength);
 		}
 
+		internal static void Set(string from, ref byte[] to, int stringLength)
+		{
+			Convert(from, out to, stringLength);
+		}
+
 		internal static void Set<TPublic, TInternal>(ref TPublic from, ref TInternal to)
 			where TPublic : struct
 			where TInternal : struct, ISettable<TPublic>
@@ -139,7 +142,7 @@ namespace Epic.OnlineServices
 				TInternal toInternal = default;
 				var fromValue = from.Value;
 				toInternal.Set(ref fromValue);
-				to = AddAllocation(Marshal.SizeOf(typeof(TInternal)), toInternal);
+				to = AddStructAllocation(toInternal);
 			}
 		}
 
@@ -181,7 +184,7 @@ namespace Epic.OnlineServices
 			TInternal toInternal = default;
 			toInternal.Set(ref from);
 
-			to = AddAllocation(Marshal.SizeOf(typeof(TInternal)), toInternal);
+			to = AddStructAllocation(toInternal);
 		}
 
 		internal static void Set<TPublic, TInternal>(TPublic[] from, ref IntPtr to, out int arrayLength, bool isArrayItemAllocated)
@@ -199,7 +202,7 @@ namespace Epic.OnlineServices
 					toInternal[index].Set(ref from[index]);
 				}
 
-				Set(toInternal, ref to, isArrayItemAllocated);
+				to = AddStructArrayAllocation(toInternal, isArrayItemAllocated);
 				Get(from, out arrayLength);
 			}
 		}
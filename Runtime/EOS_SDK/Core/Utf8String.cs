@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 using System;
+using System.Runtime.CompilerServices;
 using System.Text;
 
 namespace Epic.OnlineServices
@@ -13,6 +14,45 @@ namespace Epic.OnlineServices
 	{
 		static public Utf8String EmptyString = new Utf8String();
 
+		/// <summary>
+		/// An encoded string kept by <see cref="s_EncodingCache" />.
+		/// Immutable, so it can be published to other threads without a lock.
+		/// </summary>
+		private sealed class EncodingCacheEntry
+		{
+			public readonly string Source;
+			public readonly byte[] Bytes;
+			public readonly int Length;
+
+			public EncodingCacheEntry(string source, byte[] bytes, int length)
+			{
+				Source = source;
+				Bytes = bytes;
+				Length = length;
+			}
+		}
+
+		// Direct mapped by string identity. Strings converted every frame (socket names, lobby and session ids, attribute keys)
+		// are usually the same string instance each time, so encoding them once saves a buffer per call.
+		private const int EncodingCacheSize = 256;
+		private const int EncodingCacheMaxStringLength = 256;
+		private static readonly EncodingCacheEntry[] s_EncodingCache = new EncodingCacheEntry[EncodingCacheSize];
+
+		/// <summary>
+		/// The decoded string, decoded on first use. Strings received from the SDK that are never read are never decoded.
+		/// </summary>
+		private string m_Utf16;
+
+		/// <summary>
+		/// The UTF-8 bytes, null terminated.
+		/// </summary>
+		private byte[] m_Bytes;
+
+		/// <summary>
+		/// Whether <see cref="m_Bytes" /> is shared with <see cref="s_EncodingCache" /> and must be copied before being handed out or modified.
+		/// </summary>
+		private bool m_BytesShared;
+
 		/// <summary>
 		/// The length of the <see cref="Utf8String" />.
 		/// </summary>
@@ -20,8 +60,34 @@ namespace Epic.OnlineServices
 
 		/// <summary>
 		/// The UTF-8 bytes of the <see cref="Utf8String" />.
+		/// Instances converted from the same <see cref="string" /> share their bytes, so the first read gives this instance its own copy.
 		/// </summary>
-		public byte[] Bytes { get; private set; }
+		public byte[] Bytes
+		{
+			get
+			{
+				if (m_BytesShared)
+				{
+					m_Bytes = (byte[])m_Bytes.Clone();
+					m_BytesShared = false;
+				}
+
+				return m_Bytes;
+			}
+			private set
+			{
+				m_Bytes = value;
+				m_BytesShared = false;
+			}
+		}
+
+		/// <summary>
+		/// The UTF-8 bytes without copying them if they are shared, for passing them to the SDK. Must not be modified.
+		/// </summary>
+		internal byte[] ReadOnlyBytes
+		{
+			get { return m_Bytes; }
+		}
 
 		/// <summary>
 		/// The <see cref="Utf8String" /> as a <see cref="string" />.
@@ -30,16 +96,22 @@ namespace Epic.OnlineServices
 		{
 			get
 			{
+				if (m_Utf16 != null)
+				{
+					return m_Utf16;
+				}
+
 				if (Length > 0)
 				{
-					return Encoding.UTF8.GetString(Bytes, 0, Length);
+					m_Utf16 = Encoding.UTF8.GetString(m_Bytes, 0, Length);
+					return m_Utf16;
 				}
 
-				if (Bytes == null)
+				if (m_Bytes == null)
 				{
 					throw new Exception("Bytes array is null.");
 				}
-				else if (Bytes.Length == 0 || Bytes[Bytes.Length - 1] != 0)
+				else if (m_Bytes.Length == 0 || m_Bytes[m_Bytes.Length - 1] != 0)
 				{
 					throw new Exception("Bytes array is not null terminated.");
 				}
@@ -48,11 +120,14 @@ namespace Epic.OnlineServices
 			}
 			set
 			{
+				m_Utf16 = value;
+				m_BytesShared = false;
+
 				if (value != null)
 				{
 					// Null terminate the bytes
-					Bytes = new byte[Encoding.UTF8.GetMaxByteCount(value.Length) + 1];
-					Length = Encoding.UTF8.GetBytes(value, 0, value.Length, Bytes, 0);
+					m_Bytes = new byte[Encoding.UTF8.GetByteCount(value) + 1];
+					Length = Encoding.UTF8.GetBytes(value, 0, value.Length, m_Bytes, 0);
 				}
 				else
 				{
@@ -84,8 +159,8 @@ namespace Epic.OnlineServices
 				throw new ArgumentException("Argument is not null terminated.", "bytes");
 			}
 
-			Bytes = bytes;
-			Length = Bytes.Length - 1;
+			m_Bytes = bytes;
+			Length = m_Bytes.Length - 1;
 		}
 
 		/// <summary>
@@ -97,10 +172,59 @@ namespace Epic.OnlineServices
 			Utf16 = value;
 		}
 
+		private Utf8String(EncodingCacheEntry entry)
+		{
+			m_Bytes = entry.Bytes;
+			Length = entry.Length;
+			m_Utf16 = entry.Source;
+			m_BytesShared = true;
+		}
+
 		public byte this[int index]
 		{
-			get { return Bytes[index]; }
-			set { Bytes[index] = value; }
+			get { return m_Bytes[index]; }
+			set
+			{
+				if (m_BytesShared)
+				{
+					m_Bytes = (byte[])m_Bytes.Clone();
+					m_BytesShared = false;
+				}
+
+				m_Bytes[index] = value;
+				m_Utf16 = null;
+			}
+		}
+
+		/// <summary>
+		/// Converts a <see cref="string" /> to a <see cref="Utf8String" />, reusing the encoded bytes of a recent conversion of the same string instance.
+		/// </summary>
+		/// <param name="value">The string to convert.</param>
+		/// <returns>A <see cref="Utf8String" /> for <paramref name="value" />.</returns>
+		public static Utf8String FromCachedEncoding(string value)
+		{
+			if (value == null)
+			{
+				return null;
+			}
+
+			if (value.Length > EncodingCacheMaxStringLength)
+			{
+				return new Utf8String(value);
+			}
+
+			int slot = RuntimeHelpers.GetHashCode(value) & (EncodingCacheSize - 1);
+			EncodingCacheEntry entry = s_EncodingCache[slot];
+
+			if (entry == null || !ReferenceEquals(entry.Source, value))
+			{
+				byte[] bytes = new byte[Encoding.UTF8.GetByteCount(value) + 1];
+				int length = Encoding.UTF8.GetBytes(value, 0, value.Length, bytes, 0);
+				entry = new EncodingCacheEntry(value, bytes, length);
+				s_EncodingCache[slot] = entry;
+			}
+
+			return new Utf8String(entry);
 		}
 
 		public static explicit operator Utf8String(byte[] other)
@@ -125,12 +249,7 @@ namespace Epic.OnlineServices
 
 		public static implicit operator Utf8String(string other)
 		{
-			if (other == null)
-			{
-				return null;
-			}
-
-			return new Utf8String(other);
+			return FromCachedEncoding(other);
 		}
 
 		public static implicit operator string(Utf8String other)
@@ -146,8 +265,8 @@ namespace Epic.OnlineServices
 		public static Utf8String operator +(Utf8String left, Utf8String right)
 		{
 			byte[] Result = new byte[left.Length + right.Length + 1];
-			Buffer.BlockCopy(left.Bytes, 0, Result, 0, left.Length);
-			Buffer.BlockCopy(right.Bytes, 0, Result, left.Length, right.Length + 1);
+			Buffer.BlockCopy(left.m_Bytes, 0, Result, 0, left.Length);
+			Buffer.BlockCopy(right.m_Bytes, 0, Result, left.Length, right.Length + 1);
 			return new Utf8String(Result);
 		}
 
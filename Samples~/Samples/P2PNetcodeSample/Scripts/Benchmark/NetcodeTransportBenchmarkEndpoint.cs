@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#if COM_UNITY_MODULE_NETCODE
+
+namespace PlayEveryWare.EpicOnlineServices.Samples.Network
+{
+    using System;
+    using UnityEngine;
+    using Unity.Netcode;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// Measures <see cref="EOSTransport"/> as Netcode for GameObjects drives
+    /// it, without a NetworkManager on top. The transport always sends on
+    /// channel 0, so the channel count of the cases makes no difference to
+    /// this layer.
+    /// </summary>
+    public class NetcodeTransportBenchmarkEndpoint : P2PBenchmarkEndpoint
+    {
+        public const string LayerName = "EOSTransport";
+
+        private P2PInterface _p2pInterface;
+        private GameObject _gameObject;
+        private EOSTransport _transport;
+        private ProductUserId _localUserId;
+        private ulong _remoteTransportId;
+        private bool _isConnected;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+        private static void Register()
+        {
+            RegisterLayer(LayerName, () => new NetcodeTransportBenchmarkEndpoint());
+        }
+
+        public override bool IsConnected
+        {
+            get
+            {
+                return _isConnected;
+            }
+        }
+
+        public override bool Start(P2PInterface p2pInterface, ProductUserId localUserId, ProductUserId remoteUserId, bool isHost)
+        {
+            _p2pInterface = p2pInterface;
+            _localUserId = localUserId;
+
+            _gameObject = new GameObject($"{nameof(NetcodeTransportBenchmarkEndpoint)} {localUserId}");
+            _transport = _gameObject.AddComponent<EOSTransport>();
+            _transport.LocalUserIdOverride = localUserId;
+            _transport.P2PInterfaceOverride = p2pInterface;
+            _transport.Initialize(null);
+
+            if (isHost)
+            {
+                return _transport.StartServer();
+            }
+
+            _transport.ServerUserIdToConnectTo = remoteUserId;
+            return _transport.StartClient();
+        }
+
+        public override bool Send(ArraySegment<byte> packet, byte channel, PacketReliability reliability)
+        {
+            // The reverse of the mapping EOSTransport.Send makes
+            NetworkDelivery delivery = reliability switch
+            {
+                PacketReliability.UnreliableUnordered => NetworkDelivery.Unreliable,
+                PacketReliability.ReliableUnordered => NetworkDelivery.Reliable,
+                _ => NetworkDelivery.ReliableSequenced
+            };
+
+            // The transport logs its errors instead of returning them
+            _transport.Send(_remoteTransportId, packet, delivery);
+            return true;
+        }
+
+        public override bool TryReceive(out ArraySegment<byte> packet)
+        {
+            GetNextReceivedPacketSizeOptions sizeOptions = new()
+            {
+                LocalUserId = _localUserId,
+                RequestedChannel = null
+            };
+
+            while (true)
+            {
+                switch (_transport.PollEvent(out ulong transportId, out packet, out float _))
+                {
+                    case NetworkEvent.Connect:
+                        _remoteTransportId = transportId;
+                        _isConnected = true;
+                        continue;
+                    case NetworkEvent.Disconnect:
+                        _isConnected = false;
+                        continue;
+                    case NetworkEvent.Data:
+                        return true;
+                }
+
+                // Like the manager under it, the transport has nothing to
+                // report for the packets it keeps, so keep going until the
+                // queue is empty.
+                if (_p2pInterface.GetNextReceivedPacketSize(ref sizeOptions, out uint nextPacketSize) != Result.Success || nextPacketSize == 0)
+                {
+                    packet = default;
+                    return false;
+                }
+            }
+        }
+
+        public override void Stop()
+        {
+            if (_transport == null)
+            {
+                return;
+            }
+
+            _transport.Shutdown();
+            UnityEngine.Object.Destroy(_gameObject);
+            _transport = null;
+            _gameObject = null;
+            _isConnected = false;
+        }
+    }
+}
+
+#endif
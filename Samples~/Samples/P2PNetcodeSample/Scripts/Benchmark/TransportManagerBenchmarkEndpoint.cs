@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples.Network
+{
+    using System;
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// Measures <see cref="EOSTransportManager"/>: its connection handshake,
+    /// the fragment header it adds to each packet, and the buffers it
+    /// allocates for each packet received.
+    /// </summary>
+    public class TransportManagerBenchmarkEndpoint : P2PBenchmarkEndpoint
+    {
+        public const string LayerName = "EOSTransportManager";
+
+        private const string SocketName = "P2PBENCHMARK";
+
+        private P2PInterface _p2pInterface;
+        private EOSTransportManager _manager;
+        private ProductUserId _localUserId;
+        private ProductUserId _remoteUserId;
+        private bool _isConnected;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+        private static void Register()
+        {
+            RegisterLayer(LayerName, () => new TransportManagerBenchmarkEndpoint());
+        }
+
+        public override bool IsConnected
+        {
+            get
+            {
+                return _isConnected;
+            }
+        }
+
+        public override bool Start(P2PInterface p2pInterface, ProductUserId localUserId, ProductUserId remoteUserId, bool isHost)
+        {
+            _p2pInterface = p2pInterface;
+            _localUserId = localUserId;
+            _remoteUserId = remoteUserId;
+
+            _manager = new EOSTransportManager(localUserId, p2pInterface);
+            _manager.OnIncomingConnectionRequestedCb = (userId, socketName) =>
+            {
+                if (userId == _remoteUserId && socketName == SocketName)
+                {
+                    _manager.OpenConnection(userId, socketName);
+                }
+            };
+            _manager.OnConnectionOpenedCb = (userId, socketName) =>
+            {
+                _isConnected |= userId == _remoteUserId;
+            };
+            _manager.OnConnectionClosedCb = (userId, socketName) =>
+            {
+                _isConnected &= userId != _remoteUserId;
+            };
+
+            if (!_manager.Initialize())
+            {
+                return false;
+            }
+
+            return isHost || _manager.OpenConnection(remoteUserId, SocketName);
+        }
+
+        public override bool Send(ArraySegment<byte> packet, byte channel, PacketReliability reliability)
+        {
+            // The manager logs its errors instead of returning them
+            _manager.SendPacket(_remoteUserId, SocketName, packet, channel, false, reliability);
+            return true;
+        }
+
+        public override bool TryReceive(out ArraySegment<byte> packet)
+        {
+            GetNextReceivedPacketSizeOptions sizeOptions = new()
+            {
+                LocalUserId = _localUserId,
+                RequestedChannel = null
+            };
+
+            // The manager also returns false for the packets it keeps, such
+            // as fragments and connection confirmations, so keep going until
+            // the queue is empty.
+            while (_p2pInterface.GetNextReceivedPacketSize(ref sizeOptions, out uint nextPacketSize) == Result.Success && nextPacketSize > 0)
+            {
+                if (_manager.TryReceivePacket(out ProductUserId _, out string _, out byte _, out byte[] data))
+                {
+                    packet = new ArraySegment<byte>(data);
+                    return true;
+                }
+            }
+
+            packet = default;
+            return false;
+        }
+
+        public override void Stop()
+        {
+            if (_manager == null)
+            {
+                return;
+            }
+
+            _manager.Shutdown();
+            _manager = null;
+            _isConnected = false;
+        }
+    }
+}
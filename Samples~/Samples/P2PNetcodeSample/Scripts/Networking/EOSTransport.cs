@@ -72,6 +72,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples.Network
         // Override local user id for testing multiple clients at once
         public ProductUserId LocalUserIdOverride = null;
 
+        // Override P2P interface, for users logged into another platform than the EOSManager's
+        public Epic.OnlineServices.P2P.P2PInterface P2PInterfaceOverride = null;
+
 #if UNITY_EDITOR
         //editor field to input a PUID to connect to(ease of access when using editor buttons in the network manager
         public String ServerUserIdToConnectToInput = null;
@@ -407,7 +410,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples.Network
 
             if (LocalUserIdOverride?.IsValid() == true)
             {
-                P2PManager = new EOSTransportManager(LocalUserIdOverride);
+                P2PManager = new EOSTransportManager(LocalUserIdOverride, P2PInterfaceOverride);
             }
             else
             {
@@ -241,6 +241,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples.Network
         /// </summary>
         private ProductUserId LocalUserIdOverride = null;
 
+        /// <summary>
+        /// The P2P interface to use instead of the one of the EOSManager's platform.
+        /// </summary>
+        private P2PInterface P2PHandleOverride = null;
+
         // Maps remote users to a list of all open connections with that user
         private Dictionary<ProductUserId, List<Connection>> Connections;
 
@@ -333,6 +338,15 @@ namespace PlayEveryWare.EpicOnlineServices.Samples.Network
             LocalUserIdOverride = overrideId;
         }
 
+        /// <summary>
+        /// Creates a new, uninitialized instance of EOSTransportManager with an override user ID, using the P2P interface
+        /// of another platform than the EOSManager's (such as one from a <see cref="PlatformPool"/>).
+        /// </summary>
+        public EOSTransportManager(ProductUserId overrideId, P2PInterface p2pInterfaceOverride) : this(overrideId)
+        {
+            P2PHandleOverride = p2pInterfaceOverride;
+        }
+
         private void Clear()
         {
             P2PHandle = null;
@@ -383,7 +397,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples.Network
             }
             else
             {
-                P2PHandle = EOSManager.Instance.GetEOSP2PInterface();
+                P2PHandle = P2PHandleOverride ?? EOSManager.Instance.GetEOSP2PInterface();
                 NATType = NATType.Unknown;
                 if (LocalUserIdOverride?.IsValid() == true)
                 {
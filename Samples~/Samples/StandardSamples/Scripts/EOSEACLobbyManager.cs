@@ -127,7 +127,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 AsString = dataString
             };
 
-            LobbyManager.SetMemberAttribute(dataAttrib);
+            // Every anti-cheat message must reach the peer, so it is not coalesced with later writes to the same key
+            LobbyManager.SetMemberAttribute(dataAttrib, null, false);
         }
 
         private void OnMemberUpdated(string LobbyId, ProductUserId MemberId)
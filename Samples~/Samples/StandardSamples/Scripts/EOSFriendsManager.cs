@@ -95,6 +95,33 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         private Dictionary<EpicAccountId, ulong> FriendNotifications = new Dictionary<EpicAccountId, ulong>();
         private Dictionary<EpicAccountId, ulong> PresenceNotifications = new Dictionary<EpicAccountId, ulong>();
 
+        /// <summary>
+        /// Seconds between flushes of coalesced friend refreshes. Presence, user info and account mapping
+        /// changes are collected per account and refreshed in batches rather than per notification.
+        /// </summary>
+        public float RefreshIntervalSeconds = 0.25f;
+
+        /// <summary>
+        /// Upper bound on the <c>QueryUserInfo</c> requests started in a single flush, so that a large friends list
+        /// is resolved over several flushes instead of in one burst of requests.
+        /// </summary>
+        public int MaxUserInfoQueriesPerFlush = 16;
+
+        private float NextRefreshTime;
+
+        // Accounts waiting for the next flush
+        private HashSet<EpicAccountId> DirtyPresence = new HashSet<EpicAccountId>();
+        private HashSet<EpicAccountId> DirtyUserInfo = new HashSet<EpicAccountId>();
+        private HashSet<EpicAccountId> DirtyAccountMappings = new HashSet<EpicAccountId>();
+        private HashSet<ProductUserId> DirtyProductUserIdMappings = new HashSet<ProductUserId>();
+
+        // Accounts with a query already in flight, so repeated notifications don't start another
+        private HashSet<EpicAccountId> PresenceQueriesInFlight = new HashSet<EpicAccountId>();
+        private HashSet<EpicAccountId> UserInfoQueriesInFlight = new HashSet<EpicAccountId>();
+        private HashSet<ProductUserId> ProductUserIdMappingsInFlight = new HashSet<ProductUserId>();
+
+        private Dictionary<ProductUserId, EpicAccountId> AccountMappings = new Dictionary<ProductUserId, EpicAccountId>();
+
         public EOSFriendsManager()
         {
             CachedFriends = new Dictionary<EpicAccountId, FriendData>();
@@ -122,13 +149,26 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return returnDirty;
         }
 
+        /// <summary>Returns the <c>EpicAccountId</c> linked to <paramref name="targetUserId"/>.</summary>
+        /// <remarks>If the mapping isn't known yet, it's requested in the next batched refresh and an invalid id is returned until then.</remarks>
         public EpicAccountId GetAccountMapping(ProductUserId targetUserId)
         {
-            foreach(FriendData friendData in CachedFriends.Values)
+            if (targetUserId != null && targetUserId.IsValid())
             {
-                if(targetUserId == friendData.UserProductUserId)
+                if (AccountMappings.TryGetValue(targetUserId, out EpicAccountId accountId))
+                {
+                    return accountId;
+                }
+
+                if (EOSUserDirectoryCache.Instance.TryGetEpicAccountId(targetUserId, out accountId))
+                {
+                    AccountMappings[targetUserId] = accountId;
+                    return accountId;
+                }
+
+                if (!ProductUserIdMappingsInFlight.Contains(targetUserId))
                 {
-                    return friendData.UserId;
+                    DirtyProductUserIdMappings.Add(targetUserId);
                 }
             }
 
@@ -142,6 +182,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return friend.Name;
             }
 
+            if (EOSUserDirectoryCache.Instance.TryGetDisplayName(targetAccountId, out string displayName, out _))
+            {
+                return displayName;
+            }
+
             return string.Empty;
         }
 
@@ -336,7 +381,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 LocalUserId = EOSManager.Instance.GetLocalUserId()
             };
 
-            Dictionary<EpicAccountId, FriendData> friendsList = new Dictionary<EpicAccountId, FriendData>();
+            // Update the cached FriendData in place, so friends already resolved keep their name, mapping and presence
+            HashSet<EpicAccountId> currentFriends = new HashSet<EpicAccountId>();
 
             for (int friendIndex = 0; friendIndex < friendsCount; friendIndex++)
             {
@@ -356,15 +402,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
                     Debug.LogFormat("Friends (QueryFriendsCallback): Friend Status {0} => {1}", friendUserId, friendStatus);
 
-                    FriendData friendEntry = new FriendData()
-                    {
-                        LocalUserId = data.LocalUserId,
-                        UserId = friendUserId,
-                        Name = "Pending...",
-                        Status = friendStatus
-                    };
-
-                    friendsList.Add(friendEntry.UserId, friendEntry);
+                    currentFriends.Add(friendUserId);
+                    UpdateCachedFriend(data.LocalUserId, friendUserId, friendStatus);
                 }
                 else
                 {
@@ -372,19 +411,358 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 }
             }
 
-            CachedFriends = friendsList;
-            CachedFriendsDirty = true;
+            List<EpicAccountId> removedFriends = new List<EpicAccountId>();
+            foreach (EpicAccountId friendUserId in CachedFriends.Keys)
+            {
+                if (!currentFriends.Contains(friendUserId))
+                {
+                    removedFriends.Add(friendUserId);
+                }
+            }
 
-            foreach (FriendData friend in CachedFriends.Values)
+            foreach (EpicAccountId friendUserId in removedFriends)
             {
-                QueryPresenceInfo(EOSManager.Instance.GetLocalUserId(), friend.UserId);
-                QueryUserInfo(friend.UserId, null);
-                QueryFriendsConnectMappings();
+                RemoveCachedFriend(friendUserId);
             }
 
+            CachedFriendsDirty = true;
+
             QueryFriendCallback?.Invoke(Result.Success);
         }
 
+        /// <summary>Adds or updates the cached <c>FriendData</c> of a friend, marking whatever it's missing for the next batched refresh.</summary>
+        private void UpdateCachedFriend(EpicAccountId localUserId, EpicAccountId friendUserId, FriendsStatus friendStatus)
+        {
+            if (CachedFriends.TryGetValue(friendUserId, out FriendData friend))
+            {
+                friend.LocalUserId = localUserId;
+
+                if (friend.Status != friendStatus)
+                {
+                    friend.Status = friendStatus;
+                    CachedFriendsDirty = true;
+                }
+            }
+            else
+            {
+                friend = new FriendData()
+                {
+                    LocalUserId = localUserId,
+                    UserId = friendUserId,
+                    Name = "Pending...",
+                    Status = friendStatus
+                };
+
+                // Show what was known last session straight away, and only query names that are missing or stale
+                if (EOSUserDirectoryCache.Instance.TryGetDisplayName(friendUserId, out string displayName, out bool isStale))
+                {
+                    friend.Name = displayName;
+                }
+
+                if (displayName == null || isStale)
+                {
+                    DirtyUserInfo.Add(friendUserId);
+                }
+
+                if (EOSUserDirectoryCache.Instance.TryGetProductUserId(friendUserId, out ProductUserId productUserId))
+                {
+                    friend.UserProductUserId = productUserId;
+                    AccountMappings[productUserId] = friendUserId;
+                }
+
+                CachedFriends.Add(friendUserId, friend);
+                CachedFriendsDirty = true;
+
+                DirtyPresence.Add(friendUserId);
+            }
+
+            if (friend.UserProductUserId == null || !friend.UserProductUserId.IsValid())
+            {
+                DirtyAccountMappings.Add(friendUserId);
+            }
+        }
+
+        private void RemoveCachedFriend(EpicAccountId friendUserId)
+        {
+            if (CachedFriends.Remove(friendUserId))
+            {
+                CachedFriendsDirty = true;
+            }
+
+            DirtyUserInfo.Remove(friendUserId);
+            DirtyPresence.Remove(friendUserId);
+            DirtyAccountMappings.Remove(friendUserId);
+        }
+
+        /// <summary>
+        /// Flushes the coalesced friend refreshes if <see cref="RefreshIntervalSeconds"/> has passed since the last flush.
+        /// Called every frame by the menus that use this manager, like the other managers' <c>Update</c>.
+        /// </summary>
+        public void Update()
+        {
+            if (Time.realtimeSinceStartup < NextRefreshTime)
+            {
+                return;
+            }
+
+            NextRefreshTime = Time.realtimeSinceStartup + RefreshIntervalSeconds;
+
+            EpicAccountId localUserId = EOSManager.Instance.GetLocalUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return;
+            }
+
+            FlushPresence(localUserId);
+            FlushAccountMappings();
+            FlushProductUserIdMappings();
+            FlushUserInfo(localUserId);
+
+            EOSUserDirectoryCache.Instance.SaveIfDirty();
+        }
+
+        private void FlushPresence(EpicAccountId localUserId)
+        {
+            if (DirtyPresence.Count == 0)
+            {
+                return;
+            }
+
+            foreach (EpicAccountId targetUserId in DirtyPresence)
+            {
+                if (PresenceQueriesInFlight.Contains(targetUserId))
+                {
+                    continue;
+                }
+
+                HasPresenceOptions hasPresenceOptions = new HasPresenceOptions()
+                {
+                    LocalUserId = localUserId,
+                    TargetUserId = targetUserId
+                };
+
+                // Presence change notifications arrive with the cache already updated, so only query what isn't cached
+                if (PresenceHandle.HasPresence(ref hasPresenceOptions))
+                {
+                    UpdateCachedPresence(localUserId, targetUserId);
+                }
+                else
+                {
+                    PresenceQueriesInFlight.Add(targetUserId);
+                    QueryPresenceInfo(localUserId, targetUserId);
+                }
+            }
+
+            DirtyPresence.Clear();
+        }
+
+        private void FlushAccountMappings()
+        {
+            if (DirtyAccountMappings.Count == 0)
+            {
+                return;
+            }
+
+            List<EpicAccountId> batch = new List<EpicAccountId>(ConnectInterface.QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS);
+
+            foreach (EpicAccountId account in DirtyAccountMappings)
+            {
+                batch.Add(account);
+
+                if (batch.Count == ConnectInterface.QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS)
+                {
+                    QueryFriendsConnectMappings(batch);
+                    batch = new List<EpicAccountId>(ConnectInterface.QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS);
+                }
+            }
+
+            if (batch.Count > 0)
+            {
+                QueryFriendsConnectMappings(batch);
+            }
+
+            DirtyAccountMappings.Clear();
+        }
+
+        private void FlushProductUserIdMappings()
+        {
+            if (DirtyProductUserIdMappings.Count == 0)
+            {
+                return;
+            }
+
+            ProductUserId localProductUserId = EOSManager.Instance.GetProductUserId();
+            if (localProductUserId == null || !localProductUserId.IsValid())
+            {
+                return;
+            }
+
+            // The SDK takes as many product user ids per query as it does external account ids
+            List<ProductUserId> batch = new List<ProductUserId>(ConnectInterface.QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS);
+
+            foreach (ProductUserId productUserId in DirtyProductUserIdMappings)
+            {
+                batch.Add(productUserId);
+
+                if (batch.Count == ConnectInterface.QUERYEXTERNALACCOUNTMAPPINGS_MAX_ACCOUNT_IDS)
+                {
+                    QueryProductUserIdMappings(localProductUserId, batch.ToArray());
+                    batch.Clear();
+                }
+            }
+
+            if (batch.Count > 0)
+            {
+                QueryProductUserIdMappings(localProductUserId, batch.ToArray());
+            }
+
+            DirtyProductUserIdMappings.Clear();
+        }
+
+        private void QueryProductUserIdMappings(ProductUserId localProductUserId, ProductUserId[] batch)
+        {
+            ProductUserIdMappingsInFlight.UnionWith(batch);
+
+            QueryProductUserIdMappingsOptions options = new QueryProductUserIdMappingsOptions()
+            {
+                LocalUserId = localProductUserId,
+                ProductUserIds = batch
+            };
+
+            ConnectHandle.QueryProductUserIdMappings(ref options, batch, OnQueryProductUserIdMappingsCompleted);
+        }
+
+        private void FlushUserInfo(EpicAccountId localUserId)
+        {
+            if (DirtyUserInfo.Count == 0)
+            {
+                return;
+            }
+
+            List<EpicAccountId> flushed = new List<EpicAccountId>();
+
+            foreach (EpicAccountId targetUserId in DirtyUserInfo)
+            {
+                if (UserInfoQueriesInFlight.Count >= MaxUserInfoQueriesPerFlush)
+                {
+                    break;
+                }
+
+                flushed.Add(targetUserId);
+
+                if (UserInfoQueriesInFlight.Contains(targetUserId))
+                {
+                    continue;
+                }
+
+                // Info may already be cached by the SDK, e.g. from a search or another manager's query
+                if (UpdateCachedUserInfo(localUserId, targetUserId) == Result.Success)
+                {
+                    continue;
+                }
+
+                QueryUserInfoOptions options = new QueryUserInfoOptions()
+                {
+                    LocalUserId = localUserId,
+                    TargetUserId = targetUserId
+                };
+
+                UserInfoQueriesInFlight.Add(targetUserId);
+                UserInfoHandle.QueryUserInfo(ref options, null, OnBatchedQueryUserInfoCompleted);
+            }
+
+            foreach (EpicAccountId targetUserId in flushed)
+            {
+                DirtyUserInfo.Remove(targetUserId);
+            }
+        }
+
+        private void OnBatchedQueryUserInfoCompleted(ref QueryUserInfoCallbackInfo data)
+        {
+            UserInfoQueriesInFlight.Remove(data.TargetUserId);
+
+            if (data.ResultCode != Result.Success)
+            {
+                Debug.LogErrorFormat("Friends (OnBatchedQueryUserInfoCompleted): Error calling QueryUserInfo: {0}", data.ResultCode);
+                return;
+            }
+
+            Result result = UpdateCachedUserInfo(data.LocalUserId, data.TargetUserId);
+
+            if (result != Result.Success)
+            {
+                Debug.LogErrorFormat("Friends (OnBatchedQueryUserInfoCompleted): CopyUserInfo error: {0}", result);
+            }
+        }
+
+        /// <summary>Copies cached user info for a friend into its <c>FriendData</c>.</summary>
+        /// <returns><c>Result.NotFound</c> if the SDK has no info for the user, or isn't tracking them as a friend.</returns>
+        private Result UpdateCachedUserInfo(EpicAccountId localUserId, EpicAccountId targetUserId)
+        {
+            if (!CachedFriends.TryGetValue(targetUserId, out FriendData friend))
+            {
+                return Result.NotFound;
+            }
+
+            CopyUserInfoOptions options = new CopyUserInfoOptions()
+            {
+                LocalUserId = localUserId,
+                TargetUserId = targetUserId
+            };
+
+            Result result = UserInfoHandle.CopyUserInfo(ref options, out UserInfoData? userInfo);
+
+            if (result == Result.Success)
+            {
+                friend.LocalUserId = localUserId;
+                friend.Name = userInfo?.DisplayName;
+                CachedFriendsDirty = true;
+
+                EOSUserDirectoryCache.Instance.SetDisplayName(targetUserId, friend.Name);
+            }
+
+            return result;
+        }
+
+        private void OnQueryProductUserIdMappingsCompleted(ref QueryProductUserIdMappingsCallbackInfo data)
+        {
+            ProductUserId[] batch = (ProductUserId[])data.ClientData;
+            ProductUserIdMappingsInFlight.ExceptWith(batch);
+
+            if (data.ResultCode != Result.Success)
+            {
+                Debug.LogErrorFormat("Friends (OnQueryProductUserIdMappingsCompleted): Error calling QueryProductUserIdMappings: {0}", data.ResultCode);
+                return;
+            }
+
+            GetProductUserIdMappingOptions options = new GetProductUserIdMappingOptions()
+            {
+                LocalUserId = data.LocalUserId,
+                AccountIdType = ExternalAccountType.Epic
+            };
+
+            foreach (ProductUserId productUserId in batch)
+            {
+                options.TargetProductUserId = productUserId;
+
+                Result result = ConnectHandle.GetProductUserIdMapping(ref options, out Utf8String accountIdString);
+
+                if (result == Result.Success)
+                {
+                    EpicAccountId accountId = EpicAccountId.FromString(accountIdString);
+                    if (accountId != null && accountId.IsValid())
+                    {
+                        AccountMappings[productUserId] = accountId;
+                        EOSUserDirectoryCache.Instance.SetAccountMapping(productUserId, accountId);
+                    }
+                }
+                else if (result != Result.NotFound)
+                {
+                    Debug.LogWarningFormat("Friends (OnQueryProductUserIdMappingsCompleted): GetProductUserIdMapping for {0} failed: {1}", productUserId, result);
+                }
+            }
+        }
+
         private void QueryPresenceInfo(EpicAccountId localUserId, EpicAccountId targetUserId)
         {
             QueryPresenceOptions options = new QueryPresenceOptions()
@@ -404,6 +782,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             //    return;
             //}
 
+            PresenceQueriesInFlight.Remove(data.TargetUserId);
+
             if (data.ResultCode != Result.Success)
             {
                 Debug.LogErrorFormat("Friends (OnQueryPresenceCompleted): Error calling QueryPresence: " + data.ResultCode);
@@ -412,35 +792,45 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             Debug.Log("Friends (OnQueryPresenceCompleted): QueryPresence successful");
 
+            UpdateCachedPresence(data.LocalUserId, data.TargetUserId);
+        }
+
+        /// <summary>Copies cached presence for a friend into its <c>PresenceInfo</c>, reusing the existing instance.</summary>
+        private void UpdateCachedPresence(EpicAccountId localUserId, EpicAccountId targetUserId)
+        {
+            if (!CachedFriends.TryGetValue(targetUserId, out FriendData friendData))
+            {
+                Debug.LogWarningFormat("Friends (UpdateCachedPresence): PresenceInfo not stored, couldn't find target user in friends cache: {0}", targetUserId);
+                return;
+            }
+
             CopyPresenceOptions presenceOptions = new CopyPresenceOptions()
             {
-                LocalUserId = data.LocalUserId,
-                TargetUserId = data.TargetUserId
+                LocalUserId = localUserId,
+                TargetUserId = targetUserId
             };
 
             Result result = PresenceHandle.CopyPresence(ref presenceOptions, out Info? presence);
 
             if(result != Result.Success)
             {
-                Debug.LogErrorFormat("Friends (OnQueryPresenceCompleted): CopyPresence error: {0}", result);
+                Debug.LogErrorFormat("Friends (UpdateCachedPresence): CopyPresence error: {0}", result);
                 return;
             }
 
             GetJoinInfoOptions joinInfoOptions = new GetJoinInfoOptions()
             {
-                LocalUserId = data.LocalUserId,
-                TargetUserId = data.TargetUserId
+                LocalUserId = localUserId,
+                TargetUserId = targetUserId
             };
 
-            // If the user has a Presence JoinInfo, set that in this incoming Presence.
-            PresenceInfo presenceInfo = new PresenceInfo()
-            {
-                Application = presence?.ProductId,
-                Platform = presence?.Platform,
-                Status = (Status)(presence?.Status),
-                RichText = presence?.RichText,
-                JoinInfo = null // Default to null until the value is determined
-            };
+            PresenceInfo presenceInfo = friendData.Presence ?? new PresenceInfo();
+
+            presenceInfo.Application = presence?.ProductId;
+            presenceInfo.Platform = presence?.Platform;
+            presenceInfo.Status = (Status)(presence?.Status);
+            presenceInfo.RichText = presence?.RichText;
+            presenceInfo.JoinInfo = null; // Default to null until the value is determined
 
             Result joinInfoResult = PresenceHandle.GetJoinInfo(ref joinInfoOptions, out Utf8String joinInfo);
 
@@ -451,37 +841,25 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 presenceInfo.JoinInfo = joinInfo;
             }
 
-            if(CachedFriends.TryGetValue(data.TargetUserId, out FriendData friendData))
-            {
-                friendData.Presence = presenceInfo;
-                CachedFriendsDirty = true;
-
-                Debug.LogFormat("Friends (OnQueryPresenceCompleted): PresenceInfo (Status) updated for target user: {0}", data.TargetUserId);
-            }
-            else
-            {
-                data.TargetUserId.ToString(out Utf8String targetUserIdString);
-
-                if(string.IsNullOrEmpty(targetUserIdString))
+            friendData.Presence = presenceInfo;
+            CachedFriendsDirty = true;
 
-                Debug.LogWarningFormat("Friends (OnQueryPresenceCompleted): PresenceInfo not stored, couldn't find target user in friends cache: {0}, ", data.TargetUserId);
-            }
+            Debug.LogFormat("Friends (UpdateCachedPresence): PresenceInfo (Status) updated for target user: {0}", targetUserId);
         }
 
-        private void QueryFriendsConnectMappings()
+        private void QueryFriendsConnectMappings(List<EpicAccountId> accounts)
         {
-            if(CachedFriends.Count == 0)
+            if(accounts.Count == 0)
             {
-                Debug.LogError("Friends (QueryFriendsConnectMappings): No friend cache.");
+                Debug.LogError("Friends (QueryFriendsConnectMappings): No accounts to query.");
                 return;
             }
 
-            var externalAccountIds = new Utf8String[CachedFriends.Count];
+            var externalAccountIds = new Utf8String[accounts.Count];
 
-            int i = 0;
-            foreach(EpicAccountId account in CachedFriends.Keys)
+            for (int i = 0; i < accounts.Count; i++)
             {
-                Result result = account.ToString(out Utf8String accountAsString);
+                Result result = accounts[i].ToString(out Utf8String accountAsString);
 
                 if(result != Result.Success)
                 {
@@ -490,7 +868,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 }
 
                 externalAccountIds[i] = accountAsString;
-                i++;
             }
 
             QueryExternalAccountMappingsOptions options = new QueryExternalAccountMappingsOptions()
@@ -500,7 +877,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 ExternalAccountIds = externalAccountIds
             };
 
-            ConnectHandle.QueryExternalAccountMappings(ref options, null, OnQueryExternalAccountMappingsCompleted);
+            ConnectHandle.QueryExternalAccountMappings(ref options, accounts, OnQueryExternalAccountMappingsCompleted);
         }
 
         private void OnQueryExternalAccountMappingsCompleted(ref QueryExternalAccountMappingsCallbackInfo data)
@@ -521,9 +898,10 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             Dictionary<EpicAccountId, ProductUserId> mappingsToUpdate = new Dictionary<EpicAccountId, ProductUserId>();
 
-            foreach (FriendData friend in CachedFriends.Values)
+            // Only the accounts in this batch have been queried
+            foreach (EpicAccountId account in (List<EpicAccountId>)data.ClientData)
             {
-                if(friend.UserProductUserId == null || !friend.UserProductUserId.IsValid())
+                if(CachedFriends.TryGetValue(account, out FriendData friend) && (friend.UserProductUserId == null || !friend.UserProductUserId.IsValid()))
                 {
                     Result result = friend.UserId.ToString(out Utf8String epidAccountIdString);
 
@@ -558,6 +936,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 if(CachedFriends.TryGetValue(kvp.Key, out FriendData friend))
                 {
                     friend.UserProductUserId = kvp.Value;
+                    AccountMappings[kvp.Value] = kvp.Key;
+                    EOSUserDirectoryCache.Instance.SetAccountMapping(kvp.Value, kvp.Key);
+                    CachedFriendsDirty = true;
                 }
                 else
                 {
@@ -886,11 +1267,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 if(data.CurrentStatus == FriendsStatus.NotFriends)
                 {
-                    if(CachedFriends.ContainsKey(data.TargetUserId)) //UserId
-                    {
-                        CachedFriends.Remove(data.TargetUserId);
-                        CachedFriendsDirty = true;
-                    }
+                    RemoveCachedFriend(data.TargetUserId);
                 }
                 else
                 {
@@ -905,8 +1282,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     }
                     else
                     {
-                        // New Friend
-                        QueryFriends(null);
+                        // New Friend, resolved in the next batched refresh
+                        UpdateCachedFriend(data.LocalUserId, data.TargetUserId, data.CurrentStatus);
                     }
                 }
             }
@@ -920,7 +1297,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             //    return;
             //}
 
-            QueryPresenceInfo(data.LocalUserId, data.PresenceUserId);
+            // Coalesced with any other changes to this user until the next flush
+            if (CachedFriends.ContainsKey(data.PresenceUserId))
+            {
+                DirtyPresence.Add(data.PresenceUserId);
+            }
         }
 
         /// <summary>User Logged In actions</summary>
@@ -945,6 +1326,16 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 UnsubscribeFromFriendUpdates(localUser);
             }
+
+            DirtyPresence.Clear();
+            DirtyUserInfo.Clear();
+            DirtyAccountMappings.Clear();
+            DirtyProductUserIdMappings.Clear();
+            PresenceQueriesInFlight.Clear();
+            UserInfoQueriesInFlight.Clear();
+            ProductUserIdMappingsInFlight.Clear();
+
+            EOSUserDirectoryCache.Instance.SaveIfDirty(true);
         }
     }
 }
\ No newline at end of file
@@ -41,12 +41,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         public Transform parent;
         public UIHighFrequencyPeer2PeerMenu owner;
 
-        public float packetSizeMB = 0.5f;
-        public int refreshRate = 60;
-        private float timer;
-
-        public bool sendActive = false;
-        private List<float> dataDump;
         public const string CoordinateMessagePrefix = "m";
         
 #if UNITY_EDITOR
@@ -71,7 +65,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             ChatDataCache = new Dictionary<ProductUserId, ChatWithFriendData>();
             ChatDataCacheDirty = true;
-            updatePacketSize();
         }
 
 #if UNITY_EDITOR
@@ -80,29 +73,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             UnityEditor.EditorApplication.playModeStateChanged -= OnPlayModeChanged;
         }
 #endif
-        public void updatePacketSize()
-        {
-            dataDump = new List<float>();
-            for (int i = 0; i < packetSizeMB * 256; i++)
-            {
-                dataDump.Add(i);
-            }
-        }
-
-
-        public void P2PUpdate()
-        {
-            timer += Time.deltaTime;
-            if (timer > 1 / refreshRate)
-            {
-                timer = 0;
-                SendMessageHF();
-            }
-        }
-        void SendMessageHF()
-        {
-            SendMessage(owner.GetCurrentFriendId(), dataDump.ToString());
-        }
         public bool GetChatDataCache(out Dictionary<ProductUserId, ChatWithFriendData> ChatDataCache)
         {
             ChatDataCache = this.ChatDataCache;
@@ -42,6 +42,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         private List<LeaderboardRecord> CachedLeaderboardRecords;
         private bool CachedLeaderboardRecordsDirty;
+        private bool CachedLeaderboardRecordsStale;
+        private LeaderboardRecordPager RecordPager;
 
         private Dictionary<string, List<LeaderboardUserScore>> CachedLeaderboardUserScores;
         private bool CachedLeaderboardUserScoresDirty;
@@ -69,6 +71,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             LeaderboardsHandle = EOSManager.Instance.GetEOSPlatformInterface().GetLeaderboardsInterface();
             StatsHandle = EOSManager.Instance.GetEOSPlatformInterface().GetStatsInterface();
 
+            RecordPager = new LeaderboardRecordPager(LeaderboardsHandle);
+
             QueryDefinitionsCallback = null;
             QueryRanksCallback = null;
             QueryUserScoresCallback = null;
@@ -94,6 +98,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             CachedLeaderboardRecords.Clear();
             CachedLeaderboardRecordsDirty = true;
+            CachedLeaderboardRecordsStale = false;
+            RecordPager.Clear();
 
             CachedLeaderboardUserScores.Clear();
             CachedLeaderboardUserScoresDirty = true;
@@ -114,10 +120,16 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         }
 
         /// <summary>Returns cached <c>LeaderboardRecord</c> List.</summary>
+        /// <remarks>Copies every record of the last rank query on first call after it; prefer <c>GetLeaderboardRecordWindow()</c> for large leaderboards.</remarks>
         /// <param name="LeaderboardsRecords">Out parameter returns List of <c>LeaderboardRecord</c>.</param>
         /// <returns>True if <c>LeaderboardRecords</c> has changed since last call.</returns>
         public bool GetCachedLeaderboardRecords(out List<LeaderboardRecord> LeaderboardsRecords)
         {
+            if (CachedLeaderboardRecordsStale)
+            {
+                CacheLeaderboardRecords();
+            }
+
             LeaderboardsRecords = CachedLeaderboardRecords;
 
             bool returnDirty = CachedLeaderboardRecordsDirty;
@@ -127,6 +139,22 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return returnDirty;
         }
 
+        /// <summary>Returns the number of records returned by the last rank query.</summary>
+        public int GetLeaderboardRecordCount()
+        {
+            return RecordPager.RecordCount;
+        }
+
+        /// <summary>Copies a window of records from the last rank query, loading only the pages it covers.</summary>
+        /// <param name="firstIndex">Index of the first record, 0 being rank 1.</param>
+        /// <param name="count">Number of records wanted.</param>
+        /// <param name="LeaderboardRecords">List cleared and filled with the records in the window.</param>
+        /// <returns>True if every record in the window could be copied.</returns>
+        public bool GetLeaderboardRecordWindow(int firstIndex, int count, List<LeaderboardRecord> LeaderboardRecords)
+        {
+            return RecordPager.GetWindow(firstIndex, count, LeaderboardRecords);
+        }
+
         /// <summary>Returns cached <c>LeaderboardUserScore</c> Dictionary where LeaderboardId is the key.</summary>
         /// <param name="LeaderboardUserScores">Out parameter returns Dictionary where LeaderboardId is the key and <c>LeaderboardUserScore</c> is the value.</param>
         /// <returns>True if <c>LeaderboardUserScores</c> has changed since last call.</returns>
@@ -248,30 +276,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         private void CacheLeaderboardRecords()
         {
-            var GetLeaderboardRecordCountOptions = new GetLeaderboardRecordCountOptions();
-            uint leaderboardRecordsCount = LeaderboardsHandle.GetLeaderboardRecordCount(ref GetLeaderboardRecordCountOptions);
+            CachedLeaderboardRecordsStale = false;
 
-            CachedLeaderboardRecords.Clear();
-
-            for (uint recordIndex = 0; recordIndex < leaderboardRecordsCount; recordIndex++)
+            if (!RecordPager.GetWindow(0, RecordPager.RecordCount, CachedLeaderboardRecords))
             {
-                CopyLeaderboardRecordByIndexOptions options = new CopyLeaderboardRecordByIndexOptions()
-                {
-                    LeaderboardRecordIndex = recordIndex
-                };
-
-                Result result = LeaderboardsHandle.CopyLeaderboardRecordByIndex(ref options, out LeaderboardRecord? leaderboardRecord);
-
-                if (result != Result.Success)
-                {
-                    Debug.LogErrorFormat("Leaderboard (CacheLeaderboardRecords): CopyLeaderboardRecordByIndex failed '{0}'", result);
-                    break;
-                }
-
-                CachedLeaderboardRecords.Add(leaderboardRecord.Value);
+                Debug.LogError("Leaderboard (CacheLeaderboardRecords): Not all records could be copied");
             }
-
-            CachedLeaderboardRecordsDirty = true;
         }
 
         private void LeaderboardRanksReceivedCallbackFn(ref OnQueryLeaderboardRanksCompleteCallbackInfo data)
@@ -292,7 +302,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             Debug.Log("Leaderboard (LeaderboardRanksReceivedCallbackFn): Query Ranks Complete");
 
-            CacheLeaderboardRecords();
+            // Records are copied on demand, one page at a time
+            RecordPager.Reset();
+            CachedLeaderboardRecords.Clear();
+            CachedLeaderboardRecordsStale = true;
+            CachedLeaderboardRecordsDirty = true;
 
             QueryRanksCallback?.Invoke(Result.Success);
         }
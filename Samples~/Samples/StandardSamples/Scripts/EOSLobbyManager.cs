@@ -38,6 +38,43 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         Kicked
     }
 
+    /// <summary>
+    /// Kind of difference found by <see cref="Lobby.InitFromLobbyDetails"/> between two snapshots of a lobby
+    /// </summary>
+    public enum LobbySnapshotChangeType
+    {
+        OwnerChanged,
+        InfoChanged,
+        AttributeAdded,
+        AttributeChanged,
+        AttributeRemoved,
+        MemberJoined,
+        MemberLeft,
+        MemberAttributeAdded,
+        MemberAttributeChanged,
+        MemberAttributeRemoved
+    }
+
+    /// <summary>
+    /// Describes a single difference between two snapshots of a lobby.
+    /// <c>MemberId</c> is set for owner and member changes, <c>Key</c> for attribute changes.
+    /// </summary>
+    public readonly struct LobbySnapshotChange
+    {
+        public LobbySnapshotChangeType ChangeType { get; }
+        public ProductUserId MemberId { get; }
+        public string Key { get; }
+
+        public LobbySnapshotChange(LobbySnapshotChangeType changeType, ProductUserId memberId, string key)
+        {
+            ChangeType = changeType;
+            MemberId = memberId;
+            Key = key;
+        }
+    }
+
+    public delegate void LobbySnapshotChangedHandler(Lobby lobby, LobbySnapshotChange change);
+
     /// <summary>
     /// Class represents all Lobby properties
     /// </summary>
@@ -82,6 +119,18 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         public bool _SearchResult = false;
         public bool _BeingCreated = false;
 
+        /// <summary>
+        /// Raised for every difference found while applying a new snapshot in <see cref="InitFromLobbyDetails"/>
+        /// or <see cref="InitMemberFromLobbyHandle"/>.
+        /// </summary>
+        public event LobbySnapshotChangedHandler SnapshotChanged;
+
+        // Scratch state reused between snapshots so that diffing does not allocate once the lobby has warmed up
+        private readonly Dictionary<string, LobbyAttribute> PreviousAttributes = new Dictionary<string, LobbyAttribute>();
+        private readonly Dictionary<ProductUserId, LobbyMember> PreviousMembers = new Dictionary<ProductUserId, LobbyMember>();
+        private readonly List<string> StaleMemberAttributeKeys = new List<string>();
+        private uint SnapshotGeneration = 0;
+
         /// <summary>
         /// Checks if Lobby Id is valid
         /// </summary>
@@ -125,28 +174,46 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             Id = lobbyId;
 
-            CopyLobbyDetailsHandleOptions options = new CopyLobbyDetailsHandleOptions();
-            options.LobbyId = Id;
-            options.LocalUserId = EOSManager.Instance.GetProductUserId();
+            if (!TryCopyLobbyDetailsHandle("InitFromLobbyHandle", out LobbyDetails outLobbyDetailsHandle))
+            {
+                return;
+            }
 
-            Result result = EOSManager.Instance.GetEOSLobbyInterface().CopyLobbyDetailsHandle(ref options, out LobbyDetails outLobbyDetailsHandle);
-            if (result != Result.Success)
+            InitFromLobbyDetails(outLobbyDetailsHandle);
+            outLobbyDetailsHandle.Release();
+        }
+
+        /// <summary>
+        /// Refreshes only the attributes of the specified member, which is all that can change
+        /// when a member update notification is received. Falls back to a full refresh if the
+        /// member is not known yet.
+        /// </summary>
+        /// <param name="lobbyId">Specified Lobby Id</param>
+        /// <param name="memberId">Member whose attributes were updated</param>
+        public void InitMemberFromLobbyHandle(string lobbyId, ProductUserId memberId)
+        {
+            LobbyMember member = FindMember(memberId);
+            if (member == null || Id != lobbyId)
             {
-                Debug.LogErrorFormat("Lobbies (InitFromLobbyHandle): can't get lobby info handle. Error code: {0}", result);
+                InitFromLobbyHandle(lobbyId);
                 return;
             }
-            if (outLobbyDetailsHandle == null)
+
+            if (!TryCopyLobbyDetailsHandle("InitMemberFromLobbyHandle", out LobbyDetails outLobbyDetailsHandle))
             {
-                Debug.LogError("Lobbies (InitFromLobbyHandle): can't get lobby info handle. outLobbyDetailsHandle is null");
                 return;
             }
 
-            InitFromLobbyDetails(outLobbyDetailsHandle);
+            UpdateMemberAttributes(outLobbyDetailsHandle, member);
+            outLobbyDetailsHandle.Release();
         }
 
         //-------------------------------------------------------------------------
         /// <summary>
-        /// Initializing the given <c>LobbyDetails</c> handle and caches all relevant attributes
+        /// Initializing the given <c>LobbyDetails</c> handle and caches all relevant attributes.
+        /// The new snapshot is diffed against the cached one: attributes and members are matched by key and
+        /// <c>ProductUserId</c>, existing objects are updated in place (so member RTC state is kept) and
+        /// <see cref="SnapshotChanged"/> is raised for every difference.
         /// </summary>
         /// <param name="lobbyId">Specified <c>LobbyDetails</c> handle</param>
         public void InitFromLobbyDetails(LobbyDetails outLobbyDetailsHandle)
@@ -159,6 +226,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 LobbyOwner = newLobbyOwner;
                 LobbyOwnerAccountId = new EpicAccountId();
                 LobbyOwnerDisplayName = string.Empty;
+                RaiseSnapshotChanged(LobbySnapshotChangeType.OwnerChanged, newLobbyOwner, null);
             }
 
             // copy lobby info
@@ -175,16 +243,48 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
-            Id = outLobbyDetailsInfo?.LobbyId;
-            MaxNumLobbyMembers = (uint)(outLobbyDetailsInfo?.MaxMembers);
-            LobbyPermissionLevel = (LobbyPermissionLevel)(outLobbyDetailsInfo?.PermissionLevel);
-            AllowInvites = (bool)(outLobbyDetailsInfo?.AllowInvites);
-            AvailableSlots = (uint)(outLobbyDetailsInfo?.AvailableSlots);
-            BucketId = outLobbyDetailsInfo?.BucketId;
-            RTCRoomEnabled = (bool)(outLobbyDetailsInfo?.RTCRoomEnabled);
+            LobbyDetailsInfo info = outLobbyDetailsInfo.Value;
+            string newId = info.LobbyId;
+            string newBucketId = info.BucketId;
+
+            bool infoChanged = Id != newId ||
+                MaxNumLobbyMembers != info.MaxMembers ||
+                LobbyPermissionLevel != info.PermissionLevel ||
+                AllowInvites != info.AllowInvites ||
+                AvailableSlots != info.AvailableSlots ||
+                BucketId != newBucketId ||
+                RTCRoomEnabled != info.RTCRoomEnabled;
 
-            // get attributes
+            Id = newId;
+            MaxNumLobbyMembers = info.MaxMembers;
+            LobbyPermissionLevel = info.PermissionLevel;
+            AllowInvites = info.AllowInvites;
+            AvailableSlots = info.AvailableSlots;
+            BucketId = newBucketId;
+            RTCRoomEnabled = info.RTCRoomEnabled;
+
+            if (infoChanged)
+            {
+                RaiseSnapshotChanged(LobbySnapshotChangeType.InfoChanged, null, null);
+            }
+
+            UpdateAttributes(outLobbyDetailsHandle);
+            UpdateMembers(outLobbyDetailsHandle);
+        }
+
+        private void UpdateAttributes(LobbyDetails outLobbyDetailsHandle)
+        {
+            // Anything left in PreviousAttributes after the copy loop is no longer part of the lobby
+            PreviousAttributes.Clear();
+            foreach (LobbyAttribute attribute in Attributes)
+            {
+                if (attribute.Key != null)
+                {
+                    PreviousAttributes[attribute.Key] = attribute;
+                }
+            }
             Attributes.Clear();
+
             var lobbyDetailsGetAttributeCountOptions = new LobbyDetailsGetAttributeCountOptions();
             uint attrCount = outLobbyDetailsHandle.GetAttributeCount(ref lobbyDetailsGetAttributeCountOptions);
             for (uint i = 0; i < attrCount; i++)
@@ -192,62 +292,187 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 LobbyDetailsCopyAttributeByIndexOptions attrOptions = new LobbyDetailsCopyAttributeByIndexOptions();
                 attrOptions.AttrIndex = i;
                 Result copyAttrResult = outLobbyDetailsHandle.CopyAttributeByIndex(ref attrOptions, out Epic.OnlineServices.Lobby.Attribute? outAttribute);
-                if (copyAttrResult == Result.Success && outAttribute != null && outAttribute?.Data != null)
+                if (copyAttrResult != Result.Success || outAttribute?.Data == null)
                 {
-                    LobbyAttribute attr = new LobbyAttribute();
+                    continue;
+                }
+
+                string key = outAttribute.Value.Data.Value.Key;
+                if (key != null && PreviousAttributes.TryGetValue(key, out LobbyAttribute attr))
+                {
+                    PreviousAttributes.Remove(key);
+                    if (attr.UpdateFromAttribute(outAttribute))
+                    {
+                        RaiseSnapshotChanged(LobbySnapshotChangeType.AttributeChanged, null, key);
+                    }
+                }
+                else
+                {
+                    attr = new LobbyAttribute();
                     attr.InitFromAttribute(outAttribute);
-                    Attributes.Add(attr);
+                    RaiseSnapshotChanged(LobbySnapshotChangeType.AttributeAdded, null, attr.Key);
                 }
+
+                Attributes.Add(attr);
             }
 
-            // get members
-            List<LobbyMember> OldMembers = new List<LobbyMember>(Members);
+            foreach (string removedKey in PreviousAttributes.Keys)
+            {
+                RaiseSnapshotChanged(LobbySnapshotChangeType.AttributeRemoved, null, removedKey);
+            }
+            PreviousAttributes.Clear();
+        }
+
+        private void UpdateMembers(LobbyDetails outLobbyDetailsHandle)
+        {
+            // Members are matched by id, so existing objects (and their RTC state) survive the refresh
+            PreviousMembers.Clear();
+            foreach (LobbyMember member in Members)
+            {
+                if (member.ProductId != null)
+                {
+                    PreviousMembers[member.ProductId] = member;
+                }
+            }
             Members.Clear();
 
             var lobbyDetailsGetMemberCountOptions = new LobbyDetailsGetMemberCountOptions();
             uint memberCount = outLobbyDetailsHandle.GetMemberCount(ref lobbyDetailsGetMemberCountOptions);
 
-            for (int memberIndex = 0; memberIndex < memberCount; memberIndex++)
+            for (uint memberIndex = 0; memberIndex < memberCount; memberIndex++)
             {
-                var lobbyDetailsGetMemberByIndexOptions = new LobbyDetailsGetMemberByIndexOptions() { MemberIndex = (uint)memberIndex };
+                var lobbyDetailsGetMemberByIndexOptions = new LobbyDetailsGetMemberByIndexOptions() { MemberIndex = memberIndex };
                 ProductUserId memberId = outLobbyDetailsHandle.GetMemberByIndex(ref lobbyDetailsGetMemberByIndexOptions);
-                Members.Insert((int)memberIndex, new LobbyMember() { ProductId = memberId });
+                if (memberId == null)
+                {
+                    continue;
+                }
 
-                // member attributes
-                var lobbyDetailsGetMemberAttributeCountOptions = new LobbyDetailsGetMemberAttributeCountOptions() { TargetUserId = memberId };
-                int memberAttributeCount = (int)outLobbyDetailsHandle.GetMemberAttributeCount(ref lobbyDetailsGetMemberAttributeCountOptions);
+                bool joined = !PreviousMembers.TryGetValue(memberId, out LobbyMember member);
+                if (joined)
+                {
+                    member = new LobbyMember() { ProductId = memberId };
+                }
+                else
+                {
+                    PreviousMembers.Remove(memberId);
+                }
+
+                Members.Add(member);
 
-                for (int attributeIndex = 0; attributeIndex < memberAttributeCount; attributeIndex++)
+                if (joined)
                 {
-                    var lobbyDetailsCopyMemberAttributeByIndexOptions = new LobbyDetailsCopyMemberAttributeByIndexOptions() { AttrIndex = (uint)attributeIndex, TargetUserId = memberId };
-                    Result memberAttributeResult = outLobbyDetailsHandle.CopyMemberAttributeByIndex(ref lobbyDetailsCopyMemberAttributeByIndexOptions, out Epic.OnlineServices.Lobby.Attribute? outAttribute);
+                    RaiseSnapshotChanged(LobbySnapshotChangeType.MemberJoined, memberId, null);
+                }
 
-                    if (memberAttributeResult != Result.Success)
-                    {
-                        Debug.LogFormat("Lobbies (InitFromLobbyDetails): can't copy member attribute. Error code: {0}", memberAttributeResult);
-                        continue;
-                    }
+                UpdateMemberAttributes(outLobbyDetailsHandle, member);
+            }
+
+            foreach (LobbyMember leftMember in PreviousMembers.Values)
+            {
+                RaiseSnapshotChanged(LobbySnapshotChangeType.MemberLeft, leftMember.ProductId, null);
+            }
+            PreviousMembers.Clear();
+        }
 
-                    LobbyAttribute newAttribute = new LobbyAttribute();
-                    newAttribute.InitFromAttribute(outAttribute);
- 
-                    Members[memberIndex].MemberAttributes.Add(newAttribute.Key, newAttribute);
+        private void UpdateMemberAttributes(LobbyDetails outLobbyDetailsHandle, LobbyMember member)
+        {
+            // Attributes touched by this snapshot are stamped with the current generation, the rest are stale
+            uint generation = ++SnapshotGeneration;
+            ProductUserId memberId = member.ProductId;
+
+            var lobbyDetailsGetMemberAttributeCountOptions = new LobbyDetailsGetMemberAttributeCountOptions() { TargetUserId = memberId };
+            uint memberAttributeCount = outLobbyDetailsHandle.GetMemberAttributeCount(ref lobbyDetailsGetMemberAttributeCountOptions);
+
+            for (uint attributeIndex = 0; attributeIndex < memberAttributeCount; attributeIndex++)
+            {
+                var lobbyDetailsCopyMemberAttributeByIndexOptions = new LobbyDetailsCopyMemberAttributeByIndexOptions() { AttrIndex = attributeIndex, TargetUserId = memberId };
+                Result memberAttributeResult = outLobbyDetailsHandle.CopyMemberAttributeByIndex(ref lobbyDetailsCopyMemberAttributeByIndexOptions, out Epic.OnlineServices.Lobby.Attribute? outAttribute);
+
+                if (memberAttributeResult != Result.Success)
+                {
+                    Debug.LogFormat("Lobbies (InitFromLobbyDetails): can't copy member attribute. Error code: {0}", memberAttributeResult);
+                    continue;
                 }
 
-                // Copy RTC Status from old members
-                foreach(LobbyMember oldLobbyMember in OldMembers)
+                if (outAttribute?.Data == null)
                 {
-                    LobbyMember newMember = Members[memberIndex];
-                    if(oldLobbyMember.ProductId != newMember.ProductId)
+                    continue;
+                }
+
+                string key = outAttribute.Value.Data.Value.Key;
+                if (key != null && member.MemberAttributes.TryGetValue(key, out LobbyAttribute attr))
+                {
+                    if (attr.UpdateFromAttribute(outAttribute))
                     {
-                        continue;
+                        RaiseSnapshotChanged(LobbySnapshotChangeType.MemberAttributeChanged, memberId, key);
                     }
+                }
+                else
+                {
+                    attr = new LobbyAttribute();
+                    attr.InitFromAttribute(outAttribute);
+                    member.MemberAttributes[attr.Key] = attr;
+                    RaiseSnapshotChanged(LobbySnapshotChangeType.MemberAttributeAdded, memberId, attr.Key);
+                }
 
-                    // Copy RTC status to new object
-                    newMember.RTCState = oldLobbyMember.RTCState;
-                    break;
+                attr.SnapshotGeneration = generation;
+            }
+
+            StaleMemberAttributeKeys.Clear();
+            foreach (KeyValuePair<string, LobbyAttribute> kvp in member.MemberAttributes)
+            {
+                if (kvp.Value.SnapshotGeneration != generation)
+                {
+                    StaleMemberAttributeKeys.Add(kvp.Key);
+                }
+            }
+
+            foreach (string staleKey in StaleMemberAttributeKeys)
+            {
+                member.MemberAttributes.Remove(staleKey);
+                RaiseSnapshotChanged(LobbySnapshotChangeType.MemberAttributeRemoved, memberId, staleKey);
+            }
+            StaleMemberAttributeKeys.Clear();
+        }
+
+        private LobbyMember FindMember(ProductUserId memberId)
+        {
+            foreach (LobbyMember member in Members)
+            {
+                if (member.ProductId == memberId)
+                {
+                    return member;
                 }
             }
+
+            return null;
+        }
+
+        private bool TryCopyLobbyDetailsHandle(string caller, out LobbyDetails outLobbyDetailsHandle)
+        {
+            CopyLobbyDetailsHandleOptions options = new CopyLobbyDetailsHandleOptions();
+            options.LobbyId = Id;
+            options.LocalUserId = EOSManager.Instance.GetProductUserId();
+
+            Result result = EOSManager.Instance.GetEOSLobbyInterface().CopyLobbyDetailsHandle(ref options, out outLobbyDetailsHandle);
+            if (result != Result.Success)
+            {
+                Debug.LogErrorFormat("Lobbies ({0}): can't get lobby info handle. Error code: {1}", caller, result);
+                return false;
+            }
+            if (outLobbyDetailsHandle == null)
+            {
+                Debug.LogErrorFormat("Lobbies ({0}): can't get lobby info handle. outLobbyDetailsHandle is null", caller);
+                return false;
+            }
+
+            return true;
+        }
+
+        private void RaiseSnapshotChanged(LobbySnapshotChangeType changeType, ProductUserId memberId, string key)
+        {
+            SnapshotChanged?.Invoke(this, new LobbySnapshotChange(changeType, memberId, key));
         }
     }
 
@@ -343,28 +568,51 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return base.GetHashCode();
         }
 
+        // Generation of the last lobby snapshot that contained this attribute, see Lobby.UpdateMemberAttributes
+        internal uint SnapshotGeneration;
+
         public void InitFromAttribute(Epic.OnlineServices.Lobby.Attribute? attributeParam)
         {
             AttributeData attributeData = (AttributeData)(attributeParam?.Data);
 
             Key = attributeData.Key;
+            UpdateFromAttribute(attributeParam);
+        }
+
+        /// <summary>
+        /// Updates the type and value of this attribute in place
+        /// </summary>
+        /// <param name="attributeParam">Attribute copied from the lobby, expected to have the same key</param>
+        /// <returns>True if the type or value changed</returns>
+        public bool UpdateFromAttribute(Epic.OnlineServices.Lobby.Attribute? attributeParam)
+        {
+            AttributeData attributeData = (AttributeData)(attributeParam?.Data);
+
+            bool changed = ValueType != attributeData.Value.ValueType;
             ValueType = attributeData.Value.ValueType;
 
             switch (attributeData.Value.ValueType)
             {
                 case AttributeType.Boolean:
+                    changed |= AsBool != attributeData.Value.AsBool;
                     AsBool = attributeData.Value.AsBool;
                     break;
                 case AttributeType.Int64:
+                    changed |= AsInt64 != attributeData.Value.AsInt64;
                     AsInt64 = attributeData.Value.AsInt64;
                     break;
                 case AttributeType.Double:
+                    changed |= AsDouble != attributeData.Value.AsDouble;
                     AsDouble = attributeData.Value.AsDouble;
                     break;
                 case AttributeType.String:
-                    AsString = attributeData.Value.AsUtf8;
+                    string newString = attributeData.Value.AsUtf8;
+                    changed |= AsString != newString;
+                    AsString = newString;
                     break;
             }
+
+            return changed;
         }
     }
 
@@ -509,16 +757,26 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         private List<Action> LobbyUpdateCallbacks;
 
+        /// <summary>
+        /// Raised for every attribute and member difference applied to the current lobby,
+        /// see <see cref="Lobby.SnapshotChanged"/>.
+        /// </summary>
+        public event LobbySnapshotChangedHandler CurrentLobbySnapshotChanged;
+
         private EOSUserInfoManager UserInfoManager;
         
         public LocalRTCOptions? customLocalRTCOptions;
 
+        // Write-behind queue for ModifyLobby and SetMemberAttribute, disabled until a batch window is set
+        private LobbyModificationQueue ModificationQueue;
+
         // Init
         public EOSLobbyManager()
         {
             UserInfoManager = EOSManager.Instance.GetOrCreateManager<EOSUserInfoManager>();
 
-            CurrentLobby = new Lobby();
+            ModificationQueue = new LobbyModificationQueue(0.0f);
+            SetCurrentLobby(new Lobby());
             ActiveJoin = new LobbyJoinRequest();
 
             Invites = new Dictionary<ProductUserId, LobbyInvite>();
@@ -538,6 +796,66 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return CurrentLobby;
         }
 
+        private void SetCurrentLobby(Lobby lobby)
+        {
+            if (CurrentLobby != null)
+            {
+                CurrentLobby.SnapshotChanged -= OnCurrentLobbySnapshotChanged;
+            }
+
+            // Queued writes target the previous lobby
+            ModificationQueue.Reset(Result.Canceled);
+
+            CurrentLobby = lobby;
+            CurrentLobby.SnapshotChanged += OnCurrentLobbySnapshotChanged;
+        }
+
+        private void OnCurrentLobbySnapshotChanged(Lobby lobby, LobbySnapshotChange change)
+        {
+            CurrentLobbySnapshotChanged?.Invoke(lobby, change);
+        }
+
+        private void ClearCurrentLobby()
+        {
+            ModificationQueue.Reset(Result.Canceled);
+            CurrentLobby.Clear();
+        }
+
+        /// <summary>
+        /// Returns the queue used to batch <see cref="ModifyLobby"/> and <see cref="SetMemberAttribute"/> writes.
+        /// Set <see cref="LobbyModificationQueue.BatchWindowSeconds"/> to enable batching; <see cref="Update"/>
+        /// must then be called every frame to submit the batches.
+        /// </summary>
+        public LobbyModificationQueue GetModificationQueue()
+        {
+            return ModificationQueue;
+        }
+
+        /// <summary>
+        /// Submits queued lobby modifications once their batch window has elapsed.
+        /// This Manager is not a MonoBehaviour, so this function should be run by the program every update
+        /// when lobby modification batching is enabled.
+        /// </summary>
+        public void Update()
+        {
+            if (ModificationQueue.IsReadyToSubmit(Time.realtimeSinceStartup))
+            {
+                SubmitLobbyModificationBatch(ModificationQueue.BeginSubmit());
+            }
+        }
+
+        /// <summary>
+        /// Submits queued lobby modifications immediately, without waiting for the batch window.
+        /// Has no effect while a previous batch is still in flight.
+        /// </summary>
+        public void FlushLobbyModifications()
+        {
+            if (ModificationQueue.IsReadyToSubmit(Time.realtimeSinceStartup, true))
+            {
+                SubmitLobbyModificationBatch(ModificationQueue.BeginSubmit());
+            }
+        }
+
         public Dictionary<ProductUserId, LobbyInvite> GetInvites()
         {
             return Invites;
@@ -981,7 +1299,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         {
             _Dirty = true;
             CurrentInvite = null;
-            CurrentLobby = new Lobby();
+            SetCurrentLobby(new Lobby());
 
             SubscribeToLobbyUpdates();
             SubscribeToLobbyInvites();
@@ -1003,7 +1321,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             UnsubscribeFromLobbyInvites();
             UnsubscribeFromLobbyUpdates();
 
-            CurrentLobby = new Lobby();
+            SetCurrentLobby(new Lobby());
             ActiveJoin = new LobbyJoinRequest();
 
             Invites.Clear();
@@ -1069,7 +1387,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             EOSManager.Instance.GetEOSLobbyInterface().CreateLobby(ref createLobbyOptions, CreateLobbyCompleted, OnCreateLobbyCompleted);
 
             // Save lobby data for modification
-            CurrentLobby = lobbyProperties;
+            SetCurrentLobby(lobbyProperties);
             CurrentLobby._BeingCreated = true;
             CurrentLobby.LobbyOwner = currentUserProductId;
         }
@@ -1104,6 +1422,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
+            if (ModificationQueue.IsEnabled)
+            {
+                ModificationQueue.EnqueueLobbyUpdates(lobbyUpdates, CurrentLobby, ModififyLobbyCompleted, Time.realtimeSinceStartup);
+                return;
+            }
+
             UpdateLobbyModificationOptions options = new UpdateLobbyModificationOptions();
             options.LobbyId = CurrentLobby.Id;
             options.LocalUserId = currentProductUserId;
@@ -1224,6 +1548,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             UnsubscribeFromRTCEvents();
 
+            // Queued writes would target the lobby being left
+            ModificationQueue.Reset(Result.Canceled);
+
             LeaveLobbyOptions options = new LeaveLobbyOptions();
             options.LobbyId = CurrentLobby.Id;
             options.LocalUserId = EOSManager.Instance.GetProductUserId();
@@ -1265,11 +1592,23 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// Wrapper for calling [EOS_LobbyModification_AddMemberAttribute](https://dev.epicgames.com/docs/services/en-US/API/Members/Functions/Lobby/EOS_LobbyModification_AddMemberAttribute/index.html)
         /// </summary>
         /// <param name="memberAttribute"><c>LobbyAttribute</c> to be added to the current lobby</param>
-        public void SetMemberAttribute(LobbyAttribute memberAttribute)
+        /// <param name="SetMemberAttributeCompleted">Callback when the lobby update carrying the attribute is completed</param>
+        /// <param name="allowCoalescing">
+        /// If <c>false</c> the attribute is sent right away even when batching is enabled.
+        /// Use this for attributes that carry a stream of messages, where an overwritten write would be lost.
+        /// </param>
+        public void SetMemberAttribute(LobbyAttribute memberAttribute, OnLobbyCallback SetMemberAttributeCompleted = null, bool allowCoalescing = true)
         {
             if(!CurrentLobby.IsValid())
             {
                 Debug.LogError("Lobbies (SetMemberAttribute): CurrentLobby is not valid.");
+                SetMemberAttributeCompleted?.Invoke(Result.InvalidState);
+                return;
+            }
+
+            if (allowCoalescing && ModificationQueue.IsEnabled)
+            {
+                ModificationQueue.EnqueueMemberAttribute(memberAttribute, SetMemberAttributeCompleted, Time.realtimeSinceStartup);
                 return;
             }
 
@@ -1286,6 +1625,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             if(result != Result.Success)
             {
                 Debug.LogErrorFormat("Lobbies (SetMemberAttribute): Could not create lobby modification: Error code: {0}", result);
+                SetMemberAttributeCompleted?.Invoke(result);
                 return;
             }
 
@@ -1304,6 +1644,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             if(result != Result.Success)
             {
                 Debug.LogErrorFormat("Lobbies (SetMemberAttribute): Could not add member attribute: Error code: {0}", result);
+                SetMemberAttributeCompleted?.Invoke(result);
                 return;
             }
 
@@ -1314,7 +1655,134 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 LobbyModificationHandle = lobbyModificationHandle
             };
 
-            EOSManager.Instance.GetEOSLobbyInterface().UpdateLobby(ref updateOptions, null, OnUpdateLobbyCallBack);
+            EOSManager.Instance.GetEOSLobbyInterface().UpdateLobby(ref updateOptions, SetMemberAttributeCompleted, OnUpdateLobbyCallBack);
+        }
+
+        private void SubmitLobbyModificationBatch(LobbyModificationQueue.Batch batch)
+        {
+            ProductUserId currentProductUserId = EOSManager.Instance.GetProductUserId();
+            if (!CurrentLobby.IsValid() || !currentProductUserId.IsValid())
+            {
+                Debug.LogError("Lobbies (SubmitLobbyModificationBatch): Current lobby or player is invalid!");
+                batch.CompletedCallback(Result.InvalidState);
+                return;
+            }
+
+            if (batch.RequiresOwner && !CurrentLobby.IsOwner(currentProductUserId))
+            {
+                Debug.LogError("Lobbies (SubmitLobbyModificationBatch): Current player is not lobby owner!");
+                batch.CompletedCallback(Result.LobbyNotOwner);
+                return;
+            }
+
+            UpdateLobbyModificationOptions options = new UpdateLobbyModificationOptions()
+            {
+                LobbyId = CurrentLobby.Id,
+                LocalUserId = currentProductUserId
+            };
+
+            Result result = EOSManager.Instance.GetEOSLobbyInterface().UpdateLobbyModification(ref options, out LobbyModification lobbyModificationHandle);
+            if (result != Result.Success)
+            {
+                Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not create lobby modification. Error code: {0}", result);
+                batch.CompletedCallback(result);
+                return;
+            }
+
+            result = ApplyLobbyModificationBatch(batch, lobbyModificationHandle);
+            if (result != Result.Success)
+            {
+                lobbyModificationHandle.Release();
+                batch.CompletedCallback(result);
+                return;
+            }
+
+            var updateLobbyOptions = new UpdateLobbyOptions() { LobbyModificationHandle = lobbyModificationHandle };
+            EOSManager.Instance.GetEOSLobbyInterface().UpdateLobby(ref updateLobbyOptions, batch.CompletedCallback, OnUpdateLobbyCallBack);
+            lobbyModificationHandle.Release();
+        }
+
+        private Result ApplyLobbyModificationBatch(LobbyModificationQueue.Batch batch, LobbyModification lobbyModificationHandle)
+        {
+            Result result;
+
+            if (batch.HasBucketId)
+            {
+                var lobbyModificationSetBucketIdOptions = new LobbyModificationSetBucketIdOptions() { BucketId = batch.BucketId };
+                result = lobbyModificationHandle.SetBucketId(ref lobbyModificationSetBucketIdOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not set bucket id. Error code: {0}", result);
+                    return result;
+                }
+            }
+
+            if (batch.MaxNumLobbyMembers > 0)
+            {
+                var lobbyModificationSetMaxMembersOptions = new LobbyModificationSetMaxMembersOptions() { MaxMembers = batch.MaxNumLobbyMembers };
+                result = lobbyModificationHandle.SetMaxMembers(ref lobbyModificationSetMaxMembersOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not set max players. Error code: {0}", result);
+                    return result;
+                }
+            }
+
+            foreach (LobbyAttribute attribute in batch.LobbyAttributes.Values)
+            {
+                LobbyModificationAddAttributeOptions addAttributeOptions = new LobbyModificationAddAttributeOptions()
+                {
+                    Attribute = attribute.AsAttribute,
+                    Visibility = attribute.Visibility
+                };
+
+                result = lobbyModificationHandle.AddAttribute(ref addAttributeOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not add attribute '{0}'. Error code: {1}", attribute.Key, result);
+                    return result;
+                }
+            }
+
+            foreach (LobbyAttribute memberAttribute in batch.MemberAttributes.Values)
+            {
+                LobbyModificationAddMemberAttributeOptions addMemberAttributeOptions = new LobbyModificationAddMemberAttributeOptions()
+                {
+                    Attribute = memberAttribute.AsAttribute,
+                    Visibility = LobbyAttributeVisibility.Public
+                };
+
+                result = lobbyModificationHandle.AddMemberAttribute(ref addMemberAttributeOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not add member attribute '{0}'. Error code: {1}", memberAttribute.Key, result);
+                    return result;
+                }
+            }
+
+            if (batch.PermissionLevel != null)
+            {
+                var lobbyModificationSetPermissionLevelOptions = new LobbyModificationSetPermissionLevelOptions() { PermissionLevel = batch.PermissionLevel.Value };
+                result = lobbyModificationHandle.SetPermissionLevel(ref lobbyModificationSetPermissionLevelOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not set permission level. Error code: {0}", result);
+                    return result;
+                }
+            }
+
+            if (batch.AllowInvites != null)
+            {
+                var lobbyModificationSetInvitesAllowedOptions = new LobbyModificationSetInvitesAllowedOptions() { InvitesAllowed = batch.AllowInvites.Value };
+                result = lobbyModificationHandle.SetInvitesAllowed(ref lobbyModificationSetInvitesAllowedOptions);
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Lobbies (SubmitLobbyModificationBatch): Could not set allow invites. Error code: {0}", result);
+                    return result;
+                }
+            }
+
+            return Result.Success;
         }
 
         private void OnSendInviteCompleted(ref SendInviteCallbackInfo data)
@@ -1416,6 +1884,27 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
                 LobbyUpdateCompleted?.Invoke(Result.Success);
 
+                foreach (var callback in LobbyUpdateCallbacks)
+                {
+                    callback?.Invoke();
+                }
+            }
+            else
+            {
+                // The update succeeded for a lobby that is no longer current.
+                // Its caller, such as a batch of the modification queue, still
+                // has to be completed.
+                LobbyUpdateCompleted?.Invoke(Result.Success);
+            }
+        }
+
+        private void OnLobbyMemberUpdated(string lobbyId, ProductUserId memberId)
+        {
+            // Only the target member's attributes can change here, so the rest of the lobby is not re-read
+            if (!string.IsNullOrEmpty(lobbyId) && CurrentLobby.Id == lobbyId)
+            {
+                CurrentLobby.InitMemberFromLobbyHandle(lobbyId, memberId);
+
                 foreach (var callback in LobbyUpdateCallbacks)
                 {
                     callback?.Invoke();
@@ -1475,7 +1964,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             EOSManager.Instance.GetEOSLobbyInterface().DestroyLobby(ref options, DestroyCurrentLobbyCompleted, OnDestroyLobbyCompleted);
 
             // Clear current lobby
-            CurrentLobby.Clear();
+            ClearCurrentLobby();
         }
 
         private void OnDestroyLobbyCompleted(ref DestroyLobbyCallbackInfo data)
@@ -1947,7 +2436,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             Debug.LogFormat("Lobbies (OnKickedFromLobby):  Kicked from lobby: {0}", lobbyId);
             if (CurrentLobby.IsValid() && CurrentLobby.Id.Equals(lobbyId, StringComparison.OrdinalIgnoreCase))
             {
-                CurrentLobby.Clear();
+                ClearCurrentLobby();
                 _Dirty = true;
 
                 OnCurrentLobbyChanged(LobbyChangeType.Kicked);
@@ -2068,7 +2557,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             //}
 
             Debug.Log("Lobbies (OnMemberUpdateReceived): Member update received.");
-            OnLobbyUpdated(data.LobbyId, null);
+            OnLobbyMemberUpdated(data.LobbyId, data.TargetUserId);
 
             foreach (var callback in MemberUpdateCallbacks)
             {
@@ -2612,7 +3101,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 Debug.Log("Lobbies (OnLeaveLobbyCompleted): Successfully left lobby: " + data.LobbyId);
 
-                CurrentLobby.Clear();
+                ClearCurrentLobby();
 
                 LeaveLobbyCallback?.Invoke(Result.Success);
 
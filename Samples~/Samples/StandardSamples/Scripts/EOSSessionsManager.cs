@@ -35,8 +35,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
     using Epic.OnlineServices.Presence;
     using Epic.OnlineServices.UI;
     using Epic.OnlineServices.P2P;
-    using System.Text.RegularExpressions;
-    using System.Text;
     using UnityEngine.Events;
 
     /// <summary>
@@ -62,7 +60,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         public void Release()
         {
-            SearchResults.Clear();
+            // Results may be shared with the SessionSearchCache, so drop the reference rather than clearing them
+            SearchResults = new Dictionary<Session, SessionDetails>();
 
             if (SearchHandle != null)
             {
@@ -498,6 +497,17 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         private SessionSearch CurrentSearch;
         private string KnownPresenceSessionId = string.Empty;
 
+        /// <summary>
+        /// Results of recent <see cref="Search"/> calls, keyed by their parameters.
+        /// </summary>
+        private SessionSearchCache SearchCache;
+
+        /// <summary>
+        /// Cache key of the <see cref="Search"/> awaiting results in <see cref="CurrentSearch"/>,
+        /// or null if the pending search should not be cached.
+        /// </summary>
+        private string PendingSearchCacheKey;
+
         private Dictionary<Session, SessionDetails> Invites;
         private Session CurrentInvite;
 
@@ -584,80 +594,26 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         private const byte P2P_SESSION_STATUS_UPDATE_CHANNEL = 0xF;
 
         /// <summary>
-        /// Messages about sessions should all start with this message, so that parsing the message for information is easy.
-        /// This is part of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/>, which is then formatted to form messages that are sent.
-        /// The start of received messages are checked for starting with this text to know that it's something intended for managing Session updates.
-        /// </summary>
-        private const string P2P_INFORM_SESSION_MESSAGE_BASE = "SESSIONINFORMATION";
-
-        /// <summary>
-        /// Messages about sessions follow this format, starting with <see cref="P2P_INFORM_SESSION_MESSAGE_BASE"/>.
-        /// {0} - The EOS Game Services <see cref="Session.Id"/> of the Session to message about.
-        /// {1} - The <see cref="ProductUserId"/> of the user sending the message.
-        /// {2} - Message detail kind, such as "this is a message about a user joining".
-        /// {3} - Optional additional payload.
-        /// <see cref="P2P_JOINING_SESSION_MESSAGE_ELEMENT"/>
-        /// <see cref="P2P_LEAVING_SESSION_MESSAGE_ELEMENT"/>
-        /// <see cref="P2P_REFRESH_SESSION_MESSAGE_ELEMENT"/>
-        /// <see cref="P2P_SESSION_OWNER_DESTROYED_SESSION_MESSAGE_ELEMENT"/>
-        /// <see cref="P2P_SESSION_OWNER_SESSIONISSTARTED_ELEMENT"/>
-        /// <see cref="P2P_SESSION_OWNER_SESSIONISENDED_ELEMENT"/>
-        /// <see cref="P2P_SESSION_OWNER_INFORM_ALLREGISTEREDUSERS"/>
-        /// </summary>
-        private const string P2P_INFORM_SESSION_MESSAGE_FORMAT = P2P_INFORM_SESSION_MESSAGE_BASE + " ({0}) ({1}) ({2}) ({3})";
-
-        /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="InformSessionOwnerMessageFormat"/> indicate a user is joining the Session.
-        /// </summary>
-        private const string P2P_JOINING_SESSION_MESSAGE_ELEMENT = "JOIN";
-
-        /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate a user is leaving the Session.
-        /// </summary>
-        private const string P2P_LEAVING_SESSION_MESSAGE_ELEMENT = "LEAVE";
-
-        /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate that a user should re-acquire and refresh Session information.
-        /// Note that not every element of the Session can be re-acquired this way.
-        /// It is necessary to mirror <see cref="RegisterPlayer(string, ProductUserId)"/>, <see cref="UnregisterPlayer(string, ProductUserId)"/>,
-        /// <see cref="StartSession(string)"/>, and <see cref="EndSession(string)"/> using their associated messages.
-        /// </summary>
-        private const string P2P_REFRESH_SESSION_MESSAGE_ELEMENT = "REFRESH";
-
-        /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate that the Owner of a Session has destroyed the Session,
-        /// so members of the Session should also remove themselves from the Session.
+        /// Encodes and decodes the binary Session control messages sent on <see cref="P2P_SESSION_STATUS_SOCKET_NAME"/>.
+        /// See <see cref="SessionControlMessageType"/> for the kinds of messages exchanged.
         /// </summary>
-        private const string P2P_SESSION_OWNER_DESTROYED_SESSION_MESSAGE_ELEMENT = "DESTROY";
+        private readonly SessionControlCodec P2PSessionControlCodec = new();
 
         /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate that the Owner of a Session has started the Session.
-        /// Members of the Session should start their Session locally.
-        /// When a user joins a Session, if the Session is <see cref="OnlineSessionState.Starting"/> or <see cref="OnlineSessionState.InProgress"/>,
-        /// the Owner should inform the joining user that the Session should be Started locally.
-        /// Otherwise when the Owner starts a Session, they should inform the users to start theirs locally.
-        /// 
-        /// <see cref="ActiveSession"/>
+        /// Reused buffer for encoding outgoing Session control messages.
         /// </summary>
-        private const string P2P_SESSION_OWNER_SESSIONISSTARTED_ELEMENT = "STARTED";
+        private readonly byte[] P2PSendBuffer = new byte[P2PInterface.MAX_PACKET_SIZE];
 
         /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate that the Owner of a Session has ended the Session.
-        /// Members of the Session should end their Session locally.
-        /// When a user joins a Session, if the Session is <see cref="OnlineSessionState.Ending"/> or <see cref="OnlineSessionState.Ended"/>,
-        /// the Owner should inform the joining user that the Session should be Ended locally.
-        /// Otherwise when the Owner ends a Session, they should inform the users to start theirs locally.
-        /// 
-        /// <see cref="ActiveSession"/>
+        /// Reused buffer for incoming Session control messages.
+        /// Packets larger than this are dropped, as no valid message exceeds <see cref="P2PInterface.MAX_PACKET_SIZE"/>.
         /// </summary>
-        private const string P2P_SESSION_OWNER_SESSIONISENDED_ELEMENT = "ENDED";
+        private readonly byte[] P2PReceiveBuffer = new byte[P2PInterface.MAX_PACKET_SIZE];
 
         /// <summary>
-        /// Messages with this as the {2} parameter of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/> indicate a change in the registered users.
-        /// The {3} parameter contains a comma separated list of all registered user's ProductUserId.
-        /// <see cref="InformUsersOfRegistrationStatusChange(string)"/>
+        /// Reused target for decoding incoming Session control messages.
         /// </summary>
-        private const string P2P_SESSION_OWNER_INFORM_ALLREGISTEREDUSERS = "REGISTEREDUSERSUPDATED";
+        private readonly SessionControlMessage P2PReceivedMessage = new();
 
         /// <summary>
         /// When subscribing to peer request connection messages, this Id is held as a way to later remove the subscription.
@@ -723,6 +679,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         private void Init()
         {
             CurrentSearch?.Release();
+            SearchCache?.Clear();
+            PendingSearchCacheKey = null;
+            P2PSessionControlCodec.Clear();
             CurrentSessions?.Clear();
             Invites?.Clear();
             CurrentInvite = null;
@@ -738,6 +697,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             CurrentSessions = new Dictionary<string, Session>();
             CurrentSearch = new SessionSearch();
+            SearchCache ??= new SessionSearchCache();
             Invites = new Dictionary<Session, SessionDetails>();
             CurrentInvite = null;
 
@@ -766,6 +726,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             bool stateUpdates = false;
             HandleReceivedP2PMessages();
 
+            SearchCache.EvictExpired(Time.realtimeSinceStartup);
+
             //Update active Session from time to time
             foreach (KeyValuePair<string, Session> kvp in CurrentSessions)
             {
@@ -1233,6 +1195,17 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return CurrentSearch;
         }
 
+        /// <summary>
+        /// Accessor for the cache of recent <see cref="Search"/> results.
+        /// Use <see cref="SessionSearchCache.TryGet"/> with <see cref="SessionSearchCache.PinnedKey"/> to
+        /// filter or sort the current results locally, without another search.
+        /// </summary>
+        /// <returns>The search result cache.</returns>
+        public SessionSearchCache GetSearchCache()
+        {
+            return SearchCache;
+        }
+
         /// <summary>
         /// Accessor for all Current Session.
         /// These are all Sessions that are locally joined.
@@ -1410,6 +1383,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// Performs an online Search to look up a Session, where all attributes provided are met.
         /// <see cref="OnFindSessionsCompleteCallback"/> is called with the results.
         /// A handle for retriving results will be stored in <see cref="CurrentSearch"/>.
+        /// If the same search was made within <see cref="SessionSearchCache.TimeToLiveSeconds"/>, its cached results
+        /// are set on <see cref="CurrentSearch"/> immediately and the EOS back end is not queried.
         /// 
         /// TODO: This should run a callback or return a Result in case of errors when trying to set up the search.
         /// TODO: Only finds up to 10 results. Should have some method for finding next sets of results.
@@ -1421,10 +1396,25 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// The BucketID to search for.
         /// Results will only include Sessions created with this as their exact <see cref="Session.BucketId"/>.
         /// </param>
-        public void Search(List<SessionAttribute> attributes, string bucketId = BUCKET_ID)
+        /// <param name="forceRefresh">If true, the search is always sent to the EOS back end.</param>
+        public void Search(List<SessionAttribute> attributes, string bucketId = BUCKET_ID, bool forceRefresh = false)
         {
+            bucketId = string.IsNullOrEmpty(bucketId) ? BUCKET_ID : bucketId;
+            string cacheKey = SessionSearchCache.MakeKey(bucketId, attributes);
+
             // Clear previous search
             CurrentSearch.Release();
+            PendingSearchCacheKey = null;
+
+            if (!forceRefresh && SearchCache.TryGet(cacheKey, Time.realtimeSinceStartup, out SessionSearchCache.Entry cachedSearch))
+            {
+                Log($"{nameof(EOSSessionsManager)} ({nameof(Search)}): using {cachedSearch.Results.Count} cached result(s).");
+
+                SearchCache.PinnedKey = cacheKey;
+                ApplyLocalSessionNames(cachedSearch.Results);
+                CurrentSearch.OnSearchResultReceived(cachedSearch.Results);
+                return;
+            }
 
             CreateSessionSearchOptions searchOptions = new CreateSessionSearchOptions();
             searchOptions.MaxSearchResults = 10;
@@ -1439,12 +1429,13 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
 
             CurrentSearch.SetNewSearch(sessionSearchHandle);
+            PendingSearchCacheKey = cacheKey;
 
             AttributeData attrData = new AttributeData();
             attrData.Key = EOS_SESSIONS_SEARCH_BUCKET_ID;
             attrData.Value = new AttributeDataValue()
             {
-                AsUtf8 = string.IsNullOrEmpty(bucketId) ? BUCKET_ID : bucketId
+                AsUtf8 = bucketId
             };
 
             SessionSearchSetParameterOptions paramOptions = new SessionSearchSetParameterOptions();
@@ -1511,6 +1502,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         {
             // Clear previous search
             CurrentSearch.Release();
+            PendingSearchCacheKey = null;
 
             CreateSessionSearchOptions searchOptions = new CreateSessionSearchOptions();
             searchOptions.MaxSearchResults = 10;
@@ -1613,20 +1605,37 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     }
                     nextSession.SearchResults = true;
                     searchResults.Add(nextSession, sessionHandle);
+                }
+            }
 
+            ApplyLocalSessionNames(searchResults);
 
-                    foreach (KeyValuePair<string, Session> kvp in CurrentSessions)
+            if (PendingSearchCacheKey != null)
+            {
+                SearchCache.Add(PendingSearchCacheKey, searchResults, Time.realtimeSinceStartup);
+                SearchCache.PinnedKey = PendingSearchCacheKey;
+                PendingSearchCacheKey = null;
+            }
+
+            CurrentSearch.OnSearchResultReceived(searchResults);
+        }
+
+        /// <summary>
+        /// Gives search results that are also locally joined Sessions their local name.
+        /// </summary>
+        private void ApplyLocalSessionNames(Dictionary<Session, SessionDetails> searchResults)
+        {
+            foreach (Session searchResult in searchResults.Keys)
+            {
+                foreach (KeyValuePair<string, Session> kvp in CurrentSessions)
+                {
+                    if (kvp.Value.Id == searchResult.Id)
                     {
-                        if (kvp.Value.Id == nextSession.Id)
-                        {
-                            nextSession.Name = kvp.Key;
-                            break;
-                        }
+                        searchResult.Name = kvp.Key;
+                        break;
                     }
                 }
             }
-
-            CurrentSearch.OnSearchResultReceived(searchResults);
         }
 
         /// <summary>
@@ -1858,6 +1867,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 CurrentSessions.Remove(sessionData.SessionToDestroyName);
             }
 
+            // Nothing left to exchange control messages about
+            if (CurrentSessions.Count == 0)
+            {
+                P2PSessionControlCodec.Clear();
+            }
+
             OnPresenceChange?.Invoke();
             sessionData.DestroyCallback?.Invoke(new(sessionData.SessionToDestroyName, data.ResultCode));
         }
@@ -1968,7 +1983,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
 
             OnPresenceChange?.Invoke();
-            InformSessionOwnerWithMessage(sessionName, P2P_JOINING_SESSION_MESSAGE_ELEMENT);
+            InformSessionOwnerWithMessage(sessionName, SessionControlMessageType.Join);
 
             callback?.Invoke(result);
         }
@@ -2157,7 +2172,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             // ClientData should contain the local sessionName
             if (data.ClientData is string localSessionName)
             {
-                InformSessionMembers(localSessionName, P2P_SESSION_OWNER_SESSIONISSTARTED_ELEMENT);
+                InformSessionMembers(localSessionName, SessionControlMessageType.Started);
             }
         }
 
@@ -2216,7 +2231,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             // ClientData should contain the local sessionName
             if (data.ClientData is string localSessionName)
             {
-                InformSessionMembers(localSessionName, P2P_SESSION_OWNER_SESSIONISENDED_ELEMENT);
+                InformSessionMembers(localSessionName, SessionControlMessageType.Ended);
             }
         }
 
@@ -2623,7 +2638,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     }
                 }
 
-                InformSessionMembers(sessionName, P2P_REFRESH_SESSION_MESSAGE_ELEMENT);
+                InformSessionMembers(sessionName, SessionControlMessageType.Refresh);
                 OnPresenceChange?.Invoke();
             }
         }
@@ -3008,9 +3023,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// Utility function to send a message to the Owner of a Session.
         /// </summary>
         /// <param name="localSessionName">The local name for the Session.</param>
-        /// <param name="messageDetail">The message detail to send. This message detail is used to inform the Owner of what action to take.</param>
-        /// <param name="additionalPayload">Additional information to send. Optional.</param>
-        private void InformSessionOwnerWithMessage(string localSessionName, string messageDetail, string additionalPayload = "")
+        /// <param name="messageType">The kind of message to send. This is used to inform the Owner of what action to take.</param>
+        private void InformSessionOwnerWithMessage(string localSessionName, SessionControlMessageType messageType)
         {
             // Find the Session with this name
             // Identify the Owner of the Session
@@ -3065,8 +3079,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
-            string formattedMessage = string.Format(P2P_INFORM_SESSION_MESSAGE_FORMAT, localSession.Id, EOSManager.Instance.GetProductUserId(), messageDetail, additionalPayload);
-            SendP2PMessage(formattedMessage, ownerUserId);
+            int messageLength = P2PSessionControlCodec.Encode(P2PSendBuffer, messageType, localSession.Id);
+            SendP2PMessage(messageType, messageLength, ownerUserId);
         }
 
         /// <summary>
@@ -3075,9 +3089,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// The Session members should then refresh their Session information.
         /// </summary>
         /// <param name="localSessionName">The local name for the Session.</param>.
-        /// <param name="messageDetail">The message detail to send. This message detail is used to inform the members of what action to take.</param>
-        /// <param name="additionalPayload">Additional information about the message to send. Optional.</param>
-        private void InformSessionMembers(string localSessionName, string messageDetail, string additionalPayload = "")
+        /// <param name="messageType">The kind of message to send. This is used to inform the members of what action to take.</param>
+        /// <param name="payloadUsers">
+        /// The registered users to send with a <see cref="SessionControlMessageType.RegisteredUsers"/> message. Optional.
+        /// </param>
+        private void InformSessionMembers(string localSessionName, SessionControlMessageType messageType, List<ProductUserId> payloadUsers = null)
         {
             // First find a local Session with this name
             if (!TryGetSession(localSessionName, out Session localSession))
@@ -3129,9 +3145,10 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
-            Log($"{nameof(EOSSessionsManager)} ({nameof(InformSessionMembers)}): There are {registeredUsers.Count} registered members in {localSession.Name}, informing users of {messageDetail} (excluding self)");
+            Log($"{nameof(EOSSessionsManager)} ({nameof(InformSessionMembers)}): There are {registeredUsers.Count} registered members in {localSession.Name}, informing users of {messageType} (excluding self)");
 
-            string messageToSend = string.Format(P2P_INFORM_SESSION_MESSAGE_FORMAT, copiedInfo.Value.SessionDetails.Value.SessionId, EOSManager.Instance.GetProductUserId(), messageDetail, additionalPayload);
+            // The message is the same for every member, so encode it once and send the same bytes to each
+            int messageLength = P2PSessionControlCodec.Encode(P2PSendBuffer, messageType, copiedInfo.Value.SessionDetails.Value.SessionId, payloadUsers);
             foreach (ProductUserId user in registeredUsers)
             {
                 // We don't need to message ourself, so skip over if this is the local user
@@ -3140,17 +3157,26 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     continue;
                 }
 
-                SendP2PMessage(messageToSend, user);
+                SendP2PMessage(messageType, messageLength, user);
             }
         }
 
         /// <summary>
         /// Utility function for sending P2P messages.
+        /// Sends the first <paramref name="messageLength"/> bytes of <see cref="P2PSendBuffer"/>,
+        /// which should have been filled by <see cref="SessionControlCodec.Encode"/>.
         /// </summary>
-        /// <param name="message">The message to send. Should be a formatted string of <see cref="P2P_INFORM_SESSION_MESSAGE_FORMAT"/>.</param>
+        /// <param name="messageType">The kind of message being sent, used for logging.</param>
+        /// <param name="messageLength">The encoded length of the message, or -1 if encoding failed.</param>
         /// <param name="userToSendTo">The ProductUserId to send the message to.</param>
-        private void SendP2PMessage(string message, ProductUserId userToSendTo)
+        private void SendP2PMessage(SessionControlMessageType messageType, int messageLength, ProductUserId userToSendTo)
         {
+            if (messageLength < 0)
+            {
+                Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(SendP2PMessage)}): Could not encode {messageType} message, it does not fit in a single packet.");
+                return;
+            }
+
             SocketId socketId = new SocketId()
             {
                 SocketName = P2P_SESSION_STATUS_SOCKET_NAME
@@ -3164,7 +3190,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 AllowDelayedDelivery = true,
                 Channel = P2P_SESSION_STATUS_UPDATE_CHANNEL,
                 Reliability = PacketReliability.ReliableOrdered,
-                Data = new ArraySegment<byte>(System.Text.Encoding.UTF8.GetBytes(message))
+                Data = new ArraySegment<byte>(P2PSendBuffer, 0, messageLength)
             };
 
             // The result code of this indicates that we've managed to send the message successfully,
@@ -3177,7 +3203,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
             else
             {
-                Log($"{nameof(EOSSessionsManager)} ({nameof(SendP2PMessage)}): Sending \"{message}\" to {userToSendTo}");
+                Log($"{nameof(EOSSessionsManager)} ({nameof(SendP2PMessage)}): Sending {messageType} ({messageLength} bytes) to {userToSendTo}");
             }
         }
 
@@ -3190,7 +3216,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             ReceivePacketOptions options = new ReceivePacketOptions()
             {
                 LocalUserId = EOSManager.Instance.GetProductUserId(),
-                MaxDataSizeBytes = 4096,
+                MaxDataSizeBytes = (uint)P2PReceiveBuffer.Length,
                 RequestedChannel = P2P_SESSION_STATUS_UPDATE_CHANNEL
             };
 
@@ -3217,8 +3243,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     return;
                 }
 
-                byte[] data = new byte[nextPacketSizeBytes];
-                var dataSegment = new ArraySegment<byte>(data);
+                var dataSegment = new ArraySegment<byte>(P2PReceiveBuffer);
                 ProductUserId peerId = null;
                 SocketId socketId = new SocketId() { SocketName = P2P_SESSION_STATUS_SOCKET_NAME };
 
@@ -3226,7 +3251,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
                 if (receivePacketResult != Result.Success)
                 {
-                    Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): error while reading received packet data, code: {nextPacketSizeResult}.");
+                    Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): error while reading received packet data, code: {receivePacketResult}.");
                     return;
                 }
 
@@ -3236,73 +3261,56 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     return;
                 }
 
-                string message = System.Text.Encoding.UTF8.GetString(data);
-
-                Log($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Received a message: {message}");
-
-                if (!message.StartsWith(P2P_INFORM_SESSION_MESSAGE_BASE))
-                {
-                    Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): This function is handling a received message that it wasn't intended to. Perhaps there's a socket or channel conflict? Message: {message}");
-                    return;
-                }
-
-                // Match the message to look for (sessionid) (userid) (message element) (additional payload)
-                Match regexMatchOfMessage = Regex.Match(message, @"\(([^\)]*)\) \(([^\)]*)\) \(([^\)]*)\) \(([^\)]*)\)");
-
-                // The Regex match must have five "groups"; the 0th Group is the entire message, then four groups representing the four additional elements of the message
-                if (regexMatchOfMessage.Groups.Count != 5)
+                if (!P2PSessionControlCodec.TryDecode(new ArraySegment<byte>(P2PReceiveBuffer, 0, (int)bytesWritten), P2PReceivedMessage))
                 {
-                    Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Message received, but it didn't contain the expected three parts. Message: {message}");
-                    return;
+                    Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): This function is handling a received message that it wasn't intended to, or that was malformed. Perhaps there's a socket or channel conflict? Received {bytesWritten} bytes from {peerId}.");
+                    continue;
                 }
 
-                string sessionId = regexMatchOfMessage.Groups[1].Value;
-                string userId = regexMatchOfMessage.Groups[2].Value;
-                string messageElement = regexMatchOfMessage.Groups[3].Value;
-                string additionalPayload = regexMatchOfMessage.Groups[4].Value;
+                string sessionId = P2PReceivedMessage.SessionId;
+                SessionControlMessageType messageType = P2PReceivedMessage.Type;
 
-                Log($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Message parts: [{nameof(sessionId)}: {sessionId}] [{nameof(userId)}: {userId}] [{nameof(messageElement)}: {messageElement}] [{nameof(additionalPayload)}: {additionalPayload}]");
+                Log($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Received a message: [{nameof(sessionId)}: {sessionId}] [{nameof(peerId)}: {peerId}] [{nameof(messageType)}: {messageType}] [registered users: {P2PReceivedMessage.RegisteredUsers.Count}]");
 
                 if (!TryGetSessionById(sessionId, out Session session))
                 {
-                    // Only log a message if the type of message isn't P2P_LEAVING_SESSION_MESSAGE_ELEMENT
+                    // Only log a message if the type of message isn't SessionControlMessageType.Leave
                     // The Owner of a Session might receive leaving messages after they've already destroyed the Session
-                    if (messageElement != P2P_LEAVING_SESSION_MESSAGE_ELEMENT)
+                    if (messageType != SessionControlMessageType.Leave)
                     {
-                        Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Message received regarding sessionId {sessionId}, but no local sessions have that id. Message: {message}");
+                        Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): {messageType} message received regarding sessionId {sessionId}, but no local sessions have that id.");
                     }
-                    
-                    return;
-                }
 
-                ProductUserId messagingUserId = ProductUserId.FromString(userId);
+                    continue;
+                }
 
-                switch (messageElement)
+                // The sending user is the peer the packet arrived from, it isn't repeated inside the message
+                switch (messageType)
                 {
-                    case P2P_JOINING_SESSION_MESSAGE_ELEMENT:
-                        RegisterPlayer(session.Name, messagingUserId);
-                        InformUserOfCurrentSessionStatus(session.Name, messagingUserId);
+                    case SessionControlMessageType.Join:
+                        RegisterPlayer(session.Name, peerId);
+                        InformUserOfCurrentSessionStatus(session.Name, peerId);
                         break;
-                    case P2P_LEAVING_SESSION_MESSAGE_ELEMENT:
-                        UnregisterPlayer(session.Name, messagingUserId);
+                    case SessionControlMessageType.Leave:
+                        UnregisterPlayer(session.Name, peerId);
                         break;
-                    case P2P_REFRESH_SESSION_MESSAGE_ELEMENT:
+                    case SessionControlMessageType.Refresh:
                         RefreshSession(session.Name);
                         break;
-                    case P2P_SESSION_OWNER_DESTROYED_SESSION_MESSAGE_ELEMENT:
+                    case SessionControlMessageType.Destroyed:
                         DestroySession(session.Name);
                         break;
-                    case P2P_SESSION_OWNER_SESSIONISSTARTED_ELEMENT:
+                    case SessionControlMessageType.Started:
                         StartSession(session.Name);
                         break;
-                    case P2P_SESSION_OWNER_SESSIONISENDED_ELEMENT:
+                    case SessionControlMessageType.Ended:
                         EndSession(session.Name);
                         break;
-                    case P2P_SESSION_OWNER_INFORM_ALLREGISTEREDUSERS:
-                        HandleRegistrationChangeMessage(sessionId, additionalPayload);
+                    case SessionControlMessageType.RegisteredUsers:
+                        HandleRegistrationChangeMessage(sessionId, P2PReceivedMessage.RegisteredUsers);
                         break;
                     default:
-                        Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Unrecognized message element, unclear what action to take. Message: {message}");
+                        Debug.LogError($"{nameof(EOSSessionsManager)} ({nameof(HandleReceivedP2PMessages)}): Unrecognized message type {(byte)messageType}, unclear what action to take.");
                         break;
                 }
             }
@@ -3333,13 +3341,13 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 case OnlineSessionState.Starting:
                 case OnlineSessionState.InProgress:
-                    string startingMessage = string.Format(P2P_INFORM_SESSION_MESSAGE_FORMAT, session.Id, EOSManager.Instance.GetProductUserId(), P2P_SESSION_OWNER_SESSIONISSTARTED_ELEMENT, "");
-                    SendP2PMessage(startingMessage, userId);
+                    int startingMessageLength = P2PSessionControlCodec.Encode(P2PSendBuffer, SessionControlMessageType.Started, session.Id);
+                    SendP2PMessage(SessionControlMessageType.Started, startingMessageLength, userId);
                     break;
                 case OnlineSessionState.Ending:
                 case OnlineSessionState.Ended:
-                    string endingMessage = string.Format(P2P_INFORM_SESSION_MESSAGE_FORMAT, session.Id, EOSManager.Instance.GetProductUserId(), P2P_SESSION_OWNER_SESSIONISENDED_ELEMENT, "");
-                    SendP2PMessage(endingMessage, userId);
+                    int endingMessageLength = P2PSessionControlCodec.Encode(P2PSendBuffer, SessionControlMessageType.Ended, session.Id);
+                    SendP2PMessage(SessionControlMessageType.Ended, endingMessageLength, userId);
                     break;
             }
         }
@@ -3363,20 +3371,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             if (session.TryGetRegisteredUsers(out List<ProductUserId> userIds))
             {
-                // Compose a CSV
-                StringBuilder userIdString = new StringBuilder();
-                string commaAddOn = "";
-
-                foreach (ProductUserId curUser in userIds)
-                {
-                    userIdString.Append(commaAddOn + curUser.ToString());
-
-                    // Set the comma so later entries start with a comma
-                    commaAddOn = ",";
-                }
-
-                // Then inform members with this information
-                InformSessionMembers(sessionName, P2P_SESSION_OWNER_INFORM_ALLREGISTEREDUSERS, userIdString.ToString());
+                // Inform members with the full list, the codec packs each id into the message
+                InformSessionMembers(sessionName, SessionControlMessageType.RegisteredUsers, userIds);
             }
         }
 
@@ -3386,8 +3382,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// and which incoming users should be registered.
         /// </summary>
         /// <param name="sessionId">The EOS Game Services Session Id to update the status of.</param>
-        /// <param name="userIdCSV">A comma separated list of all users that should be registered to the Session.</param>
-        private void HandleRegistrationChangeMessage(string sessionId, string userIdCSV)
+        /// <param name="incomingUserIdsAsProductUserIds">All users that should be registered to the Session.</param>
+        private void HandleRegistrationChangeMessage(string sessionId, List<ProductUserId> incomingUserIdsAsProductUserIds)
         {
             if (!TryGetSessionById(sessionId, out Session session))
             {
@@ -3405,13 +3401,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
-            string[] incomingUserIds = userIdCSV.Split(",", StringSplitOptions.RemoveEmptyEntries);
-            List<ProductUserId> incomingUserIdsAsProductUserIds = new List<ProductUserId>();
-            foreach (string userId in incomingUserIds)
-            {
-                incomingUserIdsAsProductUserIds.Add(ProductUserId.FromString(userId));
-            }
-
             // For each user id in the incoming that isn't in the existing users, register them
             List<ProductUserId> usersToRegister = new List<ProductUserId>();
             foreach (ProductUserId curIncomingUser in incomingUserIdsAsProductUserIds)
@@ -3432,7 +3421,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     usersToUnRegister.Add(curExistingUser);
                 }
             }
-            UnregisterPlayers(session.Name, usersToRegister.ToArray());
+            UnregisterPlayers(session.Name, usersToUnRegister.ToArray());
         }
 
         private void InformOnDestroy(string sessionName)
@@ -3457,12 +3446,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             if (localSession.DoesLocalUserOwnSession())
             {
                 // We're the Owner of the Session, inform everyone that it was destroyed
-                InformSessionMembers(sessionName, P2P_SESSION_OWNER_DESTROYED_SESSION_MESSAGE_ELEMENT);
+                InformSessionMembers(sessionName, SessionControlMessageType.Destroyed);
             }
             else
             {
                 // Inform the Owner that we've left the Session
-                InformSessionOwnerWithMessage(sessionName, P2P_LEAVING_SESSION_MESSAGE_ELEMENT);
+                InformSessionOwnerWithMessage(sessionName, SessionControlMessageType.Leave);
             }
         }
 
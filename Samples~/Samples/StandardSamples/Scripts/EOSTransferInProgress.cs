@@ -20,62 +20,273 @@
 * SOFTWARE.
 */
 
-
 namespace PlayEveryWare.EpicOnlineServices.Samples
 {
+    using System;
+    using System.Buffers;
+    using System.IO;
+    using System.Threading.Tasks;
+
     using UnityEngine;
-    using Utility;
+
+    using Epic.OnlineServices;
+
+    /// <summary>
+    /// State of an <c>EOSTransferInProgress</c>.
+    /// </summary>
+    public enum EOSTransferState
+    {
+        /// <summary>
+        /// Waiting for one of the concurrent transfer slots of the service.
+        /// </summary>
+        Queued,
+
+        /// <summary>
+        /// The transfer request has been started with the EOS SDK.
+        /// </summary>
+        Active,
+
+        Completed,
+        Failed,
+        Canceled
+    }
 
     /// <summary>
-    /// Class <c>EOSTransferInProgress</c> is used in <c>EOSTitleStorageManager</c> and <c>PlayerDataStorageService</c> to keep track of downloaded cached file data.
+    /// Class <c>EOSTransferInProgress</c> tracks a single file transfer of
+    /// <c>TitleStorageService</c> or <c>PlayerDataStorageService</c>.
+    ///
+    /// Data is streamed chunk by chunk: downloads are written to
+    /// <see cref="Stream"/> as each chunk arrives, or to a buffer when no
+    /// stream is given, and uploads are read
+    /// from the stream one chunk at a time. At most one chunk per transfer is
+    /// buffered by the service. Buffers of up to
+    /// <see cref="MaxPooledBufferBytes"/> are pooled; larger ones are
+    /// allocated for the transfer and left to the garbage collector.
     /// </summary>
     public class EOSTransferInProgress
     {
         // per EOS SDK documentation, the maximum size for a file is 200MB, or this many bytes.
         public const int FileMaxSizeBytes = 200000000;
 
-        public bool Download = true;
-        public uint CurrentIndex = 0;
-        private byte[] _data;
+        /// <summary>
+        /// Largest buffer taken from, and returned to, the shared array pool.
+        /// Pooling whole file buffers would keep up to hundreds of MB alive
+        /// for the life of the process after a single large transfer.
+        /// </summary>
+        public const int MaxPooledBufferBytes = 1024 * 1024;
 
-        public byte[] Data
+        public string FileName { get; }
+
+        public bool Download { get; }
+
+        /// <summary>
+        /// Size of the file in bytes, or 0 while it is not known yet (before
+        /// the first chunk of a download, or for uploads from streams that
+        /// cannot seek).
+        /// </summary>
+        public uint TotalSize { get; internal set; }
+
+        public uint BytesTransferred { get; internal set; }
+
+        public EOSTransferState State { get; internal set; } = EOSTransferState.Queued;
+
+        /// <summary>
+        /// Result reported by the EOS SDK once the transfer has finished.
+        /// </summary>
+        public Result Result { get; internal set; } = Result.NotFound;
+
+        /// <summary>
+        /// Number of bytes requested from, or handed to, the EOS SDK at a
+        /// time. Larger chunks mean fewer callbacks for large files.
+        /// </summary>
+        public uint ChunkSize { get; }
+
+        /// <summary>
+        /// Fraction of the file transferred so far, between 0 and 1.
+        /// </summary>
+        public float Progress
         {
             get
             {
-                return _data;
-            }
-            set
-            {
-                // If the file sizer is larger than the maximum allowable size,
-                // then log an error, but do not throw an exception, since
-                // throwing an exception from a property setter is a little
-                // confusing, and there will be an opportunity to catch the 
-                // mistake when EOS returns an error code.
-                if (null != value && value.Length > FileMaxSizeBytes)
+                if (State == EOSTransferState.Completed)
                 {
-                    Debug.LogError($"Maximum file size is 200MB.");
+                    return 1.0f;
                 }
 
-                _data = value;
+                return TotalSize == 0 ? 0.0f : (float)BytesTransferred / TotalSize;
             }
         }
 
-        public uint TotalSize
+        public bool IsFinished
         {
             get
             {
-                if (null == _data)
-                    return 0;
+                return State is EOSTransferState.Completed or EOSTransferState.Failed or EOSTransferState.Canceled;
+            }
+        }
 
-                _ = SafeTranslatorUtility.TryConvert(_data.Length, out uint totalSize);
+        /// <summary>
+        /// Invoked on the main thread whenever more of the file has been
+        /// transferred, and once more when the transfer finishes.
+        /// </summary>
+        public event Action<EOSTransferInProgress> ProgressChanged;
 
-                return totalSize;
+        /// <summary>
+        /// Completes with the transfer's result once it has finished, however
+        /// it finished.
+        /// </summary>
+        public Task<Result> Completion
+        {
+            get
+            {
+                return _completion.Task;
             }
         }
 
-        public bool IsDone()
+        /// <summary>
+        /// Stream downloaded data is written to, or uploaded data is read
+        /// from. Null for transfers that use the pooled buffer.
+        /// </summary>
+        internal Stream Stream;
+
+        /// <summary>
+        /// Whether the stream is disposed of when the transfer finishes.
+        /// </summary>
+        internal bool OwnsStream;
+
+        /// <summary>
+        /// Buffer holding the whole file for
+        /// transfers without a stream, or a single chunk for uploads from a
+        /// stream. Pooled if it is no larger than
+        /// <see cref="MaxPooledBufferBytes"/>.
+        /// </summary>
+        internal byte[] Buffer;
+
+        /// <summary>
+        /// Number of valid bytes in <see cref="Buffer"/>.
+        /// </summary>
+        internal int BufferLength;
+
+        internal IFileTransferRequest Request;
+
+        internal bool CancelRequested;
+
+        /// <summary>
+        /// Starts the transfer request with the EOS SDK.
+        /// </summary>
+        internal Func<EOSTransferInProgress, IFileTransferRequest> Start;
+
+        /// <summary>
+        /// Invoked by the service when the transfer finishes, before the
+        /// buffer is returned to the pool. May turn a completed transfer
+        /// into a failed one, if what was transferred can't be used.
+        /// </summary>
+        internal Action<EOSTransferInProgress> Finished;
+
+        internal Action<EOSTransferInProgress> CancelHandler;
+
+        private readonly TaskCompletionSource<Result> _completion = new();
+
+        internal EOSTransferInProgress(string fileName, bool download, uint chunkSize)
         {
-            return TotalSize == CurrentIndex;
+            FileName = fileName;
+            Download = download;
+            ChunkSize = chunkSize;
+        }
+
+        /// <summary>
+        /// Cancels the transfer. A queued transfer is removed from the queue
+        /// straight away; an active one finishes as canceled once the EOS
+        /// SDK acknowledges the cancellation.
+        /// </summary>
+        public void Cancel()
+        {
+            if (IsFinished)
+            {
+                return;
+            }
+
+            CancelRequested = true;
+            CancelHandler?.Invoke(this);
+        }
+
+        /// <summary>
+        /// Ensures the buffer can hold at least the given number of bytes.
+        /// </summary>
+        /// <returns>
+        /// False if the size is larger than the EOS SDK allows for a file, in
+        /// which case the transfer must fail.
+        /// </returns>
+        internal bool EnsureBuffer(int size)
+        {
+            if (size < 0 || size > FileMaxSizeBytes)
+            {
+                Debug.LogError($"Could not transfer file, \"{FileName},\" of {size} bytes. Maximum file size is 200MB.");
+                return false;
+            }
+
+            if (Buffer != null && Buffer.Length >= size)
+            {
+                return true;
+            }
+
+            byte[] buffer = size <= MaxPooledBufferBytes ? ArrayPool<byte>.Shared.Rent(Math.Max(size, 1)) : new byte[size];
+            if (Buffer != null)
+            {
+                Array.Copy(Buffer, buffer, BufferLength);
+                ReturnBuffer(Buffer);
+            }
+            Buffer = buffer;
+
+            return true;
+        }
+
+        private static void ReturnBuffer(byte[] buffer)
+        {
+            if (buffer.Length <= MaxPooledBufferBytes)
+            {
+                ArrayPool<byte>.Shared.Return(buffer);
+            }
+        }
+
+        internal void ReportProgress()
+        {
+            ProgressChanged?.Invoke(this);
+        }
+
+        /// <summary>
+        /// Marks the transfer as finished and releases its resources.
+        /// </summary>
+        internal void Finish(EOSTransferState state, Result result)
+        {
+            State = state;
+            Result = result;
+
+            Request?.Release();
+            Request?.Dispose();
+            Request = null;
+
+            try
+            {
+                Finished?.Invoke(this);
+            }
+            finally
+            {
+                if (OwnsStream)
+                {
+                    Stream?.Dispose();
+                }
+                Stream = null;
+
+                if (Buffer != null)
+                {
+                    ReturnBuffer(Buffer);
+                    Buffer = null;
+                }
+
+                ReportProgress();
+                _completion.TrySetResult(Result);
+            }
         }
     }
-}
\ No newline at end of file
+}
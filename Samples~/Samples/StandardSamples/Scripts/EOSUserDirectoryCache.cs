@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+
+    /// <summary>
+    /// Persistent cache of display names and <c>ProductUserId</c> to <c>EpicAccountId</c> mappings.
+    ///
+    /// Lets social UIs show names for friends, lobby members and invite senders straight away on launch,
+    /// and lets the managers skip <c>UserInfo</c> and <c>Connect</c> queries for accounts they've already resolved.
+    /// Account mappings never change; display names can, so they're only trusted for
+    /// <see cref="DisplayNameTimeToLive"/> after they were last seen. Older names are still returned, marked as stale,
+    /// so they can be shown while they're refreshed. Entries that haven't been updated for
+    /// <see cref="EntryTimeToLive"/> are dropped.
+    ///
+    /// The file is loaded on first use and written back by <see cref="SaveIfDirty"/> after changes.
+    /// Files written with a different <see cref="FormatVersion"/> are discarded.
+    /// </summary>
+    public class EOSUserDirectoryCache
+    {
+        private const uint FileMagic = 0x43445545; // "EUDC"
+        public const ushort FormatVersion = 2;
+        private const string FileName = "eos_user_directory.cache";
+
+        /// <summary>
+        /// Minimum number of seconds between writes of the cache file.
+        /// </summary>
+        public const float SaveIntervalSeconds = 5.0f;
+
+        private class Entry
+        {
+            public string EpicAccountId;
+            public string ProductUserId;
+            public string DisplayName;
+            public long DisplayNameUpdatedUtcTicks;
+            public long UpdatedUtcTicks;
+        }
+
+        private static EOSUserDirectoryCache s_instance;
+
+        /// <summary>
+        /// Cache shared by the sample managers, stored under <c>Application.persistentDataPath</c>.
+        /// </summary>
+        public static EOSUserDirectoryCache Instance
+        {
+            get
+            {
+                return s_instance ??= new EOSUserDirectoryCache(Path.Combine(Application.persistentDataPath, FileName));
+            }
+        }
+
+        /// <summary>
+        /// How long a cached display name is used without being refreshed from the backend.
+        /// </summary>
+        public TimeSpan DisplayNameTimeToLive = TimeSpan.FromDays(7);
+
+        /// <summary>
+        /// How long an entry is kept after its display name or account mapping was last set.
+        /// </summary>
+        public TimeSpan EntryTimeToLive = TimeSpan.FromDays(90);
+
+        private readonly string _path;
+        private bool _loaded;
+        private bool _dirty;
+        private float _nextSaveTime;
+
+        private readonly Dictionary<string, Entry> _byEpicAccountId = new();
+        private readonly Dictionary<string, Entry> _byProductUserId = new();
+
+        public EOSUserDirectoryCache(string path)
+        {
+            _path = path;
+        }
+
+        /// <summary>
+        /// Returns the cached display name of <paramref name="accountId"/>.
+        /// </summary>
+        /// <param name="isStale">True if the name is older than <see cref="DisplayNameTimeToLive"/> and should be refreshed.</param>
+        public bool TryGetDisplayName(EpicAccountId accountId, out string displayName, out bool isStale)
+        {
+            displayName = null;
+            isStale = false;
+
+            if (accountId == null || !accountId.IsValid())
+            {
+                return false;
+            }
+
+            EnsureLoaded();
+
+            if (!_byEpicAccountId.TryGetValue(accountId.ToString(), out Entry entry) || string.IsNullOrEmpty(entry.DisplayName))
+            {
+                return false;
+            }
+
+            displayName = entry.DisplayName;
+            isStale = DateTime.UtcNow.Ticks - entry.DisplayNameUpdatedUtcTicks > DisplayNameTimeToLive.Ticks;
+            return true;
+        }
+
+        /// <summary>
+        /// Returns the cached <c>EpicAccountId</c> linked to <paramref name="productUserId"/>.
+        /// </summary>
+        public bool TryGetEpicAccountId(ProductUserId productUserId, out EpicAccountId accountId)
+        {
+            accountId = null;
+
+            if (productUserId == null || !productUserId.IsValid())
+            {
+                return false;
+            }
+
+            EnsureLoaded();
+
+            if (!_byProductUserId.TryGetValue(productUserId.ToString(), out Entry entry) || string.IsNullOrEmpty(entry.EpicAccountId))
+            {
+                return false;
+            }
+
+            accountId = EpicAccountId.FromString(entry.EpicAccountId);
+            return accountId != null && accountId.IsValid();
+        }
+
+        /// <summary>
+        /// Returns the cached <c>ProductUserId</c> linked to <paramref name="accountId"/>.
+        /// </summary>
+        public bool TryGetProductUserId(EpicAccountId accountId, out ProductUserId productUserId)
+        {
+            productUserId = null;
+
+            if (accountId == null || !accountId.IsValid())
+            {
+                return false;
+            }
+
+            EnsureLoaded();
+
+            if (!_byEpicAccountId.TryGetValue(accountId.ToString(), out Entry entry) || string.IsNullOrEmpty(entry.ProductUserId))
+            {
+                return false;
+            }
+
+            productUserId = ProductUserId.FromString(entry.ProductUserId);
+            return productUserId != null && productUserId.IsValid();
+        }
+
+        public void SetDisplayName(EpicAccountId accountId, string displayName)
+        {
+            if (accountId == null || !accountId.IsValid() || string.IsNullOrEmpty(displayName))
+            {
+                return;
+            }
+
+            EnsureLoaded();
+
+            Entry entry = GetOrAddEntry(accountId.ToString());
+            entry.DisplayName = displayName;
+            entry.DisplayNameUpdatedUtcTicks = DateTime.UtcNow.Ticks;
+            entry.UpdatedUtcTicks = entry.DisplayNameUpdatedUtcTicks;
+            _dirty = true;
+        }
+
+        public void SetAccountMapping(ProductUserId productUserId, EpicAccountId accountId)
+        {
+            if (productUserId == null || !productUserId.IsValid() || accountId == null || !accountId.IsValid())
+            {
+                return;
+            }
+
+            EnsureLoaded();
+
+            string productUserIdString = productUserId.ToString();
+            Entry entry = GetOrAddEntry(accountId.ToString());
+            entry.UpdatedUtcTicks = DateTime.UtcNow.Ticks;
+            _dirty = true;
+
+            if (entry.ProductUserId == productUserIdString)
+            {
+                return;
+            }
+
+            if (entry.ProductUserId != null)
+            {
+                _byProductUserId.Remove(entry.ProductUserId);
+            }
+
+            // The product user id may have been linked to another account before
+            if (_byProductUserId.TryGetValue(productUserIdString, out Entry previous))
+            {
+                previous.ProductUserId = null;
+            }
+
+            entry.ProductUserId = productUserIdString;
+            _byProductUserId[productUserIdString] = entry;
+        }
+
+        /// <summary>
+        /// Writes the cache file if anything changed and <see cref="SaveIntervalSeconds"/> has passed since the last write.
+        /// </summary>
+        public void SaveIfDirty(bool force = false)
+        {
+            if (!_dirty || (!force && Time.realtimeSinceStartup < _nextSaveTime))
+            {
+                return;
+            }
+
+            _nextSaveTime = Time.realtimeSinceStartup + SaveIntervalSeconds;
+
+            PruneExpiredEntries();
+
+            string tempPath = _path + ".tmp";
+
+            try
+            {
+                using (var writer = new BinaryWriter(File.Create(tempPath)))
+                {
+                    writer.Write(FileMagic);
+                    writer.Write(FormatVersion);
+                    writer.Write(_byEpicAccountId.Count);
+
+                    foreach (Entry entry in _byEpicAccountId.Values)
+                    {
+                        writer.Write(entry.EpicAccountId);
+                        writer.Write(entry.ProductUserId ?? string.Empty);
+                        writer.Write(entry.DisplayName ?? string.Empty);
+                        writer.Write(entry.DisplayNameUpdatedUtcTicks);
+                        writer.Write(entry.UpdatedUtcTicks);
+                    }
+                }
+
+                // Replace the old file only once the new one is complete
+                if (File.Exists(_path))
+                {
+                    File.Delete(_path);
+                }
+                File.Move(tempPath, _path);
+
+                _dirty = false;
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("EOSUserDirectoryCache (SaveIfDirty): Couldn't write \"{0}\": {1}", _path, e.Message);
+            }
+        }
+
+        private void PruneExpiredEntries()
+        {
+            long oldestTicks = DateTime.UtcNow.Ticks - EntryTimeToLive.Ticks;
+            List<Entry> expired = null;
+
+            foreach (Entry entry in _byEpicAccountId.Values)
+            {
+                if (entry.UpdatedUtcTicks < oldestTicks)
+                {
+                    (expired ??= new List<Entry>()).Add(entry);
+                }
+            }
+
+            if (expired == null)
+            {
+                return;
+            }
+
+            foreach (Entry entry in expired)
+            {
+                _byEpicAccountId.Remove(entry.EpicAccountId);
+
+                if (entry.ProductUserId != null)
+                {
+                    _byProductUserId.Remove(entry.ProductUserId);
+                }
+            }
+
+            _dirty = true;
+        }
+
+        private Entry GetOrAddEntry(string epicAccountId)
+        {
+            if (!_byEpicAccountId.TryGetValue(epicAccountId, out Entry entry))
+            {
+                entry = new Entry { EpicAccountId = epicAccountId };
+                _byEpicAccountId.Add(epicAccountId, entry);
+            }
+
+            return entry;
+        }
+
+        private void EnsureLoaded()
+        {
+            if (_loaded)
+            {
+                return;
+            }
+
+            _loaded = true;
+
+            if (!File.Exists(_path))
+            {
+                return;
+            }
+
+            try
+            {
+                using (var reader = new BinaryReader(File.OpenRead(_path)))
+                {
+                    if (reader.ReadUInt32() != FileMagic || reader.ReadUInt16() != FormatVersion)
+                    {
+                        Debug.Log("EOSUserDirectoryCache (EnsureLoaded): Discarding cache written by another version");
+                        return;
+                    }
+
+                    int count = reader.ReadInt32();
+                    for (int i = 0; i < count; ++i)
+                    {
+                        Entry entry = new Entry
+                        {
+                            EpicAccountId = reader.ReadString(),
+                            ProductUserId = NullIfEmpty(reader.ReadString()),
+                            DisplayName = NullIfEmpty(reader.ReadString()),
+                            DisplayNameUpdatedUtcTicks = reader.ReadInt64(),
+                            UpdatedUtcTicks = reader.ReadInt64()
+                        };
+
+                        _byEpicAccountId[entry.EpicAccountId] = entry;
+
+                        if (entry.ProductUserId != null)
+                        {
+                            _byProductUserId[entry.ProductUserId] = entry;
+                        }
+                    }
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("EOSUserDirectoryCache (EnsureLoaded): Discarding unreadable cache \"{0}\": {1}", _path, e.Message);
+                _byEpicAccountId.Clear();
+                _byProductUserId.Clear();
+                return;
+            }
+
+            PruneExpiredEntries();
+        }
+
+        private static string NullIfEmpty(string value)
+        {
+            return string.IsNullOrEmpty(value) ? null : value;
+        }
+    }
+}
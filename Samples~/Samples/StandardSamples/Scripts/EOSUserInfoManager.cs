@@ -251,6 +251,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             if (!string.IsNullOrEmpty(UserInfo.DisplayName))
             {
                 UserInfoDisplayNameMapping[UserInfo.DisplayName] = UserInfo;
+
+                EOSUserDirectoryCache.Instance.SetDisplayName(UserInfo.UserId, UserInfo.DisplayName);
+                EOSUserDirectoryCache.Instance.SaveIfDirty();
             }
 
             if (UserInfo.UserId == EOSManager.Instance.GetLocalUserId())
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System.Collections.Generic;
+
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Leaderboards;
+
+    /// <summary>
+    /// Windowed, paged access to the records of the last
+    /// <see cref="LeaderboardsInterface.QueryLeaderboardRanks"/> query.
+    ///
+    /// Records are copied out of the EOS cache with
+    /// <see cref="LeaderboardsInterface.CopyLeaderboardRecordByIndex"/> one
+    /// page at a time, and only for the pages a window touches, so viewing
+    /// ranks 500 to 550 of a large global board copies one or two pages
+    /// rather than the whole board. At most <see cref="MaxCachedPages"/>
+    /// pages are kept; the least recently used page is evicted and its
+    /// record storage reused for the next page loaded.
+    /// </summary>
+    public class LeaderboardRecordPager
+    {
+        public const int DefaultPageSize = 50;
+        public const int DefaultMaxCachedPages = 8;
+
+        private class Page
+        {
+            public int PageIndex;
+            public int Count;
+            public LeaderboardRecord[] Records;
+            public LinkedListNode<Page> LruNode;
+        }
+
+        private readonly LeaderboardsInterface _leaderboards;
+
+        private readonly Dictionary<int, Page> _pages = new();
+
+        // Most recently used pages first
+        private readonly LinkedList<Page> _lru = new();
+
+        /// <summary>
+        /// Number of records on each page.
+        /// </summary>
+        public int PageSize { get; }
+
+        /// <summary>
+        /// Maximum number of pages kept in memory.
+        /// </summary>
+        public int MaxCachedPages { get; }
+
+        /// <summary>
+        /// Number of records available from the last query.
+        /// </summary>
+        public int RecordCount { get; private set; }
+
+        /// <summary>
+        /// Number of pages copied from the EOS cache since the last
+        /// <see cref="Reset"/>, for profiling.
+        /// </summary>
+        public int PagesLoaded { get; private set; }
+
+        public LeaderboardRecordPager(LeaderboardsInterface leaderboards, int pageSize = DefaultPageSize, int maxCachedPages = DefaultMaxCachedPages)
+        {
+            _leaderboards = leaderboards;
+            PageSize = Mathf.Max(1, pageSize);
+            MaxCachedPages = Mathf.Max(1, maxCachedPages);
+        }
+
+        /// <summary>
+        /// Drops all cached pages and reads the record count of the latest
+        /// query. Call this whenever a rank query completes.
+        /// </summary>
+        public void Reset()
+        {
+            var countOptions = new GetLeaderboardRecordCountOptions();
+            RecordCount = (int)_leaderboards.GetLeaderboardRecordCount(ref countOptions);
+            PagesLoaded = 0;
+            InvalidatePages();
+        }
+
+        /// <summary>
+        /// Drops all cached pages without querying EOS, for example after
+        /// logging out.
+        /// </summary>
+        public void Clear()
+        {
+            RecordCount = 0;
+            PagesLoaded = 0;
+            InvalidatePages();
+        }
+
+        /// <summary>
+        /// Copies the records with indices
+        /// [<paramref name="firstIndex"/>, <paramref name="firstIndex"/> + <paramref name="count"/>)
+        /// into <paramref name="output"/>, loading only the pages the window
+        /// covers.
+        /// </summary>
+        /// <param name="firstIndex">Index of the first record, 0 being the top of the board.</param>
+        /// <param name="count">Number of records wanted.</param>
+        /// <param name="output">Cleared and filled with the window.</param>
+        /// <returns>False if a page could not be copied from the EOS cache; <paramref name="output"/> then holds the records up to the failure.</returns>
+        public bool GetWindow(int firstIndex, int count, List<LeaderboardRecord> output)
+        {
+            output.Clear();
+
+            firstIndex = Mathf.Max(0, firstIndex);
+            int endIndex = Mathf.Min(RecordCount, firstIndex + Mathf.Max(0, count));
+
+            int recordIndex = firstIndex;
+            while (recordIndex < endIndex)
+            {
+                if (!TryGetPage(recordIndex / PageSize, out Page page))
+                {
+                    return false;
+                }
+
+                int pageStart = page.PageIndex * PageSize;
+                int pageEnd = Mathf.Min(endIndex, pageStart + page.Count);
+                for (; recordIndex < pageEnd; ++recordIndex)
+                {
+                    output.Add(page.Records[recordIndex - pageStart]);
+                }
+
+                if (page.Count < PageSize && recordIndex < endIndex)
+                {
+                    // The EOS cache held fewer records than it reported
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Copies the records ranked
+        /// [<paramref name="firstRank"/>, <paramref name="lastRank"/>] into
+        /// <paramref name="output"/>. Records are returned by EOS in rank
+        /// order starting at rank 1, so rank N is record index N - 1.
+        /// </summary>
+        public bool GetWindowByRank(int firstRank, int lastRank, List<LeaderboardRecord> output)
+        {
+            return GetWindow(firstRank - 1, lastRank - firstRank + 1, output);
+        }
+
+        /// <summary>
+        /// Streams records starting at <paramref name="firstIndex"/>, loading
+        /// pages as the enumeration reaches them. Pages already passed may be
+        /// evicted while enumerating, so memory stays bounded however far
+        /// the enumeration goes.
+        /// </summary>
+        public IEnumerable<LeaderboardRecord> EnumerateRecords(int firstIndex = 0)
+        {
+            for (int recordIndex = Mathf.Max(0, firstIndex); recordIndex < RecordCount; ++recordIndex)
+            {
+                if (!TryGetPage(recordIndex / PageSize, out Page page))
+                {
+                    yield break;
+                }
+
+                int offset = recordIndex - page.PageIndex * PageSize;
+                if (offset >= page.Count)
+                {
+                    yield break;
+                }
+
+                yield return page.Records[offset];
+            }
+        }
+
+        private bool TryGetPage(int pageIndex, out Page page)
+        {
+            if (_pages.TryGetValue(pageIndex, out page))
+            {
+                if (page.LruNode != _lru.First)
+                {
+                    _lru.Remove(page.LruNode);
+                    _lru.AddFirst(page.LruNode);
+                }
+
+                return true;
+            }
+
+            page = AcquirePage(pageIndex);
+
+            int pageStart = pageIndex * PageSize;
+            int pageCount = Mathf.Min(PageSize, RecordCount - pageStart);
+
+            var copyOptions = new CopyLeaderboardRecordByIndexOptions();
+            for (int offset = 0; offset < pageCount; ++offset)
+            {
+                copyOptions.LeaderboardRecordIndex = (uint)(pageStart + offset);
+
+                Result result = _leaderboards.CopyLeaderboardRecordByIndex(ref copyOptions, out LeaderboardRecord? record);
+                if (result != Result.Success || !record.HasValue)
+                {
+                    Debug.LogErrorFormat("Leaderboard (LeaderboardRecordPager): CopyLeaderboardRecordByIndex {0} failed '{1}'", pageStart + offset, result);
+                    break;
+                }
+
+                page.Records[offset] = record.Value;
+                page.Count = offset + 1;
+            }
+
+            ++PagesLoaded;
+
+            // A page that failed to load entirely isn't kept, so it's retried next time
+            if (page.Count == 0 && pageCount > 0)
+            {
+                ReleasePage(page);
+                page = null;
+                return false;
+            }
+
+            return true;
+        }
+
+        private Page AcquirePage(int pageIndex)
+        {
+            Page page;
+            if (_pages.Count >= MaxCachedPages)
+            {
+                // Reuse the least recently used page and its record storage
+                page = _lru.Last.Value;
+                _lru.RemoveLast();
+                _pages.Remove(page.PageIndex);
+                System.Array.Clear(page.Records, 0, page.Count);
+            }
+            else
+            {
+                page = new Page { Records = new LeaderboardRecord[PageSize] };
+                page.LruNode = new LinkedListNode<Page>(page);
+            }
+
+            page.PageIndex = pageIndex;
+            page.Count = 0;
+            _pages.Add(pageIndex, page);
+            _lru.AddFirst(page.LruNode);
+
+            return page;
+        }
+
+        private void ReleasePage(Page page)
+        {
+            _pages.Remove(page.PageIndex);
+            _lru.Remove(page.LruNode);
+        }
+
+        private void InvalidatePages()
+        {
+            foreach (Page page in _pages.Values)
+            {
+                System.Array.Clear(page.Records, 0, page.Count);
+            }
+
+            _pages.Clear();
+            _lru.Clear();
+        }
+    }
+}
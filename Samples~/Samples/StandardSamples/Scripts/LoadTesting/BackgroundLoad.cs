@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Threading;
+
+    /// <summary>
+    /// Puts the process under CPU and memory pressure: busy threads working
+    /// a share of each 100 ms period, short lived allocations every frame to
+    /// keep the garbage collector busy, and memory kept alive to grow the
+    /// heap. Used by <see cref="PerformanceStressTest"/> and
+    /// <see cref="StressTestRunner"/>.
+    /// </summary>
+    public class BackgroundLoad : IDisposable
+    {
+        private const int PeriodMilliseconds = 100;
+
+        /// <summary>
+        /// Approximate size of a <see cref="GaseousArray.Databomb"/>.
+        /// </summary>
+        private const int DatabombSizeBytes = 4096;
+
+        private readonly List<Thread> _cpuThreads = new();
+        private volatile bool _stopCpuThreads;
+        private volatile int _busyMilliseconds;
+
+        private readonly List<GaseousArray.Databomb> _retained = new();
+        private GaseousArray.Databomb _garbage;
+
+        /// <summary>
+        /// Kilobytes allocated and dropped by each call to
+        /// <see cref="Tick"/>.
+        /// </summary>
+        public int GarbageKilobytesPerFrame { get; set; }
+
+        public int CpuThreadCount
+        {
+            get
+            {
+                return _cpuThreads.Count;
+            }
+        }
+
+        public int RetainedMegabytes
+        {
+            get
+            {
+                return (int)((long)_retained.Count * DatabombSizeBytes / (1024 * 1024));
+            }
+        }
+
+        /// <summary>
+        /// Starts busy threads, replacing the ones already running.
+        /// </summary>
+        /// <param name="threadCount">Number of threads.</param>
+        /// <param name="utilizationPercent">
+        /// Share of the time each thread is busy.
+        /// </param>
+        public void StartCpu(int threadCount, float utilizationPercent)
+        {
+            StopCpu();
+
+            _stopCpuThreads = false;
+            _busyMilliseconds = (int)(Math.Clamp(utilizationPercent, 0, 100) * PeriodMilliseconds / 100);
+
+            for (int i = 0; i < threadCount; ++i)
+            {
+                Thread thread = new(BusyLoop)
+                {
+                    Name = $"{nameof(BackgroundLoad)} {i}",
+                    IsBackground = true
+                };
+                _cpuThreads.Add(thread);
+                thread.Start();
+            }
+        }
+
+        public void StopCpu()
+        {
+            _stopCpuThreads = true;
+
+            foreach (Thread thread in _cpuThreads)
+            {
+                thread.Join();
+            }
+
+            _cpuThreads.Clear();
+        }
+
+        /// <summary>
+        /// Keeps about the given amount of memory alive, allocating or
+        /// releasing what is needed.
+        /// </summary>
+        public void Retain(int megabytes)
+        {
+            int count = (int)((long)Math.Max(0, megabytes) * 1024 * 1024 / DatabombSizeBytes);
+
+            if (count < _retained.Count)
+            {
+                _retained.RemoveRange(count, _retained.Count - count);
+                return;
+            }
+
+            while (_retained.Count < count)
+            {
+                _retained.Add(new GaseousArray.Databomb());
+            }
+        }
+
+        /// <summary>
+        /// Allocates the garbage of one frame.
+        /// </summary>
+        public void Tick()
+        {
+            int count = GarbageKilobytesPerFrame * 1024 / DatabombSizeBytes;
+            for (int i = 0; i < count; ++i)
+            {
+                _garbage = new GaseousArray.Databomb();
+            }
+        }
+
+        /// <summary>
+        /// Stops the busy threads and releases the memory.
+        /// </summary>
+        public void Stop()
+        {
+            StopCpu();
+            GarbageKilobytesPerFrame = 0;
+            _garbage = null;
+            _retained.Clear();
+            _retained.TrimExcess();
+        }
+
+        public void Dispose()
+        {
+            Stop();
+        }
+
+        private void BusyLoop()
+        {
+            Stopwatch watch = Stopwatch.StartNew();
+            long count = 0;
+
+            while (!_stopCpuThreads)
+            {
+                if (watch.ElapsedMilliseconds >= _busyMilliseconds)
+                {
+                    Thread.Sleep(PeriodMilliseconds - _busyMilliseconds);
+                    watch.Restart();
+                }
+                else if (++count > 10000000)
+                {
+                    count = 0;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using UnityEngine;
+
+    /// <summary>
+    /// Runs a <see cref="BotSwarmScenario"/>: creates a pooled platform for
+    /// each bot, ticks them until every bot is done or the scenario runs out
+    /// of time, and reports the latency and throughput of each operation.
+    ///
+    /// Can be added to a scene, or started from the command line of a
+    /// headless player:
+    /// <c>-batchmode -nographics -EOSBotSwarm [scenario.json] [-EOSBotSwarmReport report.csv]</c>.
+    /// When started from the command line the player quits when the run is
+    /// over, with a non-zero exit code if any bot failed.
+    /// </summary>
+    public class BotSwarmRunner : LoadTestRunner
+    {
+        private BotSwarmScenario _scenario;
+        private PlatformPool _pool;
+        private readonly List<SimulatedUser> _bots = new();
+        private readonly OperationLatencyRecorder _recorder = new();
+
+        private float _startTime;
+
+        public override bool IsRunning
+        {
+            get
+            {
+                return _pool != null || IsWaitingForPlatform;
+            }
+        }
+
+        public OperationLatencyRecorder Recorder
+        {
+            get
+            {
+                return _recorder;
+            }
+        }
+
+        /// <summary>
+        /// Invoked with the recorder when the run is over.
+        /// </summary>
+        public event Action<OperationLatencyRecorder> RunCompleted;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+        private static void StartFromCommandLine()
+        {
+            StartFromCommandLine<BotSwarmRunner>("-EOSBotSwarm");
+        }
+
+        protected override void Run(string scenarioPath)
+        {
+            Run(string.IsNullOrEmpty(scenarioPath) ? new BotSwarmScenario() : BotSwarmScenario.Load(scenarioPath));
+        }
+
+        /// <summary>
+        /// Starts running the given scenario, once the EOSManager has
+        /// initialized the SDK.
+        /// </summary>
+        public void Run(BotSwarmScenario scenario)
+        {
+            if (IsRunning)
+            {
+                Debug.LogWarning($"{nameof(BotSwarmRunner)}: A scenario is already running.");
+                return;
+            }
+
+            _scenario = scenario;
+            _startTime = Time.realtimeSinceStartup;
+            WaitForPlatform();
+        }
+
+        protected override void OnPlatformReady()
+        {
+            _recorder.Clear();
+
+            _pool = SimulatedUser.CreateSwarm(_scenario, _recorder, _bots);
+            if (_pool == null)
+            {
+                Finish(false);
+                return;
+            }
+
+            Debug.Log($"{nameof(BotSwarmRunner)}: Started {_bots.Count} bots in lobbies of {Math.Max(1, _scenario.BotsPerLobby)}.");
+            _startTime = Time.realtimeSinceStartup;
+        }
+
+        protected override void UpdateRun()
+        {
+            if (_pool == null)
+            {
+                return;
+            }
+
+            _pool.Tick();
+
+            bool allDone = true;
+            foreach (SimulatedUser bot in _bots)
+            {
+                allDone &= bot.IsDone;
+            }
+
+            bool outOfTime = _scenario.DurationSeconds > 0 && Time.realtimeSinceStartup - _startTime >= _scenario.DurationSeconds;
+
+            if (allDone || outOfTime)
+            {
+                Finish(true);
+            }
+        }
+
+        private void OnDestroy()
+        {
+            StopBots();
+        }
+
+        private void StopBots()
+        {
+            foreach (SimulatedUser bot in _bots)
+            {
+                bot.Stop();
+            }
+
+            _pool?.Dispose();
+            _pool = null;
+        }
+
+        protected override void Finish(bool started)
+        {
+            int failedBots = SimulatedUser.CountFailed(_bots);
+
+            PooledPlatform.Statistics tickStatistics = _pool?.GetTotalStatistics() ?? default;
+            StopBots();
+            _bots.Clear();
+
+            Debug.Log($"{nameof(BotSwarmRunner)}: Run over after {Time.realtimeSinceStartup - _startTime:F1} s, {failedBots} bots failed, " +
+                $"{tickStatistics.Ticks} platform ticks taking {tickStatistics.TotalTickMilliseconds:F0} ms.\n{_recorder.FormatReport()}");
+
+            Complete(started && failedBots == 0);
+        }
+
+        protected override void WriteReport(string path)
+        {
+            File.WriteAllText(path, _recorder.FormatCsv());
+        }
+
+        protected override void OnRunCompleted()
+        {
+            RunCompleted?.Invoke(_recorder);
+        }
+    }
+}
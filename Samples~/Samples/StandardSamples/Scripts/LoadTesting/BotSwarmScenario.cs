@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using UnityEngine;
+
+    /// <summary>
+    /// The steps a bot can take in a <see cref="BotSwarmScenario"/>.
+    /// </summary>
+    public enum BotActionType
+    {
+        /// <summary>
+        /// The first bot of each group creates a lobby, and the other bots of
+        /// the group join it once it exists.
+        /// </summary>
+        CreateOrJoinLobby,
+
+        /// <summary>
+        /// The lobby owner changes a lobby attribute; other members change
+        /// a member attribute.
+        /// </summary>
+        UpdateAttribute,
+
+        /// <summary>
+        /// Sends packets to every other bot in the lobby.
+        /// </summary>
+        SendPackets,
+
+        /// <summary>
+        /// Waits before the next step.
+        /// </summary>
+        Wait,
+
+        LeaveLobby,
+
+        /// <summary>
+        /// Writes a file to Player Data Storage, then reads it back.
+        /// </summary>
+        TransferFile,
+
+        /// <summary>
+        /// The first bot of each group creates a Session, and the other bots
+        /// of the group find it by id and join it once it exists.
+        /// </summary>
+        CreateOrJoinSession,
+
+        /// <summary>
+        /// The Session owner changes a Session attribute. Members can't
+        /// modify a Session, so for them the step only waits.
+        /// </summary>
+        UpdateSession,
+
+        /// <summary>
+        /// Destroys the local Session, which for its owner also removes it
+        /// from the backend.
+        /// </summary>
+        DestroySession
+    }
+
+    [Serializable]
+    public class BotAction
+    {
+        public BotActionType Action;
+
+        /// <summary>
+        /// Number of times the action is repeated.
+        /// </summary>
+        public int Count = 1;
+
+        /// <summary>
+        /// Seconds between repetitions of the action, or the time to wait.
+        /// </summary>
+        public float IntervalSeconds = 0;
+
+        /// <summary>
+        /// Size of each packet, for <see cref="BotActionType.SendPackets"/>.
+        /// </summary>
+        public int PacketSizeBytes = 256;
+
+        /// <summary>
+        /// Whether packets are sent reliably, for
+        /// <see cref="BotActionType.SendPackets"/>.
+        /// </summary>
+        public bool Reliable = false;
+
+        /// <summary>
+        /// Size of the file, for <see cref="BotActionType.TransferFile"/>.
+        /// </summary>
+        public int TransferSizeBytes = 64 * 1024;
+    }
+
+    /// <summary>
+    /// Describes a load test run by <see cref="BotSwarmRunner"/>: how many
+    /// bots there are, how they log in, and the steps each of them replays.
+    /// Stored as JSON.
+    /// </summary>
+    [Serializable]
+    public class BotSwarmScenario
+    {
+        public enum LoginType
+        {
+            /// <summary>
+            /// Connect login with a device id created for each bot.
+            /// </summary>
+            DeviceId,
+
+            /// <summary>
+            /// Auth login through the Developer Authentication Tool, with one
+            /// credential per bot, followed by a Connect login.
+            /// </summary>
+            DevAuthTool
+        }
+
+        public int BotCount = 8;
+
+        /// <summary>
+        /// Number of bots in each lobby, including its owner.
+        /// </summary>
+        public int BotsPerLobby = 4;
+
+        public LoginType Login = LoginType.DeviceId;
+
+        /// <summary>
+        /// Host and port of the Developer Authentication Tool.
+        /// </summary>
+        public string DevAuthHost = "localhost:6547";
+
+        /// <summary>
+        /// Credentials are named this prefix followed by the index of the bot.
+        /// </summary>
+        public string DevAuthCredentialPrefix = "Bot";
+
+        /// <summary>
+        /// Bucket the lobbies are created in, so they don't show up in the
+        /// searches of real players.
+        /// </summary>
+        public string LobbyBucketId = "BotSwarm";
+
+        /// <summary>
+        /// Bucket the Sessions are created in.
+        /// </summary>
+        public string SessionBucketId = "BotSwarm";
+
+        /// <summary>
+        /// Whether each bot goes back to the first step after the last one.
+        /// </summary>
+        public bool Loop = false;
+
+        /// <summary>
+        /// Seconds after which the run stops, even if bots are still going.
+        /// Zero or less has no limit.
+        /// </summary>
+        public float DurationSeconds = 120;
+
+        /// <summary>
+        /// Whether the platforms are ticked on worker threads instead of the
+        /// main thread.
+        /// </summary>
+        public bool TickInParallel = false;
+
+        public List<BotAction> Steps = new()
+        {
+            new BotAction { Action = BotActionType.CreateOrJoinLobby },
+            new BotAction { Action = BotActionType.CreateOrJoinSession },
+            new BotAction { Action = BotActionType.UpdateAttribute, Count = 10, IntervalSeconds = 0.5f },
+            new BotAction { Action = BotActionType.UpdateSession, Count = 5, IntervalSeconds = 1 },
+            new BotAction { Action = BotActionType.SendPackets, Count = 100, IntervalSeconds = 0.05f },
+            new BotAction { Action = BotActionType.DestroySession },
+            new BotAction { Action = BotActionType.LeaveLobby }
+        };
+
+        public static BotSwarmScenario Load(string path)
+        {
+            return JsonUtility.FromJson<BotSwarmScenario>(File.ReadAllText(path));
+        }
+    }
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using UnityEngine;
+
+    using CommandLineUtility = PlayEveryWare.EpicOnlineServices.Utility.CommandLineUtility;
+
+    /// <summary>
+    /// What the load testing runners have in common: starting from the
+    /// command line of a headless player, waiting for the
+    /// <see cref="EOSManager"/> to initialize the SDK before running, and
+    /// writing a report and quitting when the run is over.
+    ///
+    /// A runner started with <c>-Name [scenario.json] [-NameReport report.csv]</c>
+    /// quits when the run is over, with a non-zero exit code if the run
+    /// failed.
+    /// </summary>
+    public abstract class LoadTestRunner : MonoBehaviour
+    {
+        /// <summary>
+        /// Path of the scenario to run. If empty, the default scenario is run.
+        /// </summary>
+        public string ScenarioPath;
+
+        /// <summary>
+        /// Path of the CSV report written at the end of the run, if not empty.
+        /// </summary>
+        public string ReportPath;
+
+        public bool RunOnStart = true;
+
+        /// <summary>
+        /// Whether the application quits when the run is over.
+        /// </summary>
+        public bool QuitWhenDone = false;
+
+        /// <summary>
+        /// Seconds to wait for the EOSManager to initialize the SDK.
+        /// </summary>
+        protected const float PlatformTimeoutSeconds = 30;
+
+        private bool _waitingForPlatform;
+        private float _waitStartTime;
+
+        public abstract bool IsRunning { get; }
+
+        protected bool IsWaitingForPlatform
+        {
+            get
+            {
+                return _waitingForPlatform;
+            }
+        }
+
+        /// <summary>
+        /// Creates a runner of the given type if the option is on the command
+        /// line, along with an EOSManager if the scene has none. The report
+        /// path is read from the option with <c>Report</c> appended.
+        /// </summary>
+        /// <param name="option">
+        /// The option starting the runner, followed by the path of the
+        /// scenario if it isn't the default one.
+        /// </param>
+        protected static void StartFromCommandLine<T>(string option) where T : LoadTestRunner
+        {
+            if (!CommandLineUtility.TryGetValue(option, out string scenarioPath))
+            {
+                return;
+            }
+
+            if (FindObjectOfType<EOSManager>() == null)
+            {
+                new GameObject(nameof(EOSManager)).AddComponent<EOSManager>();
+            }
+
+            T runner = new GameObject(typeof(T).Name).AddComponent<T>();
+            runner.ScenarioPath = scenarioPath;
+            runner.ReportPath = CommandLineUtility.GetValue(option + "Report");
+            runner.QuitWhenDone = true;
+            DontDestroyOnLoad(runner.gameObject);
+        }
+
+        protected void Start()
+        {
+            if (RunOnStart)
+            {
+                Run(ScenarioPath);
+            }
+        }
+
+        protected void Update()
+        {
+            if (_waitingForPlatform)
+            {
+                if (EOSManager.Instance.GetEOSPlatformInterface() != null)
+                {
+                    _waitingForPlatform = false;
+                    OnPlatformReady();
+                }
+                else if (Time.realtimeSinceStartup - _waitStartTime > PlatformTimeoutSeconds)
+                {
+                    _waitingForPlatform = false;
+                    Debug.LogError($"{GetType().Name}: The EOS SDK wasn't initialized after {PlatformTimeoutSeconds} seconds.");
+                    Finish(false);
+                }
+                return;
+            }
+
+            UpdateRun();
+        }
+
+        /// <summary>
+        /// Loads the scenario at the given path, or the default scenario if
+        /// the path is empty, and starts running it.
+        /// </summary>
+        protected abstract void Run(string scenarioPath);
+
+        /// <summary>
+        /// Calls <see cref="OnPlatformReady"/> once the EOSManager has
+        /// initialized the SDK, or fails the run if it isn't initialized
+        /// after <see cref="PlatformTimeoutSeconds"/>.
+        /// </summary>
+        protected void WaitForPlatform()
+        {
+            _waitingForPlatform = true;
+            _waitStartTime = Time.realtimeSinceStartup;
+        }
+
+        protected abstract void OnPlatformReady();
+
+        /// <summary>
+        /// Called every frame once the SDK is initialized.
+        /// </summary>
+        protected abstract void UpdateRun();
+
+        /// <summary>
+        /// Stops the run and reports its results.
+        /// </summary>
+        /// <param name="started">
+        /// Whether the run got far enough to measure anything.
+        /// </param>
+        protected abstract void Finish(bool started);
+
+        /// <summary>
+        /// Writes the report if there is a report path, raises the completion
+        /// event of the runner, and quits if the runner should.
+        /// </summary>
+        /// <param name="succeeded">Whether to quit with a zero exit code.</param>
+        protected void Complete(bool succeeded)
+        {
+            if (!string.IsNullOrEmpty(ReportPath))
+            {
+                try
+                {
+                    WriteReport(ReportPath);
+                }
+                catch (Exception e)
+                {
+                    Debug.LogError($"{GetType().Name}: Couldn't write the report to \"{ReportPath}\": {e.Message}");
+                }
+            }
+
+            OnRunCompleted();
+
+            if (QuitWhenDone)
+            {
+                Application.Quit(succeeded ? 0 : 1);
+            }
+        }
+
+        protected abstract void WriteReport(string path);
+
+        protected abstract void OnRunCompleted();
+    }
+}
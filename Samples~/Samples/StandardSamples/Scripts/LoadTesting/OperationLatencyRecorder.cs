@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Globalization;
+    using System.Text;
+
+    /// <summary>
+    /// Records the latency, outcome and size of named operations, and
+    /// summarizes them as percentiles and throughput. Safe to use from
+    /// several threads.
+    /// </summary>
+    public class OperationLatencyRecorder
+    {
+        /// <summary>
+        /// Summary of the samples recorded for one operation.
+        /// </summary>
+        public struct Summary
+        {
+            public string Operation;
+            public long Count;
+            public long Failures;
+            public long Bytes;
+            public double MinMilliseconds;
+            public double MeanMilliseconds;
+            public double P50Milliseconds;
+            public double P90Milliseconds;
+            public double P99Milliseconds;
+            public double MaxMilliseconds;
+
+            /// <summary>
+            /// Operations per second over the time the recorder has run.
+            /// </summary>
+            public double OperationsPerSecond;
+
+            /// <summary>
+            /// Bytes per second over the time the recorder has run.
+            /// </summary>
+            public double BytesPerSecond;
+        }
+
+        /// <summary>
+        /// Upper bounds, in milliseconds, of the buckets of
+        /// <see cref="GetHistogram"/>: powers of two from 1/16 ms to 16 s.
+        /// A last bucket counts the samples above the last bound.
+        /// </summary>
+        public static readonly double[] HistogramUpperBounds = CreateHistogramUpperBounds();
+
+        private class OperationSamples
+        {
+            public readonly List<double> Milliseconds = new();
+            public long Failures;
+            public long Bytes;
+        }
+
+        private readonly Dictionary<string, OperationSamples> _operations = new();
+        private readonly Stopwatch _elapsed = Stopwatch.StartNew();
+        private readonly object _lock = new();
+
+        /// <summary>
+        /// Timestamp to pass to <see cref="RecordSince"/>, comparable across
+        /// threads.
+        /// </summary>
+        public static long Timestamp
+        {
+            get
+            {
+                return Stopwatch.GetTimestamp();
+            }
+        }
+
+        public static double MillisecondsSince(long timestamp)
+        {
+            return (Stopwatch.GetTimestamp() - timestamp) * 1000.0 / Stopwatch.Frequency;
+        }
+
+        /// <summary>
+        /// Records an operation that started at the given timestamp.
+        /// </summary>
+        public void RecordSince(string operation, long startTimestamp, bool succeeded = true, long bytes = 0)
+        {
+            Record(operation, MillisecondsSince(startTimestamp), succeeded, bytes);
+        }
+
+        /// <summary>
+        /// Records an operation. Failed operations are counted, but their
+        /// latency is left out of the percentiles.
+        /// </summary>
+        public void Record(string operation, double milliseconds, bool succeeded = true, long bytes = 0)
+        {
+            lock (_lock)
+            {
+                if (!_operations.TryGetValue(operation, out OperationSamples samples))
+                {
+                    samples = new OperationSamples();
+                    _operations.Add(operation, samples);
+                }
+
+                if (succeeded)
+                {
+                    samples.Milliseconds.Add(milliseconds);
+                    samples.Bytes += bytes;
+                }
+                else
+                {
+                    samples.Failures++;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Forgets every sample and restarts the throughput clock.
+        /// </summary>
+        public void Clear()
+        {
+            lock (_lock)
+            {
+                _operations.Clear();
+                _elapsed.Restart();
+            }
+        }
+
+        /// <summary>
+        /// Summarizes every operation, sorted by name.
+        /// </summary>
+        public List<Summary> GetSummaries()
+        {
+            List<Summary> summaries = new();
+
+            lock (_lock)
+            {
+                double seconds = Math.Max(_elapsed.Elapsed.TotalSeconds, double.Epsilon);
+
+                foreach (var operation in _operations)
+                {
+                    List<double> sorted = new(operation.Value.Milliseconds);
+                    sorted.Sort();
+
+                    double total = 0;
+                    foreach (double milliseconds in sorted)
+                    {
+                        total += milliseconds;
+                    }
+
+                    summaries.Add(new Summary
+                    {
+                        Operation = operation.Key,
+                        Count = sorted.Count,
+                        Failures = operation.Value.Failures,
+                        Bytes = operation.Value.Bytes,
+                        MinMilliseconds = sorted.Count > 0 ? sorted[0] : 0,
+                        MeanMilliseconds = sorted.Count > 0 ? total / sorted.Count : 0,
+                        P50Milliseconds = GetPercentile(sorted, 0.50),
+                        P90Milliseconds = GetPercentile(sorted, 0.90),
+                        P99Milliseconds = GetPercentile(sorted, 0.99),
+                        MaxMilliseconds = sorted.Count > 0 ? sorted[sorted.Count - 1] : 0,
+                        OperationsPerSecond = sorted.Count / seconds,
+                        BytesPerSecond = operation.Value.Bytes / seconds
+                    });
+                }
+            }
+
+            summaries.Sort((left, right) => string.CompareOrdinal(left.Operation, right.Operation));
+            return summaries;
+        }
+
+        /// <summary>
+        /// Counts the successful samples of an operation in each of the
+        /// buckets of <see cref="HistogramUpperBounds"/>.
+        /// </summary>
+        /// <returns>
+        /// One count per bound, followed by the count of samples above the
+        /// last bound.
+        /// </returns>
+        public long[] GetHistogram(string operation)
+        {
+            long[] counts = new long[HistogramUpperBounds.Length + 1];
+
+            lock (_lock)
+            {
+                if (!_operations.TryGetValue(operation, out OperationSamples samples))
+                {
+                    return counts;
+                }
+
+                foreach (double milliseconds in samples.Milliseconds)
+                {
+                    int bucket = Array.BinarySearch(HistogramUpperBounds, milliseconds);
+                    counts[bucket >= 0 ? bucket : ~bucket]++;
+                }
+            }
+
+            return counts;
+        }
+
+        /// <summary>
+        /// Formats the summaries as a table.
+        /// </summary>
+        public string FormatReport()
+        {
+            StringBuilder report = new();
+            report.AppendLine("Operation                      Count  Failed    p50 ms    p90 ms    p99 ms    max ms     ops/s     KiB/s");
+
+            foreach (Summary summary in GetSummaries())
+            {
+                report.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                    "{0,-28} {1,7} {2,7} {3,9:0.00} {4,9:0.00} {5,9:0.00} {6,9:0.00} {7,9:0.0} {8,9:0.0}",
+                    summary.Operation, summary.Count, summary.Failures,
+                    summary.P50Milliseconds, summary.P90Milliseconds, summary.P99Milliseconds, summary.MaxMilliseconds,
+                    summary.OperationsPerSecond, summary.BytesPerSecond / 1024.0));
+            }
+
+            return report.ToString();
+        }
+
+        /// <summary>
+        /// Formats the summaries as comma separated values, for CI to pick up.
+        /// </summary>
+        public string FormatCsv()
+        {
+            StringBuilder csv = new();
+            csv.AppendLine("operation,count,failures,bytes,min_ms,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,ops_per_second,bytes_per_second");
+
+            foreach (Summary summary in GetSummaries())
+            {
+                csv.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                    "{0},{1},{2},{3},{4:0.###},{5:0.###},{6:0.###},{7:0.###},{8:0.###},{9:0.###},{10:0.###},{11:0.###}",
+                    summary.Operation, summary.Count, summary.Failures, summary.Bytes,
+                    summary.MinMilliseconds, summary.MeanMilliseconds,
+                    summary.P50Milliseconds, summary.P90Milliseconds, summary.P99Milliseconds, summary.MaxMilliseconds,
+                    summary.OperationsPerSecond, summary.BytesPerSecond));
+            }
+
+            return csv.ToString();
+        }
+
+        private static double[] CreateHistogramUpperBounds()
+        {
+            double[] bounds = new double[19];
+            for (int i = 0; i < bounds.Length; ++i)
+            {
+                bounds[i] = Math.Pow(2, i - 4);
+            }
+
+            return bounds;
+        }
+
+        /// <summary>
+        /// Nearest rank percentile of sorted samples.
+        /// </summary>
+        private static double GetPercentile(List<double> sorted, double percentile)
+        {
+            if (sorted.Count == 0)
+            {
+                return 0;
+            }
+
+            int rank = (int)Math.Ceiling(percentile * sorted.Count) - 1;
+            return sorted[Math.Max(0, Math.Min(rank, sorted.Count - 1))];
+        }
+    }
+}
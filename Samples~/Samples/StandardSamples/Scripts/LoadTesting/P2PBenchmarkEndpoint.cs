@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// One local user of a <see cref="P2PBenchmarkRunner"/>, exchanging
+    /// packets with one remote user through one networking layer.
+    ///
+    /// Each layer the benchmark can measure has its own subclass, registered
+    /// under the name of the layer with <see cref="RegisterLayer"/>. The raw
+    /// <see cref="P2PInterface"/> is always registered; the layers of the
+    /// P2P Netcode sample register themselves when that sample is imported.
+    /// </summary>
+    public abstract class P2PBenchmarkEndpoint
+    {
+        private static readonly SortedDictionary<string, Func<P2PBenchmarkEndpoint>> s_layers = new()
+        {
+            { RawP2PBenchmarkEndpoint.LayerName, () => new RawP2PBenchmarkEndpoint() }
+        };
+
+        /// <summary>
+        /// The names of the registered layers, sorted.
+        /// </summary>
+        public static IReadOnlyCollection<string> LayerNames
+        {
+            get
+            {
+                return s_layers.Keys;
+            }
+        }
+
+        /// <summary>
+        /// Registers a layer, replacing any layer of the same name.
+        /// </summary>
+        public static void RegisterLayer(string name, Func<P2PBenchmarkEndpoint> create)
+        {
+            s_layers[name] = create;
+        }
+
+        /// <summary>
+        /// Creates an endpoint of the given layer, or returns null if no
+        /// layer of that name is registered.
+        /// </summary>
+        public static P2PBenchmarkEndpoint Create(string layer)
+        {
+            return s_layers.TryGetValue(layer, out Func<P2PBenchmarkEndpoint> create) ? create() : null;
+        }
+
+        /// <summary>
+        /// Whether the connection to the remote user is open in both
+        /// directions, so that packets sent now are expected to arrive.
+        /// </summary>
+        public abstract bool IsConnected { get; }
+
+        /// <summary>
+        /// Starts connecting to the remote user. Of the two users of a pair,
+        /// the host waits for the connection and the other user requests it.
+        /// </summary>
+        /// <returns>False if the layer couldn't be set up.</returns>
+        public abstract bool Start(P2PInterface p2pInterface, ProductUserId localUserId, ProductUserId remoteUserId, bool isHost);
+
+        /// <summary>
+        /// Sends a packet to the remote user.
+        /// </summary>
+        /// <returns>False if the layer reported an error.</returns>
+        public abstract bool Send(ArraySegment<byte> packet, byte channel, PacketReliability reliability);
+
+        /// <summary>
+        /// Receives the next packet from the remote user, handling any
+        /// packet the layer uses internally on the way.
+        /// </summary>
+        /// <param name="packet">
+        /// The packet, only valid until the next call.
+        /// </param>
+        /// <returns>False if there is no packet to receive.</returns>
+        public abstract bool TryReceive(out ArraySegment<byte> packet);
+
+        /// <summary>
+        /// Closes the connection and releases the layer.
+        /// </summary>
+        public abstract void Stop();
+    }
+}
@@ -0,0 +1,720 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+    using System.Globalization;
+    using System.IO;
+    using System.Text;
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Connect;
+    using Epic.OnlineServices.P2P;
+
+    using Debug = UnityEngine.Debug;
+
+    /// <summary>
+    /// Measures the throughput, one-way latency, loss and CPU cost of P2P
+    /// packets through each networking layer, for every case of a
+    /// <see cref="P2PBenchmarkSettings"/> sweep.
+    ///
+    /// The users are logged in with device ids on platforms of a
+    /// <see cref="PlatformPool"/>, so the packets never leave the process
+    /// when running against the mock backend, and go through the relays
+    /// otherwise. Every packet starts with the time it was sent, and the
+    /// platforms are ticked on the main thread, so the latency includes up
+    /// to a frame of waiting for the next tick.
+    ///
+    /// Can be added to a scene, or started from the command line of a
+    /// headless player:
+    /// <c>-batchmode -nographics -EOSP2PBenchmark [settings.json] [-EOSP2PBenchmarkReport report.csv]</c>.
+    /// When started from the command line the player quits when the run is
+    /// over, with a non-zero exit code if a layer couldn't be measured.
+    /// </summary>
+    public class P2PBenchmarkRunner : LoadTestRunner
+    {
+        /// <summary>
+        /// The measurements of one case of the sweep.
+        /// </summary>
+        public struct CaseResult
+        {
+            public string Layer;
+            public int PacketSizeBytes;
+            public float PacketsPerSecond;
+            public int Channels;
+            public PacketReliability Reliability;
+
+            public long Sent;
+            public long SendFailures;
+            public long Received;
+
+            /// <summary>
+            /// Share of the sent packets that didn't arrive before the end of
+            /// the case, in percent.
+            /// </summary>
+            public double LossPercent;
+
+            /// <summary>
+            /// Bytes received per second of sending, over all users.
+            /// </summary>
+            public double BytesPerSecond;
+
+            public double P50Milliseconds;
+            public double P99Milliseconds;
+            public double MaxMilliseconds;
+
+            /// <summary>
+            /// Time spent in the send call of the layer, per packet sent.
+            /// </summary>
+            public double SendMicrosecondsPerPacket;
+
+            /// <summary>
+            /// Time spent polling the layer for packets, per packet received.
+            /// </summary>
+            public double ReceiveMicrosecondsPerPacket;
+
+            /// <summary>
+            /// Time spent ticking the platforms, per packet received.
+            /// </summary>
+            public double TickMicrosecondsPerPacket;
+        }
+
+        private enum Phase
+        {
+            Idle,
+            LoggingIn,
+            Connecting,
+            Sending,
+            Draining
+        }
+
+        private struct Case
+        {
+            public int PacketSizeBytes;
+            public float PacketsPerSecond;
+            public int Channels;
+            public PacketReliability Reliability;
+        }
+
+        private class User
+        {
+            public PooledPlatform Platform;
+            public ProductUserId UserId;
+            public bool LoginFailed;
+            public User Peer;
+            public bool IsHost;
+            public P2PBenchmarkEndpoint Endpoint;
+
+            /// <summary>
+            /// Packets sent during the current case.
+            /// </summary>
+            public long Sent;
+        }
+
+        /// <summary>
+        /// Size of the header at the start of each packet: the time it was
+        /// sent, the case it belongs to, and its sequence number.
+        /// </summary>
+        private const int PacketHeaderSize = sizeof(long) + sizeof(int) + sizeof(int);
+
+        private const string SendOperation = "Send";
+        private const string DeliveryOperation = "Delivery";
+
+        private P2PBenchmarkSettings _settings;
+        private PlatformPool _pool;
+        private readonly List<User> _users = new();
+        private readonly List<User> _pairedUsers = new();
+        private readonly List<string> _layers = new();
+        private readonly List<string> _failedLayers = new();
+        private readonly List<Case> _cases = new();
+        private readonly List<CaseResult> _results = new();
+        private readonly OperationLatencyRecorder _recorder = new();
+        private byte[] _sendBuffer = Array.Empty<byte>();
+
+        private Phase _phase = Phase.Idle;
+        private long _phaseTimestamp;
+        private int _layerIndex;
+        private int _caseIndex;
+
+        // Identifies the current case in the packets, so that packets still
+        // arriving from a previous case or layer aren't counted.
+        private int _caseId;
+
+        private long _sent;
+        private long _sendFailures;
+        private long _received;
+        private long _receiveTicks;
+        private double _caseStartTickMilliseconds;
+
+        public override bool IsRunning
+        {
+            get
+            {
+                return _phase != Phase.Idle || IsWaitingForPlatform;
+            }
+        }
+
+        /// <summary>
+        /// The results of the cases run so far.
+        /// </summary>
+        public IReadOnlyList<CaseResult> Results
+        {
+            get
+            {
+                return _results;
+            }
+        }
+
+        /// <summary>
+        /// Invoked with the results when the run is over.
+        /// </summary>
+        public event Action<IReadOnlyList<CaseResult>> RunCompleted;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+        private static void StartFromCommandLine()
+        {
+            StartFromCommandLine<P2PBenchmarkRunner>("-EOSP2PBenchmark");
+        }
+
+        /// <summary>
+        /// Runs the <see cref="P2PBenchmarkSettings"/> at the given path, or
+        /// the default settings if the path is empty.
+        /// </summary>
+        protected override void Run(string settingsPath)
+        {
+            Run(string.IsNullOrEmpty(settingsPath) ? new P2PBenchmarkSettings() : P2PBenchmarkSettings.Load(settingsPath));
+        }
+
+        /// <summary>
+        /// Starts running the given sweep, once the EOSManager has
+        /// initialized the SDK.
+        /// </summary>
+        public void Run(P2PBenchmarkSettings settings)
+        {
+            if (IsRunning)
+            {
+                Debug.LogWarning($"{nameof(P2PBenchmarkRunner)}: A benchmark is already running.");
+                return;
+            }
+
+            _settings = settings;
+            _results.Clear();
+            _failedLayers.Clear();
+
+            _layers.Clear();
+            _layers.AddRange(settings.Layers.Count > 0 ? settings.Layers : P2PBenchmarkEndpoint.LayerNames);
+
+            _cases.Clear();
+            foreach (int packetSize in settings.PacketSizes)
+            {
+                foreach (float packetsPerSecond in settings.PacketsPerSecond)
+                {
+                    foreach (int channels in settings.ChannelCounts)
+                    {
+                        foreach (PacketReliability reliability in settings.Reliabilities)
+                        {
+                            _cases.Add(new Case
+                            {
+                                PacketSizeBytes = Math.Clamp(packetSize, PacketHeaderSize, P2PInterface.MAX_PACKET_SIZE),
+                                PacketsPerSecond = Math.Max(1, packetsPerSecond),
+                                // The highest channel is kept for the layers' own packets
+                                Channels = Math.Clamp(channels, 1, byte.MaxValue),
+                                Reliability = reliability
+                            });
+                        }
+                    }
+                }
+            }
+
+            WaitForPlatform();
+        }
+
+        private void EnterPhase(Phase phase)
+        {
+            _phase = phase;
+            _phaseTimestamp = OperationLatencyRecorder.Timestamp;
+        }
+
+        private double SecondsInPhase
+        {
+            get
+            {
+                return OperationLatencyRecorder.MillisecondsSince(_phaseTimestamp) / 1000.0;
+            }
+        }
+
+        protected override void UpdateRun()
+        {
+            if (_phase == Phase.Idle)
+            {
+                return;
+            }
+
+            if (_phase == Phase.Sending)
+            {
+                SendPackets();
+            }
+
+            _pool.Tick();
+            ReceivePackets();
+
+            switch (_phase)
+            {
+                case Phase.LoggingIn:
+                    UpdateLoggingIn();
+                    break;
+                case Phase.Connecting:
+                    UpdateConnecting();
+                    break;
+                case Phase.Sending:
+                    if (SecondsInPhase >= _settings.SecondsPerCase)
+                    {
+                        EnterPhase(Phase.Draining);
+                    }
+                    break;
+                case Phase.Draining:
+                    if (SecondsInPhase >= _settings.DrainSeconds)
+                    {
+                        FinishCase();
+                    }
+                    break;
+            }
+        }
+
+        private void OnDestroy()
+        {
+            StopUsers();
+        }
+
+        #region Users
+
+        protected override void OnPlatformReady()
+        {
+            // Every platform is ticked on the main thread, as the layers of
+            // the samples aren't safe to use from several threads.
+            _pool = PlatformPool.Create(Math.Max(2, _settings.UserCount), new PlatformPool.Settings
+            {
+                Mode = PlatformPool.TickMode.RoundRobin
+            });
+
+            if (_pool == null)
+            {
+                Finish(false);
+                return;
+            }
+
+            foreach (PooledPlatform platform in _pool.Platforms)
+            {
+                User user = new() { Platform = platform };
+                _users.Add(user);
+                LogIn(user);
+            }
+
+            for (int i = 0; i + 1 < _users.Count; i += 2)
+            {
+                _users[i].IsHost = true;
+                _users[i].Peer = _users[i + 1];
+                _users[i + 1].Peer = _users[i];
+
+                // Hosts first, so that they are listening before the other
+                // users of the pairs request a connection
+                _pairedUsers.Add(_users[i]);
+                _pairedUsers.Add(_users[i + 1]);
+            }
+
+            EnterPhase(Phase.LoggingIn);
+        }
+
+        private void LogIn(User user)
+        {
+            ConnectInterface connectInterface = user.Platform.Platform.GetConnectInterface();
+
+            CreateDeviceIdOptions createDeviceIdOptions = new()
+            {
+                DeviceModel = "P2PBenchmark"
+            };
+
+            connectInterface.CreateDeviceId(ref createDeviceIdOptions, null, (ref CreateDeviceIdCallbackInfo createData) =>
+            {
+                // A device id already existing for this platform's cache is fine
+                if (createData.ResultCode != Result.Success && createData.ResultCode != Result.DuplicateNotAllowed)
+                {
+                    Debug.LogWarning($"{nameof(P2PBenchmarkRunner)}: CreateDeviceId failed for user {user.Platform.Index} with result {createData.ResultCode}.");
+                    user.LoginFailed = true;
+                    return;
+                }
+
+                LoginOptions loginOptions = new()
+                {
+                    Credentials = new Credentials { Type = ExternalCredentialType.DeviceidAccessToken, Token = null },
+                    UserLoginInfo = new UserLoginInfo { DisplayName = "P2P Benchmark " + user.Platform.Index }
+                };
+
+                connectInterface.Login(ref loginOptions, null, (ref LoginCallbackInfo loginData) =>
+                {
+                    if (loginData.ResultCode != Result.Success)
+                    {
+                        Debug.LogWarning($"{nameof(P2PBenchmarkRunner)}: Connect login failed for user {user.Platform.Index} with result {loginData.ResultCode}.");
+                        user.LoginFailed = true;
+                        return;
+                    }
+
+                    user.UserId = loginData.LocalUserId;
+                });
+            });
+        }
+
+        private void UpdateLoggingIn()
+        {
+            bool allDone = true;
+            bool anyFailed = false;
+            foreach (User user in _users)
+            {
+                allDone &= user.UserId != null || user.LoginFailed;
+                anyFailed |= user.LoginFailed;
+            }
+
+            if (anyFailed)
+            {
+                Finish(false);
+            }
+            else if (allDone)
+            {
+                _layerIndex = 0;
+                StartLayer();
+            }
+            else if (SecondsInPhase > _settings.ConnectTimeoutSeconds)
+            {
+                Debug.LogError($"{nameof(P2PBenchmarkRunner)}: The users weren't logged in after {_settings.ConnectTimeoutSeconds} seconds.");
+                Finish(false);
+            }
+        }
+
+        private void StopUsers()
+        {
+            StopLayer();
+            _users.Clear();
+            _pairedUsers.Clear();
+
+            _pool?.Dispose();
+            _pool = null;
+        }
+
+        #endregion
+
+        #region Layers
+
+        private void StartLayer()
+        {
+            while (_layerIndex < _layers.Count)
+            {
+                string layer = _layers[_layerIndex];
+                bool started = true;
+
+                foreach (User user in _pairedUsers)
+                {
+                    user.Endpoint = P2PBenchmarkEndpoint.Create(layer);
+                    if (user.Endpoint == null)
+                    {
+                        Debug.LogError($"{nameof(P2PBenchmarkRunner)}: No layer named \"{layer}\" is registered.");
+                        started = false;
+                        break;
+                    }
+
+                    if (!user.Endpoint.Start(user.Platform.Platform.GetP2PInterface(), user.UserId, user.Peer.UserId, user.IsHost))
+                    {
+                        Debug.LogError($"{nameof(P2PBenchmarkRunner)}: The {layer} layer couldn't be started for user {user.Platform.Index}.");
+                        started = false;
+                        break;
+                    }
+                }
+
+                if (started)
+                {
+                    _caseIndex = 0;
+                    EnterPhase(Phase.Connecting);
+                    return;
+                }
+
+                _failedLayers.Add(layer);
+                StopLayer();
+                _layerIndex++;
+            }
+
+            Finish(true);
+        }
+
+        private void UpdateConnecting()
+        {
+            bool allConnected = true;
+            foreach (User user in _pairedUsers)
+            {
+                allConnected &= user.Endpoint.IsConnected;
+            }
+
+            if (allConnected)
+            {
+                StartCase();
+            }
+            else if (SecondsInPhase > _settings.ConnectTimeoutSeconds)
+            {
+                Debug.LogError($"{nameof(P2PBenchmarkRunner)}: The users of the {_layers[_layerIndex]} layer weren't connected after {_settings.ConnectTimeoutSeconds} seconds.");
+                _failedLayers.Add(_layers[_layerIndex]);
+                NextLayer();
+            }
+        }
+
+        private void NextLayer()
+        {
+            StopLayer();
+            _layerIndex++;
+            StartLayer();
+        }
+
+        private void StopLayer()
+        {
+            foreach (User user in _pairedUsers)
+            {
+                user.Endpoint?.Stop();
+                user.Endpoint = null;
+            }
+        }
+
+        #endregion
+
+        #region Cases
+
+        private void StartCase()
+        {
+            Case current = _cases[_caseIndex];
+            if (_sendBuffer.Length != current.PacketSizeBytes)
+            {
+                _sendBuffer = new byte[current.PacketSizeBytes];
+            }
+
+            foreach (User user in _pairedUsers)
+            {
+                user.Sent = 0;
+            }
+
+            _caseId++;
+            _sent = 0;
+            _sendFailures = 0;
+            _received = 0;
+            _receiveTicks = 0;
+            _caseStartTickMilliseconds = _pool.GetTotalStatistics().TotalTickMilliseconds;
+            _recorder.Clear();
+
+            EnterPhase(Phase.Sending);
+        }
+
+        /// <summary>
+        /// Sends every packet due by now at the rate of the case, each user
+        /// to the other user of its pair.
+        /// </summary>
+        private void SendPackets()
+        {
+            Case current = _cases[_caseIndex];
+            long due = (long)(SecondsInPhase * current.PacketsPerSecond) + 1;
+            ArraySegment<byte> packet = new(_sendBuffer);
+
+            foreach (User user in _pairedUsers)
+            {
+                for (; user.Sent < due; user.Sent++)
+                {
+                    BitConverter.TryWriteBytes(new Span<byte>(_sendBuffer, sizeof(long), sizeof(int)), _caseId);
+                    BitConverter.TryWriteBytes(new Span<byte>(_sendBuffer, sizeof(long) + sizeof(int), sizeof(int)), (int)user.Sent);
+
+                    long startTimestamp = OperationLatencyRecorder.Timestamp;
+                    BitConverter.TryWriteBytes(new Span<byte>(_sendBuffer, 0, sizeof(long)), startTimestamp);
+
+                    bool succeeded = user.Endpoint.Send(packet, (byte)(user.Sent % current.Channels), current.Reliability);
+                    _recorder.RecordSince(SendOperation, startTimestamp, succeeded, packet.Count);
+
+                    if (succeeded)
+                    {
+                        _sent++;
+                    }
+                    else
+                    {
+                        _sendFailures++;
+                    }
+                }
+            }
+        }
+
+        private void ReceivePackets()
+        {
+            bool measuring = _phase == Phase.Sending || _phase == Phase.Draining;
+
+            foreach (User user in _pairedUsers)
+            {
+                if (user.Endpoint == null)
+                {
+                    continue;
+                }
+
+                long startTimestamp = Stopwatch.GetTimestamp();
+
+                while (user.Endpoint.TryReceive(out ArraySegment<byte> packet))
+                {
+                    if (!measuring || packet.Count < PacketHeaderSize
+                        || BitConverter.ToInt32(packet.Array, packet.Offset + sizeof(long)) != _caseId)
+                    {
+                        continue;
+                    }
+
+                    long sentTimestamp = BitConverter.ToInt64(packet.Array, packet.Offset);
+                    _recorder.RecordSince(DeliveryOperation, sentTimestamp, true, packet.Count);
+                    _received++;
+                }
+
+                if (measuring)
+                {
+                    _receiveTicks += Stopwatch.GetTimestamp() - startTimestamp;
+                }
+            }
+        }
+
+        private void FinishCase()
+        {
+            Case current = _cases[_caseIndex];
+            OperationLatencyRecorder.Summary send = default;
+            OperationLatencyRecorder.Summary delivery = default;
+
+            foreach (OperationLatencyRecorder.Summary summary in _recorder.GetSummaries())
+            {
+                if (summary.Operation == SendOperation)
+                {
+                    send = summary;
+                }
+                else if (summary.Operation == DeliveryOperation)
+                {
+                    delivery = summary;
+                }
+            }
+
+            double tickMilliseconds = _pool.GetTotalStatistics().TotalTickMilliseconds - _caseStartTickMilliseconds;
+            long received = Math.Min(_received, _sent);
+
+            _results.Add(new CaseResult
+            {
+                Layer = _layers[_layerIndex],
+                PacketSizeBytes = current.PacketSizeBytes,
+                PacketsPerSecond = current.PacketsPerSecond,
+                Channels = current.Channels,
+                Reliability = current.Reliability,
+                Sent = _sent,
+                SendFailures = _sendFailures,
+                Received = _received,
+                LossPercent = _sent > 0 ? 100.0 * (_sent - received) / _sent : 0,
+                BytesPerSecond = delivery.Bytes / Math.Max(_settings.SecondsPerCase, float.Epsilon),
+                P50Milliseconds = delivery.P50Milliseconds,
+                P99Milliseconds = delivery.P99Milliseconds,
+                MaxMilliseconds = delivery.MaxMilliseconds,
+                SendMicrosecondsPerPacket = send.MeanMilliseconds * 1000.0,
+                ReceiveMicrosecondsPerPacket = _received > 0 ? _receiveTicks * 1000000.0 / Stopwatch.Frequency / _received : 0,
+                TickMicrosecondsPerPacket = _received > 0 ? tickMilliseconds * 1000.0 / _received : 0
+            });
+
+            if (++_caseIndex < _cases.Count)
+            {
+                StartCase();
+            }
+            else
+            {
+                NextLayer();
+            }
+        }
+
+        #endregion
+
+        protected override void Finish(bool completed)
+        {
+            StopUsers();
+            _phase = Phase.Idle;
+
+            bool succeeded = completed && _failedLayers.Count == 0;
+            string failures = _failedLayers.Count > 0 ? $", failed to measure {string.Join(", ", _failedLayers)}" : "";
+            Debug.Log($"{nameof(P2PBenchmarkRunner)}: Run over, {_results.Count} cases measured{failures}.\n{FormatReport(_results)}");
+
+            Complete(succeeded);
+        }
+
+        protected override void WriteReport(string path)
+        {
+            File.WriteAllText(path, FormatCsv(_results));
+        }
+
+        protected override void OnRunCompleted()
+        {
+            RunCompleted?.Invoke(_results);
+        }
+
+        /// <summary>
+        /// Formats results as a table.
+        /// </summary>
+        public static string FormatReport(IReadOnlyList<CaseResult> results)
+        {
+            StringBuilder report = new();
+            report.AppendLine("Layer                 Bytes  pkt/s  Ch Reliability            Sent    Recv  Loss %     KiB/s    p50 ms    p99 ms    max ms  send us  recv us  tick us");
+
+            foreach (CaseResult result in results)
+            {
+                report.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                    "{0,-20} {1,6} {2,6:0} {3,3} {4,-19} {5,7} {6,7} {7,7:0.00} {8,9:0.0} {9,9:0.00} {10,9:0.00} {11,9:0.00} {12,8:0.0} {13,8:0.0} {14,8:0.0}",
+                    result.Layer, result.PacketSizeBytes, result.PacketsPerSecond, result.Channels, result.Reliability,
+                    result.Sent, result.Received, result.LossPercent, result.BytesPerSecond / 1024.0,
+                    result.P50Milliseconds, result.P99Milliseconds, result.MaxMilliseconds,
+                    result.SendMicrosecondsPerPacket, result.ReceiveMicrosecondsPerPacket, result.TickMicrosecondsPerPacket));
+            }
+
+            return report.ToString();
+        }
+
+        /// <summary>
+        /// Formats results as comma separated values, for CI to pick up.
+        /// </summary>
+        public static string FormatCsv(IReadOnlyList<CaseResult> results)
+        {
+            StringBuilder csv = new();
+            csv.AppendLine("layer,packet_bytes,packets_per_second,channels,reliability,sent,send_failures,received,loss_percent,bytes_per_second,p50_ms,p99_ms,max_ms,send_us_per_packet,receive_us_per_packet,tick_us_per_packet");
+
+            foreach (CaseResult result in results)
+            {
+                csv.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                    "{0},{1},{2:0.###},{3},{4},{5},{6},{7},{8:0.###},{9:0.###},{10:0.###},{11:0.###},{12:0.###},{13:0.###},{14:0.###},{15:0.###}",
+                    result.Layer, result.PacketSizeBytes, result.PacketsPerSecond, result.Channels, result.Reliability,
+                    result.Sent, result.SendFailures, result.Received, result.LossPercent, result.BytesPerSecond,
+                    result.P50Milliseconds, result.P99Milliseconds, result.MaxMilliseconds,
+                    result.SendMicrosecondsPerPacket, result.ReceiveMicrosecondsPerPacket, result.TickMicrosecondsPerPacket));
+            }
+
+            return csv.ToString();
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using UnityEngine;
+
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// Describes a sweep run by <see cref="P2PBenchmarkRunner"/>: the layers
+    /// to measure, and the packet sizes, rates, channel counts and
+    /// reliabilities to measure each of them with. Every combination is run
+    /// as one case. Stored as JSON.
+    /// </summary>
+    [Serializable]
+    public class P2PBenchmarkSettings
+    {
+        /// <summary>
+        /// Number of local users. Users are paired, and the two users of a
+        /// pair send packets to each other; an odd user out stays idle.
+        /// </summary>
+        public int UserCount = 2;
+
+        /// <summary>
+        /// Names of the layers to measure, as registered with
+        /// <see cref="P2PBenchmarkEndpoint.RegisterLayer"/>. Empty measures
+        /// every registered layer.
+        /// </summary>
+        public List<string> Layers = new();
+
+        /// <summary>
+        /// Sizes of the packets, including the 16 byte header the benchmark
+        /// writes at the start of each of them.
+        /// </summary>
+        public List<int> PacketSizes = new() { 64, 1024 };
+
+        /// <summary>
+        /// Packets each user sends per second.
+        /// </summary>
+        public List<float> PacketsPerSecond = new() { 60, 500 };
+
+        /// <summary>
+        /// Number of channels the packets of a case are spread over.
+        /// </summary>
+        public List<int> ChannelCounts = new() { 1, 4 };
+
+        public List<PacketReliability> Reliabilities = new()
+        {
+            PacketReliability.UnreliableUnordered,
+            PacketReliability.ReliableUnordered,
+            PacketReliability.ReliableOrdered
+        };
+
+        /// <summary>
+        /// Seconds each case sends packets for.
+        /// </summary>
+        public float SecondsPerCase = 2;
+
+        /// <summary>
+        /// Seconds to keep receiving after a case stops sending, for the
+        /// packets still in flight.
+        /// </summary>
+        public float DrainSeconds = 0.5f;
+
+        /// <summary>
+        /// Seconds to wait for the users to log in, and for the users of each
+        /// pair to connect to each other.
+        /// </summary>
+        public float ConnectTimeoutSeconds = 30;
+
+        public static P2PBenchmarkSettings Load(string path)
+        {
+            return JsonUtility.FromJson<P2PBenchmarkSettings>(File.ReadAllText(path));
+        }
+    }
+}
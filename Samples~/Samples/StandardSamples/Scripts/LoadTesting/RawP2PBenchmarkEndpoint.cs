@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// Measures the <see cref="P2PInterface"/> of the SDK wrapper directly,
+    /// as the baseline the other layers are compared to.
+    /// </summary>
+    public class RawP2PBenchmarkEndpoint : P2PBenchmarkEndpoint
+    {
+        public const string LayerName = "P2PInterface";
+
+        private const string SocketName = "P2PBENCHMARK";
+
+        private readonly byte[] _receiveBuffer = new byte[P2PInterface.MAX_PACKET_SIZE];
+        private readonly SocketId _socketId = new() { SocketName = SocketName };
+
+        private P2PInterface _p2pInterface;
+        private ProductUserId _localUserId;
+        private ProductUserId _remoteUserId;
+        private ulong _connectionEstablishedNotificationId;
+        private bool _isConnected;
+
+        // Reused between calls, so that the socket id and the peer id are
+        // only marshalled again when they change.
+        private ProductUserId _receivedPeerId;
+        private SocketId _receivedSocketId;
+
+        public override bool IsConnected
+        {
+            get
+            {
+                return _isConnected;
+            }
+        }
+
+        public override bool Start(P2PInterface p2pInterface, ProductUserId localUserId, ProductUserId remoteUserId, bool isHost)
+        {
+            _p2pInterface = p2pInterface;
+            _localUserId = localUserId;
+            _remoteUserId = remoteUserId;
+
+            AddNotifyPeerConnectionEstablishedOptions establishedOptions = new()
+            {
+                LocalUserId = _localUserId,
+                SocketId = _socketId
+            };
+
+            _connectionEstablishedNotificationId = _p2pInterface.AddNotifyPeerConnectionEstablished(ref establishedOptions, null, (ref OnPeerConnectionEstablishedInfo data) =>
+            {
+                if (data.RemoteUserId == _remoteUserId)
+                {
+                    _isConnected = true;
+                }
+            });
+
+            // Accepting a connection that hasn't been requested yet requests
+            // it, so both users of the pair accept it up front.
+            AcceptConnectionOptions acceptOptions = new()
+            {
+                LocalUserId = _localUserId,
+                RemoteUserId = _remoteUserId,
+                SocketId = _socketId
+            };
+
+            return _p2pInterface.AcceptConnection(ref acceptOptions) == Result.Success;
+        }
+
+        public override bool Send(ArraySegment<byte> packet, byte channel, PacketReliability reliability)
+        {
+            SendPacketOptions options = new()
+            {
+                LocalUserId = _localUserId,
+                RemoteUserId = _remoteUserId,
+                SocketId = _socketId,
+                Channel = channel,
+                Data = packet,
+                AllowDelayedDelivery = false,
+                Reliability = reliability
+            };
+
+            return _p2pInterface.SendPacket(ref options) == Result.Success;
+        }
+
+        public override bool TryReceive(out ArraySegment<byte> packet)
+        {
+            ReceivePacketOptions options = new()
+            {
+                LocalUserId = _localUserId,
+                MaxDataSizeBytes = (uint)_receiveBuffer.Length,
+                RequestedChannel = null
+            };
+
+            Result result = _p2pInterface.ReceivePacket(ref options, ref _receivedPeerId, ref _receivedSocketId, out byte _, new ArraySegment<byte>(_receiveBuffer), out uint bytesWritten);
+            if (result != Result.Success)
+            {
+                packet = default;
+                return false;
+            }
+
+            packet = new ArraySegment<byte>(_receiveBuffer, 0, (int)bytesWritten);
+            return true;
+        }
+
+        public override void Stop()
+        {
+            if (_p2pInterface == null)
+            {
+                return;
+            }
+
+            _p2pInterface.RemoveNotifyPeerConnectionEstablished(_connectionEstablishedNotificationId);
+
+            CloseConnectionOptions closeOptions = new()
+            {
+                LocalUserId = _localUserId,
+                RemoteUserId = _remoteUserId,
+                SocketId = _socketId
+            };
+
+            _p2pInterface.CloseConnection(ref closeOptions);
+            _p2pInterface = null;
+            _isConnected = false;
+        }
+    }
+}
@@ -0,0 +1,1144 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Auth;
+    using Epic.OnlineServices.Connect;
+    using Epic.OnlineServices.Lobby;
+    using Epic.OnlineServices.P2P;
+    using Epic.OnlineServices.PlayerDataStorage;
+    using Epic.OnlineServices.Sessions;
+
+    using AttributeData = Epic.OnlineServices.Lobby.AttributeData;
+    using AttributeDataValue = Epic.OnlineServices.Lobby.AttributeDataValue;
+    using SessionAttributeData = Epic.OnlineServices.Sessions.AttributeData;
+    using ConnectLoginOptions = Epic.OnlineServices.Connect.LoginOptions;
+    using ConnectLoginCallbackInfo = Epic.OnlineServices.Connect.LoginCallbackInfo;
+    using ConnectCredentials = Epic.OnlineServices.Connect.Credentials;
+
+    /// <summary>
+    /// The bots of a <see cref="BotSwarmScenario"/> that share a lobby and a
+    /// Session. The first bot creates them, and tells the others where they
+    /// are.
+    /// </summary>
+    public class BotSwarmGroup
+    {
+        private readonly object _lock = new();
+        private readonly List<ProductUserId> _members = new();
+
+        /// <summary>
+        /// Id of the lobby of the group, or null until it has been created.
+        /// </summary>
+        public volatile string LobbyId;
+
+        /// <summary>
+        /// Set if the lobby couldn't be created, so that the other bots of
+        /// the group stop waiting for it.
+        /// </summary>
+        public volatile bool CreationFailed;
+
+        /// <summary>
+        /// Id of the Session of the group, or null until it has been created.
+        /// </summary>
+        public volatile string SessionId;
+
+        /// <summary>
+        /// Set if the Session couldn't be created, so that the other bots of
+        /// the group stop waiting for it.
+        /// </summary>
+        public volatile bool SessionCreationFailed;
+
+        public void AddMember(ProductUserId userId)
+        {
+            lock (_lock)
+            {
+                _members.Add(userId);
+            }
+        }
+
+        public void RemoveMember(ProductUserId userId)
+        {
+            lock (_lock)
+            {
+                _members.Remove(userId);
+            }
+        }
+
+        /// <summary>
+        /// Fills the given list with the members of the lobby.
+        /// </summary>
+        public void GetMembers(List<ProductUserId> members)
+        {
+            lock (_lock)
+            {
+                members.Clear();
+                members.AddRange(_members);
+            }
+        }
+    }
+
+    /// <summary>
+    /// A bot replaying the steps of a <see cref="BotSwarmScenario"/> on its
+    /// own pooled platform, and recording the time each of its requests takes
+    /// in an <see cref="OperationLatencyRecorder"/>.
+    ///
+    /// The bot is driven by <see cref="PooledPlatform.Ticked"/>, so its steps
+    /// and the SDK callbacks always run on the thread ticking its platform.
+    /// The lobby, Sessions, P2P and storage managers of the samples are bound to the
+    /// platform of the <see cref="EOSManager"/>, so the bot uses the
+    /// interfaces of its own platform directly.
+    /// </summary>
+    public class SimulatedUser
+    {
+        public enum BotState
+        {
+            LoggingIn,
+            Running,
+            Finished,
+            Failed
+        }
+
+        private const string SocketName = "BOTSWARM";
+        private const string LobbyAttributeKey = "BOTSWARM_COUNTER";
+        private const string SessionName = "BotSwarm";
+        private const string SessionAttributeKey = "BOTSWARM_COUNTER";
+        private const string TransferFileNamePrefix = "BotSwarm_";
+        private const uint TransferChunkSize = 4096;
+
+        /// <summary>
+        /// Size of the send timestamp at the start of each packet.
+        /// </summary>
+        private const int PacketHeaderSize = sizeof(long);
+
+        private readonly PooledPlatform _platform;
+        private readonly BotSwarmScenario _scenario;
+        private readonly BotSwarmGroup _group;
+        private readonly OperationLatencyRecorder _recorder;
+        private readonly bool _isLobbyOwner;
+
+        private readonly List<ProductUserId> _peers = new();
+        private readonly byte[] _receiveBuffer = new byte[P2PInterface.MAX_PACKET_SIZE];
+        private byte[] _sendBuffer = Array.Empty<byte>();
+        private byte[] _transferBuffer = Array.Empty<byte>();
+        private int _transferOffset;
+        private PlayerDataStorageFileTransferRequest _transfer;
+
+        private ProductUserId _userId;
+        private string _lobbyId;
+        private string _sessionId;
+        private SessionSearch _sessionSearch;
+        private SessionDetails _sessionDetails;
+        private ulong _connectionRequestNotificationId;
+
+        private int _stepIndex;
+        private int _stepRepetitions;
+        private long _nextStepTimestamp;
+        private bool _waitingForCallback;
+        private long _attributeCounter;
+
+        public int Index
+        {
+            get
+            {
+                return _platform.Index;
+            }
+        }
+
+        public volatile BotState State = BotState.LoggingIn;
+
+        public bool IsDone
+        {
+            get
+            {
+                return State == BotState.Finished || State == BotState.Failed;
+            }
+        }
+
+        public SimulatedUser(PooledPlatform platform, BotSwarmScenario scenario, BotSwarmGroup group, OperationLatencyRecorder recorder)
+        {
+            _platform = platform;
+            _scenario = scenario;
+            _group = group;
+            _recorder = recorder;
+            _isLobbyOwner = platform.Index % Math.Max(1, scenario.BotsPerLobby) == 0;
+
+            _platform.UserData = this;
+            _platform.Ticked += OnTicked;
+            _platform.Post(_ => StartLogin());
+        }
+
+        /// <summary>
+        /// Creates a pooled platform for each bot of the scenario, with a bot
+        /// on each of them. The bots are put in groups of
+        /// <see cref="BotSwarmScenario.BotsPerLobby"/>.
+        /// </summary>
+        /// <param name="bots">The list the bots are added to.</param>
+        /// <returns>The pool, or null if it couldn't be created.</returns>
+        public static PlatformPool CreateSwarm(BotSwarmScenario scenario, OperationLatencyRecorder recorder, List<SimulatedUser> bots)
+        {
+            PlatformPool pool = PlatformPool.Create(scenario.BotCount, new PlatformPool.Settings
+            {
+                Mode = scenario.TickInParallel ? PlatformPool.TickMode.Parallel : PlatformPool.TickMode.RoundRobin
+            });
+
+            if (pool == null)
+            {
+                return null;
+            }
+
+            int botsPerLobby = Math.Max(1, scenario.BotsPerLobby);
+            BotSwarmGroup group = null;
+
+            foreach (PooledPlatform platform in pool.Platforms)
+            {
+                if (platform.Index % botsPerLobby == 0)
+                {
+                    group = new BotSwarmGroup();
+                }
+
+                bots.Add(new SimulatedUser(platform, scenario, group, recorder));
+            }
+
+            return pool;
+        }
+
+        /// <summary>
+        /// Counts the bots that failed.
+        /// </summary>
+        public static int CountFailed(IEnumerable<SimulatedUser> bots)
+        {
+            int failed = 0;
+            foreach (SimulatedUser bot in bots)
+            {
+                if (bot.State == BotState.Failed)
+                {
+                    failed++;
+                }
+            }
+
+            return failed;
+        }
+
+        /// <summary>
+        /// Stops driving the bot. Must be called before the platform is
+        /// released.
+        /// </summary>
+        public void Stop()
+        {
+            _platform.Ticked -= OnTicked;
+
+            if (_connectionRequestNotificationId != 0)
+            {
+                _platform.Platform?.GetP2PInterface().RemoveNotifyPeerConnectionRequest(_connectionRequestNotificationId);
+                _connectionRequestNotificationId = 0;
+            }
+
+            if (_transfer != null)
+            {
+                _transfer.CancelRequest();
+                _transfer.Release();
+                _transfer = null;
+            }
+
+            ReleaseSessionHandles();
+
+            if (!IsDone)
+            {
+                State = BotState.Finished;
+            }
+        }
+
+        private void Fail(string message)
+        {
+            Debug.LogWarning($"{nameof(SimulatedUser)} {Index}: {message}");
+            State = BotState.Failed;
+
+            if (_isLobbyOwner && _group.LobbyId == null)
+            {
+                _group.CreationFailed = true;
+            }
+
+            if (_isLobbyOwner && _group.SessionId == null)
+            {
+                _group.SessionCreationFailed = true;
+            }
+        }
+
+        #region Login
+
+        private void StartLogin()
+        {
+            if (_scenario.Login == BotSwarmScenario.LoginType.DevAuthTool)
+            {
+                StartAuthLogin();
+                return;
+            }
+
+            CreateDeviceIdOptions createDeviceIdOptions = new()
+            {
+                DeviceModel = "BotSwarm"
+            };
+
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _platform.Platform.GetConnectInterface().CreateDeviceId(ref createDeviceIdOptions, null, (ref CreateDeviceIdCallbackInfo data) =>
+            {
+                // A device id already existing for this platform's cache is fine
+                bool succeeded = data.ResultCode == Result.Success || data.ResultCode == Result.DuplicateNotAllowed;
+                _recorder.RecordSince("Connect.CreateDeviceId", startTimestamp, succeeded);
+
+                if (!succeeded)
+                {
+                    Fail($"CreateDeviceId failed with result {data.ResultCode}.");
+                    return;
+                }
+
+                StartConnectLogin(new ConnectCredentials { Type = ExternalCredentialType.DeviceidAccessToken, Token = null });
+            });
+        }
+
+        private void StartAuthLogin()
+        {
+            Epic.OnlineServices.Auth.LoginOptions authLoginOptions = new()
+            {
+                Credentials = new Epic.OnlineServices.Auth.Credentials
+                {
+                    Type = LoginCredentialType.Developer,
+                    Id = _scenario.DevAuthHost,
+                    Token = _scenario.DevAuthCredentialPrefix + Index
+                },
+                ScopeFlags = AuthScopeFlags.BasicProfile
+            };
+
+            AuthInterface authInterface = _platform.Platform.GetAuthInterface();
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            authInterface.Login(ref authLoginOptions, null, (ref Epic.OnlineServices.Auth.LoginCallbackInfo data) =>
+            {
+                _recorder.RecordSince("Auth.Login", startTimestamp, data.ResultCode == Result.Success);
+
+                if (data.ResultCode != Result.Success)
+                {
+                    Fail($"Auth login failed with result {data.ResultCode}.");
+                    return;
+                }
+
+                Epic.OnlineServices.Auth.CopyIdTokenOptions copyIdTokenOptions = new()
+                {
+                    AccountId = data.LocalUserId
+                };
+
+                Result result = authInterface.CopyIdToken(ref copyIdTokenOptions, out Epic.OnlineServices.Auth.IdToken? idToken);
+                if (result != Result.Success || idToken == null)
+                {
+                    Fail($"CopyIdToken failed with result {result}.");
+                    return;
+                }
+
+                StartConnectLogin(new ConnectCredentials { Type = ExternalCredentialType.EpicIdToken, Token = idToken.Value.JsonWebToken });
+            });
+        }
+
+        private void StartConnectLogin(ConnectCredentials credentials)
+        {
+            ConnectLoginOptions connectLoginOptions = new()
+            {
+                Credentials = credentials
+            };
+
+            if (credentials.Type == ExternalCredentialType.DeviceidAccessToken)
+            {
+                connectLoginOptions.UserLoginInfo = new UserLoginInfo { DisplayName = "Bot " + Index };
+            }
+
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _platform.Platform.GetConnectInterface().Login(ref connectLoginOptions, null, (ref ConnectLoginCallbackInfo data) =>
+            {
+                _recorder.RecordSince("Connect.Login", startTimestamp, data.ResultCode == Result.Success);
+
+                if (data.ResultCode != Result.Success)
+                {
+                    Fail($"Connect login failed with result {data.ResultCode}.");
+                    return;
+                }
+
+                _userId = data.LocalUserId;
+                AcceptIncomingConnections();
+                State = BotState.Running;
+                _nextStepTimestamp = OperationLatencyRecorder.Timestamp;
+            });
+        }
+
+        #endregion
+
+        #region Steps
+
+        private void OnTicked(PooledPlatform platform)
+        {
+            if (State != BotState.Running)
+            {
+                return;
+            }
+
+            ReceivePackets();
+
+            if (_waitingForCallback || OperationLatencyRecorder.Timestamp < _nextStepTimestamp)
+            {
+                return;
+            }
+
+            if (_stepIndex >= _scenario.Steps.Count)
+            {
+                if (!_scenario.Loop || _scenario.Steps.Count == 0)
+                {
+                    State = BotState.Finished;
+                    return;
+                }
+
+                _stepIndex = 0;
+            }
+
+            BotAction step = _scenario.Steps[_stepIndex];
+
+            switch (step.Action)
+            {
+                case BotActionType.CreateOrJoinLobby:
+                    if (!CreateOrJoinLobby())
+                    {
+                        // Still waiting for the owner of the group
+                        return;
+                    }
+                    break;
+                case BotActionType.UpdateAttribute:
+                    UpdateAttribute();
+                    break;
+                case BotActionType.SendPackets:
+                    SendPackets(step);
+                    break;
+                case BotActionType.LeaveLobby:
+                    LeaveLobby();
+                    break;
+                case BotActionType.TransferFile:
+                    WriteFile(step);
+                    break;
+                case BotActionType.CreateOrJoinSession:
+                    if (!CreateOrJoinSession())
+                    {
+                        // Still waiting for the owner of the group
+                        return;
+                    }
+                    break;
+                case BotActionType.UpdateSession:
+                    UpdateSessionAttribute();
+                    break;
+                case BotActionType.DestroySession:
+                    DestroySession();
+                    break;
+                case BotActionType.Wait:
+                    break;
+            }
+
+            _nextStepTimestamp = OperationLatencyRecorder.Timestamp + (long)(step.IntervalSeconds * System.Diagnostics.Stopwatch.Frequency);
+
+            if (++_stepRepetitions >= Math.Max(1, step.Count))
+            {
+                _stepRepetitions = 0;
+                _stepIndex++;
+            }
+        }
+
+        /// <summary>
+        /// Creates the lobby of the group, or joins it.
+        /// </summary>
+        /// <returns>
+        /// False if the lobby of the group doesn't exist yet.
+        /// </returns>
+        private bool CreateOrJoinLobby()
+        {
+            if (_lobbyId != null)
+            {
+                return true;
+            }
+
+            LobbyInterface lobbyInterface = _platform.Platform.GetLobbyInterface();
+
+            if (_isLobbyOwner)
+            {
+                CreateLobbyOptions createLobbyOptions = new()
+                {
+                    LocalUserId = _userId,
+                    MaxLobbyMembers = (uint)Math.Max(1, _scenario.BotsPerLobby),
+                    PermissionLevel = LobbyPermissionLevel.Publicadvertised,
+                    PresenceEnabled = false,
+                    AllowInvites = false,
+                    BucketId = _scenario.LobbyBucketId,
+                    EnableJoinById = true
+                };
+
+                _waitingForCallback = true;
+                long startTimestamp = OperationLatencyRecorder.Timestamp;
+                lobbyInterface.CreateLobby(ref createLobbyOptions, null, (ref CreateLobbyCallbackInfo data) =>
+                {
+                    _waitingForCallback = false;
+                    _recorder.RecordSince("Lobby.Create", startTimestamp, data.ResultCode == Result.Success);
+
+                    if (data.ResultCode != Result.Success)
+                    {
+                        Fail($"CreateLobby failed with result {data.ResultCode}.");
+                        return;
+                    }
+
+                    _lobbyId = data.LobbyId;
+                    _group.AddMember(_userId);
+                    _group.LobbyId = _lobbyId;
+                });
+
+                return true;
+            }
+
+            if (_group.CreationFailed)
+            {
+                Fail("The lobby of the group couldn't be created.");
+                return true;
+            }
+
+            string groupLobbyId = _group.LobbyId;
+            if (groupLobbyId == null)
+            {
+                return false;
+            }
+
+            JoinLobbyByIdOptions joinLobbyByIdOptions = new()
+            {
+                LocalUserId = _userId,
+                LobbyId = groupLobbyId,
+                PresenceEnabled = false
+            };
+
+            _waitingForCallback = true;
+            long joinTimestamp = OperationLatencyRecorder.Timestamp;
+            lobbyInterface.JoinLobbyById(ref joinLobbyByIdOptions, null, (ref JoinLobbyByIdCallbackInfo data) =>
+            {
+                _waitingForCallback = false;
+                _recorder.RecordSince("Lobby.Join", joinTimestamp, data.ResultCode == Result.Success);
+
+                if (data.ResultCode != Result.Success)
+                {
+                    Fail($"JoinLobbyById failed with result {data.ResultCode}.");
+                    return;
+                }
+
+                _lobbyId = groupLobbyId;
+                _group.AddMember(_userId);
+            });
+
+            return true;
+        }
+
+        /// <summary>
+        /// Changes a lobby attribute if the bot owns the lobby, or one of its
+        /// member attributes otherwise.
+        /// </summary>
+        private void UpdateAttribute()
+        {
+            if (_lobbyId == null)
+            {
+                return;
+            }
+
+            LobbyInterface lobbyInterface = _platform.Platform.GetLobbyInterface();
+
+            UpdateLobbyModificationOptions modificationOptions = new()
+            {
+                LocalUserId = _userId,
+                LobbyId = _lobbyId
+            };
+
+            Result result = lobbyInterface.UpdateLobbyModification(ref modificationOptions, out LobbyModification modification);
+            if (result != Result.Success)
+            {
+                _recorder.Record("Lobby.Update", 0, false);
+                return;
+            }
+
+            AttributeData attribute = new()
+            {
+                Key = LobbyAttributeKey,
+                Value = new AttributeDataValue { AsInt64 = ++_attributeCounter }
+            };
+
+            if (_isLobbyOwner)
+            {
+                LobbyModificationAddAttributeOptions addAttributeOptions = new()
+                {
+                    Attribute = attribute,
+                    Visibility = LobbyAttributeVisibility.Public
+                };
+                result = modification.AddAttribute(ref addAttributeOptions);
+            }
+            else
+            {
+                LobbyModificationAddMemberAttributeOptions addMemberAttributeOptions = new()
+                {
+                    Attribute = attribute,
+                    Visibility = LobbyAttributeVisibility.Public
+                };
+                result = modification.AddMemberAttribute(ref addMemberAttributeOptions);
+            }
+
+            if (result != Result.Success)
+            {
+                modification.Release();
+                _recorder.Record("Lobby.Update", 0, false);
+                return;
+            }
+
+            UpdateLobbyOptions updateLobbyOptions = new()
+            {
+                LobbyModificationHandle = modification
+            };
+
+            _waitingForCallback = true;
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            lobbyInterface.UpdateLobby(ref updateLobbyOptions, null, (ref UpdateLobbyCallbackInfo data) =>
+            {
+                _waitingForCallback = false;
+                _recorder.RecordSince("Lobby.Update", startTimestamp, data.ResultCode == Result.Success);
+            });
+
+            modification.Release();
+        }
+
+        private void LeaveLobby()
+        {
+            if (_lobbyId == null)
+            {
+                return;
+            }
+
+            LeaveLobbyOptions leaveLobbyOptions = new()
+            {
+                LocalUserId = _userId,
+                LobbyId = _lobbyId
+            };
+
+            _group.RemoveMember(_userId);
+            _lobbyId = null;
+
+            // When looping, the owner creates a new lobby for the group
+            if (_isLobbyOwner)
+            {
+                _group.LobbyId = null;
+            }
+
+            _waitingForCallback = true;
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _platform.Platform.GetLobbyInterface().LeaveLobby(ref leaveLobbyOptions, null, (ref LeaveLobbyCallbackInfo data) =>
+            {
+                _waitingForCallback = false;
+                _recorder.RecordSince("Lobby.Leave", startTimestamp, data.ResultCode == Result.Success);
+            });
+        }
+
+        #endregion
+
+        #region Sessions
+
+        /// <summary>
+        /// Creates the Session of the group, or finds it by id and joins it.
+        /// </summary>
+        /// <returns>
+        /// False if the Session of the group doesn't exist yet.
+        /// </returns>
+        private bool CreateOrJoinSession()
+        {
+            if (_sessionId != null)
+            {
+                return true;
+            }
+
+            SessionsInterface sessionsInterface = _platform.Platform.GetSessionsInterface();
+
+            if (_isLobbyOwner)
+            {
+                CreateSessionModificationOptions createSessionModificationOptions = new()
+                {
+                    SessionName = SessionName,
+                    BucketId = _scenario.SessionBucketId,
+                    MaxPlayers = (uint)Math.Max(1, _scenario.BotsPerLobby),
+                    LocalUserId = _userId,
+                    PresenceEnabled = false
+                };
+
+                Result result = sessionsInterface.CreateSessionModification(ref createSessionModificationOptions, out SessionModification modification);
+                if (result != Result.Success)
+                {
+                    _recorder.Record("Session.Create", 0, false);
+                    Fail($"CreateSessionModification failed with result {result}.");
+                    return true;
+                }
+
+                UpdateSessionOptions updateSessionOptions = new()
+                {
+                    SessionModificationHandle = modification
+                };
+
+                _waitingForCallback = true;
+                long startTimestamp = OperationLatencyRecorder.Timestamp;
+                sessionsInterface.UpdateSession(ref updateSessionOptions, null, (ref UpdateSessionCallbackInfo data) =>
+                {
+                    _waitingForCallback = false;
+                    _recorder.RecordSince("Session.Create", startTimestamp, data.ResultCode == Result.Success);
+
+                    if (data.ResultCode != Result.Success)
+                    {
+                        Fail($"Creating the Session failed with result {data.ResultCode}.");
+                        return;
+                    }
+
+                    _sessionId = data.SessionId;
+                    _group.SessionId = _sessionId;
+                });
+
+                modification.Release();
+                return true;
+            }
+
+            if (_group.SessionCreationFailed)
+            {
+                Fail("The Session of the group couldn't be created.");
+                return true;
+            }
+
+            string groupSessionId = _group.SessionId;
+            if (groupSessionId == null)
+            {
+                return false;
+            }
+
+            CreateSessionSearchOptions createSessionSearchOptions = new()
+            {
+                MaxSearchResults = 1
+            };
+
+            Result searchResult = sessionsInterface.CreateSessionSearch(ref createSessionSearchOptions, out _sessionSearch);
+            if (searchResult == Result.Success)
+            {
+                SessionSearchSetSessionIdOptions setSessionIdOptions = new()
+                {
+                    SessionId = groupSessionId
+                };
+
+                searchResult = _sessionSearch.SetSessionId(ref setSessionIdOptions);
+            }
+
+            if (searchResult != Result.Success)
+            {
+                ReleaseSessionHandles();
+                _recorder.Record("Session.Find", 0, false);
+                Fail($"Creating the Session search failed with result {searchResult}.");
+                return true;
+            }
+
+            SessionSearchFindOptions findOptions = new()
+            {
+                LocalUserId = _userId
+            };
+
+            _waitingForCallback = true;
+            long findTimestamp = OperationLatencyRecorder.Timestamp;
+            _sessionSearch.Find(ref findOptions, null, (ref SessionSearchFindCallbackInfo data) =>
+            {
+                _recorder.RecordSince("Session.Find", findTimestamp, data.ResultCode == Result.Success);
+
+                // Stopped while searching
+                if (_sessionSearch == null)
+                {
+                    return;
+                }
+
+                Result result = data.ResultCode;
+                if (result == Result.Success)
+                {
+                    SessionSearchCopySearchResultByIndexOptions copyOptions = new()
+                    {
+                        SessionIndex = 0
+                    };
+
+                    result = _sessionSearch.CopySearchResultByIndex(ref copyOptions, out _sessionDetails);
+                }
+
+                if (result != Result.Success)
+                {
+                    _waitingForCallback = false;
+                    ReleaseSessionHandles();
+                    Fail($"Finding the Session of the group failed with result {result}.");
+                    return;
+                }
+
+                JoinSession(groupSessionId);
+            });
+
+            return true;
+        }
+
+        private void JoinSession(string sessionId)
+        {
+            JoinSessionOptions joinSessionOptions = new()
+            {
+                SessionName = SessionName,
+                SessionHandle = _sessionDetails,
+                LocalUserId = _userId,
+                PresenceEnabled = false
+            };
+
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _platform.Platform.GetSessionsInterface().JoinSession(ref joinSessionOptions, null, (ref JoinSessionCallbackInfo data) =>
+            {
+                // The Session details must outlive the request
+                ReleaseSessionHandles();
+                _waitingForCallback = false;
+                _recorder.RecordSince("Session.Join", startTimestamp, data.ResultCode == Result.Success);
+
+                if (data.ResultCode != Result.Success)
+                {
+                    Fail($"JoinSession failed with result {data.ResultCode}.");
+                    return;
+                }
+
+                _sessionId = sessionId;
+            });
+        }
+
+        /// <summary>
+        /// Changes a Session attribute if the bot owns the Session.
+        /// </summary>
+        private void UpdateSessionAttribute()
+        {
+            if (_sessionId == null || !_isLobbyOwner)
+            {
+                return;
+            }
+
+            SessionsInterface sessionsInterface = _platform.Platform.GetSessionsInterface();
+
+            UpdateSessionModificationOptions modificationOptions = new()
+            {
+                SessionName = SessionName
+            };
+
+            Result result = sessionsInterface.UpdateSessionModification(ref modificationOptions, out SessionModification modification);
+            if (result != Result.Success)
+            {
+                _recorder.Record("Session.Update", 0, false);
+                return;
+            }
+
+            SessionModificationAddAttributeOptions addAttributeOptions = new()
+            {
+                SessionAttribute = new SessionAttributeData
+                {
+                    Key = SessionAttributeKey,
+                    Value = ++_attributeCounter
+                },
+                AdvertisementType = SessionAttributeAdvertisementType.Advertise
+            };
+
+            result = modification.AddAttribute(ref addAttributeOptions);
+            if (result != Result.Success)
+            {
+                modification.Release();
+                _recorder.Record("Session.Update", 0, false);
+                return;
+            }
+
+            UpdateSessionOptions updateSessionOptions = new()
+            {
+                SessionModificationHandle = modification
+            };
+
+            _waitingForCallback = true;
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            sessionsInterface.UpdateSession(ref updateSessionOptions, null, (ref UpdateSessionCallbackInfo data) =>
+            {
+                _waitingForCallback = false;
+                _recorder.RecordSince("Session.Update", startTimestamp, data.ResultCode == Result.Success);
+            });
+
+            modification.Release();
+        }
+
+        private void DestroySession()
+        {
+            if (_sessionId == null)
+            {
+                return;
+            }
+
+            _sessionId = null;
+
+            // When looping, the owner creates a new Session for the group
+            if (_isLobbyOwner)
+            {
+                _group.SessionId = null;
+            }
+
+            DestroySessionOptions destroySessionOptions = new()
+            {
+                SessionName = SessionName
+            };
+
+            _waitingForCallback = true;
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _platform.Platform.GetSessionsInterface().DestroySession(ref destroySessionOptions, null, (ref DestroySessionCallbackInfo data) =>
+            {
+                _waitingForCallback = false;
+                _recorder.RecordSince("Session.Destroy", startTimestamp, data.ResultCode == Result.Success);
+            });
+        }
+
+        private void ReleaseSessionHandles()
+        {
+            _sessionDetails?.Release();
+            _sessionDetails = null;
+            _sessionSearch?.Release();
+            _sessionSearch = null;
+        }
+
+        #endregion
+
+        #region Storage
+
+        /// <summary>
+        /// Writes a file of the size of the step to Player Data Storage, and
+        /// reads it back once it has been written.
+        /// </summary>
+        private void WriteFile(BotAction step)
+        {
+            int transferSize = Math.Max(1, step.TransferSizeBytes);
+            if (_transferBuffer.Length != transferSize)
+            {
+                _transferBuffer = new byte[transferSize];
+            }
+
+            _transferOffset = 0;
+            string fileName = TransferFileNamePrefix + Index;
+
+            WriteFileOptions writeFileOptions = new()
+            {
+                LocalUserId = _userId,
+                Filename = fileName,
+                ChunkLengthBytes = TransferChunkSize,
+                WriteFileDataCallback = OnWriteFileData
+            };
+
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _transfer = _platform.Platform.GetPlayerDataStorageInterface().WriteFile(ref writeFileOptions, null, (ref WriteFileCallbackInfo data) =>
+            {
+                // Cancelled by Stop, or the request was never made
+                if (_transfer == null)
+                {
+                    return;
+                }
+
+                _transfer.Release();
+                _transfer = null;
+                _waitingForCallback = false;
+                _recorder.RecordSince("Storage.Write", startTimestamp, data.ResultCode == Result.Success, _transferBuffer.Length);
+
+                if (data.ResultCode == Result.Success)
+                {
+                    ReadFile(fileName);
+                }
+            });
+
+            // Backends without Player Data Storage don't create the request
+            // and never complete it
+            if (_transfer == null)
+            {
+                _recorder.Record("Storage.Write", 0, false);
+                return;
+            }
+
+            _waitingForCallback = true;
+        }
+
+        private WriteResult OnWriteFileData(ref WriteFileDataCallbackInfo data, out ArraySegment<byte> outDataBuffer)
+        {
+            int length = Math.Min((int)data.DataBufferLengthBytes, _transferBuffer.Length - _transferOffset);
+            outDataBuffer = new ArraySegment<byte>(_transferBuffer, _transferOffset, length);
+            _transferOffset += length;
+
+            return _transferOffset < _transferBuffer.Length ? WriteResult.ContinueWriting : WriteResult.CompleteRequest;
+        }
+
+        private void ReadFile(string fileName)
+        {
+            _transferOffset = 0;
+
+            ReadFileOptions readFileOptions = new()
+            {
+                LocalUserId = _userId,
+                Filename = fileName,
+                ReadChunkLengthBytes = TransferChunkSize,
+                ReadFileDataCallback = OnReadFileData
+            };
+
+            long startTimestamp = OperationLatencyRecorder.Timestamp;
+            _transfer = _platform.Platform.GetPlayerDataStorageInterface().ReadFile(ref readFileOptions, null, (ref ReadFileCallbackInfo data) =>
+            {
+                if (_transfer == null)
+                {
+                    return;
+                }
+
+                _transfer.Release();
+                _transfer = null;
+                _waitingForCallback = false;
+                _recorder.RecordSince("Storage.Read", startTimestamp, data.ResultCode == Result.Success, _transferOffset);
+            });
+
+            if (_transfer == null)
+            {
+                _recorder.Record("Storage.Read", 0, false);
+                return;
+            }
+
+            _waitingForCallback = true;
+        }
+
+        private ReadResult OnReadFileData(ref ReadFileDataCallbackInfo data)
+        {
+            _transferOffset += data.DataChunk.Count;
+            return ReadResult.ContinueReading;
+        }
+
+        #endregion
+
+        #region P2P
+
+        private void AcceptIncomingConnections()
+        {
+            SocketId socketId = new() { SocketName = SocketName };
+
+            AddNotifyPeerConnectionRequestOptions options = new()
+            {
+                LocalUserId = _userId,
+                SocketId = socketId
+            };
+
+            P2PInterface p2pInterface = _platform.Platform.GetP2PInterface();
+            _connectionRequestNotificationId = p2pInterface.AddNotifyPeerConnectionRequest(ref options, null, (ref OnIncomingConnectionRequestInfo data) =>
+            {
+                AcceptConnectionOptions acceptOptions = new()
+                {
+                    LocalUserId = _userId,
+                    RemoteUserId = data.RemoteUserId,
+                    SocketId = data.SocketId
+                };
+
+                p2pInterface.AcceptConnection(ref acceptOptions);
+            });
+        }
+
+        /// <summary>
+        /// Sends a packet to every other member of the lobby. Each packet
+        /// starts with the time it was sent, so that the receiver can record
+        /// how long it took to arrive.
+        /// </summary>
+        private void SendPackets(BotAction step)
+        {
+            if (_lobbyId == null)
+            {
+                return;
+            }
+
+            int packetSize = Math.Clamp(step.PacketSizeBytes, PacketHeaderSize, P2PInterface.MAX_PACKET_SIZE);
+            if (_sendBuffer.Length != packetSize)
+            {
+                _sendBuffer = new byte[packetSize];
+            }
+
+            _group.GetMembers(_peers);
+            P2PInterface p2pInterface = _platform.Platform.GetP2PInterface();
+
+            foreach (ProductUserId peer in _peers)
+            {
+                if (peer == _userId)
+                {
+                    continue;
+                }
+
+                BitConverter.TryWriteBytes(new Span<byte>(_sendBuffer, 0, PacketHeaderSize), OperationLatencyRecorder.Timestamp);
+
+                SendPacketOptions sendOptions = new()
+                {
+                    LocalUserId = _userId,
+                    RemoteUserId = peer,
+                    SocketId = new SocketId { SocketName = SocketName },
+                    Channel = 0,
+                    Data = new ArraySegment<byte>(_sendBuffer),
+                    AllowDelayedDelivery = true,
+                    Reliability = step.Reliable ? PacketReliability.ReliableOrdered : PacketReliability.UnreliableUnordered
+                };
+
+                long startTimestamp = OperationLatencyRecorder.Timestamp;
+                Result result = p2pInterface.SendPacket(ref sendOptions);
+                _recorder.RecordSince("P2P.Send", startTimestamp, result == Result.Success, packetSize);
+            }
+        }
+
+        private void ReceivePackets()
+        {
+            P2PInterface p2pInterface = _platform.Platform.GetP2PInterface();
+
+            ReceivePacketOptions options = new()
+            {
+                LocalUserId = _userId,
+                MaxDataSizeBytes = (uint)_receiveBuffer.Length,
+                RequestedChannel = null
+            };
+
+            ArraySegment<byte> dataSegment = new(_receiveBuffer);
+            ProductUserId peerId = null;
+            SocketId socketId = default;
+
+            while (p2pInterface.ReceivePacket(ref options, ref peerId, ref socketId, out byte _, dataSegment, out uint bytesWritten) == Result.Success)
+            {
+                if (bytesWritten < PacketHeaderSize)
+                {
+                    continue;
+                }
+
+                long sentTimestamp = BitConverter.ToInt64(_receiveBuffer, 0);
+                _recorder.RecordSince("P2P.Delivery", sentTimestamp, true, bytesWritten);
+            }
+        }
+
+        #endregion
+    }
+}
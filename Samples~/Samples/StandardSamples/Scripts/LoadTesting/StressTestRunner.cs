@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+    using System.IO;
+    using System.Text;
+    using UnityEngine;
+
+    /// <summary>
+    /// Runs a <see cref="StressTestScenario"/>: logs the bots in on pooled
+    /// platforms, then goes through the phases of the scenario while the
+    /// bots loop over their steps, putting the process under the CPU and
+    /// memory pressure of each phase with a <see cref="BackgroundLoad"/>.
+    /// For each phase it records the time each frame spends ticking the EOS
+    /// platforms (<c>Frame.EOSTick</c>), the length of the frames
+    /// (<c>Frame.Time</c>), and the latency of the requests of the bots, and
+    /// reports them as percentiles and histograms.
+    ///
+    /// Can be added to a scene, or started from the command line of a
+    /// headless player:
+    /// <c>-batchmode -nographics -EOSStressTest [scenario.json] [-EOSStressTestReport report.csv]</c>.
+    /// The histograms are written next to the report, with <c>_histograms</c>
+    /// appended to its name. When started from the command line the player
+    /// quits when the run is over, with a non-zero exit code if any bot
+    /// failed.
+    /// </summary>
+    public class StressTestRunner : LoadTestRunner
+    {
+        /// <summary>
+        /// What was measured during one phase.
+        /// </summary>
+        public class PhaseResult
+        {
+            public StressTestPhase Phase;
+            public float Seconds;
+            public long Frames;
+
+            /// <summary>
+            /// Number of times the youngest generation was collected.
+            /// </summary>
+            public int GarbageCollections;
+
+            public List<OperationLatencyRecorder.Summary> Summaries;
+
+            /// <summary>
+            /// The histogram of each operation, with the buckets of
+            /// <see cref="OperationLatencyRecorder.HistogramUpperBounds"/>.
+            /// </summary>
+            public Dictionary<string, long[]> Histograms;
+
+            /// <summary>
+            /// The summaries formatted as a table.
+            /// </summary>
+            public string Report;
+        }
+
+        private enum RunState
+        {
+            Idle,
+            LoggingIn,
+            Running
+        }
+
+        private const string FrameTickOperation = "Frame.EOSTick";
+        private const string FrameTimeOperation = "Frame.Time";
+
+        private StressTestScenario _scenario;
+        private PlatformPool _pool;
+        private readonly List<SimulatedUser> _bots = new();
+        private readonly OperationLatencyRecorder _recorder = new();
+        private readonly BackgroundLoad _load = new();
+        private readonly List<PhaseResult> _results = new();
+
+        private RunState _state = RunState.Idle;
+        private float _stateStartTime;
+        private int _phaseIndex;
+        private long _phaseFrames;
+        private int _phaseGarbageCollections;
+
+        public override bool IsRunning
+        {
+            get
+            {
+                return _state != RunState.Idle || IsWaitingForPlatform;
+            }
+        }
+
+        /// <summary>
+        /// The results of the phases run so far.
+        /// </summary>
+        public IReadOnlyList<PhaseResult> Results
+        {
+            get
+            {
+                return _results;
+            }
+        }
+
+        /// <summary>
+        /// Invoked with the results of every phase when the run is over.
+        /// </summary>
+        public event Action<IReadOnlyList<PhaseResult>> RunCompleted;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+        private static void StartFromCommandLine()
+        {
+            StartFromCommandLine<StressTestRunner>("-EOSStressTest");
+        }
+
+        protected override void Run(string scenarioPath)
+        {
+            Run(string.IsNullOrEmpty(scenarioPath) ? new StressTestScenario() : StressTestScenario.Load(scenarioPath));
+        }
+
+        /// <summary>
+        /// Starts running the given scenario, once the EOSManager has
+        /// initialized the SDK.
+        /// </summary>
+        public void Run(StressTestScenario scenario)
+        {
+            if (IsRunning)
+            {
+                Debug.LogWarning($"{nameof(StressTestRunner)}: A stress test is already running.");
+                return;
+            }
+
+            _scenario = scenario;
+            _scenario.Bots.Loop = true;
+            _results.Clear();
+            WaitForPlatform();
+        }
+
+        private void SetState(RunState state)
+        {
+            _state = state;
+            _stateStartTime = Time.realtimeSinceStartup;
+        }
+
+        protected override void OnPlatformReady()
+        {
+            _pool = SimulatedUser.CreateSwarm(_scenario.Bots, _recorder, _bots);
+            if (_pool == null)
+            {
+                Finish(false);
+                return;
+            }
+
+            SetState(RunState.LoggingIn);
+        }
+
+        protected override void UpdateRun()
+        {
+            switch (_state)
+            {
+                case RunState.LoggingIn:
+                    _pool.Tick();
+                    UpdateLogin();
+                    break;
+
+                case RunState.Running:
+                    UpdatePhase();
+                    break;
+            }
+        }
+
+        private void UpdateLogin()
+        {
+            int loggingIn = 0;
+            int running = 0;
+            foreach (SimulatedUser bot in _bots)
+            {
+                if (bot.State == SimulatedUser.BotState.LoggingIn)
+                {
+                    loggingIn++;
+                }
+                else if (bot.State == SimulatedUser.BotState.Running)
+                {
+                    running++;
+                }
+            }
+
+            if (loggingIn > 0 && Time.realtimeSinceStartup - _stateStartTime < _scenario.LoginTimeoutSeconds)
+            {
+                return;
+            }
+
+            if (running == 0)
+            {
+                Debug.LogError($"{nameof(StressTestRunner)}: None of the {_bots.Count} bots could log in.");
+                Finish(false);
+                return;
+            }
+
+            Debug.Log($"{nameof(StressTestRunner)}: {running} of {_bots.Count} bots logged in.");
+            _phaseIndex = 0;
+            StartPhase();
+        }
+
+        private void StartPhase()
+        {
+            if (_phaseIndex >= _scenario.Phases.Count)
+            {
+                Finish(true);
+                return;
+            }
+
+            StressTestPhase phase = _scenario.Phases[_phaseIndex];
+
+            int cpuThreads = phase.CpuThreads < 0 ? SystemInfo.processorCount : phase.CpuThreads;
+            if (cpuThreads > 0)
+            {
+                _load.StartCpu(cpuThreads, phase.CpuUtilizationPercent);
+            }
+            else
+            {
+                _load.StopCpu();
+            }
+
+            _load.GarbageKilobytesPerFrame = Math.Max(0, phase.GarbageKilobytesPerFrame);
+            _load.Retain(phase.RetainedMegabytes);
+
+            Debug.Log($"{nameof(StressTestRunner)}: Phase \"{phase.Name}\": {cpuThreads} busy threads at {phase.CpuUtilizationPercent}%, " +
+                $"{_load.GarbageKilobytesPerFrame} KiB of garbage per frame, {_load.RetainedMegabytes} MiB retained.");
+
+            _recorder.Clear();
+            _phaseFrames = 0;
+            _phaseGarbageCollections = GC.CollectionCount(0);
+            SetState(RunState.Running);
+        }
+
+        private void UpdatePhase()
+        {
+            // The first frame of a phase includes setting up its load
+            if (_phaseFrames > 0)
+            {
+                _recorder.Record(FrameTimeOperation, Time.unscaledDeltaTime * 1000.0);
+            }
+
+            _phaseFrames++;
+            _load.Tick();
+
+            long tickTimestamp = OperationLatencyRecorder.Timestamp;
+            _pool.Tick();
+            _recorder.RecordSince(FrameTickOperation, tickTimestamp);
+
+            if (Time.realtimeSinceStartup - _stateStartTime < _scenario.Phases[_phaseIndex].DurationSeconds)
+            {
+                return;
+            }
+
+            PhaseResult result = new()
+            {
+                Phase = _scenario.Phases[_phaseIndex],
+                Seconds = Time.realtimeSinceStartup - _stateStartTime,
+                Frames = _phaseFrames,
+                GarbageCollections = GC.CollectionCount(0) - _phaseGarbageCollections,
+                Summaries = _recorder.GetSummaries(),
+                Histograms = new Dictionary<string, long[]>(),
+                Report = _recorder.FormatReport()
+            };
+
+            foreach (OperationLatencyRecorder.Summary summary in result.Summaries)
+            {
+                result.Histograms.Add(summary.Operation, _recorder.GetHistogram(summary.Operation));
+            }
+
+            _results.Add(result);
+
+            _phaseIndex++;
+            StartPhase();
+        }
+
+        private void OnDestroy()
+        {
+            Stop();
+        }
+
+        private void Stop()
+        {
+            _load.Stop();
+
+            foreach (SimulatedUser bot in _bots)
+            {
+                bot.Stop();
+            }
+
+            _bots.Clear();
+            _pool?.Dispose();
+            _pool = null;
+            _state = RunState.Idle;
+        }
+
+        protected override void Finish(bool started)
+        {
+            int failedBots = SimulatedUser.CountFailed(_bots);
+
+            Stop();
+
+            Debug.Log($"{nameof(StressTestRunner)}: Run over, {failedBots} bots failed.\n{FormatReport(_results)}");
+
+            Complete(started && failedBots == 0);
+        }
+
+        /// <summary>
+        /// Writes the summaries to the report, and the histograms next to it
+        /// with <c>_histograms</c> appended to its name.
+        /// </summary>
+        protected override void WriteReport(string path)
+        {
+            string histogramPath = Path.Combine(Path.GetDirectoryName(path) ?? string.Empty,
+                Path.GetFileNameWithoutExtension(path) + "_histograms" + Path.GetExtension(path));
+
+            File.WriteAllText(path, FormatCsv(_results));
+            File.WriteAllText(histogramPath, FormatHistogramCsv(_results));
+        }
+
+        protected override void OnRunCompleted()
+        {
+            RunCompleted?.Invoke(_results);
+        }
+
+        /// <summary>
+        /// Formats the results as one table per phase.
+        /// </summary>
+        public static string FormatReport(IReadOnlyList<PhaseResult> results)
+        {
+            StringBuilder report = new();
+
+            foreach (PhaseResult result in results)
+            {
+                report.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                    "Phase \"{0}\": {1:0.0} s, {2} frames, {3} garbage collections",
+                    result.Phase.Name, result.Seconds, result.Frames, result.GarbageCollections));
+                report.AppendLine(result.Report);
+            }
+
+            return report.ToString();
+        }
+
+        /// <summary>
+        /// Formats the summaries of every phase as comma separated values,
+        /// for CI to pick up.
+        /// </summary>
+        public static string FormatCsv(IReadOnlyList<PhaseResult> results)
+        {
+            StringBuilder csv = new();
+            csv.AppendLine("phase,seconds,frames,garbage_collections,operation,count,failures,bytes,min_ms,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,ops_per_second,bytes_per_second");
+
+            foreach (PhaseResult result in results)
+            {
+                foreach (OperationLatencyRecorder.Summary summary in result.Summaries)
+                {
+                    csv.AppendLine(string.Format(CultureInfo.InvariantCulture,
+                        "{0},{1:0.###},{2},{3},{4},{5},{6},{7},{8:0.###},{9:0.###},{10:0.###},{11:0.###},{12:0.###},{13:0.###},{14:0.###},{15:0.###}",
+                        result.Phase.Name, result.Seconds, result.Frames, result.GarbageCollections,
+                        summary.Operation, summary.Count, summary.Failures, summary.Bytes,
+                        summary.MinMilliseconds, summary.MeanMilliseconds,
+                        summary.P50Milliseconds, summary.P90Milliseconds, summary.P99Milliseconds, summary.MaxMilliseconds,
+                        summary.OperationsPerSecond, summary.BytesPerSecond));
+                }
+            }
+
+            return csv.ToString();
+        }
+
+        /// <summary>
+        /// Formats the histograms of every phase as comma separated values,
+        /// one row per bucket. The bucket above the last bound has an upper
+        /// bound of <c>inf</c>.
+        /// </summary>
+        public static string FormatHistogramCsv(IReadOnlyList<PhaseResult> results)
+        {
+            StringBuilder csv = new();
+            csv.AppendLine("phase,operation,upper_ms,count");
+
+            foreach (PhaseResult result in results)
+            {
+                foreach (var histogram in result.Histograms)
+                {
+                    for (int bucket = 0; bucket < histogram.Value.Length; ++bucket)
+                    {
+                        string upperBound = bucket < OperationLatencyRecorder.HistogramUpperBounds.Length
+                            ? OperationLatencyRecorder.HistogramUpperBounds[bucket].ToString("0.####", CultureInfo.InvariantCulture)
+                            : "inf";
+
+                        csv.AppendLine(string.Format(CultureInfo.InvariantCulture, "{0},{1},{2},{3}",
+                            result.Phase.Name, histogram.Key, upperBound, histogram.Value[bucket]));
+                    }
+                }
+            }
+
+            return csv.ToString();
+        }
+    }
+}
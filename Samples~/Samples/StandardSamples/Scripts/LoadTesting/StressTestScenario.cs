@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using UnityEngine;
+
+    /// <summary>
+    /// A period of a <see cref="StressTestScenario"/> with a constant
+    /// background load.
+    /// </summary>
+    [Serializable]
+    public class StressTestPhase
+    {
+        public string Name = "Baseline";
+
+        public float DurationSeconds = 30;
+
+        /// <summary>
+        /// Number of busy threads. Less than zero uses one per processor.
+        /// </summary>
+        public int CpuThreads = 0;
+
+        /// <summary>
+        /// Share of the time each busy thread works.
+        /// </summary>
+        public float CpuUtilizationPercent = 90;
+
+        /// <summary>
+        /// Kilobytes allocated and dropped each frame.
+        /// </summary>
+        public int GarbageKilobytesPerFrame = 0;
+
+        /// <summary>
+        /// Megabytes kept alive for the length of the phase.
+        /// </summary>
+        public int RetainedMegabytes = 0;
+    }
+
+    /// <summary>
+    /// Describes a stress test run by <see cref="StressTestRunner"/>: bots
+    /// replaying EOS workloads, and a sequence of phases putting the process
+    /// under more and more CPU and memory pressure while they do. Stored as
+    /// JSON.
+    /// </summary>
+    [Serializable]
+    public class StressTestScenario
+    {
+        /// <summary>
+        /// The bots and their steps. The steps are looped for the whole run;
+        /// <see cref="BotSwarmScenario.DurationSeconds"/> and
+        /// <see cref="BotSwarmScenario.Loop"/> are ignored.
+        /// </summary>
+        public BotSwarmScenario Bots = new()
+        {
+            BotCount = 4,
+            BotsPerLobby = 2,
+            LobbyBucketId = "StressTest",
+            Steps = new List<BotAction>
+            {
+                new BotAction { Action = BotActionType.CreateOrJoinLobby },
+                new BotAction { Action = BotActionType.UpdateAttribute, Count = 4, IntervalSeconds = 0.25f },
+                new BotAction { Action = BotActionType.SendPackets, Count = 300, IntervalSeconds = 0.01f, PacketSizeBytes = 1024 },
+                new BotAction { Action = BotActionType.TransferFile, TransferSizeBytes = 64 * 1024 },
+                new BotAction { Action = BotActionType.LeaveLobby },
+                new BotAction { Action = BotActionType.Wait, IntervalSeconds = 0.5f }
+            }
+        };
+
+        /// <summary>
+        /// Seconds to wait for the bots to log in before the first phase.
+        /// </summary>
+        public float LoginTimeoutSeconds = 30;
+
+        public List<StressTestPhase> Phases = new()
+        {
+            new StressTestPhase { Name = "Baseline" },
+            new StressTestPhase { Name = "CPU", CpuThreads = -1 },
+            new StressTestPhase { Name = "GC", GarbageKilobytesPerFrame = 4096 },
+            new StressTestPhase { Name = "Memory", RetainedMegabytes = 1024, GarbageKilobytesPerFrame = 256 },
+            new StressTestPhase { Name = "Combined", CpuThreads = -1, GarbageKilobytesPerFrame = 4096, RetainedMegabytes = 1024 }
+        };
+
+        public static StressTestScenario Load(string path)
+        {
+            return JsonUtility.FromJson<StressTestScenario>(File.ReadAllText(path));
+        }
+    }
+}
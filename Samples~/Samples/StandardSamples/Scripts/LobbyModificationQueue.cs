@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Lobby;
+
+    /// <summary>
+    /// Write-behind queue for lobby modifications. Attribute writes are
+    /// coalesced per key (last writer wins) over a batch window, and the
+    /// result is submitted as a single UpdateLobby request. Every caller
+    /// whose write was coalesced into a batch receives the batch result.
+    /// The queue holds state only, <see cref="EOSLobbyManager"/> performs
+    /// the SDK calls.
+    /// </summary>
+    public class LobbyModificationQueue
+    {
+        /// <summary>
+        /// All writes that will be submitted together in one UpdateLobby
+        /// request.
+        /// </summary>
+        public class Batch
+        {
+            // Attribute keys are uppercased when transmitted, so coalesce
+            // them without regard to case.
+            public readonly Dictionary<string, LobbyAttribute> LobbyAttributes =
+                new(StringComparer.OrdinalIgnoreCase);
+
+            public readonly Dictionary<string, LobbyAttribute> MemberAttributes =
+                new(StringComparer.OrdinalIgnoreCase);
+
+            public bool HasBucketId;
+            public string BucketId;
+            public uint MaxNumLobbyMembers;
+            public LobbyPermissionLevel? PermissionLevel;
+            public bool? AllowInvites;
+
+            /// <summary>
+            /// Invokes every callback registered with this batch, pass it
+            /// as the client data of the UpdateLobby request.
+            /// </summary>
+            public readonly EOSLobbyManager.OnLobbyCallback CompletedCallback;
+
+            private readonly List<EOSLobbyManager.OnLobbyCallback> _callbacks = new();
+            private readonly LobbyModificationQueue _owner;
+
+            public Batch(LobbyModificationQueue owner)
+            {
+                _owner = owner;
+                CompletedCallback = OnCompleted;
+            }
+
+            public bool IsEmpty =>
+                LobbyAttributes.Count == 0 &&
+                MemberAttributes.Count == 0 &&
+                !HasBucketId &&
+                MaxNumLobbyMembers == 0 &&
+                PermissionLevel == null &&
+                AllowInvites == null;
+
+            /// <summary>
+            /// Whether the batch changes lobby-wide state, which only the
+            /// lobby owner is allowed to do.
+            /// </summary>
+            public bool RequiresOwner =>
+                LobbyAttributes.Count > 0 ||
+                HasBucketId ||
+                MaxNumLobbyMembers > 0 ||
+                PermissionLevel != null ||
+                AllowInvites != null;
+
+            internal void AddCallback(EOSLobbyManager.OnLobbyCallback callback)
+            {
+                if (callback != null)
+                {
+                    _callbacks.Add(callback);
+                }
+            }
+
+            internal void Clear()
+            {
+                LobbyAttributes.Clear();
+                MemberAttributes.Clear();
+                HasBucketId = false;
+                BucketId = null;
+                MaxNumLobbyMembers = 0;
+                PermissionLevel = null;
+                AllowInvites = null;
+                _callbacks.Clear();
+            }
+
+            private void OnCompleted(Result result)
+            {
+                _owner.OnBatchCompleted(this, result);
+            }
+
+            internal void InvokeCallbacks(Result result)
+            {
+                foreach (EOSLobbyManager.OnLobbyCallback callback in _callbacks)
+                {
+                    callback(result);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Time in seconds that writes are collected for, measured from the
+        /// first write into an empty batch. Zero or less disables batching.
+        /// </summary>
+        public float BatchWindowSeconds { get; set; }
+
+        /// <summary>
+        /// Whether a batch has been submitted and is waiting for its result.
+        /// </summary>
+        public bool SubmitInProgress { get; private set; }
+
+        /// <summary>
+        /// Number of individual write calls that were merged into a batch
+        /// instead of producing a request of their own.
+        /// </summary>
+        public int CoalescedWriteCount { get; private set; }
+
+        public bool IsEnabled => BatchWindowSeconds > 0.0f;
+
+        public bool HasPendingWrites => !_pending.IsEmpty;
+
+        // Batches are swapped rather than reallocated so a chatty lobby
+        // settles into a steady state without garbage.
+        private Batch _pending;
+        private Batch _inFlight;
+        private float _windowStartTime;
+        private int _pendingWriteCount;
+
+        public LobbyModificationQueue(float batchWindowSeconds)
+        {
+            BatchWindowSeconds = batchWindowSeconds;
+            _pending = new Batch(this);
+            _inFlight = new Batch(this);
+        }
+
+        /// <summary>
+        /// Queues the lobby-wide settings and attributes from
+        /// <paramref name="lobbyUpdates"/>. Settings that match
+        /// <paramref name="currentLobby"/> are not sent, mirroring
+        /// <see cref="EOSLobbyManager.ModifyLobby"/>. If nothing differs,
+        /// <paramref name="callback"/> succeeds straight away.
+        /// </summary>
+        public void EnqueueLobbyUpdates(Lobby lobbyUpdates, Lobby currentLobby, EOSLobbyManager.OnLobbyCallback callback, float now)
+        {
+            bool bucketIdChanged = !string.Equals(lobbyUpdates.BucketId, currentLobby.BucketId);
+            bool permissionLevelChanged = lobbyUpdates.LobbyPermissionLevel != currentLobby.LobbyPermissionLevel;
+            bool allowInvitesChanged = lobbyUpdates.AllowInvites != currentLobby.AllowInvites;
+            bool hasAttributes = lobbyUpdates.Attributes.Exists(attribute => attribute?.Key != null);
+
+            if (!bucketIdChanged && lobbyUpdates.MaxNumLobbyMembers == 0 && !permissionLevelChanged && !allowInvitesChanged && !hasAttributes)
+            {
+                callback?.Invoke(Result.Success);
+                return;
+            }
+
+            BeginWrite(now);
+
+            if (bucketIdChanged)
+            {
+                _pending.HasBucketId = true;
+                _pending.BucketId = lobbyUpdates.BucketId;
+            }
+
+            if (lobbyUpdates.MaxNumLobbyMembers > 0)
+            {
+                _pending.MaxNumLobbyMembers = lobbyUpdates.MaxNumLobbyMembers;
+            }
+
+            if (permissionLevelChanged)
+            {
+                _pending.PermissionLevel = lobbyUpdates.LobbyPermissionLevel;
+            }
+
+            if (allowInvitesChanged)
+            {
+                _pending.AllowInvites = lobbyUpdates.AllowInvites;
+            }
+
+            foreach (LobbyAttribute attribute in lobbyUpdates.Attributes)
+            {
+                if (attribute?.Key != null)
+                {
+                    _pending.LobbyAttributes[attribute.Key] = CopyAttribute(attribute);
+                }
+            }
+
+            _pending.AddCallback(callback);
+        }
+
+        /// <summary>
+        /// Queues a member attribute for the local user, replacing any
+        /// pending write to the same key.
+        /// </summary>
+        public void EnqueueMemberAttribute(LobbyAttribute memberAttribute, EOSLobbyManager.OnLobbyCallback callback, float now)
+        {
+            BeginWrite(now);
+
+            _pending.MemberAttributes[memberAttribute.Key] = CopyAttribute(memberAttribute);
+            _pending.AddCallback(callback);
+        }
+
+        // Callers may change or reuse their attribute objects after queueing
+        // them, which must not change what is sent.
+        private static LobbyAttribute CopyAttribute(LobbyAttribute attribute)
+        {
+            return new LobbyAttribute()
+            {
+                Visibility = attribute.Visibility,
+                ValueType = attribute.ValueType,
+                Key = attribute.Key,
+                AsInt64 = attribute.AsInt64,
+                AsDouble = attribute.AsDouble,
+                AsBool = attribute.AsBool,
+                AsString = attribute.AsString
+            };
+        }
+
+        /// <summary>
+        /// Returns true when the pending batch should be submitted: it has
+        /// writes, its window has elapsed (or <paramref name="force"/> is
+        /// set) and no other batch is in flight.
+        /// </summary>
+        public bool IsReadyToSubmit(float now, bool force = false)
+        {
+            if (SubmitInProgress || _pending.IsEmpty)
+            {
+                return false;
+            }
+
+            return force || now - _windowStartTime >= BatchWindowSeconds;
+        }
+
+        /// <summary>
+        /// Moves the pending batch in flight and returns it. The batch must
+        /// be completed through <see cref="Batch.CompletedCallback"/>.
+        /// </summary>
+        public Batch BeginSubmit()
+        {
+            (_pending, _inFlight) = (_inFlight, _pending);
+            _pending.Clear();
+
+            if (_pendingWriteCount > 1)
+            {
+                CoalescedWriteCount += _pendingWriteCount - 1;
+            }
+            _pendingWriteCount = 0;
+
+            SubmitInProgress = true;
+            return _inFlight;
+        }
+
+        /// <summary>
+        /// Drops all pending writes, reporting <paramref name="result"/> to
+        /// their callers. A batch already in flight is not affected.
+        /// </summary>
+        public void CancelPending(Result result)
+        {
+            if (_pending.IsEmpty)
+            {
+                return;
+            }
+
+            Batch canceled = _pending;
+            _pending = new Batch(this);
+            _pendingWriteCount = 0;
+            canceled.InvokeCallbacks(result);
+        }
+
+        /// <summary>
+        /// Cancels pending writes and stops waiting for the batch in flight,
+        /// used when the current lobby is left or replaced. The result of
+        /// the detached batch is still reported to its callers if it
+        /// arrives.
+        /// </summary>
+        public void Reset(Result result)
+        {
+            CancelPending(result);
+
+            if (SubmitInProgress)
+            {
+                _inFlight = new Batch(this);
+                SubmitInProgress = false;
+            }
+        }
+
+        private void BeginWrite(float now)
+        {
+            if (_pending.IsEmpty)
+            {
+                _windowStartTime = now;
+            }
+
+            ++_pendingWriteCount;
+        }
+
+        private void OnBatchCompleted(Batch batch, Result result)
+        {
+            if (batch == _inFlight)
+            {
+                SubmitInProgress = false;
+            }
+
+            batch.InvokeCallbacks(result);
+            batch.Clear();
+        }
+    }
+}
@@ -113,6 +113,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         }
     }
 
+    /// <summary>
+    /// Interactive CPU, GPU and memory stress tests. To measure how EOS
+    /// behaves under the same kind of pressure, with a script and without a
+    /// GPU, see <see cref="StressTestRunner"/>.
+    /// </summary>
     public class PerformanceStressTest : MonoBehaviour
     {
         public class UISliderToText : MonoBehaviour
@@ -128,7 +133,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         //CPU Test 
         int threads = 0;
-        List<Thread> threadList;
+        BackgroundLoad cpuLoad;
         bool threadOverride = false;
         public Slider threadSlider;
         public Slider targetUtilizationSlider;
@@ -147,36 +152,13 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         {
             threads = SystemInfo.processorCount;
             UnityEngine.Debug.Log("Working with: " + threads + " threads");
-            threadList = new List<Thread>();
+            cpuLoad = new BackgroundLoad();
             UnityEngine.EventSystems.EventSystem.current.SetSelectedGameObject(targetUtilizationSlider.gameObject);
         }
 
-        public void CPUTest()
+        private void OnDestroy()
         {
-            UnityEngine.Debug.Log("CPU Thread started");
-            long count = 0;
-            Stopwatch watch = new Stopwatch();
-            watch.Start();
-            while (true)
-            {
-                //sleep for the desired time
-                if (watch.ElapsedMilliseconds > targetUtilization)
-                {
-                    Thread.Sleep((int)(100 - targetUtilization));
-
-                    watch.Reset();
-                    watch.Start();
-                }
-                //work for the determined time to hit the target utilization
-                else
-                {
-                    count++;
-                    if (count > 10000000)
-                    {
-                        count = 0;
-                    }
-                }
-            }
+            cpuLoad?.Stop();
         }
 
         public void StartCPUTest()
@@ -192,22 +174,13 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             UnityEngine.Debug.Log(
                 "Starting: " + targetThreads + " threads with a target usage of: " + targetUtilization);
-            for (int i = 0; i < targetThreads; i++)
-            {
-                threadList.Add(new Thread(new ThreadStart(CPUTest)));
-                threadList[i].Start();
-            }
+            cpuLoad.StartCpu(targetThreads, targetUtilization);
         }
 
         public void StopCPUTest()
         {
-            UnityEngine.Debug.Log("Stopping: " + threadList.Count + " threads");
-            for (int i = 0; i < threadList.Count; i++)
-            {
-                threadList[i].Abort();
-            }
-
-            threadList.Clear();
+            UnityEngine.Debug.Log("Stopping: " + cpuLoad.CpuThreadCount + " threads");
+            cpuLoad.StopCpu();
         }
 
         public void ToggleOverride()
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Security.Cryptography;
+    using System.Text;
+    using System.Threading.Tasks;
+
+    using UnityEngine;
+    using UnityEngine.Networking;
+
+    /// <summary>
+    /// Loads achievement icons without blocking the main thread, and keeps
+    /// them cached on disk and in memory.
+    ///
+    /// Icons are requested through <see cref="UnityWebRequestTexture"/>, which
+    /// decodes and uploads the image off the main thread, unlike
+    /// <c>Texture2D.LoadImage</c>. Downloaded bytes are written to a
+    /// content-addressed store on disk, named by a hash of the icon URL, so
+    /// later sessions load icons from disk instead of the network. The store
+    /// is bounded, and the icons used least recently are deleted first.
+    ///
+    /// Every texture returned by <see cref="GetTextureAsync"/> is a reference
+    /// that must be given back with <see cref="ReleaseTexture"/> once it is no
+    /// longer displayed. Decoded textures are kept in a bounded least recently
+    /// used cache, and a texture is only destroyed once it has been evicted
+    /// or cleared and no reference to it is left.
+    /// </summary>
+    public class AchievementIconCache
+    {
+        /// <summary>
+        /// Maximum number of decoded textures kept in memory.
+        /// </summary>
+        public int MaxCachedTextures { get; }
+
+        /// <summary>
+        /// Maximum number of icons downloaded or decoded at the same time.
+        /// Further requests wait for a free slot.
+        /// </summary>
+        public int MaxConcurrentLoads { get; }
+
+        /// <summary>
+        /// Maximum size in bytes of the icons stored on disk.
+        /// </summary>
+        public long MaxStoreBytes { get; }
+
+        private class Entry
+        {
+            public string Uri;
+            public Texture2D Texture;
+            public int References;
+
+            // Set once the entry has left the cache, to destroy the texture
+            // when its last reference is released
+            public bool Detached;
+        }
+
+        private readonly string _directory;
+
+        private readonly Dictionary<string, LinkedListNode<Entry>> _textures = new();
+
+        // Every texture handed out and not destroyed yet, including detached ones
+        private readonly Dictionary<Texture2D, Entry> _entriesByTexture = new();
+
+        // Most recently used textures first
+        private readonly LinkedList<Entry> _lru = new();
+
+        // Loads in progress, so concurrent requests for one icon share a load
+        private readonly Dictionary<string, Task<Texture2D>> _pending = new();
+
+        private readonly Queue<TaskCompletionSource<bool>> _waitingLoads = new();
+
+        // Trims run on worker threads, and would delete too much if they
+        // overlapped
+        private static readonly object s_trimLock = new();
+        private int _activeLoads;
+
+        public AchievementIconCache(string directory, int maxCachedTextures = 256, int maxConcurrentLoads = 4, long maxStoreBytes = 64 * 1024 * 1024)
+        {
+            _directory = directory;
+            MaxCachedTextures = Math.Max(1, maxCachedTextures);
+            MaxConcurrentLoads = Math.Max(1, maxConcurrentLoads);
+            MaxStoreBytes = Math.Max(0, maxStoreBytes);
+        }
+
+        /// <summary>
+        /// Gets the texture of the icon at the given URI, from memory, disk
+        /// or the network, in that order. The texture stays valid until it is
+        /// given back with <see cref="ReleaseTexture"/>.
+        /// </summary>
+        /// <param name="uri">The URI of the icon.</param>
+        /// <returns>
+        /// The icon texture, or null if it could not be loaded.
+        /// </returns>
+        public Task<Texture2D> GetTextureAsync(string uri)
+        {
+            if (string.IsNullOrEmpty(uri))
+            {
+                return Task.FromResult<Texture2D>(null);
+            }
+
+            if (_textures.TryGetValue(uri, out var node))
+            {
+                _lru.Remove(node);
+                _lru.AddFirst(node);
+                ++node.Value.References;
+                return Task.FromResult(node.Value.Texture);
+            }
+
+            if (!_pending.TryGetValue(uri, out Task<Texture2D> task))
+            {
+                task = LoadAsync(uri);
+
+                // A load that completed synchronously has already been cached
+                if (!task.IsCompleted)
+                {
+                    _pending[uri] = task;
+                }
+            }
+
+            return AcquireLoadedTextureAsync(uri, task);
+        }
+
+        /// <summary>
+        /// Gives back a texture returned by <see cref="GetTextureAsync"/>.
+        /// </summary>
+        /// <param name="texture">The texture, which may be null.</param>
+        public void ReleaseTexture(Texture2D texture)
+        {
+            if (texture == null || !_entriesByTexture.TryGetValue(texture, out Entry entry))
+            {
+                return;
+            }
+
+            if (entry.References > 0)
+            {
+                --entry.References;
+            }
+
+            if (entry.References > 0)
+            {
+                return;
+            }
+
+            if (entry.Detached)
+            {
+                DestroyEntry(entry);
+            }
+            else
+            {
+                Trim(null);
+            }
+        }
+
+        /// <summary>
+        /// Empties the cache of textures in memory. Textures that are not
+        /// referenced are destroyed straight away, the others once they are
+        /// released. The icons stored on disk are kept.
+        /// </summary>
+        public void Clear()
+        {
+            foreach (Entry entry in _lru)
+            {
+                DetachEntry(entry);
+            }
+
+            _lru.Clear();
+            _textures.Clear();
+        }
+
+        private async Task<Texture2D> AcquireLoadedTextureAsync(string uri, Task<Texture2D> load)
+        {
+            Texture2D texture = await load;
+            if (texture == null)
+            {
+                return null;
+            }
+
+            if (_textures.TryGetValue(uri, out var node) && node.Value.Texture == texture)
+            {
+                ++node.Value.References;
+                return texture;
+            }
+
+            // The cache was cleared since the texture was loaded
+            return await GetTextureAsync(uri);
+        }
+
+        private async Task<Texture2D> LoadAsync(string uri)
+        {
+            await AcquireLoadSlotAsync();
+
+            try
+            {
+                string path = GetStorePath(uri);
+                Texture2D texture = null;
+
+                if (File.Exists(path))
+                {
+                    texture = await RequestTextureAsync(new Uri(path).AbsoluteUri, null, 0);
+
+                    if (texture != null)
+                    {
+                        // The store is trimmed by last write time
+                        _ = Task.Run(() => TouchStoredIcon(path));
+                    }
+                }
+
+                if (texture == null)
+                {
+                    texture = await RequestTextureAsync(uri, path, MaxStoreBytes);
+                }
+
+                if (texture != null)
+                {
+                    AddTexture(uri, texture);
+                }
+
+                return texture;
+            }
+            finally
+            {
+                _pending.Remove(uri);
+                ReleaseLoadSlot();
+            }
+        }
+
+        private Task AcquireLoadSlotAsync()
+        {
+            if (_activeLoads < MaxConcurrentLoads)
+            {
+                ++_activeLoads;
+                return Task.CompletedTask;
+            }
+
+            TaskCompletionSource<bool> slot = new();
+            _waitingLoads.Enqueue(slot);
+            return slot.Task;
+        }
+
+        private void ReleaseLoadSlot()
+        {
+            // Hand the slot directly to the next waiting load
+            if (_waitingLoads.Count > 0)
+            {
+                _waitingLoads.Dequeue().SetResult(true);
+            }
+            else
+            {
+                --_activeLoads;
+            }
+        }
+
+        /// <summary>
+        /// Requests a texture from the given URL.
+        /// </summary>
+        /// <param name="url">The URL of the image, possibly a file URL.</param>
+        /// <param name="storePath">
+        /// If not null, where to write the downloaded bytes once the request
+        /// succeeds.
+        /// </param>
+        /// <param name="maxStoreBytes">
+        /// Size the store is trimmed to after writing to it.
+        /// </param>
+        private static Task<Texture2D> RequestTextureAsync(string url, string storePath, long maxStoreBytes)
+        {
+            TaskCompletionSource<Texture2D> tcs = new();
+
+            // Non-readable textures are decoded and uploaded without keeping a
+            // copy of the pixels in managed memory.
+            UnityWebRequest request = UnityWebRequestTexture.GetTexture(url, true);
+
+            UnityWebRequestAsyncOperation asyncOp = request.SendWebRequest();
+
+            asyncOp.completed += operation =>
+            {
+                Texture2D texture = null;
+
+                if (request.result == UnityWebRequest.Result.Success)
+                {
+                    texture = DownloadHandlerTexture.GetContent(request);
+
+                    if (storePath != null)
+                    {
+                        byte[] bytes = request.downloadHandler.data;
+                        Task.Run(() =>
+                        {
+                            WriteToStore(storePath, bytes);
+                            TrimStore(Path.GetDirectoryName(storePath), maxStoreBytes);
+                        });
+                    }
+                }
+                else
+                {
+                    Debug.LogWarning($"Could not load achievement icon from \"{url}\": {request.result}.");
+                }
+
+                request.Dispose();
+
+                tcs.SetResult(texture);
+            };
+
+            return tcs.Task;
+        }
+
+        private static void WriteToStore(string path, byte[] bytes)
+        {
+            try
+            {
+                Directory.CreateDirectory(Path.GetDirectoryName(path));
+
+                // Write to a temporary file first, so a partially written
+                // icon is never picked up by a later load
+                string tempPath = path + ".tmp";
+                File.WriteAllBytes(tempPath, bytes);
+
+                if (File.Exists(path))
+                {
+                    File.Delete(path);
+                }
+                File.Move(tempPath, path);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning($"Could not store achievement icon at \"{path}\": {e.Message}");
+            }
+        }
+
+        private static void TouchStoredIcon(string path)
+        {
+            try
+            {
+                File.SetLastWriteTimeUtc(path, DateTime.UtcNow);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning($"Could not update achievement icon at \"{path}\": {e.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Deletes the least recently used icons from the store until it is
+        /// no larger than the given size.
+        /// </summary>
+        private static void TrimStore(string directory, long maxBytes)
+        {
+            lock (s_trimLock)
+            {
+                TrimStoreLocked(directory, maxBytes);
+            }
+        }
+
+        private static void TrimStoreLocked(string directory, long maxBytes)
+        {
+            try
+            {
+                List<FileInfo> files = new();
+                long totalBytes = 0;
+
+                foreach (FileInfo file in new DirectoryInfo(directory).GetFiles())
+                {
+                    // Icons being written
+                    if (file.Extension == ".tmp")
+                    {
+                        continue;
+                    }
+
+                    files.Add(file);
+                    totalBytes += file.Length;
+                }
+
+                if (totalBytes <= maxBytes)
+                {
+                    return;
+                }
+
+                files.Sort((a, b) => a.LastWriteTimeUtc.CompareTo(b.LastWriteTimeUtc));
+
+                foreach (FileInfo file in files)
+                {
+                    if (totalBytes <= maxBytes)
+                    {
+                        break;
+                    }
+
+                    long length = file.Length;
+
+                    try
+                    {
+                        file.Delete();
+                        totalBytes -= length;
+                    }
+                    catch (IOException)
+                    {
+                        // In use by a load, or already deleted by another trim
+                    }
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarning($"Could not trim the achievement icon store at \"{directory}\": {e.Message}");
+            }
+        }
+
+        private void AddTexture(string uri, Texture2D texture)
+        {
+            if (_textures.TryGetValue(uri, out var existing))
+            {
+                _lru.Remove(existing);
+                _textures.Remove(uri);
+                DetachEntry(existing.Value);
+            }
+
+            Entry entry = new() { Uri = uri, Texture = texture };
+            _entriesByTexture[texture] = entry;
+            _textures[uri] = _lru.AddFirst(entry);
+
+            // The new texture is kept until its callers have acquired it
+            Trim(entry);
+        }
+
+        /// <summary>
+        /// Evicts the least recently used textures that are not referenced,
+        /// until the cache is back within its bounds. Referenced textures are
+        /// kept even if that goes over the bounds.
+        /// </summary>
+        private void Trim(Entry keep)
+        {
+            var node = _lru.Last;
+            while (node != null && _textures.Count > MaxCachedTextures)
+            {
+                var previous = node.Previous;
+
+                if (node.Value.References == 0 && node.Value != keep)
+                {
+                    _lru.Remove(node);
+                    _textures.Remove(node.Value.Uri);
+                    DestroyEntry(node.Value);
+                }
+
+                node = previous;
+            }
+        }
+
+        private void DetachEntry(Entry entry)
+        {
+            if (entry.References == 0)
+            {
+                DestroyEntry(entry);
+            }
+            else
+            {
+                entry.Detached = true;
+            }
+        }
+
+        private void DestroyEntry(Entry entry)
+        {
+            _entriesByTexture.Remove(entry.Texture);
+            UnityEngine.Object.Destroy(entry.Texture);
+        }
+
+        private string GetStorePath(string uri)
+        {
+            using SHA256 sha256 = SHA256.Create();
+            byte[] hash = sha256.ComputeHash(Encoding.UTF8.GetBytes(uri));
+
+            StringBuilder name = new(hash.Length * 2);
+            foreach (byte b in hash)
+            {
+                name.Append(b.ToString("x2"));
+            }
+
+            return Path.Combine(_directory, name.ToString());
+        }
+    }
+}
@@ -28,9 +28,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
     using System.Diagnostics;
     using System.Collections.Generic;
     using System.Collections.Concurrent;
+    using System.IO;
 
     using UnityEngine;
-    using UnityEngine.Networking;
 
     using Epic.OnlineServices;
     using Epic.OnlineServices.Achievements;
@@ -44,15 +44,20 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
     public class AchievementsService : EOSService
     {
         /// <summary>
-        /// Stores data that has been cached, where the string key is a URI,
-        /// and the value is the bytes of the resource at that URI.
+        /// Loads and caches achievement icons. Created on first use, since it
+        /// needs the Unity cache path.
         /// </summary>
-        private ConcurrentDictionary<string, byte[]> _downloadCache = new();
+        private AchievementIconCache _iconCache;
 
         /// <summary>
         /// Contains a list of the achievements that exist for the game.
         /// </summary>
         private IList<DefinitionV2> _achievements = new List<DefinitionV2>();
+
+        /// <summary>
+        /// Maps achievement ids to the definitions in _achievements.
+        /// </summary>
+        private Dictionary<string, DefinitionV2> _achievementsById = new();
         
         /// <summary>
         /// Maps a given user to a list of player achievements.
@@ -114,8 +119,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         protected override void Reset()
         {
-            _downloadCache.Clear();
+            _iconCache?.Clear();
             _achievements.Clear();
+            _achievementsById.Clear();
             _playerAchievements.Clear();
 
             base.Reset();
@@ -137,6 +143,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             ProductUserId productUserId = EOSManager.Instance.GetProductUserId();
             _achievements = await QueryAchievementsAsync(productUserId);
 
+            _achievementsById.Clear();
+            foreach (DefinitionV2 definition in _achievements)
+            {
+                _achievementsById[definition.AchievementId] = definition;
+            }
+
             // If the user is not in the list, then add it.
             if (!_playerAchievements.ContainsKey(productUserId))
             {
@@ -344,6 +356,18 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return await GetAchievementIconTexture(achievementId, v2 => v2.LockedIconURL);
         }
 
+        /// <summary>
+        /// Gives back an icon texture returned by
+        /// <see cref="GetAchievementUnlockedIconTexture"/> or
+        /// <see cref="GetAchievementLockedIconTexture"/>, once it is no longer
+        /// displayed. Icons are only destroyed once they have been released.
+        /// </summary>
+        /// <param name="texture">The texture, which may be null.</param>
+        public void ReleaseAchievementIconTexture(Texture2D texture)
+        {
+            _iconCache?.ReleaseTexture(texture);
+        }
+
         /// <summary>
         /// Retrieves the icon texture associated with the given achievement ID
         /// given the provided uri selector.
@@ -361,61 +385,14 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// </returns>
         private async Task<Texture2D> GetAchievementIconTexture(string achievementId, Func<DefinitionV2, string> uriSelector)
         {
-            Texture2D textureFromBytes = null;
-            
-            foreach (var achievementDef in _achievements)
+            if (!_achievementsById.TryGetValue(achievementId, out DefinitionV2 achievementDef))
             {
-                if (achievementDef.AchievementId != achievementId)
-                    continue;
-
-                var uri = uriSelector(achievementDef);
-                byte[] iconBytes = null;
-
-                // Download the data
-                if (!_downloadCache.ContainsKey(uri))
-                {
-                    TaskCompletionSource<byte[]> downloadTcs = new();
-
-                    GetAndCacheData(uri, data =>
-                    {
-                        if (data.result == UnityWebRequest.Result.Success)
-                        {
-                            downloadTcs.SetResult(data.data);
-                            return;
-                        }
-
-                        Debug.LogWarning($"Could not download achievement icon: {data.result}.");
-                        downloadTcs.SetResult(null);
-                    });
-
-                    iconBytes = await downloadTcs.Task;
-
-                    if (null != iconBytes)
-                    {
-                        _downloadCache[uri] = iconBytes;
-                    }
-                }
-                else
-                {
-                    _downloadCache.TryGetValue(uri, out iconBytes);
-                }
-
-
-                if (null != iconBytes)
-                {
-                    textureFromBytes = new Texture2D(2, 2);
-
-                    if (!textureFromBytes.LoadImage(iconBytes))
-                    {
-                        Debug.LogWarning("Could not load achievement icon bytes into texture.");
-                        textureFromBytes = null;
-                    }
-                }
-
-                break;
+                return null;
             }
 
-            return textureFromBytes;
+            _iconCache ??= new AchievementIconCache(Path.Combine(Application.temporaryCachePath, "AchievementIcons"));
+
+            return await _iconCache.GetTextureAsync(uriSelector(achievementDef));
         }
 
         /// <summary>
@@ -503,14 +480,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         public Task<PlayerAchievement> UnlockAchievementAsync(string achievementId)
         {
             DefinitionV2? definition = null;
-            for (int i = 0; i < _achievements.Count; i++)
+            if (_achievementsById.TryGetValue(achievementId, out DefinitionV2 foundDefinition))
             {
-                DefinitionV2 otherDefinition = _achievements[i];
-                if (otherDefinition.AchievementId == achievementId)
-                {
-                    definition = otherDefinition;
-                    break;
-                }
+                definition = foundDefinition;
             }
 
             if (!definition.HasValue)
@@ -617,55 +589,5 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             return collectedAchievements;
         }
-
-
-        protected struct DownloadDataCallback
-        {
-            public byte[] data;
-            public UnityWebRequest.Result result;
-        }
-
-        /// <summary>
-        /// Gets and subsequently caches the data at the given URI.
-        /// </summary>
-        /// <param name="uri">
-        /// The URI to get bytes from.
-        /// </param>
-        /// <param name="callback">
-        /// Action to invoke when the data has been retrieved and cached.
-        /// </param>
-        private void GetAndCacheData(string uri, Action<DownloadDataCallback> callback)
-        {
-            if (_downloadCache.ContainsKey(uri))
-            {
-                return;
-            }
-
-            UnityWebRequest request = UnityWebRequest.Get(uri);
-
-            UnityWebRequestAsyncOperation asyncOp = request.SendWebRequest();
-
-            asyncOp.completed += operation =>
-            {
-                DownloadDataCallback callbackInfo = new()
-                {
-                    result = request.result
-                };
-
-#if UNITY_2020_1_OR_NEWER
-                if (request.result == UnityWebRequest.Result.Success)
-#else
-                if (!request.isNetworkError && !request.isHttpError)
-#endif
-                {
-                    _downloadCache[uri] = request.downloadHandler.data;
-                    callbackInfo.data = request.downloadHandler.data;
-                }
-
-                callback(callbackInfo);
-
-                request.Dispose();
-            };
-        }
     }
 }
\ No newline at end of file
@@ -25,6 +25,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
     using System.Threading.Tasks;
     using System;
     using System.Collections.Generic;
+    using System.IO;
     using UnityEngine;
     using Epic.OnlineServices;
     using Epic.OnlineServices.PlayerDataStorage;
@@ -63,6 +64,44 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         #endregion
 
+        /// <summary>
+        /// Metadata of the files on the backend, from the last file list query.
+        /// </summary>
+        private readonly Dictionary<string, FileMetadata> _remoteFiles = new(StringComparer.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Local copy of the files of the logged in user, so files that
+        /// haven't changed on the backend are not downloaded again.
+        /// </summary>
+        private StorageContentCache _contentCache;
+        private ProductUserId _contentCacheUserId;
+
+        /// <summary>
+        /// Number of uploads of each file that haven't finished yet. While a
+        /// file is being uploaded, the backend may end up with any of the
+        /// queued contents, so an upload of it is never skipped.
+        /// </summary>
+        private readonly Dictionary<string, int> _pendingUploads = new(StringComparer.OrdinalIgnoreCase);
+
+        protected override void Reset()
+        {
+            _remoteFiles.Clear();
+            _pendingUploads.Clear();
+            _contentCache = null;
+            _contentCacheUserId = null;
+
+            base.Reset();
+        }
+
+        //-------------------------------------------------------------------------
+        /// <summary>Get the metadata of a file from the last file list query.</summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="metadata">Size, MD5 hash and modification time of the file on the backend.</param>
+        /// <returns>True if the file was in the last file list.</returns>
+        public bool TryGetFileMetadata(string fileName, out FileMetadata metadata)
+        {
+            return _remoteFiles.TryGetValue(fileName, out metadata);
+        }
 
         //-------------------------------------------------------------------------
         /// <summary>(async) Query list of files.</summary>
@@ -86,82 +125,227 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// <summary>(async) Begin file data download.</summary>
         /// <param name="fileName">Name of file.</param>
         /// <param name="downloadCompletedCallback">Function called when download is completed.</param>
-        public void DownloadFile(string fileName, Action downloadCompletedCallback = null)
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFile(string fileName, Action downloadCompletedCallback = null)
         {
             ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
             if (localUserId == null || !localUserId.IsValid())
             {
-                return;
+                return null;
             }
 
+            // Skip the download if the local copy is the version the backend
+            // has
+            if (TryLoadFromContentCache(localUserId, fileName, out EOSTransferInProgress cached))
+            {
+                downloadCompletedCallback?.Invoke();
+                return cached;
+            }
+
+            return QueueCachedDownload(fileName, transfer => StartReadFile(localUserId, transfer, downloadCompletedCallback));
+        }
+
+        //-------------------------------------------------------------------------
+        /// <summary>(async) Begin file data download, writing each chunk to a stream as it arrives.</summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="destination">Stream the file content is written to.</param>
+        /// <param name="ownsStream">Whether the stream is disposed of when the download finishes.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFileToStream(string fileName, Stream destination, bool ownsStream = false)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return null;
+            }
+
+            return QueueTransfer(fileName, true, destination, ownsStream, transfer => StartReadFile(localUserId, transfer, null));
+        }
+
+        //-------------------------------------------------------------------------
+        /// <summary>(async) Begin file data download straight to a file on disk.</summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="path">Path of the file to write.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFileToPath(string fileName, string path)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return null;
+            }
+
+            return QueueFileDownload(fileName, path, transfer => StartReadFile(localUserId, transfer, null));
+        }
+
+        private PlayerDataStorageFileTransferRequestWrapper StartReadFile(ProductUserId localUserId, EOSTransferInProgress transfer, Action downloadCompletedCallback)
+        {
             ReadFileOptions options = new ReadFileOptions
             {
                 LocalUserId = localUserId,
-                Filename = fileName,
-                ReadChunkLengthBytes = MAX_CHUNK_SIZE,
+                Filename = transfer.FileName,
+                ReadChunkLengthBytes = transfer.ChunkSize,
                 ReadFileDataCallback = OnFileDataReceived,
                 FileTransferProgressCallback = OnFileTransferProgressUpdated
             };
 
-            var queryFileOptions = new QueryFileOptions { Filename = fileName, LocalUserId = localUserId };
-            EOSManager.Instance.GetPlayerDataStorageInterface().QueryFile(ref queryFileOptions, null, (ref QueryFileCallbackInfo data) =>
+            PlayerDataStorageFileTransferRequest req = EOSManager.Instance.GetPlayerDataStorageInterface().ReadFile(ref options, downloadCompletedCallback, OnFileReceived);
+            if (req == null)
             {
-                if(data.ResultCode == Result.Success)
-                {
+                Debug.LogErrorFormat("[EOS SDK] Player data storage: can't start file download, bad handle returned for filename '{0}'", transfer.FileName);
+                return null;
+            }
+
+            return req;
+        }
 
-                    var copyFileMetadataOptions = new CopyFileMetadataByFilenameOptions { Filename = fileName, LocalUserId = localUserId };
-                    EOSManager.Instance.GetPlayerDataStorageInterface().CopyFileMetadataByFilename(ref copyFileMetadataOptions, out FileMetadata? fileMetadata);
+        //-------------------------------------------------------------------------
+        /// <summary>(async) Begin file data upload.</summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <returns>True if upload started</returns>
+        public bool StartFileDataUpload(string fileName, Action fileCreatedCallback = null)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return false;
+            }
+
+            string fileData = null;
+            if (_locallyCachedData.TryGetValue(fileName, out string entry))
+            {
+                fileData = entry;
+            }
 
-                    PlayerDataStorageFileTransferRequest req = EOSManager.Instance.GetPlayerDataStorageInterface().ReadFile(ref options, downloadCompletedCallback, OnFileReceived);
-                    if (req == null)
+            byte[] content = null != fileData ? System.Text.Encoding.UTF8.GetBytes(fileData) : Array.Empty<byte>();
+            string contentHash = StorageContentCache.ComputeHash(content, 0, content.Length);
+            StorageContentCache contentCache = GetContentCache(localUserId);
+
+            // Nothing to send if the backend still has the version of the
+            // file that was last uploaded or downloaded with this content
+            if (!_pendingUploads.ContainsKey(fileName) &&
+                _remoteFiles.TryGetValue(fileName, out FileMetadata remoteFile) &&
+                contentCache.TryGetVersion(fileName, out string cachedVersion) &&
+                StorageContentCache.HashesMatch(cachedVersion, remoteFile.MD5Hash) &&
+                contentCache.TryGetContentHash(fileName, out string cachedContentHash) &&
+                StorageContentCache.HashesMatch(cachedContentHash, contentHash))
+            {
+                Debug.LogFormat("[EOS SDK] Player data storage: '{0}' is unchanged, skipping upload", fileName);
+                fileCreatedCallback?.Invoke();
+                return true;
+            }
+
+            EOSTransferInProgress transfer = CreateTransfer(fileName, false, null, false, t => StartWriteFile(localUserId, t, fileCreatedCallback));
+
+            // The content must be in place before the transfer can start
+            if (!transfer.EnsureBuffer(content.Length))
+            {
+                return false;
+            }
+
+            Buffer.BlockCopy(content, 0, transfer.Buffer, 0, content.Length);
+            transfer.BufferLength = content.Length;
+            transfer.TotalSize = (uint)content.Length;
+
+            _pendingUploads[fileName] = _pendingUploads.TryGetValue(fileName, out int pending) ? pending + 1 : 1;
+
+            transfer.Finished = t =>
+            {
+                bool lastPendingUpload = RemovePendingUpload(t.FileName);
+
+                if (t.State == EOSTransferState.Completed)
+                {
+                    contentCache.Store(t.FileName, t.Buffer ?? Array.Empty<byte>(), t.BufferLength, null);
+
+                    if (lastPendingUpload)
                     {
-                        Debug.LogErrorFormat("[EOS SDK] Player data storage: can't start file download, bad handle returned for filename '{0}'", fileName);
-                        return;
+                        QueryUploadedVersion(localUserId, t.FileName, contentHash);
                     }
+                }
+                else if (lastPendingUpload)
+                {
+                    // The backend may or may not have the content that was
+                    // being sent
+                    contentCache.Remove(t.FileName);
+                }
+            };
 
-                    CancelCurrentTransfer();
-                    CurrentTransferHandle = req;
+            return !QueueTransfer(transfer).IsFinished;
+        }
 
-                    EOSTransferInProgress newTransfer = new EOSTransferInProgress()
-                    {
-                        Download = true,
-                        Data = new byte[(uint)fileMetadata?.FileSizeBytes],
-                    };
+        /// <returns>True if no other upload of the file is pending.</returns>
+        private bool RemovePendingUpload(string fileName)
+        {
+            if (!_pendingUploads.TryGetValue(fileName, out int pending) || pending <= 1)
+            {
+                _pendingUploads.Remove(fileName);
+                return true;
+            }
 
-                    _transfersInProgress[fileName] = newTransfer;
+            _pendingUploads[fileName] = pending - 1;
+            return false;
+        }
 
-                    CurrentTransferName = fileName;
+        /// <summary>
+        /// Queries the hash the backend reports for an uploaded file, and
+        /// records it as the version of the cached content, so the next
+        /// file list can tell whether the file has changed since.
+        /// </summary>
+        private void QueryUploadedVersion(ProductUserId localUserId, string fileName, string contentHash)
+        {
+            var queryFileOptions = new QueryFileOptions { Filename = fileName, LocalUserId = localUserId };
+            EOSManager.Instance.GetPlayerDataStorageInterface().QueryFile(ref queryFileOptions, null, (ref QueryFileCallbackInfo data) =>
+            {
+                if (data.ResultCode != Result.Success)
+                {
+                    Debug.LogWarningFormat("[EOS SDK] Player data storage: unable to query file info of uploaded file '{0}': {1}", fileName, data.ResultCode);
+                    return;
                 }
-                else
+
+                var copyFileMetadataOptions = new CopyFileMetadataByFilenameOptions { Filename = fileName, LocalUserId = localUserId };
+                if (EOSManager.Instance.GetPlayerDataStorageInterface().CopyFileMetadataByFilename(ref copyFileMetadataOptions, out FileMetadata? fileMetadata) != Result.Success || fileMetadata == null)
                 {
-                    Debug.LogErrorFormat("[EOS SDK] Player data storage: can't start file download, unable to query file info {0}", fileName);
+                    return;
                 }
+
+                _remoteFiles[fileName] = fileMetadata.Value;
+
+                // Another upload started since, so the backend may have
+                // other content by now
+                if (_pendingUploads.ContainsKey(fileName))
+                {
+                    return;
+                }
+
+                GetContentCache(localUserId).SetVersion(fileName, contentHash, fileMetadata.Value.MD5Hash);
             });
         }
 
         //-------------------------------------------------------------------------
-        /// <summary>(async) Begin file data upload.</summary>
+        /// <summary>(async) Begin file data upload, reading one chunk at a time from a stream.</summary>
         /// <param name="fileName">Name of file.</param>
-        /// <returns>True if upload started</returns>
-        public bool StartFileDataUpload(string fileName, Action fileCreatedCallback = null)
+        /// <param name="source">Stream the file content is read from, from its current position.</param>
+        /// <param name="ownsStream">Whether the stream is disposed of when the upload finishes.</param>
+        /// <param name="fileCreatedCallback">Function called when file creation and upload is completed.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress UploadFileFromStream(string fileName, Stream source, bool ownsStream = false, Action fileCreatedCallback = null)
         {
             ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
             if (localUserId == null || !localUserId.IsValid())
             {
-                return false;
+                return null;
             }
 
-            string fileData = null;
-            if (_locallyCachedData.TryGetValue(fileName, out string entry))
-            {
-                fileData = entry;
-            }
+            return QueueTransfer(fileName, false, source, ownsStream, t => StartWriteFile(localUserId, t, fileCreatedCallback));
+        }
 
+        private PlayerDataStorageFileTransferRequestWrapper StartWriteFile(ProductUserId localUserId, EOSTransferInProgress transfer, Action fileCreatedCallback)
+        {
             WriteFileOptions options = new WriteFileOptions()
             {
                 LocalUserId = localUserId,
-                Filename = fileName,
-                ChunkLengthBytes = MAX_CHUNK_SIZE,
+                Filename = transfer.FileName,
+                ChunkLengthBytes = transfer.ChunkSize,
                 WriteFileDataCallback = OnFileDataSend,
                 FileTransferProgressCallback = OnFileTransferProgressUpdated
             };
@@ -169,30 +353,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             PlayerDataStorageFileTransferRequest req = EOSManager.Instance.GetPlayerDataStorageInterface().WriteFile(ref options, fileCreatedCallback, OnFileSent);
             if (req == null)
             {
-                Debug.LogErrorFormat("[EOS SDK] Player data storage: can't start file download, bad handle returned for filename '{0}'", fileName);
-                return false;
-            }
-
-            CancelCurrentTransfer();
-            CurrentTransferHandle = req;
-
-            EOSTransferInProgress newTransfer = new()
-            {
-                Download = false
-            };
-
-            if (null != fileData)
-            {
-                newTransfer.Data = System.Text.Encoding.UTF8.GetBytes(fileData);
+                Debug.LogErrorFormat("[EOS SDK] Player data storage: can't start file upload, bad handle returned for filename '{0}'", transfer.FileName);
+                return null;
             }
-            
-            newTransfer.CurrentIndex = 0;
 
-            _transfersInProgress[fileName] = newTransfer;
-            
-            CurrentTransferName = fileName;
-
-            return true;
+            return req;
         }
 
         //-------------------------------------------------------------------------
@@ -273,6 +438,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
 
             EraseLocalData(fileName);
+            _remoteFiles.Remove(fileName);
+            GetContentCache(localUserId).Remove(fileName);
 
             DeleteFileOptions options = new DeleteFileOptions()
             {
@@ -299,72 +466,87 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             return _locallyCachedData.Remove(entryName);
         }
 
-        //-------------------------------------------------------------------------
-        private WriteResult SendData(string fileName, out ArraySegment<byte> data)
+        private StorageContentCache GetContentCache(ProductUserId localUserId)
         {
-            data = new ArraySegment<byte>();
-
-            if (_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer))
+            if (_contentCache == null || !localUserId.Equals(_contentCacheUserId))
             {
-                if (transfer.Download)
-                {
-                    Debug.LogError("[EOS SDK] Player data storage: can't send file data: download/upload mismatch.");
-                    return WriteResult.FailRequest;
-                }
+                _contentCache = new StorageContentCache(StorageContentCache.GetDefaultDirectory("PlayerDataStorage", localUserId.ToString()));
+                _contentCacheUserId = localUserId;
+            }
 
-                if (transfer.IsDone())
-                {
-                    return WriteResult.CompleteRequest;
-                }
+            return _contentCache;
+        }
 
-                uint bytesToWrite = Math.Min(MAX_CHUNK_SIZE, transfer.TotalSize - transfer.CurrentIndex);
+        /// <summary>
+        /// Loads a file into the local cache of data from the content cache,
+        /// if the cached copy is the version the backend has.
+        /// </summary>
+        private bool TryLoadFromContentCache(ProductUserId localUserId, string fileName, out EOSTransferInProgress transfer)
+        {
+            transfer = null;
 
-                if (bytesToWrite > 0)
-                {
-                    data = new ArraySegment<byte>(transfer.Data, (int)transfer.CurrentIndex, (int)bytesToWrite);
-                }
+            if (!_remoteFiles.TryGetValue(fileName, out FileMetadata remoteFile) ||
+                !GetContentCache(localUserId).TryRead(fileName, remoteFile.MD5Hash, out byte[] content))
+            {
+                return false;
+            }
 
-                transfer.CurrentIndex += bytesToWrite;
+            _locallyCachedData[fileName] = System.Text.Encoding.UTF8.GetString(content);
 
-                if (transfer.IsDone())
-                {
-                    return WriteResult.CompleteRequest;
-                }
-                else
-                {
-                    return WriteResult.ContinueWriting;
-                }
-            }
-            else
+            // Report the file as downloaded, for callers waiting on the transfer
+            transfer = CreateCompletedDownload(fileName, (uint)content.Length);
+
+            return true;
+        }
+
+        protected override void OnCachedDownloadCompleted(EOSTransferInProgress transfer)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
             {
-                Debug.LogError("[EOS SDK] Player data storage: could not send data as this file is not being uploaded at the moment.");
-                return WriteResult.CancelRequest;
+                return;
             }
+
+            string remoteHash = _remoteFiles.TryGetValue(transfer.FileName, out FileMetadata remoteFile) ? (string)remoteFile.MD5Hash : null;
+            GetContentCache(localUserId).Store(transfer.FileName, transfer.Buffer ?? Array.Empty<byte>(), transfer.BufferLength, remoteHash);
         }
-        
-        private void FinishFileUpload(string fileName, Action fileUploadCallback = null)
+
+        /// <summary>
+        /// Brings the files that have been cached locally up to date with the
+        /// file list: unchanged files are loaded from the content cache,
+        /// files that changed on the backend are downloaded again, and files
+        /// that were deleted are forgotten. Files that were never downloaded
+        /// are left to be downloaded on demand.
+        /// </summary>
+        private void SyncContentCache(ProductUserId localUserId)
         {
-            if (_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer))
+            StorageContentCache contentCache = GetContentCache(localUserId);
+
+            foreach (string fileName in contentCache.FileNames)
             {
-                if (transfer.Download)
+                if (!_remoteFiles.TryGetValue(fileName, out FileMetadata remoteFile))
                 {
-                    Debug.LogError("[EOS SDK] Player data storage: error while file write operation: can't finish because of download/upload mismatch.");
-                    return;
+                    contentCache.Remove(fileName);
+                    continue;
                 }
 
-                if (!transfer.IsDone())
+                // Uploads in progress set the version once they're done
+                if (_pendingUploads.ContainsKey(fileName))
                 {
-                    Debug.LogError("[EOS SDK] Player data storage: error while file write operation: unexpected end of transfer.");
+                    continue;
                 }
 
-                _transfersInProgress.Remove(fileName);
+                contentCache.TryGetVersion(fileName, out string cachedVersion);
 
-                if (fileName.Equals(CurrentTransferName, StringComparison.OrdinalIgnoreCase))
+                if (!StorageContentCache.HashesMatch(cachedVersion, remoteFile.MD5Hash))
                 {
-                    ClearCurrentTransfer();
+                    Debug.LogFormat("[EOS SDK] Player data storage: '{0}' changed on the backend, downloading it", fileName);
+                    DownloadFile(fileName);
+                }
+                else if (GetCachedFileContent(fileName) == null)
+                {
+                    TryLoadFromContentCache(localUserId, fileName, out _);
                 }
-
-                fileUploadCallback?.Invoke();
             }
         }
 
@@ -407,6 +589,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             PlayerDataStorageInterface playerStorageHandle = EOSManager.Instance.GetPlayerDataStorageInterface();
             List<string> fileNames = new List<string>();
+            _remoteFiles.Clear();
 
             for (uint fileIndex = 0; fileIndex < data.FileCount; fileIndex++)
             {
@@ -428,11 +611,13 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     if (!string.IsNullOrEmpty(fileMetadata?.Filename))
                     {
                         fileNames.Add(fileMetadata?.Filename);
+                        _remoteFiles[fileMetadata?.Filename] = fileMetadata.Value;
                     }
                 }
             }
 
             SetFileList(fileNames);
+            SyncContentCache(localUserId);
             OnFileListUpdated?.Invoke();
         }
 
@@ -451,7 +636,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         //-------------------------------------------------------------------------
         private void OnFileReceived(ref ReadFileCallbackInfo data)
         {
-            FinishFileDownload(data.Filename, data.ResultCode);
+            FinishTransfer(data.Filename, data.ResultCode);
 
             var callback = data.ClientData as Action;
             callback?.Invoke();
@@ -459,18 +644,14 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         private WriteResult OnFileDataSend(ref WriteFileDataCallbackInfo data, out ArraySegment<byte> outDataBuffer)
         {
-            WriteResult result = SendData(data.Filename, out ArraySegment<byte> dataBuffer);
-
-            if (dataBuffer != null)
+            return SendData(data.Filename, out outDataBuffer) switch
             {
-                outDataBuffer = dataBuffer;
-            }
-            else
-            {
-                outDataBuffer = new ArraySegment<byte>();
-            }
-
-            return result;
+                FileTransferResult.FailRequest => WriteResult.FailRequest,
+                FileTransferResult.CancelRequest => WriteResult.CancelRequest,
+                FileTransferResult.ContinueReading => WriteResult.ContinueWriting,
+                FileTransferResult.CompleteRequest => WriteResult.CompleteRequest,
+                _ => throw new ArgumentOutOfRangeException()
+            };
         }
 
         private void OnFileSent(ref WriteFileCallbackInfo data)
@@ -480,19 +661,16 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             if (data.ResultCode != Result.Success)
             {
                 Debug.LogErrorFormat("[EOS SDK] Player data storage: could not upload file: {0}", data.ResultCode);
-                FinishFileUpload(data.Filename, callback);
-                return;
             }
 
-            FinishFileUpload(data.Filename, callback);
+            FinishTransfer(data.Filename, data.ResultCode);
+
+            callback?.Invoke();
         }
 
         private void OnFileTransferProgressUpdated(ref FileTransferProgressCallbackInfo data)
         {
-            if (data.TotalFileSizeBytes > 0)
-            {
-                Debug.LogFormat("[EOS SDK] Player data storage: transfer progress {0} / {1}", data.BytesTransferred, data.TotalFileSizeBytes);
-            }
+            UpdateTransferProgress(data.Filename, data.BytesTransferred, data.TotalFileSizeBytes);
         }
 
         private void OnFileCopied(ref DuplicateFileCallbackInfo data)
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Globalization;
+    using System.IO;
+    using System.Text;
+
+    /// <summary>
+    /// Small append-only file recording stat ingestion that has been queued
+    /// by the StatsService but not yet sent, so that it survives a crash or
+    /// the application closing before the next flush.
+    ///
+    /// Each line holds one queued ingestion as the stat name, the amount and
+    /// how the stat is aggregated, separated by tabs. Lines written before
+    /// the aggregation was recorded have no third field. A line cut short by
+    /// a crash is ignored when the journal is read back.
+    /// </summary>
+    public class StatsIngestJournal
+    {
+        /// <summary>
+        /// One queued ingestion read back from the journal.
+        /// </summary>
+        public readonly struct Entry
+        {
+            public readonly string StatName;
+            public readonly int IngestAmount;
+
+            /// <summary>
+            /// How the stat was merged when it was queued, or null if the
+            /// journal didn't record it.
+            /// </summary>
+            public readonly StatIngestAggregation? Aggregation;
+
+            public Entry(string statName, int ingestAmount, StatIngestAggregation? aggregation)
+            {
+                StatName = statName;
+                IngestAmount = ingestAmount;
+                Aggregation = aggregation;
+            }
+        }
+
+        private readonly string _path;
+
+        public StatsIngestJournal(string path)
+        {
+            _path = path;
+        }
+
+        /// <summary>
+        /// The file the journal is kept in.
+        /// </summary>
+        public string Path
+        {
+            get
+            {
+                return _path;
+            }
+        }
+
+        /// <summary>
+        /// Records a single queued ingestion.
+        /// </summary>
+        public void Append(string statName, int ingestAmount, StatIngestAggregation aggregation)
+        {
+            try
+            {
+                File.AppendAllText(_path, FormatLine(statName, ingestAmount, aggregation));
+            }
+            catch (Exception e)
+            {
+                UnityEngine.Debug.LogWarning($"Could not append to stats journal \"{_path}\": {e.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Replaces the contents of the journal with the given pending
+        /// ingestion, or deletes it if there is none.
+        /// </summary>
+        public void Rewrite(IEnumerable<Entry> pending)
+        {
+            StringBuilder contents = new();
+            foreach (Entry entry in pending)
+            {
+                contents.Append(FormatLine(entry.StatName, entry.IngestAmount, entry.Aggregation ?? StatIngestAggregation.Sum));
+            }
+
+            try
+            {
+                if (contents.Length == 0)
+                {
+                    File.Delete(_path);
+                    return;
+                }
+
+                string tempPath = _path + ".tmp";
+                File.WriteAllText(tempPath, contents.ToString());
+
+                if (File.Exists(_path))
+                {
+                    File.Delete(_path);
+                }
+                File.Move(tempPath, _path);
+            }
+            catch (Exception e)
+            {
+                UnityEngine.Debug.LogWarning($"Could not rewrite stats journal \"{_path}\": {e.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Reads back every ingestion recorded in the journal, in the order
+        /// it was queued.
+        /// </summary>
+        public List<Entry> Read()
+        {
+            List<Entry> entries = new();
+
+            if (!File.Exists(_path))
+            {
+                return entries;
+            }
+
+            try
+            {
+                string[] lines = File.ReadAllText(_path).Split('\n');
+
+                // The last element is either empty or a line that was never
+                // terminated, and so may have been cut short
+                for (int i = 0; i < lines.Length - 1; ++i)
+                {
+                    string line = lines[i];
+                    int separator = line.LastIndexOf('\t');
+                    if (separator <= 0)
+                    {
+                        continue;
+                    }
+
+                    StatIngestAggregation? aggregation = null;
+                    string field = line.Substring(separator + 1);
+                    if (!int.TryParse(field, NumberStyles.Integer, CultureInfo.InvariantCulture, out _))
+                    {
+                        if (!Enum.TryParse(field, out StatIngestAggregation parsed) || !Enum.IsDefined(typeof(StatIngestAggregation), parsed))
+                        {
+                            continue;
+                        }
+
+                        aggregation = parsed;
+                        line = line.Substring(0, separator);
+                        separator = line.LastIndexOf('\t');
+                    }
+
+                    if (separator <= 0 ||
+                        !int.TryParse(line.Substring(separator + 1), NumberStyles.Integer, CultureInfo.InvariantCulture, out int amount))
+                    {
+                        continue;
+                    }
+
+                    entries.Add(new Entry(line.Substring(0, separator), amount, aggregation));
+                }
+            }
+            catch (Exception e)
+            {
+                UnityEngine.Debug.LogWarning($"Could not read stats journal \"{_path}\": {e.Message}");
+            }
+
+            return entries;
+        }
+
+        private static string FormatLine(string statName, int ingestAmount, StatIngestAggregation aggregation)
+        {
+            return statName + "\t" + ingestAmount.ToString(CultureInfo.InvariantCulture) + "\t" + aggregation + "\n";
+        }
+    }
+}
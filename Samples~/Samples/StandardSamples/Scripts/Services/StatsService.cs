@@ -28,6 +28,7 @@ namespace PlayEveryWare.EpicOnlineServices
     using System;
     using System.Collections.Generic;
     using System.Diagnostics;
+    using System.IO;
 
     using Epic.OnlineServices;
     using Epic.OnlineServices.Stats;
@@ -36,6 +37,20 @@ namespace PlayEveryWare.EpicOnlineServices
     using System.Collections.Concurrent;
     using System.Threading.Tasks;
 
+    /// <summary>
+    /// How queued ingestion of a stat is merged locally before it is sent.
+    /// This should match the aggregation type of the stat in the developer
+    /// portal, so that one merged ingestion has the same effect as the
+    /// separate ingestions would have had.
+    /// </summary>
+    public enum StatIngestAggregation
+    {
+        Sum,
+        Max,
+        Min,
+        Latest
+    }
+
     public class StatsService : EOSService
     {
         #region Singleton Implementation
@@ -75,11 +90,65 @@ namespace PlayEveryWare.EpicOnlineServices
         /// </summary>
         private readonly ConcurrentDictionary<ProductUserId, List<Stat>> _playerStats = new();
 
+        /// <summary>
+        /// Number of seconds queued stat ingestion is held before it is sent.
+        /// </summary>
+        public float IngestFlushIntervalSeconds { get; set; } = 10.0f;
+
+        /// <summary>
+        /// Longest delay before queued stat ingestion is sent again, after
+        /// sending it kept failing with errors that may go away, such as
+        /// throttling or a lost connection. The delay doubles from
+        /// IngestFlushIntervalSeconds with every failed flush.
+        /// </summary>
+        public float MaxIngestRetryDelaySeconds { get; set; } = 300.0f;
+
+        /// <summary>
+        /// Ingestion queued with QueueIngestStat, merged per stat name, that
+        /// has not been sent yet.
+        /// </summary>
+        private Dictionary<string, int> _pendingIngest = new();
+
+        /// <summary>
+        /// How queued ingestion is merged for each stat. Stats not in here
+        /// are summed.
+        /// </summary>
+        private readonly Dictionary<string, StatIngestAggregation> _ingestAggregation = new();
+
+        /// <summary>
+        /// Journal of the pending ingestion, for the user that last logged
+        /// in. It is loaded once per user, and kept while they are logged
+        /// out so that logging in again doesn't read it back twice.
+        /// </summary>
+        private StatsIngestJournal _ingestJournal;
+        private ProductUserId _ingestJournalUserId;
+
+        private readonly object _ingestLock = new();
+        private bool _ingestFlushScheduled;
+
+        /// <summary>
+        /// The flush being sent, if any.
+        /// </summary>
+        private IngestFlush _ingestFlush;
+
+        /// <summary>
+        /// Number of flushes in a row that failed with a retryable error.
+        /// </summary>
+        private int _ingestRetryCount;
+
         protected override void Reset()
         {
             // Clear any player stats that may have been locally cached.
             _playerStats.Clear();
 
+            // Pending ingestion stays queued, and in the journal, until the
+            // same user logs in again. It is only put aside once another
+            // user logs in.
+            lock (_ingestLock)
+            {
+                _ingestRetryCount = 0;
+            }
+
             // Call the base implementation.
             base.Reset();
         }
@@ -98,6 +167,8 @@ namespace PlayEveryWare.EpicOnlineServices
         {
             if (TryGetProductUserId(out ProductUserId userId))
             {
+                RestoreIngestJournal(userId);
+
                 await RefreshPlayerStatsAsync(userId);
             }
         }
@@ -182,6 +253,458 @@ namespace PlayEveryWare.EpicOnlineServices
             return taskCompletionSource.Task;
         }
 
+        /// <summary>
+        /// Sets how queued ingestion of the given stat is merged before it is
+        /// sent. By default, queued ingestion is summed.
+        /// </summary>
+        /// <param name="statName">The stat name.</param>
+        /// <param name="aggregation">
+        /// The aggregation type of the stat in the developer portal.
+        /// </param>
+        public void SetIngestAggregation(string statName, StatIngestAggregation aggregation)
+        {
+            lock (_ingestLock)
+            {
+                _ingestAggregation[statName] = aggregation;
+            }
+        }
+
+        /// <summary>
+        /// Queues ingestion of a stat for the current player. Queued ingestion
+        /// is merged per stat name and sent as a single IngestStat call every
+        /// IngestFlushIntervalSeconds, or when FlushIngestQueueAsync is
+        /// called. Use this for stats updated often during gameplay, where
+        /// IngestStatAsync would quickly run into throttling.
+        /// </summary>
+        /// <param name="statName">The stat name.</param>
+        /// <param name="ingestAmount">
+        /// The amount to "ingest" for the stat.
+        /// </param>
+        public void QueueIngestStat(string statName, int ingestAmount)
+        {
+            if (!TryGetProductUserId(out ProductUserId userId))
+            {
+                return;
+            }
+
+            lock (_ingestLock)
+            {
+                LoadIngestJournal(userId);
+
+                MergeIngest(_pendingIngest, statName, ingestAmount);
+                _ingestJournal.Append(statName, ingestAmount, GetIngestAggregation(statName));
+            }
+
+            ScheduleIngestFlush();
+        }
+
+        /// <summary>
+        /// Sends all queued stat ingestion now, for instance at the end of a
+        /// match or session. Ingestion that fails to send with an error that
+        /// may go away stays queued, and is sent again after a delay that
+        /// grows with every failure. Ingestion the backend rejects is dropped.
+        /// </summary>
+        /// <returns>
+        /// A task so that this function can be awaitable.
+        /// </returns>
+        public async Task FlushIngestQueueAsync()
+        {
+            if (!TryGetProductUserId(out ProductUserId userId))
+            {
+                return;
+            }
+
+            IngestFlush flush;
+            lock (_ingestLock)
+            {
+                if (_ingestFlush != null || _pendingIngest.Count == 0 || !IsCurrentIngestJournal(userId))
+                {
+                    return;
+                }
+
+                flush = new IngestFlush(userId, _ingestJournal, _pendingIngest);
+                _ingestFlush = flush;
+                _pendingIngest = new Dictionary<string, int>();
+            }
+
+            List<KeyValuePair<string, int>> entries = new(flush.Unsent);
+            List<IngestData> batch = new(Math.Min(entries.Count, StatsInterface.MAX_INGEST_STATS));
+            Result result = Result.Success;
+
+            try
+            {
+                for (int i = 0; i < entries.Count && !IsRetryableIngestResult(result); ++i)
+                {
+                    batch.Add(new IngestData() { StatName = entries[i].Key, IngestAmount = entries[i].Value });
+
+                    if (batch.Count == StatsInterface.MAX_INGEST_STATS || i == entries.Count - 1)
+                    {
+                        result = await SendIngestAsync(flush, batch);
+                        batch.Clear();
+                    }
+                }
+            }
+            finally
+            {
+                bool retry = IsRetryableIngestResult(result);
+                bool flushAgain;
+
+                lock (_ingestLock)
+                {
+                    _ingestFlush = null;
+
+                    // If another user has logged in since, what's left
+                    // unsent stays in the journal of the flush until its
+                    // user logs in again.
+                    if (IsCurrentIngestJournal(flush.Journal))
+                    {
+                        // Unsent ingestion was queued before anything that
+                        // is pending now.
+                        foreach (var entry in flush.Unsent)
+                        {
+                            MergeIngest(_pendingIngest, entry.Key, entry.Value, true);
+                        }
+
+                        _ingestRetryCount = retry ? _ingestRetryCount + 1 : 0;
+                    }
+
+                    flushAgain = _pendingIngest.Count > 0;
+                }
+
+                if (retry)
+                {
+                    UnityEngine.Debug.LogWarning($"Could not ingest {flush.Unsent.Count} queued stats, they will be retried. Result code: {result}");
+                }
+
+                if (flushAgain)
+                {
+                    ScheduleIngestFlush();
+                }
+            }
+
+            if (flush.AnySucceeded)
+            {
+                _ = AchievementsService.Instance.RefreshAsync();
+            }
+        }
+
+        /// <summary>
+        /// Ingestion being sent by one flush, for the user it was queued for.
+        /// </summary>
+        private class IngestFlush
+        {
+            public readonly ProductUserId UserId;
+            public readonly StatsIngestJournal Journal;
+
+            /// <summary>
+            /// Ingestion of the flush that hasn't been acknowledged or
+            /// dropped yet.
+            /// </summary>
+            public readonly Dictionary<string, int> Unsent;
+
+            /// <summary>
+            /// Ingestion queued for the same user after the flush started,
+            /// that was put aside when another user logged in. It is kept
+            /// in the journal along with what is left unsent.
+            /// </summary>
+            public readonly Dictionary<string, int> QueuedSince = new();
+
+            public bool AnySucceeded;
+
+            public IngestFlush(ProductUserId userId, StatsIngestJournal journal, Dictionary<string, int> unsent)
+            {
+                UserId = userId;
+                Journal = journal;
+                Unsent = unsent;
+            }
+        }
+
+        /// <summary>
+        /// Sends a batch of stats. If the backend rejects the batch, each of
+        /// its stats is sent on its own so that only the stats at fault are
+        /// dropped.
+        /// </summary>
+        /// <returns>
+        /// The result of the last call, which is retryable if sending should
+        /// stop for now.
+        /// </returns>
+        private async Task<Result> SendIngestAsync(IngestFlush flush, List<IngestData> batch)
+        {
+            Result result = await SendIngestBatchAsync(flush, batch.ToArray());
+            if (result == Result.Success || IsRetryableIngestResult(result))
+            {
+                return result;
+            }
+
+            if (batch.Count == 1)
+            {
+                UnityEngine.Debug.LogError($"Dropping queued ingestion of stat \"{batch[0].StatName}\", which was rejected. Result code: {result}");
+
+                lock (_ingestLock)
+                {
+                    flush.Unsent.Remove(batch[0].StatName);
+                    PersistIngestJournal(flush);
+                }
+
+                return result;
+            }
+
+            foreach (IngestData stat in batch)
+            {
+                result = await SendIngestAsync(flush, new List<IngestData>() { stat });
+                if (IsRetryableIngestResult(result))
+                {
+                    break;
+                }
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Sends one IngestStat call for the given batch of stats. Once it
+        /// has been acknowledged, the stats are removed from the unsent
+        /// ingestion of the flush and from the journal, before the next batch
+        /// is sent.
+        /// </summary>
+        private Task<Result> SendIngestBatchAsync(IngestFlush flush, IngestData[] stats)
+        {
+            IngestStatOptions ingestOptions = new()
+            {
+                LocalUserId = flush.UserId,
+                TargetUserId = flush.UserId,
+                Stats = stats
+            };
+
+            TaskCompletionSource<Result> taskCompletionSource = new();
+
+            GetEOSStatsInterface().IngestStat(ref ingestOptions, null, (ref IngestStatCompleteCallbackInfo data) =>
+            {
+                if (data.ResultCode == Result.Success)
+                {
+                    Log($"Ingested {stats.Length} queued stats.");
+
+                    lock (_ingestLock)
+                    {
+                        foreach (IngestData stat in stats)
+                        {
+                            flush.Unsent.Remove(stat.StatName);
+                        }
+
+                        flush.AnySucceeded = true;
+                        PersistIngestJournal(flush);
+                    }
+                }
+
+                taskCompletionSource.SetResult(data.ResultCode);
+            });
+
+            return taskCompletionSource.Task;
+        }
+
+        /// <summary>
+        /// Whether ingestion that failed with the given result may succeed
+        /// if it is sent again later. Other failures mean the backend
+        /// rejected the ingestion itself.
+        /// </summary>
+        private static bool IsRetryableIngestResult(Result result)
+        {
+            return result is not (Result.Success or Result.InvalidParameters or Result.InvalidRequest or Result.NotFound);
+        }
+
+        /// <summary>
+        /// Rewrites the journal of a flush with what is still to be sent for
+        /// its user: the unsent ingestion of the flush, and what has been
+        /// queued since if the user is still logged in. Must be called with
+        /// the ingest lock held.
+        /// </summary>
+        private void PersistIngestJournal(IngestFlush flush)
+        {
+            if (flush.Journal == null)
+            {
+                return;
+            }
+
+            Dictionary<string, int> queuedSince = IsCurrentIngestJournal(flush.Journal) ? _pendingIngest : flush.QueuedSince;
+
+            Dictionary<string, int> remaining = new(flush.Unsent);
+            foreach (var entry in queuedSince)
+            {
+                MergeIngest(remaining, entry.Key, entry.Value);
+            }
+
+            List<StatsIngestJournal.Entry> entries = new(remaining.Count);
+            foreach (var entry in remaining)
+            {
+                entries.Add(new StatsIngestJournal.Entry(entry.Key, entry.Value, GetIngestAggregation(entry.Key)));
+            }
+
+            flush.Journal.Rewrite(entries);
+        }
+
+        /// <summary>
+        /// Whether the given journal is the one of the user that last logged
+        /// in. Journals are compared by file, since there is one per user.
+        /// Must be called with the ingest lock held.
+        /// </summary>
+        private bool IsCurrentIngestJournal(StatsIngestJournal journal)
+        {
+            return journal != null && _ingestJournal != null && journal.Path == _ingestJournal.Path;
+        }
+
+        /// <summary>
+        /// Whether the loaded journal is the one of the given user. Must be
+        /// called with the ingest lock held.
+        /// </summary>
+        private bool IsCurrentIngestJournal(ProductUserId userId)
+        {
+            return _ingestJournal != null && _ingestJournalUserId == userId;
+        }
+
+        /// <summary>
+        /// Starts a delayed flush of queued ingestion, unless one is already
+        /// scheduled. The delay doubles with every flush in a row that has
+        /// failed, up to MaxIngestRetryDelaySeconds.
+        /// </summary>
+        private async void ScheduleIngestFlush()
+        {
+            float delaySeconds;
+            lock (_ingestLock)
+            {
+                if (_ingestFlushScheduled)
+                {
+                    return;
+                }
+
+                _ingestFlushScheduled = true;
+
+                delaySeconds = IngestFlushIntervalSeconds;
+                if (_ingestRetryCount > 0)
+                {
+                    delaySeconds = Math.Max(delaySeconds, Math.Min(delaySeconds * (1 << Math.Min(_ingestRetryCount, 16)), MaxIngestRetryDelaySeconds));
+                }
+            }
+
+            await Task.Delay(TimeSpan.FromSeconds(delaySeconds));
+
+            lock (_ingestLock)
+            {
+                _ingestFlushScheduled = false;
+            }
+
+            await FlushIngestQueueAsync();
+        }
+
+        /// <summary>
+        /// Merges an ingestion amount into the given pending ingestion,
+        /// according to the aggregation type of the stat.
+        /// </summary>
+        /// <param name="isOlder">
+        /// Whether the amount was queued before the pending amount it is
+        /// merged with.
+        /// </param>
+        private void MergeIngest(Dictionary<string, int> pending, string statName, int ingestAmount, bool isOlder = false)
+        {
+            if (!pending.TryGetValue(statName, out int pendingAmount))
+            {
+                pending[statName] = ingestAmount;
+                return;
+            }
+
+            pending[statName] = GetIngestAggregation(statName) switch
+            {
+                StatIngestAggregation.Max => Math.Max(pendingAmount, ingestAmount),
+                StatIngestAggregation.Min => Math.Min(pendingAmount, ingestAmount),
+                StatIngestAggregation.Latest => isOlder ? pendingAmount : ingestAmount,
+                _ => pendingAmount + ingestAmount
+            };
+        }
+
+        private StatIngestAggregation GetIngestAggregation(string statName)
+        {
+            return _ingestAggregation.TryGetValue(statName, out StatIngestAggregation aggregation) ? aggregation : StatIngestAggregation.Sum;
+        }
+
+        /// <summary>
+        /// Loads the journal of the given user, and schedules what is queued
+        /// in it to be sent. Logging in again as the same user, including
+        /// the Connect login that follows an expired authentication, keeps
+        /// the journal and ingestion that are already loaded.
+        /// </summary>
+        private void RestoreIngestJournal(ProductUserId userId)
+        {
+            bool pending;
+            lock (_ingestLock)
+            {
+                int restored = LoadIngestJournal(userId);
+                if (restored > 0)
+                {
+                    Log($"Restored {restored} queued stat ingestions from the journal.");
+                }
+
+                pending = _pendingIngest.Count > 0;
+            }
+
+            if (pending)
+            {
+                ScheduleIngestFlush();
+            }
+        }
+
+        /// <summary>
+        /// Makes the journal of the given user the current one, reading back
+        /// the ingestion left in it by a previous session, unless it is
+        /// already loaded. Stats whose aggregation hasn't been set take the
+        /// aggregation recorded in the journal. Must be called with the
+        /// ingest lock held.
+        /// </summary>
+        /// <returns>The number of ingestions read back.</returns>
+        private int LoadIngestJournal(ProductUserId userId)
+        {
+            if (IsCurrentIngestJournal(userId))
+            {
+                return 0;
+            }
+
+            if (_ingestJournal != null)
+            {
+                // What the previous user queued is already in their journal,
+                // except for what a flush in progress would rewrite it without.
+                if (IsCurrentIngestJournal(_ingestFlush?.Journal))
+                {
+                    foreach (var entry in _pendingIngest)
+                    {
+                        MergeIngest(_ingestFlush.QueuedSince, entry.Key, entry.Value);
+                    }
+                }
+
+                _pendingIngest = new Dictionary<string, int>();
+                _ingestRetryCount = 0;
+            }
+
+            _ingestJournal = new StatsIngestJournal(GetIngestJournalPath(userId));
+            _ingestJournalUserId = userId;
+
+            List<StatsIngestJournal.Entry> entries = _ingestJournal.Read();
+            foreach (StatsIngestJournal.Entry entry in entries)
+            {
+                if (entry.Aggregation.HasValue && !_ingestAggregation.ContainsKey(entry.StatName))
+                {
+                    _ingestAggregation[entry.StatName] = entry.Aggregation.Value;
+                }
+
+                MergeIngest(_pendingIngest, entry.StatName, entry.IngestAmount);
+            }
+
+            return entries.Count;
+        }
+
+        private static string GetIngestJournalPath(ProductUserId userId)
+        {
+            userId.ToString(out Utf8String userIdString);
+            return Path.Combine(UnityEngine.Application.persistentDataPath, $"stats_ingest_{userIdString}.journal");
+        }
+
         /// <summary>
         /// Queries from the server the stats pertaining to the user associated
         /// to the given ProductUserId.
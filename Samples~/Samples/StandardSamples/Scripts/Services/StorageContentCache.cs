@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.IO;
+    using System.Security.Cryptography;
+    using System.Text;
+
+    using UnityEngine;
+
+    /// <summary>
+    /// Local copy of player or title storage files, so unchanged files do
+    /// not have to be downloaded again.
+    ///
+    /// Each file is cached along with the MD5 hash the EOS backend reports
+    /// for it. That hash covers the file as stored by the backend, including
+    /// a header the SDK adds, so it never matches a hash of the content
+    /// itself; it is only compared with later hashes from the backend, as a
+    /// version tag. The integrity of the cached content is checked with a
+    /// separate hash of the content, which also names the file the content
+    /// is stored in.
+    /// </summary>
+    public class StorageContentCache
+    {
+        private const uint FileMagic = 0x48434353; // "SCCH"
+        public const ushort FormatVersion = 2;
+        private const string IndexFileName = "index";
+
+        private class Entry
+        {
+            /// <summary>
+            /// Hash reported by the backend for the cached content, or null
+            /// if it isn't known yet.
+            /// </summary>
+            public string Version;
+
+            /// <summary>
+            /// Hash of the cached content, from <see cref="ComputeHash"/>.
+            /// </summary>
+            public string ContentHash;
+
+            public long Length;
+        }
+
+        private readonly string _directory;
+        private readonly Dictionary<string, Entry> _entries = new(StringComparer.OrdinalIgnoreCase);
+        private bool _loaded;
+
+        public StorageContentCache(string directory)
+        {
+            _directory = directory;
+        }
+
+        /// <summary>
+        /// Gets the default cache directory of a storage interface, under the
+        /// EOS cache directory.
+        /// </summary>
+        /// <param name="storageName">Name of the storage interface.</param>
+        /// <param name="scope">
+        /// Optional subdirectory, such as the user the files belong to.
+        /// </param>
+        public static string GetDefaultDirectory(string storageName, string scope = null)
+        {
+            string directory = Path.Combine(EOSManagerPlatformSpecificsSingleton.Instance.GetTempDir(), storageName);
+            return string.IsNullOrEmpty(scope) ? directory : Path.Combine(directory, scope);
+        }
+
+        /// <summary>
+        /// Computes the hash used to check the integrity of cached content.
+        /// It can't be compared with the hashes reported by the backend.
+        /// </summary>
+        public static string ComputeHash(byte[] data, int offset, int count)
+        {
+            using MD5 md5 = MD5.Create();
+            byte[] hash = md5.ComputeHash(data, offset, count);
+
+            StringBuilder hex = new(hash.Length * 2);
+            foreach (byte b in hash)
+            {
+                hex.Append(b.ToString("x2"));
+            }
+
+            return hex.ToString();
+        }
+
+        public static bool HashesMatch(string left, string right)
+        {
+            return !string.IsNullOrEmpty(left) && string.Equals(left, right, StringComparison.OrdinalIgnoreCase);
+        }
+
+        /// <summary>
+        /// Gets the backend hash of the cached content of a file.
+        /// </summary>
+        /// <returns>
+        /// False if the file isn't cached, or its backend hash isn't known.
+        /// </returns>
+        public bool TryGetVersion(string fileName, out string version)
+        {
+            EnsureLoaded();
+
+            version = _entries.TryGetValue(fileName, out Entry entry) ? entry.Version : null;
+            return version != null;
+        }
+
+        /// <summary>
+        /// Gets the hash of the cached content of a file, as computed by
+        /// <see cref="ComputeHash"/>.
+        /// </summary>
+        public bool TryGetContentHash(string fileName, out string contentHash)
+        {
+            EnsureLoaded();
+
+            contentHash = _entries.TryGetValue(fileName, out Entry entry) ? entry.ContentHash : null;
+            return contentHash != null;
+        }
+
+        /// <summary>
+        /// Names of all the files with cached content.
+        /// </summary>
+        public IEnumerable<string> FileNames
+        {
+            get
+            {
+                EnsureLoaded();
+                return new List<string>(_entries.Keys);
+            }
+        }
+
+        /// <summary>
+        /// Reads the cached content of a file, if it is the version the
+        /// backend has.
+        /// </summary>
+        /// <param name="fileName">Name of the file.</param>
+        /// <param name="version">
+        /// Hash the backend reports for the current content of the file.
+        /// </param>
+        /// <param name="content">The cached content.</param>
+        /// <returns>True if up to date content was read.</returns>
+        public bool TryRead(string fileName, string version, out byte[] content)
+        {
+            content = null;
+
+            EnsureLoaded();
+
+            if (!_entries.TryGetValue(fileName, out Entry entry) || !HashesMatch(entry.Version, version))
+            {
+                return false;
+            }
+
+            string path = GetContentPath(entry.ContentHash);
+
+            try
+            {
+                content = File.ReadAllBytes(path);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("StorageContentCache (TryRead): Couldn't read \"{0}\": {1}", path, e.Message);
+                Remove(fileName);
+                return false;
+            }
+
+            if (content.Length != entry.Length || !HashesMatch(ComputeHash(content, 0, content.Length), entry.ContentHash))
+            {
+                Debug.LogWarningFormat("StorageContentCache (TryRead): Discarding corrupt cached copy of \"{0}\"", fileName);
+                content = null;
+                Remove(fileName);
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Stores the content of a file.
+        /// </summary>
+        /// <param name="fileName">Name of the file.</param>
+        /// <param name="content">Buffer holding the content.</param>
+        /// <param name="length">Number of bytes of content in the buffer.</param>
+        /// <param name="version">
+        /// Hash the backend reports for the content, or null if it isn't
+        /// known yet, as after an upload. The content is only read back once
+        /// its version is known, see <see cref="SetVersion"/>.
+        /// </param>
+        /// <returns>
+        /// The hash of the content, or null if it couldn't be stored.
+        /// </returns>
+        public string Store(string fileName, byte[] content, int length, string version)
+        {
+            string contentHash = ComputeHash(content, 0, length);
+            string path = GetContentPath(contentHash);
+
+            try
+            {
+                if (!File.Exists(path))
+                {
+                    Directory.CreateDirectory(_directory);
+
+                    // Write to a temporary file first, so a partially written
+                    // file is never picked up by a later read
+                    string tempPath = path + ".tmp";
+                    using (FileStream stream = File.Create(tempPath))
+                    {
+                        stream.Write(content, 0, length);
+                    }
+                    File.Move(tempPath, path);
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("StorageContentCache (Store): Couldn't write \"{0}\": {1}", path, e.Message);
+                Remove(fileName);
+                return null;
+            }
+
+            SetEntry(fileName, new Entry
+            {
+                Version = string.IsNullOrEmpty(version) ? null : version,
+                ContentHash = contentHash,
+                Length = length
+            });
+
+            return contentHash;
+        }
+
+        /// <summary>
+        /// Sets the backend hash of the cached content of a file, once it is
+        /// known, if the content is still the one with the given hash.
+        /// </summary>
+        /// <returns>True if the version was set.</returns>
+        public bool SetVersion(string fileName, string contentHash, string version)
+        {
+            EnsureLoaded();
+
+            if (!_entries.TryGetValue(fileName, out Entry entry) || !HashesMatch(entry.ContentHash, contentHash))
+            {
+                return false;
+            }
+
+            if (!string.Equals(entry.Version, version, StringComparison.OrdinalIgnoreCase))
+            {
+                entry.Version = string.IsNullOrEmpty(version) ? null : version;
+                SaveIndex();
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Forgets the cached content of a file.
+        /// </summary>
+        public void Remove(string fileName)
+        {
+            SetEntry(fileName, null);
+        }
+
+        /// <summary>
+        /// Forgets every cached file and deletes the cache directory.
+        /// </summary>
+        public void Clear()
+        {
+            _entries.Clear();
+            _loaded = true;
+
+            try
+            {
+                if (Directory.Exists(_directory))
+                {
+                    Directory.Delete(_directory, true);
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("StorageContentCache (Clear): Couldn't delete \"{0}\": {1}", _directory, e.Message);
+            }
+        }
+
+        private void SetEntry(string fileName, Entry entry)
+        {
+            EnsureLoaded();
+
+            _entries.TryGetValue(fileName, out Entry previous);
+
+            if (entry == null)
+            {
+                if (!_entries.Remove(fileName))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                _entries[fileName] = entry;
+            }
+
+            // Content is shared by all the files with the same content, so is
+            // only deleted once no file refers to it any more
+            if (previous != null && !HashesMatch(previous.ContentHash, entry?.ContentHash) && !IsContentReferenced(previous.ContentHash))
+            {
+                try
+                {
+                    File.Delete(GetContentPath(previous.ContentHash));
+                }
+                catch (Exception e)
+                {
+                    Debug.LogWarningFormat("StorageContentCache (SetEntry): Couldn't delete cached content {0}: {1}", previous.ContentHash, e.Message);
+                }
+            }
+
+            SaveIndex();
+        }
+
+        private bool IsContentReferenced(string contentHash)
+        {
+            foreach (Entry entry in _entries.Values)
+            {
+                if (HashesMatch(entry.ContentHash, contentHash))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        private string GetContentPath(string contentHash)
+        {
+            return Path.Combine(_directory, contentHash.ToLowerInvariant());
+        }
+
+        private void SaveIndex()
+        {
+            string path = Path.Combine(_directory, IndexFileName);
+            string tempPath = path + ".tmp";
+
+            try
+            {
+                Directory.CreateDirectory(_directory);
+
+                using (var writer = new BinaryWriter(File.Create(tempPath)))
+                {
+                    writer.Write(FileMagic);
+                    writer.Write(FormatVersion);
+                    writer.Write(_entries.Count);
+
+                    foreach (var entry in _entries)
+                    {
+                        writer.Write(entry.Key);
+                        writer.Write(entry.Value.Version ?? string.Empty);
+                        writer.Write(entry.Value.ContentHash);
+                        writer.Write(entry.Value.Length);
+                    }
+                }
+
+                // Replace the old file only once the new one is complete
+                if (File.Exists(path))
+                {
+                    File.Delete(path);
+                }
+                File.Move(tempPath, path);
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("StorageContentCache (SaveIndex): Couldn't write \"{0}\": {1}", path, e.Message);
+            }
+        }
+
+        private void EnsureLoaded()
+        {
+            if (_loaded)
+            {
+                return;
+            }
+
+            _loaded = true;
+
+            string path = Path.Combine(_directory, IndexFileName);
+            if (!File.Exists(path))
+            {
+                return;
+            }
+
+            try
+            {
+                using (var reader = new BinaryReader(File.OpenRead(path)))
+                {
+                    if (reader.ReadUInt32() != FileMagic || reader.ReadUInt16() != FormatVersion)
+                    {
+                        Debug.Log("StorageContentCache (EnsureLoaded): Discarding cache written by another version");
+                        return;
+                    }
+
+                    int count = reader.ReadInt32();
+                    for (int i = 0; i < count; ++i)
+                    {
+                        string fileName = reader.ReadString();
+                        string version = reader.ReadString();
+
+                        _entries[fileName] = new Entry
+                        {
+                            Version = version.Length == 0 ? null : version,
+                            ContentHash = reader.ReadString(),
+                            Length = reader.ReadInt64()
+                        };
+                    }
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogWarningFormat("StorageContentCache (EnsureLoaded): Discarding unreadable cache \"{0}\": {1}", path, e.Message);
+                _entries.Clear();
+            }
+        }
+    }
+}
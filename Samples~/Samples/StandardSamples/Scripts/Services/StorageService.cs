@@ -26,6 +26,7 @@ namespace PlayEveryWare.EpicOnlineServices
     using Samples;
     using System;
     using System.Collections.Generic;
+    using System.IO;
     using Epic.OnlineServices;
     using Events;
     using System.Text;
@@ -39,17 +40,6 @@ namespace PlayEveryWare.EpicOnlineServices
     /// </typeparam>
     public abstract class StorageService<T> : EOSService where T : IFileTransferRequest
     {
-        /// <summary>
-        /// Reference to an instance of a transfer request created within the
-        /// EOS SDK.
-        /// </summary>
-        protected T CurrentTransferHandle;
-
-        /// <summary>
-        /// Stores the name of the currently transferring file.
-        /// </summary>
-        protected string CurrentTransferName = string.Empty;
-
         /// <summary>
         /// Event is triggered when a file is finished downloading.
         /// </summary>
@@ -74,35 +64,60 @@ namespace PlayEveryWare.EpicOnlineServices
             /// <summary>
             /// Indicates that the file transfer is still happening.
             /// </summary>
-            ContinueReading
+            ContinueReading,
+
+            /// <summary>
+            /// Indicates that all the data of an upload has been sent.
+            /// </summary>
+            CompleteRequest
         }
 
         /// <summary>
-        /// Indicates the maximum number of bytes that can be read at a time
-        /// during data transfer operations.
+        /// Default number of bytes read or written at a time during data
+        /// transfer operations.
         /// </summary>
-        protected const uint MAX_CHUNK_SIZE = 4096;
+        public const uint DEFAULT_CHUNK_SIZE = 64 * 1024;
 
         /// <summary>
-        /// Stores the file transfers that are currently in progress for the
-        /// given data service.
+        /// Number of bytes read or written at a time by new transfers. Larger
+        /// chunks mean fewer callbacks from the EOS SDK for large files.
         /// </summary>
-        protected Dictionary<string, EOSTransferInProgress> _transfersInProgress = new();
+        public uint ChunkSize { get; set; } = DEFAULT_CHUNK_SIZE;
 
         /// <summary>
-        /// Stores the locally cached copy of the data that the service manages.
+        /// Maximum number of transfers that run at the same time. Further
+        /// transfers wait in a queue until a slot frees up.
         /// </summary>
-        protected Dictionary<string, string> _locallyCachedData = new();
+        public int MaxConcurrentTransfers
+        {
+            get
+            {
+                return _maxConcurrentTransfers;
+            }
+            set
+            {
+                _maxConcurrentTransfers = Math.Max(1, value);
+                StartQueuedTransfers();
+            }
+        }
+
+        private int _maxConcurrentTransfers = 4;
 
         /// <summary>
-        /// Clears all the current transfers that the data service is managing.
+        /// Stores the file transfers that are currently active for the given
+        /// data service, by file name.
         /// </summary>
-        protected void ClearCurrentTransfer()
-        {
-            CurrentTransferName = string.Empty;
-            CurrentTransferHandle?.Release();
-            CurrentTransferHandle?.Dispose();
-        }
+        protected Dictionary<string, EOSTransferInProgress> _transfersInProgress = new(StringComparer.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Transfers waiting for a free slot, in the order they were started.
+        /// </summary>
+        private readonly LinkedList<EOSTransferInProgress> _queuedTransfers = new();
+
+        /// <summary>
+        /// Stores the locally cached copy of the data that the service manages.
+        /// </summary>
+        protected Dictionary<string, string> _locallyCachedData = new();
 
         /// <summary>
         /// Retrieves the current local cache of data.
@@ -114,88 +129,207 @@ namespace PlayEveryWare.EpicOnlineServices
         }
 
         /// <summary>
-        /// Attempts to cancel the "current" transfer handle (needs to be a
-        /// field member added to derived classes).
+        /// Number of transfers currently running.
         /// </summary>
-        /// <returns>
-        /// True if the transfer handle is not null, and canceling it was
-        /// successful, false otherwise.
-        /// </returns>
-        protected bool TryCancelTransferHandle()
+        public int ActiveTransferCount
         {
-            // Default to success, because if the transfer handle is null, then
-            // the task of canceling the transfer can be considered to be a
-            // success.
-            if (CurrentTransferHandle == null)
+            get
             {
-                return true;
+                return _transfersInProgress.Count;
             }
+        }
 
-            // Cancel the transfer request handle, if it fails, then indicate
-            // as much by returning false.
-            Result cancelResult = CurrentTransferHandle.CancelRequest();
-            if (Result.Success != cancelResult)
+        /// <summary>
+        /// Number of transfers waiting for a free slot.
+        /// </summary>
+        public int QueuedTransferCount
+        {
+            get
             {
-                Debug.LogWarning($"Failed to cancel the transfer " +
-                                 $"request. Result code: {cancelResult}.");
-                return false;
+                return _queuedTransfers.Count;
             }
+        }
+
+        protected override void Reset()
+        {
+            CancelAllTransfers();
 
-            // Return true if the result of canceling the request was
-            // successful, and after releasing the handle and setting it to
-            // null.
-            CurrentTransferHandle.Release();
-            CurrentTransferHandle.Dispose();
-            return true;
+            base.Reset();
         }
 
         /// <summary>
-        /// Called when a file has finished downloading.
+        /// Queues a transfer, and starts it if a slot is free.
         /// </summary>
-        /// <param name="fileName">
-        /// The file that has finished downloading.
+        /// <param name="fileName">The name of the file to transfer.</param>
+        /// <param name="download">
+        /// True for a download, false for an upload.
         /// </param>
-        /// <param name="result">
-        /// The result of the file download operation.
+        /// <param name="stream">
+        /// The stream to write downloaded data to, or to read uploaded data
+        /// from. If null, a pooled buffer is used instead.
+        /// </param>
+        /// <param name="ownsStream">
+        /// Whether the stream is disposed of when the transfer finishes.
         /// </param>
-        protected void FinishFileDownload(string fileName, Result result)
+        /// <param name="start">
+        /// Starts the transfer request with the EOS SDK.
+        /// </param>
+        /// <returns>The transfer that has been queued.</returns>
+        protected EOSTransferInProgress QueueTransfer(string fileName, bool download, Stream stream, bool ownsStream, Func<EOSTransferInProgress, T> start)
         {
-            Debug.Log($"File, \"{fileName},\" finished downloading with Result Code = {result}");
+            return QueueTransfer(CreateTransfer(fileName, download, stream, ownsStream, start));
+        }
 
-            if (!_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer) || null == transfer)
+        /// <summary>
+        /// Creates a transfer without queueing it, so that its buffer and
+        /// <see cref="EOSTransferInProgress.Finished"/> handler can be set up
+        /// before it can start, or finish. Queue it with
+        /// <see cref="QueueTransfer(EOSTransferInProgress)"/>.
+        /// </summary>
+        /// <param name="fileName">The name of the file to transfer.</param>
+        /// <param name="download">
+        /// True for a download, false for an upload.
+        /// </param>
+        /// <param name="stream">
+        /// The stream to write downloaded data to, or to read uploaded data
+        /// from. If null, a pooled buffer is used instead, which for uploads
+        /// must be filled in by the caller.
+        /// </param>
+        /// <param name="ownsStream">
+        /// Whether the stream is disposed of when the transfer finishes.
+        /// </param>
+        /// <param name="start">
+        /// Starts the transfer request with the EOS SDK.
+        /// </param>
+        /// <returns>The transfer, not queued yet.</returns>
+        protected EOSTransferInProgress CreateTransfer(string fileName, bool download, Stream stream, bool ownsStream, Func<EOSTransferInProgress, T> start)
+        {
+            EOSTransferInProgress transfer = new(fileName, download, ChunkSize)
             {
-                Debug.LogError($"Downloaded file, \"{fileName},\" " +
-                               $"does not appear to be in the list of " +
-                               $"transfers in progress.");
+                Stream = stream,
+                OwnsStream = ownsStream,
+                Start = t => start(t),
+                CancelHandler = CancelTransfer
+            };
+
+            if (!download && stream != null && stream.CanSeek)
+            {
+                transfer.TotalSize = (uint)Math.Min(stream.Length - stream.Position, uint.MaxValue);
             }
 
-            if (!transfer.Download)
+            return transfer;
+        }
+
+        /// <summary>
+        /// Queues a transfer made with <see cref="CreateTransfer"/>, and
+        /// starts it if a slot is free.
+        /// </summary>
+        /// <param name="transfer">The transfer to queue.</param>
+        /// <returns>The transfer that has been queued.</returns>
+        protected EOSTransferInProgress QueueTransfer(EOSTransferInProgress transfer)
+        {
+            string fileName = transfer.FileName;
+
+            // Only one transfer per file can be active at a time, as the EOS
+            // SDK identifies transfers by file name in its callbacks.
+            if (_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress previous))
             {
-                Debug.LogError($"Downloaded file, \"{fileName},\" " +
-                               $"should have been uploaded not downloaded. " +
-                               $"Something went wrong.");
+                Debug.LogWarning($"Canceling the transfer of \"{fileName}\" that is in progress, to start a new one.");
+                previous.Cancel();
             }
 
+            foreach (EOSTransferInProgress queued in _queuedTransfers)
+            {
+                if (queued.FileName.Equals(fileName, StringComparison.OrdinalIgnoreCase))
+                {
+                    queued.Cancel();
+                    break;
+                }
+            }
 
-            if (!transfer.IsDone() || Result.Success != result)
+            _queuedTransfers.AddLast(transfer);
+            StartQueuedTransfers();
+
+            return transfer;
+        }
+
+        /// <summary>
+        /// Starts queued transfers for as long as there are free slots, and
+        /// no other transfer of the same file is still finishing.
+        /// </summary>
+        private void StartQueuedTransfers()
+        {
+            var node = _queuedTransfers.First;
+            while (node != null && _transfersInProgress.Count < MaxConcurrentTransfers)
             {
-                Debug.Log($"File transfer finished before all data " +
-                          $"was downloaded. Result code: {result}.");
+                var next = node.Next;
+                EOSTransferInProgress transfer = node.Value;
+
+                if (!_transfersInProgress.ContainsKey(transfer.FileName))
+                {
+                    _queuedTransfers.Remove(node);
+                    StartTransfer(transfer);
+                }
+
+                node = next;
             }
-            else
+        }
+
+        private void StartTransfer(EOSTransferInProgress transfer)
+        {
+            transfer.State = EOSTransferState.Active;
+            _transfersInProgress[transfer.FileName] = transfer;
+
+            IFileTransferRequest request = transfer.Start(transfer);
+            if (request == null)
             {
-                string fileData = Encoding.UTF8.GetString(transfer.Data, 0, (int)transfer.TotalSize);
-                _locallyCachedData[fileName] = fileData;
+                Debug.LogError($"Could not start the transfer of \"{transfer.FileName}\", bad handle returned.");
+                FinishTransfer(transfer.FileName, Result.InvalidState);
+                return;
             }
 
-            _transfersInProgress.Remove(fileName);
-            
-            if (fileName.Equals(CurrentTransferName, StringComparison.OrdinalIgnoreCase))
+            transfer.Request = request;
+        }
+
+        /// <summary>
+        /// Cancels the given transfer.
+        /// </summary>
+        private void CancelTransfer(EOSTransferInProgress transfer)
+        {
+            if (transfer.State == EOSTransferState.Queued)
+            {
+                _queuedTransfers.Remove(transfer);
+                transfer.Finish(EOSTransferState.Canceled, Result.Canceled);
+                return;
+            }
+
+            if (transfer.Request == null)
+            {
+                return;
+            }
+
+            Result cancelResult = transfer.Request.CancelRequest();
+            if (Result.Success != cancelResult)
+            {
+                Debug.LogWarning($"Failed to cancel the transfer " +
+                                 $"request. Result code: {cancelResult}.");
+            }
+        }
+
+        /// <summary>
+        /// Cancels every queued and active transfer.
+        /// </summary>
+        public void CancelAllTransfers()
+        {
+            foreach (EOSTransferInProgress transfer in new List<EOSTransferInProgress>(_queuedTransfers))
             {
-                ClearCurrentTransfer();
+                transfer.Cancel();
             }
 
-            OnFileDownloaded?.Invoke(result);
+            foreach (EOSTransferInProgress transfer in new List<EOSTransferInProgress>(_transfersInProgress.Values))
+            {
+                transfer.Cancel();
+            }
         }
 
         /// <summary>
@@ -204,38 +338,55 @@ namespace PlayEveryWare.EpicOnlineServices
         /// <returns>True if a file is transferring, false otherwise.</returns>
         protected bool IsTransferring()
         {
-            return (!string.IsNullOrEmpty(CurrentTransferName) || _transfersInProgress.Count != 0);
+            return _transfersInProgress.Count != 0 || _queuedTransfers.Count != 0;
         }
 
         /// <summary>
-        /// Cancel the current transfer.
+        /// Called by the EOS SDK callbacks when a transfer has finished,
+        /// however it finished.
         /// </summary>
-        protected void CancelCurrentTransfer()
+        /// <param name="fileName">
+        /// The file that has finished transferring.
+        /// </param>
+        /// <param name="result">
+        /// The result of the transfer.
+        /// </param>
+        protected void FinishTransfer(string fileName, Result result)
         {
-            // If nothing is being transferred, do not try to cancel.
-            if (!IsTransferring())
-                return;
-
-            // Log if the transfer handle could not be canceled.
-            if (!TryCancelTransferHandle())
+            if (!_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer) || null == transfer)
             {
-                Debug.LogWarning($"Could not cancel the current transfer.");
+                Debug.LogError($"Transferred file, \"{fileName},\" " +
+                               $"does not appear to be in the list of " +
+                               $"transfers in progress.");
                 return;
             }
 
-            // If the transfer does not exist in the list of transfers in 
-            // progress, then log a warning and stop.
-            if (!_transfersInProgress.TryGetValue(CurrentTransferName, out EOSTransferInProgress transfer) || null == transfer)
+            _transfersInProgress.Remove(fileName);
+
+            EOSTransferState state = result switch
             {
-                Debug.LogWarning($"Could not find a current transfer matching filename \"{CurrentTransferName}\" to cancel.");
-                return;
+                Result.Success => EOSTransferState.Completed,
+                Result.Canceled => EOSTransferState.Canceled,
+                _ => transfer.CancelRequested ? EOSTransferState.Canceled : EOSTransferState.Failed
+            };
+
+            if (state == EOSTransferState.Completed && transfer.TotalSize != 0 && transfer.BytesTransferred != transfer.TotalSize)
+            {
+                Debug.Log($"File transfer finished before all data " +
+                          $"was transferred. Result code: {result}.");
+                state = EOSTransferState.Failed;
             }
 
-            // Remove the transfer from the collection of current transfers
-            _transfersInProgress.Remove(CurrentTransferName);
+            Debug.Log($"File, \"{fileName},\" finished {(transfer.Download ? "downloading" : "uploading")} with Result Code = {result}");
+
+            transfer.Finish(state, result);
 
-            // Clear the name of the currently transferring file name
-            ClearCurrentTransfer();
+            if (transfer.Download)
+            {
+                OnFileDownloaded?.Invoke(transfer.Result);
+            }
+
+            StartQueuedTransfers();
         }
 
         /// <summary>
@@ -257,7 +408,7 @@ namespace PlayEveryWare.EpicOnlineServices
         protected FileTransferResult ReceiveData(string fileName, ArraySegment<byte> data, uint totalSize)
         {
             // Fail request if data received is null.
-            if (null == data)
+            if (null == data.Array)
             {
                 Debug.LogError("Data received is null");
                 return FileTransferResult.FailRequest;
@@ -268,11 +419,16 @@ namespace PlayEveryWare.EpicOnlineServices
             if (!_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer))
             {
                 Debug.LogError($"Receiving data for file " +
-                               $"\"{{fileName}},\" but that file is not in " +
+                               $"\"{fileName},\" but that file is not in " +
                                $"the list of current transfers.");
                 return FileTransferResult.CancelRequest;
             }
 
+            if (transfer.CancelRequested)
+            {
+                return FileTransferResult.CancelRequest;
+            }
+
             // Fail if the file transfer for which data is being received is 
             // marked as an upload instead of a download.
             if (!transfer.Download)
@@ -283,32 +439,273 @@ namespace PlayEveryWare.EpicOnlineServices
                 return FileTransferResult.FailRequest;
             }
 
-            // If this is the first update (indicated by the CurrentIndex being
-            // 0), then allocate the byte array for the file transfer
-            if (0 == transfer.CurrentIndex)
-            {
-                transfer.Data = new byte[totalSize];
-            }
+            transfer.TotalSize = totalSize;
 
-            // If the amount of data being recieved exceeds the amount expected
-            // and allocated, then fail the request
-            if (transfer.TotalSize < transfer.CurrentIndex + data.Count)
+            // If the amount of data being received exceeds the amount
+            // expected, then fail the request
+            if (transfer.TotalSize < transfer.BytesTransferred + data.Count)
             {
                 Debug.LogError($"Could not continue to receive data " +
                                $"for file, \"{fileName},\" as more data was " +
-                               $"received than there is space allocated for " +
-                               $"the transfer.");
+                               $"received than the size of the file.");
                 return FileTransferResult.FailRequest;
             }
 
-            // Copy received data into the Data field member of the transfer
-            // object.
-            data.Array?.CopyTo(transfer.Data, transfer.CurrentIndex);
+            try
+            {
+                if (transfer.Stream != null)
+                {
+                    transfer.Stream.Write(data.Array, data.Offset, data.Count);
+                }
+                else
+                {
+                    // Sized for the whole file on the first chunk
+                    if (!transfer.EnsureBuffer((int)Math.Min(totalSize, int.MaxValue)))
+                    {
+                        return FileTransferResult.FailRequest;
+                    }
+
+                    Array.Copy(data.Array, data.Offset, transfer.Buffer, transfer.BufferLength, data.Count);
+                    transfer.BufferLength += data.Count;
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"Could not write data received for file, \"{fileName},\": {e.Message}");
+                return FileTransferResult.FailRequest;
+            }
 
-            // Increment the current index of the data being received.
-            transfer.CurrentIndex += (uint)data.Count;
+            transfer.BytesTransferred += (uint)data.Count;
+            transfer.ReportProgress();
 
             return FileTransferResult.ContinueReading;
         }
+
+        /// <summary>
+        /// Called by the progress callbacks of the EOS SDK.
+        /// </summary>
+        /// <param name="fileName">
+        /// Name of the file being transferred.
+        /// </param>
+        /// <param name="bytesTransferred">
+        /// Number of bytes the EOS SDK has transferred so far.
+        /// </param>
+        /// <param name="totalSize">
+        /// Total size of the file, if known.
+        /// </param>
+        protected void UpdateTransferProgress(string fileName, uint bytesTransferred, uint totalSize)
+        {
+            if (!_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer))
+            {
+                return;
+            }
+
+            // Byte counts are kept by ReceiveData and SendData, which see
+            // every chunk, so only the size is taken from here.
+            if (transfer.TotalSize == 0 && totalSize > 0)
+            {
+                transfer.TotalSize = totalSize;
+                transfer.ReportProgress();
+            }
+        }
+
+        /// <summary>
+        /// Called when the EOS SDK asks for the next chunk of an upload.
+        /// </summary>
+        /// <param name="fileName">
+        /// Name of the file for which data is being sent.
+        /// </param>
+        /// <param name="data">
+        /// The next chunk of data to send, valid until the next call.
+        /// </param>
+        /// <returns>
+        /// A FileTransferResult indicating the current state of the request.
+        /// </returns>
+        protected FileTransferResult SendData(string fileName, out ArraySegment<byte> data)
+        {
+            data = new ArraySegment<byte>();
+
+            if (!_transfersInProgress.TryGetValue(fileName, out EOSTransferInProgress transfer))
+            {
+                Debug.LogError($"Could not send data for file, \"{fileName},\" as it is not being uploaded at the moment.");
+                return FileTransferResult.CancelRequest;
+            }
+
+            if (transfer.CancelRequested)
+            {
+                return FileTransferResult.CancelRequest;
+            }
+
+            if (transfer.Download)
+            {
+                Debug.LogError($"Could not send data for file, \"{fileName},\" as it is being downloaded, not uploaded.");
+                return FileTransferResult.FailRequest;
+            }
+
+            int bytesToWrite;
+
+            try
+            {
+                if (transfer.Stream != null)
+                {
+                    // Read a single chunk into a reused buffer. Streams may
+                    // return less than asked for before their end, so read
+                    // until the chunk is full or the stream has ended.
+                    if (!transfer.EnsureBuffer((int)transfer.ChunkSize))
+                    {
+                        return FileTransferResult.FailRequest;
+                    }
+
+                    bytesToWrite = 0;
+                    int bytesRead;
+                    while (bytesToWrite < transfer.ChunkSize &&
+                           (bytesRead = transfer.Stream.Read(transfer.Buffer, bytesToWrite, (int)transfer.ChunkSize - bytesToWrite)) > 0)
+                    {
+                        bytesToWrite += bytesRead;
+                    }
+
+                    data = new ArraySegment<byte>(transfer.Buffer, 0, bytesToWrite);
+                }
+                else
+                {
+                    bytesToWrite = (int)Math.Min(transfer.ChunkSize, (uint)transfer.BufferLength - transfer.BytesTransferred);
+                    data = new ArraySegment<byte>(transfer.Buffer ?? Array.Empty<byte>(), (int)transfer.BytesTransferred, bytesToWrite);
+                }
+            }
+            catch (Exception e)
+            {
+                Debug.LogError($"Could not read data to send for file, \"{fileName},\": {e.Message}");
+                return FileTransferResult.FailRequest;
+            }
+
+            transfer.BytesTransferred += (uint)bytesToWrite;
+            transfer.ReportProgress();
+
+            // A chunk that isn't full marks the end of the data
+            bool done = transfer.Stream != null
+                ? bytesToWrite < transfer.ChunkSize
+                : transfer.BytesTransferred >= transfer.BufferLength;
+
+            if (done && transfer.TotalSize == 0)
+            {
+                transfer.TotalSize = transfer.BytesTransferred;
+            }
+
+            return done ? FileTransferResult.CompleteRequest : FileTransferResult.ContinueReading;
+        }
+
+        /// <summary>
+        /// Queues a download into a pooled buffer, that is decoded into the
+        /// local cache of data once the download completes.
+        /// </summary>
+        protected EOSTransferInProgress QueueCachedDownload(string fileName, Func<EOSTransferInProgress, T> start)
+        {
+            EOSTransferInProgress transfer = CreateTransfer(fileName, true, null, false, start);
+
+            transfer.Finished = t =>
+            {
+                if (t.State == EOSTransferState.Completed)
+                {
+                    _locallyCachedData[t.FileName] = t.Buffer == null ? string.Empty : Encoding.UTF8.GetString(t.Buffer, 0, t.BufferLength);
+                    OnCachedDownloadCompleted(t);
+                }
+            };
+
+            return QueueTransfer(transfer);
+        }
+
+        /// <summary>
+        /// Queues a download into a temporary file in the directory of the
+        /// given path. The temporary file replaces the file at the path once
+        /// the download completes, and is deleted if it fails or is canceled,
+        /// so an existing file is never left partly overwritten.
+        /// </summary>
+        protected EOSTransferInProgress QueueFileDownload(string fileName, string path, Func<EOSTransferInProgress, T> start)
+        {
+            string tempPath = $"{path}.{Guid.NewGuid():N}.download";
+            EOSTransferInProgress transfer = CreateTransfer(fileName, true, CreateDownloadFileStream(tempPath), true, start);
+
+            transfer.Finished = t =>
+            {
+                // Closed here so that the file can be moved
+                t.Stream.Dispose();
+
+                if (t.State == EOSTransferState.Completed)
+                {
+                    try
+                    {
+                        if (File.Exists(path))
+                        {
+                            File.Replace(tempPath, path, null);
+                        }
+                        else
+                        {
+                            File.Move(tempPath, path);
+                        }
+
+                        return;
+                    }
+                    catch (Exception e)
+                    {
+                        Debug.LogError($"Could not move the downloaded file, \"{t.FileName},\" to \"{path}\": {e.Message}");
+                        t.State = EOSTransferState.Failed;
+                        t.Result = Result.UnexpectedError;
+                    }
+                }
+
+                try
+                {
+                    File.Delete(tempPath);
+                }
+                catch (Exception e)
+                {
+                    Debug.LogWarning($"Could not delete the partial download \"{tempPath}\": {e.Message}");
+                }
+            };
+
+            return QueueTransfer(transfer);
+        }
+
+        /// <summary>
+        /// Creates a download that is already complete, for data that was
+        /// served without a transfer, so callers can treat it like any other
+        /// download.
+        /// </summary>
+        protected EOSTransferInProgress CreateCompletedDownload(string fileName, uint size)
+        {
+            EOSTransferInProgress transfer = new(fileName, true, ChunkSize)
+            {
+                TotalSize = size,
+                BytesTransferred = size
+            };
+            transfer.Finish(EOSTransferState.Completed, Result.Success);
+
+            return transfer;
+        }
+
+        /// <summary>
+        /// Called when a download queued by <see cref="QueueCachedDownload"/>
+        /// completes, while the downloaded data is still in the buffer of
+        /// the transfer.
+        /// </summary>
+        protected virtual void OnCachedDownloadCompleted(EOSTransferInProgress transfer)
+        {
+        }
+
+        /// <summary>
+        /// Opens a file to download into, creating its directory if needed.
+        /// Downloads to a path go through <see cref="QueueFileDownload"/>,
+        /// which writes to a temporary file.
+        /// </summary>
+        protected static FileStream CreateDownloadFileStream(string path)
+        {
+            string directory = Path.GetDirectoryName(path);
+            if (!string.IsNullOrEmpty(directory))
+            {
+                Directory.CreateDirectory(directory);
+            }
+
+            return new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.None, (int)DEFAULT_CHUNK_SIZE);
+        }
     }
-}
\ No newline at end of file
+}
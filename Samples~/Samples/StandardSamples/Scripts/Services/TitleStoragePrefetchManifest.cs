@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+
+    /// <summary>
+    /// Describes the title storage files to download in the background after
+    /// login, so they are ready before gameplay needs them.
+    /// </summary>
+    [Serializable]
+    public class TitleStoragePrefetchManifest
+    {
+        /// <summary>
+        /// Tags the file list is queried with.
+        /// </summary>
+        public List<string> Tags = new();
+
+        /// <summary>
+        /// Files to prefetch. If empty, every file matching the tags is
+        /// prefetched.
+        /// </summary>
+        public List<string> FileNames = new();
+
+        /// <summary>
+        /// Maximum number of files downloaded at the same time by the
+        /// prefetch, leaving the other transfer slots of the service free for
+        /// downloads made on demand.
+        /// </summary>
+        public int MaxConcurrentDownloads = 2;
+
+        /// <summary>
+        /// Maximum average download rate of the prefetch, in bytes per
+        /// second. Zero for no limit.
+        /// </summary>
+        public uint MaxBytesPerSecond = 0;
+
+        /// <summary>
+        /// Whether the given file is part of the prefetch.
+        /// </summary>
+        public bool Includes(string fileName)
+        {
+            return FileNames.Count == 0 || FileNames.Exists(name => string.Equals(name, fileName, StringComparison.OrdinalIgnoreCase));
+        }
+    }
+}
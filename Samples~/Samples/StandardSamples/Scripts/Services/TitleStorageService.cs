@@ -26,6 +26,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
     using System.Threading.Tasks;
     using System;
     using System.Collections.Generic;
+    using System.IO;
     using UnityEngine;
     using Epic.OnlineServices;
     using Epic.OnlineServices.TitleStorage;
@@ -64,12 +65,269 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         // Manager Callbacks
         public EOSResultEventHandler QueryListCallback { get; private set; } = null;
-        
+
+        /// <summary>
+        /// Triggered when a file has been loaded into the local cache of data
+        /// and can be read without waiting.
+        /// </summary>
+        public event Action<string> OnFileReady;
+
+        /// <summary>
+        /// Metadata of every file seen in file list queries.
+        /// </summary>
+        private readonly Dictionary<string, FileMetadata> _remoteFiles = new(StringComparer.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Local copy of downloaded files, so files that haven't changed are
+        /// not downloaded again in later sessions.
+        /// </summary>
+        private StorageContentCache _contentCache;
+
+        private readonly HashSet<string> _readyFiles = new(StringComparer.OrdinalIgnoreCase);
+        private readonly Dictionary<string, TaskCompletionSource<bool>> _readyWaiters = new(StringComparer.OrdinalIgnoreCase);
+
+        private TitleStoragePrefetchManifest _prefetchManifest;
+
+        // Incremented to stop a prefetch that is in progress
+        private int _prefetchGeneration;
+
+        /// <summary>
+        /// Files to download in the background at login. Setting it while a
+        /// user is logged in starts the prefetch straight away.
+        /// </summary>
+        public TitleStoragePrefetchManifest PrefetchManifest
+        {
+            get
+            {
+                return _prefetchManifest;
+            }
+            set
+            {
+                _prefetchManifest = value;
+
+                ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+                if (value != null && localUserId != null && localUserId.IsValid())
+                {
+                    StartPrefetch(value);
+                }
+            }
+        }
+
         public List<string> GetCachedCurrentFileNames()
         {
             return CurrentFileNames;
         }
 
+        protected override void OnLoggedIn(AuthenticationListener.LoginChangeKind changeType)
+        {
+            if (changeType == AuthenticationListener.LoginChangeKind.Connect && _prefetchManifest != null)
+            {
+                StartPrefetch(_prefetchManifest);
+            }
+        }
+
+        protected override void Reset()
+        {
+            ++_prefetchGeneration;
+            _remoteFiles.Clear();
+            _readyFiles.Clear();
+
+            foreach (TaskCompletionSource<bool> waiter in _readyWaiters.Values)
+            {
+                waiter.TrySetResult(false);
+            }
+            _readyWaiters.Clear();
+
+            base.Reset();
+        }
+
+        /// <summary>
+        /// Whether a file is in the local cache of data, so can be read
+        /// without waiting for a download.
+        /// </summary>
+        public bool IsFileReady(string fileName)
+        {
+            return _readyFiles.Contains(fileName);
+        }
+
+        /// <summary>
+        /// Gets the content of a file if it is ready, without ever waiting
+        /// for a download.
+        /// </summary>
+        public bool TryGetReadyFile(string fileName, out string content)
+        {
+            content = null;
+            return IsFileReady(fileName) && _locallyCachedData.TryGetValue(fileName, out content);
+        }
+
+        /// <summary>
+        /// Waits for a file to be ready.
+        /// </summary>
+        /// <returns>
+        /// A task that completes with true once the file is ready, or false
+        /// if its download failed or the user logged out.
+        /// </returns>
+        public Task<bool> WhenFileReadyAsync(string fileName)
+        {
+            if (IsFileReady(fileName))
+            {
+                return Task.FromResult(true);
+            }
+
+            if (!_readyWaiters.TryGetValue(fileName, out TaskCompletionSource<bool> waiter))
+            {
+                waiter = new TaskCompletionSource<bool>();
+                _readyWaiters.Add(fileName, waiter);
+            }
+
+            return waiter.Task;
+        }
+
+        private void SetFileReady(string fileName, bool ready)
+        {
+            if (ready)
+            {
+                _readyFiles.Add(fileName);
+            }
+
+            if (_readyWaiters.TryGetValue(fileName, out TaskCompletionSource<bool> waiter))
+            {
+                _readyWaiters.Remove(fileName);
+                waiter.TrySetResult(ready);
+            }
+
+            if (ready)
+            {
+                OnFileReady?.Invoke(fileName);
+            }
+        }
+
+        /// <summary>
+        /// Queries the files of the manifest, and downloads the ones that are
+        /// missing from the local cache or have changed, in the background.
+        /// Replaces any prefetch in progress.
+        /// </summary>
+        public void StartPrefetch(TitleStoragePrefetchManifest manifest)
+        {
+            int generation = ++_prefetchGeneration;
+            List<string> fileNames = new();
+
+            QueryFileList(manifest.Tags.ToArray(), fileNames, result =>
+            {
+                if (generation != _prefetchGeneration)
+                {
+                    return;
+                }
+
+                if (result != Result.Success)
+                {
+                    Debug.LogErrorFormat("Title storage: can't prefetch files, file list retrieval error: {0}", result);
+                    return;
+                }
+
+                _ = PrefetchFilesAsync(manifest, fileNames, generation);
+            });
+        }
+
+        private async Task PrefetchFilesAsync(TitleStoragePrefetchManifest manifest, List<string> fileNames, int generation)
+        {
+            List<Task<Result>> downloads = new();
+            float startTime = Time.realtimeSinceStartup;
+            ulong bytesRequested = 0;
+
+            foreach (string fileName in fileNames)
+            {
+                if (!manifest.Includes(fileName) || TryLoadFromContentCache(fileName, out _))
+                {
+                    continue;
+                }
+
+                while (downloads.Count >= Math.Max(1, manifest.MaxConcurrentDownloads))
+                {
+                    downloads.Remove(await Task.WhenAny(downloads));
+                }
+
+                // Downloads can't be slowed down once started, so the rate is
+                // kept by delaying the start of the next one
+                if (manifest.MaxBytesPerSecond > 0)
+                {
+                    double waitSeconds = (double)bytesRequested / manifest.MaxBytesPerSecond - (Time.realtimeSinceStartup - startTime);
+                    if (waitSeconds > 0)
+                    {
+                        await Task.Delay(TimeSpan.FromSeconds(waitSeconds));
+                    }
+                }
+
+                if (generation != _prefetchGeneration)
+                {
+                    return;
+                }
+
+                EOSTransferInProgress transfer = DownloadFile(fileName, null);
+                if (transfer == null)
+                {
+                    return;
+                }
+
+                bytesRequested += _remoteFiles.TryGetValue(fileName, out FileMetadata metadata) ? metadata.FileSizeBytes : 0;
+                downloads.Add(transfer.Completion);
+            }
+
+            await Task.WhenAll(downloads);
+
+            if (generation != _prefetchGeneration)
+            {
+                return;
+            }
+
+            // Don't leave callers waiting on files that aren't in title storage
+            foreach (string fileName in manifest.FileNames)
+            {
+                if (!_remoteFiles.ContainsKey(fileName))
+                {
+                    Debug.LogWarningFormat("Title storage: can't prefetch '{0}', it isn't in the file list", fileName);
+                    SetFileReady(fileName, false);
+                }
+            }
+
+            Debug.LogFormat("Title storage: prefetch finished in {0:0.00}s, {1} bytes downloaded", Time.realtimeSinceStartup - startTime, bytesRequested);
+        }
+
+        /// <summary>
+        /// Loads a file into the local cache of data from the content cache,
+        /// if the cached copy is the version in title storage.
+        /// </summary>
+        /// <param name="fileName">Name of the file.</param>
+        /// <param name="contentLength">Size of the cached content.</param>
+        private bool TryLoadFromContentCache(string fileName, out int contentLength)
+        {
+            contentLength = 0;
+
+            _contentCache ??= new StorageContentCache(StorageContentCache.GetDefaultDirectory("TitleStorage"));
+
+            if (!_remoteFiles.TryGetValue(fileName, out FileMetadata remoteFile) ||
+                !_contentCache.TryRead(fileName, remoteFile.MD5Hash, out byte[] content))
+            {
+                return false;
+            }
+
+            _locallyCachedData[fileName] = System.Text.Encoding.UTF8.GetString(content);
+            contentLength = content.Length;
+            SetFileReady(fileName, true);
+
+            return true;
+        }
+
+        protected override void OnCachedDownloadCompleted(EOSTransferInProgress transfer)
+        {
+            _contentCache ??= new StorageContentCache(StorageContentCache.GetDefaultDirectory("TitleStorage"));
+
+            string remoteHash = _remoteFiles.TryGetValue(transfer.FileName, out FileMetadata remoteFile) ? (string)remoteFile.MD5Hash : null;
+            _contentCache.Store(transfer.FileName, transfer.Buffer ?? Array.Empty<byte>(), transfer.BufferLength, remoteHash);
+
+            SetFileReady(transfer.FileName, true);
+        }
+
         protected override Task InternalRefreshAsync()
         {
             // TODO: Needs implementation
@@ -77,6 +335,21 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         }
 
         public void QueryFileList(string[] tags, EOSResultEventHandler QueryFileListCompleted)
+        {
+            QueryListCallback = QueryFileListCompleted;
+            QueryFileList(tags, CurrentFileNames, QueryFileListCompleted);
+        }
+
+        /// <summary>
+        /// Client data of a file list query.
+        /// </summary>
+        private class QueryFileListRequest
+        {
+            public List<string> FileNames;
+            public EOSResultEventHandler Callback;
+        }
+
+        private void QueryFileList(string[] tags, List<string> fileNames, EOSResultEventHandler QueryFileListCompleted)
         {
             Utf8String[] utf8StringTags = null;
             if (tags != null && tags.Length > 0)
@@ -95,18 +368,18 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 LocalUserId = EOSManager.Instance.GetProductUserId()
             };
 
-            QueryListCallback = QueryFileListCompleted;
-
             TitleStorageInterface titleStorageHandle = EOSManager.Instance.GetEOSPlatformInterface().GetTitleStorageInterface();
-            titleStorageHandle.QueryFileList(ref queryOptions, null, OnQueryFileListCompleted);
+            titleStorageHandle.QueryFileList(ref queryOptions, new QueryFileListRequest { FileNames = fileNames, Callback = QueryFileListCompleted }, OnQueryFileListCompleted);
         }
 
         private void OnQueryFileListCompleted(ref QueryFileListCallbackInfo data)
         {
+            var request = data.ClientData as QueryFileListRequest;
+
             if (data.ResultCode != Result.Success)
             {
                 Debug.LogErrorFormat("Title storage: file list retrieval error: {0}", data.ResultCode);
-                QueryListCallback?.Invoke(data.ResultCode);
+                request?.Callback?.Invoke(data.ResultCode);
                 return;
             }
 
@@ -114,7 +387,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             uint fileCount = data.FileCount;
             TitleStorageInterface titleStorageHandle = EOSManager.Instance.GetEOSPlatformInterface().GetTitleStorageInterface();
-            CurrentFileNames.Clear();
+            List<string> fileNames = request?.FileNames ?? CurrentFileNames;
+            fileNames.Clear();
 
             for (uint fileIndex = 0; fileIndex < fileCount; fileIndex++)
             {
@@ -128,71 +402,116 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 {
                     if (!string.IsNullOrEmpty(fileMetadata?.Filename))
                     {
-                        CurrentFileNames.Add(fileMetadata?.Filename);
+                        fileNames.Add(fileMetadata?.Filename);
+                        _remoteFiles[fileMetadata?.Filename] = fileMetadata.Value;
                     }
                 }
             }
 
-            QueryListCallback?.Invoke(Result.Success);
+            request?.Callback?.Invoke(Result.Success);
         }
 
-        public void DownloadFile(string fileName, EOSResultEventHandler ReadFileCompleted)
+        /// <summary>
+        /// (async) Begin file data download into the local cache.
+        /// </summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="ReadFileCompleted">Function called when the download finishes.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFile(string fileName, EOSResultEventHandler ReadFileCompleted)
         {
             ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
             if (localUserId == null || !localUserId.IsValid())
             {
-                return;
+                return null;
             }
 
-            var queryFileOptions = new QueryFileOptions { Filename = fileName, LocalUserId = localUserId };
-            EOSManager.Instance.GetEOSTitleStorageInterface().QueryFile(ref queryFileOptions, null, (ref QueryFileCallbackInfo data) => 
+            // Skip the download if the local copy is the version in title
+            // storage. The size in the metadata includes a header added by
+            // the backend, so the size of the content is reported instead.
+            if (TryLoadFromContentCache(fileName, out int contentLength))
             {
-                if(data.ResultCode == Result.Success)
-                {
-                    var copyFileMetadataByFilenameOptions = new CopyFileMetadataByFilenameOptions { Filename = fileName, LocalUserId = localUserId };
-                    EOSManager.Instance.GetEOSTitleStorageInterface().CopyFileMetadataByFilename(ref copyFileMetadataByFilenameOptions, out FileMetadata? fileMetadata);
-
+                ReadFileCompleted?.Invoke(Result.Success);
+                return CreateCompletedDownload(fileName, (uint)contentLength);
+            }
 
-                    ReadFileOptions fileReadOptions = new ReadFileOptions();
-                    fileReadOptions.LocalUserId = EOSManager.Instance.GetProductUserId();
-                    fileReadOptions.Filename = fileName;
-                    fileReadOptions.ReadChunkLengthBytes = MAX_CHUNK_SIZE;
+            return QueueCachedDownload(fileName, transfer => StartReadFile(localUserId, transfer, ReadFileCompleted));
+        }
 
-                    fileReadOptions.ReadFileDataCallback = OnFileDataReceived;
-                    fileReadOptions.FileTransferProgressCallback = OnFileTransferProgressUpdated;
+        /// <summary>
+        /// (async) Begin file data download, writing each chunk to a stream as
+        /// it arrives.
+        /// </summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="destination">Stream the file content is written to.</param>
+        /// <param name="ownsStream">Whether the stream is disposed of when the download finishes.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFileToStream(string fileName, Stream destination, bool ownsStream = false)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return null;
+            }
 
-                    // ReadFile Callback
-                    OnFileDownloaded += ReadFileCompleted;
+            return QueueTransfer(fileName, true, destination, ownsStream, transfer => StartReadFile(localUserId, transfer, null));
+        }
 
-                    TitleStorageInterface titleStorageHandle = EOSManager.Instance.GetEOSPlatformInterface().GetTitleStorageInterface();
-                    TitleStorageFileTransferRequest transferReq = titleStorageHandle.ReadFile(ref fileReadOptions, null, OnFileReceived);
+        /// <summary>
+        /// (async) Begin file data download straight to a file on disk.
+        /// </summary>
+        /// <param name="fileName">Name of file.</param>
+        /// <param name="path">Path of the file to write.</param>
+        /// <returns>The transfer, or null if no user is logged in.</returns>
+        public EOSTransferInProgress DownloadFileToPath(string fileName, string path)
+        {
+            ProductUserId localUserId = EOSManager.Instance.GetProductUserId();
+            if (localUserId == null || !localUserId.IsValid())
+            {
+                return null;
+            }
 
-                    CancelCurrentTransfer();
-                    CurrentTransferHandle = transferReq;
+            return QueueFileDownload(fileName, path, transfer => StartReadFile(localUserId, transfer, null));
+        }
 
-                    EOSTransferInProgress newTransfer = new EOSTransferInProgress();
-                    newTransfer.Download = true;
-                    newTransfer.Data = new byte[(uint)fileMetadata?.FileSizeBytes];
+        private TitleStorageFileTransferRequestWrapper StartReadFile(ProductUserId localUserId, EOSTransferInProgress transfer, EOSResultEventHandler ReadFileCompleted)
+        {
+            ReadFileOptions fileReadOptions = new ReadFileOptions();
+            fileReadOptions.LocalUserId = localUserId;
+            fileReadOptions.Filename = transfer.FileName;
+            fileReadOptions.ReadChunkLengthBytes = transfer.ChunkSize;
 
+            fileReadOptions.ReadFileDataCallback = OnFileDataReceived;
+            fileReadOptions.FileTransferProgressCallback = OnFileTransferProgressUpdated;
 
-                    _transfersInProgress[fileName] = newTransfer;
+            TitleStorageInterface titleStorageHandle = EOSManager.Instance.GetEOSPlatformInterface().GetTitleStorageInterface();
+            TitleStorageFileTransferRequest transferReq = titleStorageHandle.ReadFile(ref fileReadOptions, ReadFileCompleted, OnFileReceived);
+            if (transferReq == null)
+            {
+                Debug.LogErrorFormat("Title storage: can't start file download, bad handle returned for filename '{0}'", transfer.FileName);
+                return null;
+            }
 
-                    CurrentTransferName = fileName;
-                }
-            });
+            return transferReq;
         }
 
         private void OnFileReceived(ref ReadFileCallbackInfo data)
         {
-            FinishFileDownload(data.Filename, data.ResultCode);
+            FinishTransfer(data.Filename, data.ResultCode);
+
+            // A canceled download has been replaced by a newer one
+            if (data.ResultCode != Result.Success && data.ResultCode != Result.Canceled)
+            {
+                SetFileReady(data.Filename, false);
+            }
+
+            // ReadFile Callback
+            var callback = data.ClientData as EOSResultEventHandler;
+            callback?.Invoke(data.ResultCode);
         }
 
         private void OnFileTransferProgressUpdated(ref FileTransferProgressCallbackInfo data)
         {
-            if (data.TotalFileSizeBytes > 0)
-            {
-                Debug.LogFormat("Title storage: transfer progress {0} / {1}", data.BytesTransferred, data.TotalFileSizeBytes);
-            }
+            UpdateTransferProgress(data.Filename, data.BytesTransferred, data.TotalFileSizeBytes);
         }
 
         private ReadResult OnFileDataReceived(ref ReadFileDataCallbackInfo data)
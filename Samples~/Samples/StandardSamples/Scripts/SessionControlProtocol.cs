@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Text;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.P2P;
+
+    /// <summary>
+    /// Kinds of Session control messages exchanged between a Session Owner
+    /// and its members by <see cref="EOSSessionsManager"/>.
+    /// </summary>
+    public enum SessionControlMessageType : byte
+    {
+        /// <summary>A member tells the Owner that it joined the Session.</summary>
+        Join = 1,
+
+        /// <summary>A member tells the Owner that it left the Session.</summary>
+        Leave = 2,
+
+        /// <summary>The Owner tells members to re-acquire Session information.</summary>
+        Refresh = 3,
+
+        /// <summary>The Owner destroyed the Session; members should destroy their local copy.</summary>
+        Destroyed = 4,
+
+        /// <summary>The Owner started the Session.</summary>
+        Started = 5,
+
+        /// <summary>The Owner ended the Session.</summary>
+        Ended = 6,
+
+        /// <summary>The Owner sends the complete list of registered users.</summary>
+        RegisteredUsers = 7,
+    }
+
+    /// <summary>
+    /// A decoded Session control message. Instances are reused by
+    /// <see cref="SessionControlCodec.TryDecode"/>, so copy anything that
+    /// must outlive the next decode.
+    /// </summary>
+    public sealed class SessionControlMessage
+    {
+        public SessionControlMessageType Type { get; internal set; }
+        public string SessionId { get; internal set; }
+
+        /// <summary>
+        /// Registered users carried by a
+        /// <see cref="SessionControlMessageType.RegisteredUsers"/> message,
+        /// empty for all other types.
+        /// </summary>
+        public List<ProductUserId> RegisteredUsers { get; } = new();
+    }
+
+    /// <summary>
+    /// Compact binary framing for Session control messages, replacing the
+    /// formatted strings previously parsed with a regular expression.
+    ///
+    /// Layout:
+    /// <code>
+    /// [magic:1][version:1][type:1][flags:1]
+    /// [id entry: session id]
+    /// [varint: user count][user count x id entry]
+    /// </code>
+    /// An id entry is a varint tag <c>(length &lt;&lt; 1) | packed</c>
+    /// followed by <c>length</c> bytes. EOS ids are 32 lowercase hex
+    /// characters and are packed into 16 bytes; anything else is sent as
+    /// UTF-8. This keeps a 64-player registration list within
+    /// <see cref="P2PInterface.MAX_PACKET_SIZE"/>.
+    ///
+    /// The sender is not part of the message, receivers use the peer id
+    /// reported by the P2P interface.
+    ///
+    /// Encoded and decoded ids are kept in small least recently used caches,
+    /// so after warm-up encoding and decoding the ids of the current Sessions
+    /// and their members do not allocate, while ids of peers seen long ago
+    /// are evicted instead of accumulating for the lifetime of the codec.
+    /// </summary>
+    public sealed class SessionControlCodec
+    {
+        public const byte Magic = 0xE5;
+        public const byte Version = 1;
+        public const int HeaderSize = 4;
+
+        /// <summary>
+        /// Number of user ids kept per direction. Comfortably more than the
+        /// members of the few Sessions a client is in at once.
+        /// </summary>
+        public const int UserIdCacheCapacity = 256;
+
+        /// <summary>
+        /// Number of Session ids kept per direction.
+        /// </summary>
+        public const int SessionIdCacheCapacity = 16;
+
+        private const int PackedIdLength = 16;
+        private const int HexIdLength = PackedIdLength * 2;
+
+        /// <summary>
+        /// An id in its wire representation.
+        /// </summary>
+        private readonly struct EncodedId
+        {
+            public readonly ulong High;
+            public readonly ulong Low;
+
+            // Set only for ids that can't be packed
+            public readonly byte[] Raw;
+
+            public EncodedId(ulong high, ulong low)
+            {
+                High = high;
+                Low = low;
+                Raw = null;
+            }
+
+            public EncodedId(byte[] raw)
+            {
+                High = 0;
+                Low = 0;
+                Raw = raw;
+            }
+
+            public int Length => Raw?.Length ?? PackedIdLength;
+        }
+
+        private readonly struct PackedId : IEquatable<PackedId>
+        {
+            public readonly ulong High;
+            public readonly ulong Low;
+
+            public PackedId(ulong high, ulong low)
+            {
+                High = high;
+                Low = low;
+            }
+
+            public bool Equals(PackedId other) => High == other.High && Low == other.Low;
+
+            public override bool Equals(object obj) => obj is PackedId other && Equals(other);
+
+            public override int GetHashCode() => (High ^ (Low * 0x9E3779B97F4A7C15UL)).GetHashCode();
+        }
+
+        /// <summary>
+        /// Fixed capacity map that evicts the least recently used entry.
+        /// Evicted nodes are reused, so a full cache does not allocate.
+        /// </summary>
+        private sealed class LruCache<TKey, TValue>
+        {
+            private readonly int _capacity;
+            private readonly Dictionary<TKey, LinkedListNode<KeyValuePair<TKey, TValue>>> _nodes;
+            private readonly LinkedList<KeyValuePair<TKey, TValue>> _order = new();
+
+            public LruCache(int capacity)
+            {
+                _capacity = capacity;
+                _nodes = new Dictionary<TKey, LinkedListNode<KeyValuePair<TKey, TValue>>>(capacity);
+            }
+
+            public bool TryGetValue(TKey key, out TValue value)
+            {
+                if (!_nodes.TryGetValue(key, out LinkedListNode<KeyValuePair<TKey, TValue>> node))
+                {
+                    value = default;
+                    return false;
+                }
+
+                if (node != _order.First)
+                {
+                    _order.Remove(node);
+                    _order.AddFirst(node);
+                }
+
+                value = node.Value.Value;
+                return true;
+            }
+
+            public void Add(TKey key, TValue value)
+            {
+                LinkedListNode<KeyValuePair<TKey, TValue>> node;
+                if (_nodes.Count >= _capacity)
+                {
+                    node = _order.Last;
+                    _order.RemoveLast();
+                    _nodes.Remove(node.Value.Key);
+                    node.Value = new KeyValuePair<TKey, TValue>(key, value);
+                }
+                else
+                {
+                    node = new LinkedListNode<KeyValuePair<TKey, TValue>>(new KeyValuePair<TKey, TValue>(key, value));
+                }
+
+                _order.AddFirst(node);
+                _nodes.Add(key, node);
+            }
+
+            public void Clear()
+            {
+                _nodes.Clear();
+                _order.Clear();
+            }
+        }
+
+        private readonly LruCache<ProductUserId, EncodedId> _encodedUserIds = new(UserIdCacheCapacity);
+        private readonly LruCache<string, EncodedId> _encodedSessionIds = new(SessionIdCacheCapacity);
+        private readonly LruCache<PackedId, ProductUserId> _decodedUserIds = new(UserIdCacheCapacity);
+        private readonly LruCache<PackedId, string> _decodedSessionIds = new(SessionIdCacheCapacity);
+
+        /// <summary>
+        /// Encodes a message into <paramref name="buffer"/>.
+        /// </summary>
+        /// <param name="buffer">Destination buffer.</param>
+        /// <param name="type">Message type.</param>
+        /// <param name="sessionId">EOS Game Services Session id the message is about.</param>
+        /// <param name="registeredUsers">
+        /// Registered users, only sent with <see cref="SessionControlMessageType.RegisteredUsers"/>.
+        /// </param>
+        /// <returns>The encoded length, or -1 if the message does not fit.</returns>
+        public int Encode(byte[] buffer, SessionControlMessageType type, string sessionId, List<ProductUserId> registeredUsers = null)
+        {
+            if (buffer.Length < HeaderSize)
+            {
+                return -1;
+            }
+
+            buffer[0] = Magic;
+            buffer[1] = Version;
+            buffer[2] = (byte)type;
+            buffer[3] = 0;
+            int offset = HeaderSize;
+
+            if (!TryWriteId(buffer, ref offset, EncodeSessionId(sessionId)))
+            {
+                return -1;
+            }
+
+            int userCount = type == SessionControlMessageType.RegisteredUsers && registeredUsers != null ? registeredUsers.Count : 0;
+            if (!TryWriteVarint(buffer, ref offset, (uint)userCount))
+            {
+                return -1;
+            }
+
+            for (int i = 0; i < userCount; ++i)
+            {
+                if (!TryWriteId(buffer, ref offset, EncodeUserId(registeredUsers[i])))
+                {
+                    return -1;
+                }
+            }
+
+            return offset;
+        }
+
+        /// <summary>
+        /// Decodes a message received from a peer.
+        /// </summary>
+        /// <param name="packet">The received bytes.</param>
+        /// <param name="message">Reused message to decode into.</param>
+        /// <returns>False if the packet is not a well formed Session control message.</returns>
+        public bool TryDecode(ArraySegment<byte> packet, SessionControlMessage message)
+        {
+            message.RegisteredUsers.Clear();
+            message.SessionId = null;
+
+            byte[] buffer = packet.Array;
+            int offset = packet.Offset;
+            int end = packet.Offset + packet.Count;
+
+            if (packet.Count < HeaderSize || buffer[offset] != Magic || buffer[offset + 1] != Version)
+            {
+                return false;
+            }
+
+            message.Type = (SessionControlMessageType)buffer[offset + 2];
+            offset += HeaderSize;
+
+            if (!TryReadId(buffer, ref offset, end, out bool packed, out PackedId packedId, out int rawOffset, out int rawLength))
+            {
+                return false;
+            }
+
+            message.SessionId = packed ? DecodeSessionId(packedId) : Encoding.UTF8.GetString(buffer, rawOffset, rawLength);
+
+            if (!TryReadVarint(buffer, ref offset, end, out uint userCount))
+            {
+                return false;
+            }
+
+            for (uint i = 0; i < userCount; ++i)
+            {
+                if (!TryReadId(buffer, ref offset, end, out packed, out packedId, out rawOffset, out rawLength))
+                {
+                    return false;
+                }
+
+                message.RegisteredUsers.Add(packed ? DecodeUserId(packedId) : ProductUserId.FromString(Encoding.UTF8.GetString(buffer, rawOffset, rawLength)));
+            }
+
+            return offset == end;
+        }
+
+        /// <summary>
+        /// Drops all cached ids, for example when the local user logs out or
+        /// leaves their last Session.
+        /// </summary>
+        public void Clear()
+        {
+            _encodedUserIds.Clear();
+            _encodedSessionIds.Clear();
+            _decodedUserIds.Clear();
+            _decodedSessionIds.Clear();
+        }
+
+        private EncodedId EncodeUserId(ProductUserId userId)
+        {
+            if (!_encodedUserIds.TryGetValue(userId, out EncodedId encoded))
+            {
+                encoded = EncodeIdString(userId.ToString());
+                _encodedUserIds.Add(userId, encoded);
+            }
+
+            return encoded;
+        }
+
+        private EncodedId EncodeSessionId(string sessionId)
+        {
+            sessionId ??= string.Empty;
+
+            if (!_encodedSessionIds.TryGetValue(sessionId, out EncodedId encoded))
+            {
+                encoded = EncodeIdString(sessionId);
+                _encodedSessionIds.Add(sessionId, encoded);
+            }
+
+            return encoded;
+        }
+
+        private ProductUserId DecodeUserId(PackedId packedId)
+        {
+            if (!_decodedUserIds.TryGetValue(packedId, out ProductUserId userId))
+            {
+                userId = ProductUserId.FromString(UnpackHex(packedId));
+                _decodedUserIds.Add(packedId, userId);
+            }
+
+            return userId;
+        }
+
+        private string DecodeSessionId(PackedId packedId)
+        {
+            if (!_decodedSessionIds.TryGetValue(packedId, out string sessionId))
+            {
+                sessionId = UnpackHex(packedId);
+                _decodedSessionIds.Add(packedId, sessionId);
+            }
+
+            return sessionId;
+        }
+
+        private static EncodedId EncodeIdString(string id)
+        {
+            if (id.Length == HexIdLength)
+            {
+                ulong high = 0;
+                ulong low = 0;
+                bool isLowercaseHex = true;
+
+                for (int i = 0; i < HexIdLength && isLowercaseHex; ++i)
+                {
+                    int nibble = HexValue(id[i]);
+                    if (nibble < 0)
+                    {
+                        isLowercaseHex = false;
+                    }
+                    else if (i < HexIdLength / 2)
+                    {
+                        high = (high << 4) | (uint)nibble;
+                    }
+                    else
+                    {
+                        low = (low << 4) | (uint)nibble;
+                    }
+                }
+
+                if (isLowercaseHex)
+                {
+                    return new EncodedId(high, low);
+                }
+            }
+
+            return new EncodedId(Encoding.UTF8.GetBytes(id));
+        }
+
+        private static int HexValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+
+            if (c >= 'a' && c <= 'f')
+            {
+                return c - 'a' + 10;
+            }
+
+            return -1;
+        }
+
+        private static string UnpackHex(PackedId packedId)
+        {
+            const string hexDigits = "0123456789abcdef";
+
+            char[] chars = new char[HexIdLength];
+            for (int i = 0; i < HexIdLength / 2; ++i)
+            {
+                int shift = (HexIdLength / 2 - 1 - i) * 4;
+                chars[i] = hexDigits[(int)((packedId.High >> shift) & 0xF)];
+                chars[i + HexIdLength / 2] = hexDigits[(int)((packedId.Low >> shift) & 0xF)];
+            }
+
+            return new string(chars);
+        }
+
+        private static bool TryWriteId(byte[] buffer, ref int offset, in EncodedId id)
+        {
+            bool packed = id.Raw == null;
+            uint tag = ((uint)id.Length << 1) | (packed ? 1u : 0u);
+
+            if (!TryWriteVarint(buffer, ref offset, tag) || offset + id.Length > buffer.Length)
+            {
+                return false;
+            }
+
+            if (packed)
+            {
+                WriteUInt64BigEndian(buffer, offset, id.High);
+                WriteUInt64BigEndian(buffer, offset + 8, id.Low);
+            }
+            else
+            {
+                Buffer.BlockCopy(id.Raw, 0, buffer, offset, id.Raw.Length);
+            }
+
+            offset += id.Length;
+            return true;
+        }
+
+        private static bool TryReadId(byte[] buffer, ref int offset, int end, out bool packed, out PackedId packedId, out int rawOffset, out int rawLength)
+        {
+            packedId = default;
+            rawOffset = 0;
+            rawLength = 0;
+            packed = false;
+
+            if (!TryReadVarint(buffer, ref offset, end, out uint tag))
+            {
+                return false;
+            }
+
+            packed = (tag & 1) != 0;
+            uint length = tag >> 1;
+
+            if (length > (uint)(end - offset) || (packed && length != PackedIdLength))
+            {
+                return false;
+            }
+
+            if (packed)
+            {
+                packedId = new PackedId(ReadUInt64BigEndian(buffer, offset), ReadUInt64BigEndian(buffer, offset + 8));
+            }
+            else
+            {
+                rawOffset = offset;
+                rawLength = (int)length;
+            }
+
+            offset += (int)length;
+            return true;
+        }
+
+        private static bool TryWriteVarint(byte[] buffer, ref int offset, uint value)
+        {
+            do
+            {
+                if (offset >= buffer.Length)
+                {
+                    return false;
+                }
+
+                byte next = (byte)(value & 0x7F);
+                value >>= 7;
+                buffer[offset++] = value != 0 ? (byte)(next | 0x80) : next;
+            }
+            while (value != 0);
+
+            return true;
+        }
+
+        private static bool TryReadVarint(byte[] buffer, ref int offset, int end, out uint value)
+        {
+            value = 0;
+
+            // A uint needs at most five 7-bit groups
+            for (int shift = 0; shift < 35; shift += 7)
+            {
+                if (offset >= end)
+                {
+                    return false;
+                }
+
+                byte next = buffer[offset++];
+                value |= (uint)(next & 0x7F) << shift;
+
+                if ((next & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        private static void WriteUInt64BigEndian(byte[] buffer, int offset, ulong value)
+        {
+            for (int i = 7; i >= 0; --i)
+            {
+                buffer[offset + i] = (byte)value;
+                value >>= 8;
+            }
+        }
+
+        private static ulong ReadUInt64BigEndian(byte[] buffer, int offset)
+        {
+            ulong value = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                value = (value << 8) | buffer[offset + i];
+            }
+
+            return value;
+        }
+    }
+}
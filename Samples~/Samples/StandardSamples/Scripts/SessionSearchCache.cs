@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Text;
+
+    using UnityEngine;
+
+    using Epic.OnlineServices;
+    using Epic.OnlineServices.Sessions;
+
+    /// <summary>
+    /// Caches the results of <see cref="EOSSessionsManager.Search"/>, keyed
+    /// by the normalized search parameters, so that repeating a search
+    /// within <see cref="TimeToLiveSeconds"/> does not go back to the EOS
+    /// back end. Each entry indexes its results by attribute so that they
+    /// can be filtered and sorted client-side.
+    ///
+    /// The cache owns the <see cref="SessionDetails"/> handles of its
+    /// entries and releases them when an entry is evicted or replaced. The
+    /// entry named by <see cref="PinnedKey"/> (the results currently on
+    /// display) is never evicted by expiry or capacity.
+    /// </summary>
+    public class SessionSearchCache
+    {
+        public const float DefaultTimeToLiveSeconds = 30.0f;
+        public const int DefaultCapacity = 8;
+
+        /// <summary>
+        /// The results of one search, together with their attribute index.
+        /// </summary>
+        public class Entry
+        {
+            private struct IndexedSession
+            {
+                public Session Session;
+                public SessionAttribute Attribute;
+            }
+
+            public string Key { get; }
+            public Dictionary<Session, SessionDetails> Results { get; }
+            public float FetchedAt { get; }
+
+            internal float LastAccessedAt;
+
+            // Per attribute key, the sessions that have that attribute,
+            // sorted ascending by its value. Built on first use.
+            private readonly Dictionary<string, List<IndexedSession>> _sortedByAttribute =
+                new(StringComparer.OrdinalIgnoreCase);
+
+            internal Entry(string key, Dictionary<Session, SessionDetails> results, float now)
+            {
+                Key = key;
+                Results = results;
+                FetchedAt = now;
+                LastAccessedAt = now;
+            }
+
+            public bool IsExpired(float now, float timeToLiveSeconds)
+            {
+                return now - FetchedAt >= timeToLiveSeconds;
+            }
+
+            /// <summary>
+            /// Appends the results that have the attribute
+            /// <paramref name="attributeKey"/> to <paramref name="output"/>,
+            /// ordered by its value. Sessions without the attribute are
+            /// skipped.
+            /// </summary>
+            /// <returns>The number of sessions appended.</returns>
+            public int GetSortedByAttribute(string attributeKey, bool descending, List<Session> output)
+            {
+                List<IndexedSession> sorted = GetIndex(attributeKey);
+
+                if (descending)
+                {
+                    for (int i = sorted.Count - 1; i >= 0; --i)
+                    {
+                        output.Add(sorted[i].Session);
+                    }
+                }
+                else
+                {
+                    foreach (IndexedSession indexed in sorted)
+                    {
+                        output.Add(indexed.Session);
+                    }
+                }
+
+                return sorted.Count;
+            }
+
+            /// <summary>
+            /// Appends the results whose attribute
+            /// <paramref name="attributeKey"/> compares to
+            /// <paramref name="operand"/> as <paramref name="comparison"/>
+            /// requires, in ascending attribute order. Supports the equality
+            /// and ordering operators plus <see cref="ComparisonOp.Contains"/>
+            /// for strings; values of a different type than the operand never
+            /// match.
+            /// </summary>
+            /// <returns>The number of sessions appended.</returns>
+            public int Filter(string attributeKey, ComparisonOp comparison, SessionAttribute operand, List<Session> output)
+            {
+                List<IndexedSession> sorted = GetIndex(attributeKey);
+
+                // [lower, upper) is the range of values equal to the operand
+                int lower = LowerBound(sorted, operand, false);
+                int upper = LowerBound(sorted, operand, true);
+                int countBefore = output.Count;
+
+                switch (comparison)
+                {
+                    case ComparisonOp.Equal:
+                        AppendRange(sorted, lower, upper, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Notequal:
+                        AppendRange(sorted, 0, lower, operand.ValueType, output);
+                        AppendRange(sorted, upper, sorted.Count, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Greaterthan:
+                        AppendRange(sorted, upper, sorted.Count, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Greaterthanorequal:
+                        AppendRange(sorted, lower, sorted.Count, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Lessthan:
+                        AppendRange(sorted, 0, lower, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Lessthanorequal:
+                        AppendRange(sorted, 0, upper, operand.ValueType, output);
+                        break;
+                    case ComparisonOp.Contains:
+                        foreach (IndexedSession indexed in sorted)
+                        {
+                            if (indexed.Attribute.ValueType == AttributeType.String &&
+                                operand.AsString != null &&
+                                indexed.Attribute.AsString != null &&
+                                indexed.Attribute.AsString.IndexOf(operand.AsString, StringComparison.OrdinalIgnoreCase) >= 0)
+                            {
+                                output.Add(indexed.Session);
+                            }
+                        }
+                        break;
+                    default:
+                        Debug.LogWarning($"{nameof(SessionSearchCache)} ({nameof(Filter)}): comparison {comparison} is not supported for local filtering.");
+                        break;
+                }
+
+                return output.Count - countBefore;
+            }
+
+            internal void Release()
+            {
+                foreach (SessionDetails sessionHandle in Results.Values)
+                {
+                    sessionHandle?.Release();
+                }
+
+                Results.Clear();
+                _sortedByAttribute.Clear();
+            }
+
+            private List<IndexedSession> GetIndex(string attributeKey)
+            {
+                if (_sortedByAttribute.TryGetValue(attributeKey, out List<IndexedSession> sorted))
+                {
+                    return sorted;
+                }
+
+                sorted = new List<IndexedSession>(Results.Count);
+                foreach (Session session in Results.Keys)
+                {
+                    SessionAttribute attribute = session.Attributes.Find(x => string.Equals(x.Key, attributeKey, StringComparison.OrdinalIgnoreCase));
+                    if (attribute != null)
+                    {
+                        sorted.Add(new IndexedSession() { Session = session, Attribute = attribute });
+                    }
+                }
+
+                sorted.Sort((left, right) => CompareValues(left.Attribute, right.Attribute));
+                _sortedByAttribute.Add(attributeKey, sorted);
+
+                return sorted;
+            }
+
+            /// <summary>
+            /// Index of the first element not less than the operand, or with
+            /// <paramref name="upper"/> set, the first element greater than it.
+            /// </summary>
+            private static int LowerBound(List<IndexedSession> sorted, SessionAttribute operand, bool upper)
+            {
+                int low = 0;
+                int high = sorted.Count;
+
+                while (low < high)
+                {
+                    int mid = low + (high - low) / 2;
+                    int comparison = CompareValues(sorted[mid].Attribute, operand);
+
+                    if (comparison < 0 || (upper && comparison == 0))
+                    {
+                        low = mid + 1;
+                    }
+                    else
+                    {
+                        high = mid;
+                    }
+                }
+
+                return low;
+            }
+
+            private static void AppendRange(List<IndexedSession> sorted, int start, int end, AttributeType valueType, List<Session> output)
+            {
+                for (int i = start; i < end; ++i)
+                {
+                    if (sorted[i].Attribute.ValueType == valueType)
+                    {
+                        output.Add(sorted[i].Session);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Seconds after which a cached search is fetched again.
+        /// </summary>
+        public float TimeToLiveSeconds { get; set; } = DefaultTimeToLiveSeconds;
+
+        /// <summary>
+        /// Maximum number of searches kept; the least recently used one is
+        /// evicted first.
+        /// </summary>
+        public int Capacity { get; set; } = DefaultCapacity;
+
+        /// <summary>
+        /// Key of the entry whose results are currently in use, which is
+        /// exempt from eviction until another entry is pinned.
+        /// </summary>
+        public string PinnedKey { get; set; }
+
+        public int Count => _entries.Count;
+
+        private readonly Dictionary<string, Entry> _entries = new();
+        private readonly List<Entry> _evictionScratch = new();
+
+        /// <summary>
+        /// Builds the cache key for a search. Attributes are ordered by key
+        /// and keys are compared without regard to case, so equivalent
+        /// searches share an entry.
+        /// </summary>
+        public static string MakeKey(string bucketId, List<SessionAttribute> attributes)
+        {
+            StringBuilder keyBuilder = new(bucketId);
+
+            if (attributes != null && attributes.Count > 0)
+            {
+                List<SessionAttribute> orderedAttributes = new(attributes);
+                orderedAttributes.Sort((left, right) => string.Compare(left.Key, right.Key, StringComparison.OrdinalIgnoreCase));
+
+                foreach (SessionAttribute attribute in orderedAttributes)
+                {
+                    keyBuilder.Append('\n')
+                        .Append(attribute.Key?.ToUpperInvariant())
+                        .Append(':')
+                        .Append((int)attribute.ValueType)
+                        .Append('=');
+
+                    switch (attribute.ValueType)
+                    {
+                        case AttributeType.Boolean:
+                            keyBuilder.Append(attribute.AsBool);
+                            break;
+                        case AttributeType.Int64:
+                            keyBuilder.Append(attribute.AsInt64);
+                            break;
+                        case AttributeType.Double:
+                            keyBuilder.Append(attribute.AsDouble?.ToString("R", System.Globalization.CultureInfo.InvariantCulture));
+                            break;
+                        case AttributeType.String:
+                            keyBuilder.Append(attribute.AsString);
+                            break;
+                    }
+                }
+            }
+
+            return keyBuilder.ToString();
+        }
+
+        /// <summary>
+        /// Orders two attribute values, first by type and then by value.
+        /// Strings are compared ordinally.
+        /// </summary>
+        public static int CompareValues(SessionAttribute left, SessionAttribute right)
+        {
+            if (left.ValueType != right.ValueType)
+            {
+                return left.ValueType.CompareTo(right.ValueType);
+            }
+
+            switch (left.ValueType)
+            {
+                case AttributeType.Boolean:
+                    return Nullable.Compare(left.AsBool, right.AsBool);
+                case AttributeType.Int64:
+                    return Nullable.Compare(left.AsInt64, right.AsInt64);
+                case AttributeType.Double:
+                    return Nullable.Compare(left.AsDouble, right.AsDouble);
+                case AttributeType.String:
+                    return string.CompareOrdinal(left.AsString, right.AsString);
+                default:
+                    return 0;
+            }
+        }
+
+        /// <summary>
+        /// Looks up an unexpired entry. An expired entry found under the key
+        /// is evicted unless pinned, but is never returned.
+        /// </summary>
+        public bool TryGet(string key, float now, out Entry entry)
+        {
+            if (!_entries.TryGetValue(key, out entry))
+            {
+                return false;
+            }
+
+            if (entry.IsExpired(now, TimeToLiveSeconds))
+            {
+                if (key != PinnedKey)
+                {
+                    Evict(entry);
+                }
+
+                entry = null;
+                return false;
+            }
+
+            entry.LastAccessedAt = now;
+            return true;
+        }
+
+        /// <summary>
+        /// Stores the results of a search, taking ownership of their
+        /// <see cref="SessionDetails"/> handles. Any previous entry with the
+        /// same key is released, then the least recently used entries are
+        /// evicted until the cache is within <see cref="Capacity"/>.
+        /// </summary>
+        public Entry Add(string key, Dictionary<Session, SessionDetails> results, float now)
+        {
+            if (_entries.TryGetValue(key, out Entry previous))
+            {
+                Evict(previous);
+            }
+
+            Entry entry = new(key, results, now);
+            _entries.Add(key, entry);
+
+            while (_entries.Count > Math.Max(Capacity, 1))
+            {
+                Entry leastRecentlyUsed = null;
+                foreach (Entry candidate in _entries.Values)
+                {
+                    if (candidate == entry || candidate.Key == PinnedKey)
+                    {
+                        continue;
+                    }
+
+                    if (leastRecentlyUsed == null || candidate.LastAccessedAt < leastRecentlyUsed.LastAccessedAt)
+                    {
+                        leastRecentlyUsed = candidate;
+                    }
+                }
+
+                if (leastRecentlyUsed == null)
+                {
+                    break;
+                }
+
+                Evict(leastRecentlyUsed);
+            }
+
+            return entry;
+        }
+
+        /// <summary>
+        /// Evicts every expired entry other than the pinned one.
+        /// </summary>
+        public void EvictExpired(float now)
+        {
+            foreach (Entry entry in _entries.Values)
+            {
+                if (entry.Key != PinnedKey && entry.IsExpired(now, TimeToLiveSeconds))
+                {
+                    _evictionScratch.Add(entry);
+                }
+            }
+
+            foreach (Entry entry in _evictionScratch)
+            {
+                Evict(entry);
+            }
+
+            _evictionScratch.Clear();
+        }
+
+        /// <summary>
+        /// Evicts every entry, including the pinned one.
+        /// </summary>
+        public void Clear()
+        {
+            foreach (Entry entry in _entries.Values)
+            {
+                entry.Release();
+            }
+
+            _entries.Clear();
+            PinnedKey = null;
+        }
+
+        private void Evict(Entry entry)
+        {
+            _entries.Remove(entry.Key);
+            entry.Release();
+        }
+    }
+}
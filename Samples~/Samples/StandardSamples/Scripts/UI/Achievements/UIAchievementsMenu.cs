@@ -79,6 +79,23 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         {
             base.OnDestroy();
             AchievementsService.Instance.Updated -= OnAchievementDataUpdated;
+            ReleaseIcons();
+        }
+
+        private void ReleaseIcons()
+        {
+            foreach (AchievementData achievementData in achievementDataList)
+            {
+                ReleaseIcons(achievementData);
+            }
+        }
+
+        private static void ReleaseIcons(AchievementData achievementData)
+        {
+            AchievementsService.Instance.ReleaseAchievementIconTexture(achievementData.UnlockedIcon);
+            AchievementsService.Instance.ReleaseAchievementIconTexture(achievementData.LockedIcon);
+            achievementData.UnlockedIcon = null;
+            achievementData.LockedIcon = null;
         }
 
         public async void IncrementLoginStat()
@@ -126,6 +143,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 Destroy(item.gameObject);
             }
             achievementListItems.Clear();
+            ReleaseIcons();
             achievementDataList.Clear();
 
             uint achievementDefCount = AchievementsService.GetAchievementsCount();
@@ -157,11 +175,15 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 scrollRect.gameObject.SetActive(true);
                 scrollRect.content.sizeDelta = new Vector2(0, achievementDefCount * 30);
 
+                // Buttons are added in order up front, while their icons load concurrently
                 List<AchievementData> achievementDataListCopy = new(achievementDataList);
+                List<Task> addButtonTasks = new();
                 foreach (var achievementData in achievementDataListCopy)
                 {
-                    await AddAchievementButton(achievementData);
+                    addButtonTasks.Add(AddAchievementButton(achievementData));
                 }
+
+                await Task.WhenAll(addButtonTasks);
             }
             else
             {
@@ -185,11 +207,18 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             bool unlocked = achievement.PlayerData.HasValue && achievement.PlayerData.Value.Progress >= 1;
 
-            achievement.UnlockedIcon = 
-                await AchievementsService.Instance.GetAchievementUnlockedIconTexture(achievementId);
+            Task<Texture2D> unlockedIconTask = AchievementsService.Instance.GetAchievementUnlockedIconTexture(achievementId);
+            Task<Texture2D> lockedIconTask = AchievementsService.Instance.GetAchievementLockedIconTexture(achievementId);
+
+            achievement.UnlockedIcon = await unlockedIconTask;
+            achievement.LockedIcon = await lockedIconTask;
 
-            achievement.LockedIcon =
-                await AchievementsService.Instance.GetAchievementLockedIconTexture(achievementId);
+            // The list was rebuilt or the menu destroyed while the icons loaded
+            if (this == null || !achievementDataList.Contains(achievement))
+            {
+                ReleaseIcons(achievement);
+                return;
+            }
 
             Texture2D iconTexture = unlocked ? achievement.UnlockedIcon : achievement.LockedIcon;
 
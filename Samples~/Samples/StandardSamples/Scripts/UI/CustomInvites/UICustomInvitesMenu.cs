@@ -62,6 +62,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             EOSManager.Instance.RemoveManager<EOSCustomInvitesManager>();
         }
 
+        protected override void Update()
+        {
+            base.Update();
+            FriendsManager?.Update();
+        }
+
         protected override void HideInternal()
         {
             if (EOSManager.Instance.GetProductUserId()?.IsValid() == true)
@@ -127,6 +127,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         protected override void Update()
         {
             base.Update();
+            FriendsManager?.Update();
 #if ENABLE_INPUT_SYSTEM
             var gamepad = Gamepad.current;
             if (gamepad != null && gamepad.rightShoulder.wasPressedThisFrame)
@@ -49,6 +49,9 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         public GameObject LeaderboardEntriesContentParent;
         public GameObject UILeaderboardEntryPrefab;
 
+        public Button PreviousRecordsButton;
+        public Button NextRecordsButton;
+
         public UIConsoleInputField ingestStatValueInput;
 
         private string currentSelectedDefinitionLeaderboardId = string.Empty;
@@ -80,12 +83,21 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         /// </summary>
         private Coroutine refreshLeaderboardCoroutine { get; set; }
 
+        /// <summary>
+        /// Number of global records shown at once. Only the records in view are copied out of the EOS cache.
+        /// </summary>
+        public int RecordsPerWindow = LeaderboardRecordPager.DefaultPageSize;
+
+        private int recordWindowStart = 0;
+        private readonly List<LeaderboardRecord> recordWindow = new List<LeaderboardRecord>();
+
         private void Start()
         {
             PlayerManager = EOSManager.Instance.GetOrCreateManager<EOSFriendsManager>();
             LeaderboardManager = EOSManager.Instance.GetOrCreateManager<EOSLeaderboardManager>();
 
             CurrentSelectedLeaderboardTxt.text = "*select definition*";
+            UpdateRecordPagingButtons();
         }
 
         protected override void OnDestroy()
@@ -95,9 +107,16 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             EOSManager.Instance.RemoveManager<EOSLeaderboardManager>();
         }
 
+        protected override void Update()
+        {
+            base.Update();
+            PlayerManager?.Update();
+        }
+
         private void DefinitionListOnClick(string leaderboardId)
         {
             currentSelectedDefinitionLeaderboardId = leaderboardId;
+            recordWindowStart = 0;
 
             Definition? leaderboard = LeaderboardManager.GetCachedDefinitionFromId(leaderboardId);
 
@@ -131,40 +150,98 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                 return;
             }
 
-            // Update UI
-            if(LeaderboardManager.GetCachedLeaderboardRecords(out List<LeaderboardRecord> leaderboardRecords))
+            DisplayRecordWindow();
+
+            if (refreshLeaderboardCoroutine != null)
             {
-                Debug.LogFormat("Display Leaderboard Records: Count={0}", leaderboardRecords.Count);
+                StopCoroutine(refreshLeaderboardCoroutine);
+            }
+            refreshLeaderboardCoroutine = StartCoroutine(RefreshCurrentLeaderboardAfterWait(SecondsBetweenLeaderboardRefreshes));
+        }
 
-                // Destroy current entries
-                foreach (Transform child in LeaderboardEntriesContentParent.transform)
-                {
-                    GameObject.Destroy(child.gameObject);
-                }
+        private void DisplayRecordWindow()
+        {
+            int recordCount = LeaderboardManager.GetLeaderboardRecordCount();
+            recordWindowStart = Mathf.Clamp(recordWindowStart, 0, Mathf.Max(0, recordCount - 1));
 
-                foreach (LeaderboardRecord record in leaderboardRecords)
-                {
-                    Debug.LogFormat("    Record: UserName={0} ({1}), Rank={2}, Score={3} ", record.UserDisplayName, record.UserId, record.Rank, record.Score);
+            if (!LeaderboardManager.GetLeaderboardRecordWindow(recordWindowStart, RecordsPerWindow, recordWindow))
+            {
+                Debug.LogError("UILeaderboardMenu (DisplayRecordWindow): Not all records in window could be copied");
+            }
+
+            Debug.LogFormat("Display Leaderboard Records: {0}-{1} of {2}", recordWindowStart, recordWindowStart + recordWindow.Count, recordCount);
 
-                    // Display in UI
+            // Destroy current entries
+            foreach (Transform child in LeaderboardEntriesContentParent.transform)
+            {
+                GameObject.Destroy(child.gameObject);
+            }
 
-                    GameObject entryUIObj = Instantiate(UILeaderboardEntryPrefab, LeaderboardEntriesContentParent.transform);
+            foreach (LeaderboardRecord record in recordWindow)
+            {
+                Debug.LogFormat("    Record: UserName={0} ({1}), Rank={2}, Score={3} ", record.UserDisplayName, record.UserId, record.Rank, record.Score);
 
-                    UILeaderboardEntry uiEntry = entryUIObj.GetComponent<UILeaderboardEntry>();
+                // Display in UI
 
-                    if(uiEntry != null)
-                    {
-                        uiEntry.RankTxt.text = record.Rank.ToString();
-                        uiEntry.NameTxt.text = record.UserDisplayName;
-                        uiEntry.ScoreTxt.text = record.Score.ToString();
-                    }
-                }
+                GameObject entryUIObj = Instantiate(UILeaderboardEntryPrefab, LeaderboardEntriesContentParent.transform);
 
-                if (refreshLeaderboardCoroutine != null)
+                UILeaderboardEntry uiEntry = entryUIObj.GetComponent<UILeaderboardEntry>();
+
+                if(uiEntry != null)
                 {
-                    StopCoroutine(refreshLeaderboardCoroutine);
+                    uiEntry.RankTxt.text = record.Rank.ToString();
+                    uiEntry.NameTxt.text = record.UserDisplayName;
+                    uiEntry.ScoreTxt.text = record.Score.ToString();
                 }
-                refreshLeaderboardCoroutine = StartCoroutine(RefreshCurrentLeaderboardAfterWait(SecondsBetweenLeaderboardRefreshes));
+            }
+
+            UpdateRecordPagingButtons();
+        }
+
+        /// <summary>
+        /// Enables the previous and next buttons only when there are global records to page to.
+        /// </summary>
+        private void UpdateRecordPagingButtons()
+        {
+            bool isGlobal = currentGroup == LeaderboardGroup.Global && !string.IsNullOrEmpty(currentSelectedDefinitionLeaderboardId);
+            int recordCount = isGlobal ? LeaderboardManager.GetLeaderboardRecordCount() : 0;
+
+            if (PreviousRecordsButton != null)
+            {
+                PreviousRecordsButton.interactable = isGlobal && recordWindowStart > 0;
+            }
+
+            if (NextRecordsButton != null)
+            {
+                NextRecordsButton.interactable = isGlobal && recordWindowStart + RecordsPerWindow < recordCount;
+            }
+        }
+
+        public void ShowNextRecordsOnClick()
+        {
+            if (currentGroup != LeaderboardGroup.Global)
+            {
+                return;
+            }
+
+            if (recordWindowStart + RecordsPerWindow < LeaderboardManager.GetLeaderboardRecordCount())
+            {
+                recordWindowStart += RecordsPerWindow;
+                DisplayRecordWindow();
+            }
+        }
+
+        public void ShowPreviousRecordsOnClick()
+        {
+            if (currentGroup != LeaderboardGroup.Global)
+            {
+                return;
+            }
+
+            if (recordWindowStart > 0)
+            {
+                recordWindowStart = Mathf.Max(0, recordWindowStart - RecordsPerWindow);
+                DisplayRecordWindow();
             }
         }
 
@@ -208,6 +285,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 currentGroup = LeaderboardGroup.Friends;
                 SetCurrentLeaderboardDescription();
+                UpdateRecordPagingButtons();
 
                 List<ProductUserId> friends = new List<ProductUserId>();
 
@@ -79,7 +79,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         public Toggle InvitePresence;
         
         // UI Cache
+        // Lobby and member attribute writes made within this window are sent as one lobby update
+        private const float ModificationBatchWindowSeconds = 0.25f;
+
         private int lastMemberCount = 0;
+        private bool membershipChanged = false;
         private ProductUserId currentLobbyOwnerCache;
         private bool lastCurrentLobbyIsValid = false;
 
@@ -117,6 +121,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
 
             LobbyManager.AddNotifyMemberUpdateReceived(OnMemberUpdate);
+            LobbyManager.GetModificationQueue().BatchWindowSeconds = ModificationBatchWindowSeconds;
+            LobbyManager.CurrentLobbySnapshotChanged += OnCurrentLobbySnapshotChanged;
             CurrentLobbyPanel.SetActive(false);
 
             if (ONANDROIDPLATFORM){
@@ -155,6 +161,10 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             UIActions.OnExpandFriendsTab -= DisableInterferingUIForFriendsTab;
 
             LobbyManager?.RemoveNotifyMemberUpdate(OnMemberUpdate);
+            if (LobbyManager != null)
+            {
+                LobbyManager.CurrentLobbySnapshotChanged -= OnCurrentLobbySnapshotChanged;
+            }
 
             EOSManager.Instance.RemoveManager<EOSLobbyManager>();
             EOSManager.Instance.RemoveManager<EOSFriendsManager>();
@@ -182,9 +192,22 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
         }
 
+        private void OnCurrentLobbySnapshotChanged(Lobby lobby, LobbySnapshotChange change)
+        {
+            // A member can leave and another join in the same update, which keeps the count unchanged
+            if (change.ChangeType == LobbySnapshotChangeType.MemberJoined ||
+                change.ChangeType == LobbySnapshotChangeType.MemberLeft)
+            {
+                membershipChanged = true;
+            }
+        }
+
         protected override void Update()
         {
             base.Update();
+            LobbyManager?.Update();
+            FriendsManager?.Update();
+
             ProductUserId productUserId = EOSManager.Instance.GetProductUserId();
             if (productUserId == null || !productUserId.IsValid())
             {
@@ -221,10 +244,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     currentLobbyOwnerCache = currentLobby.LobbyOwner;
                 }
 
-                // Only update if MemberCount changes
-                if (lastMemberCount != currentLobby.Members.Count || ownerChanged)
+                // Only update if membership changes
+                if (lastMemberCount != currentLobby.Members.Count || membershipChanged || ownerChanged)
                 {
                     lastMemberCount = currentLobby.Members.Count;
+                    membershipChanged = false;
 
                     // Destroy current UI member list
                     foreach (Transform child in MemberContentParent.transform)
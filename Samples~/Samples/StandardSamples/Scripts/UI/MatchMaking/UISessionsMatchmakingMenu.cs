@@ -327,11 +327,16 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
         public void RefreshSearch()
         {
-            SearchByLevelEndEdit(SearchByLevelBox.InputField.text);
+            SearchByLevel(SearchByLevelBox.InputField.text, true);
         }
 
         // Search
         public void SearchByLevelEndEdit(string searchPattern)
+        {
+            SearchByLevel(searchPattern, false);
+        }
+
+        private void SearchByLevel(string searchPattern, bool forceRefresh)
         {
             if (string.IsNullOrEmpty(searchPattern))
             {
@@ -347,7 +352,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
 
             List<SessionAttribute> attributes = new List<SessionAttribute>() { levelAttribute };
 
-            GetEOSSessionsManager.Search(attributes);
+            GetEOSSessionsManager.Search(attributes, forceRefresh: forceRefresh);
 
             previousFrameResultCount = 0;
             ShowSearchResults = true;
@@ -48,6 +48,11 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         private EOSHighFrequencyPeer2PeerManager Peer2PeerManager;
         private EOSFriendsManager FriendsManager;
 
+        // Settings of the P2P benchmark started by the toggle
+        private P2PBenchmarkRunner benchmarkRunner;
+        private int benchmarkPacketSize = 1024;
+        private int benchmarkPacketsPerSecond = 60;
+
         private string currentChatDisplayName;
         private ProductUserId currentChatProductUserId;
 
@@ -75,16 +80,41 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             SendOnClick();
         }
 
+        /// <summary>
+        /// Starts the P2P benchmark with the packet size and rate entered in
+        /// the menu, or stops it if it's running. The results are logged when
+        /// every layer has been measured.
+        /// </summary>
         public void ToggleHighFrequencySending()
         {
-            if (Peer2PeerManager != null)
+            if (benchmarkRunner != null)
             {
-                Peer2PeerManager.sendActive = !Peer2PeerManager.sendActive;
+                Destroy(benchmarkRunner);
+                benchmarkRunner = null;
+                Debug.Log("UIPeer2PeerMenu (ToggleHighFrequencySending): Stopped the P2P benchmark.");
+                return;
             }
+
+            benchmarkRunner = gameObject.AddComponent<P2PBenchmarkRunner>();
+            benchmarkRunner.RunOnStart = false;
+            benchmarkRunner.RunCompleted += OnBenchmarkCompleted;
+            benchmarkRunner.Run(new P2PBenchmarkSettings
+            {
+                PacketSizes = new List<int> { benchmarkPacketSize },
+                PacketsPerSecond = new List<float> { benchmarkPacketsPerSecond }
+            });
+            Debug.Log($"UIPeer2PeerMenu (ToggleHighFrequencySending): Started the P2P benchmark with {benchmarkPacketSize} byte packets at {benchmarkPacketsPerSecond} packets per second.");
+        }
+
+        private void OnBenchmarkCompleted(IReadOnlyList<P2PBenchmarkRunner.CaseResult> results)
+        {
+            Destroy(benchmarkRunner);
+            benchmarkRunner = null;
         }
         protected override void Update()
         {
             base.Update();
+            FriendsManager?.Update();
             ProductUserId messageFromPlayer = Peer2PeerManager.HandleReceivedMessages();
             if (messageFromPlayer != null)
             {
@@ -95,12 +125,6 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             {
                 ParticlesOnClick();
             }
-
-            if (Peer2PeerManager.sendActive)
-            {
-                Peer2PeerManager.P2PUpdate();
-            }
-
         }
 
         public override FriendInteractionState GetFriendInteractionState(FriendData friendData)
@@ -274,8 +298,8 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
                     Debug.Log("Invalid value (negative): " + hz);
                     return;
                 }
-                Peer2PeerManager.refreshRate = refreshRate;
-                Debug.Log("Updated refresh rate to " + refreshRate + " Hz.");
+                benchmarkPacketsPerSecond = refreshRate;
+                Debug.Log("Updated benchmark rate to " + refreshRate + " packets per second.");
             }
             else
             {
@@ -283,30 +307,29 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             }
         }
 
-        public void SetPacketSize(string mb)
+        public void SetPacketSize(string bytes)
         {
-            if (string.IsNullOrEmpty(mb))
+            if (string.IsNullOrEmpty(bytes))
             {
                 Debug.Log("Invalid value: empty or null input.");
                 return;
             }
 
-            bool attemptParse = float.TryParse(mb, out float packetSizeMB);
+            bool attemptParse = int.TryParse(bytes, out int packetSize);
 
             if (attemptParse)
             {
-                if (packetSizeMB < 0)
+                if (packetSize <= 0 || packetSize > Epic.OnlineServices.P2P.P2PInterface.MAX_PACKET_SIZE)
                 {
-                    Debug.Log("Invalid value (negative): " + mb);
+                    Debug.Log($"Invalid value (not between 1 and {Epic.OnlineServices.P2P.P2PInterface.MAX_PACKET_SIZE}): " + bytes);
                     return;
                 }
-                Peer2PeerManager.packetSizeMB = packetSizeMB;
-                Peer2PeerManager.updatePacketSize();
-                Debug.Log("UIPeer2PeerMenu (SetPacketSize):Updated packet size to " + Peer2PeerManager.packetSizeMB + " Mb.");
+                benchmarkPacketSize = packetSize;
+                Debug.Log("UIPeer2PeerMenu (SetPacketSize): Updated benchmark packet size to " + benchmarkPacketSize + " bytes.");
             }
             else
             {
-                Debug.Log("Invalid value: " + mb);
+                Debug.Log("Invalid value: " + bytes);
             }
         }
 
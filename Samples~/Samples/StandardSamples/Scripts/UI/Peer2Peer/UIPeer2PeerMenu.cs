@@ -78,6 +78,7 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
         protected override void Update()
         {
             base.Update();
+            FriendsManager?.Update();
             ProductUserId messageFromPlayer = Peer2PeerManager.HandleReceivedMessages();
 
             if (messageFromPlayer != null)
@@ -64,6 +64,12 @@ namespace PlayEveryWare.EpicOnlineServices.Samples
             base.OnDestroy();
         }
 
+        protected override void Update()
+        {
+            base.Update();
+            FriendsManager?.Update();
+        }
+
         public void ReportButtonOnClick(ProductUserId userId, string playerName)
         {
             if(userId == null)
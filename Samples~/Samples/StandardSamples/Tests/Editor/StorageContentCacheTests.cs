@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024 PlayEveryWare
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+namespace PlayEveryWare.EpicOnlineServices.Samples.Tests
+{
+    using System;
+    using System.IO;
+    using System.Security.Cryptography;
+    using System.Text;
+    using NUnit.Framework;
+
+    public class StorageContentCacheTests
+    {
+        private const string FileName = "save.json";
+
+        private string _directory;
+
+        [SetUp]
+        public void CreateCacheDirectory()
+        {
+            _directory = Path.Combine(Path.GetTempPath(), "StorageContentCacheTests", Guid.NewGuid().ToString("N"));
+        }
+
+        [TearDown]
+        public void DeleteCacheDirectory()
+        {
+            if (Directory.Exists(_directory))
+            {
+                Directory.Delete(_directory, true);
+            }
+        }
+
+        /// <summary>
+        /// The hash the backend reports covers the file as it stores it,
+        /// with a header in front of the content, so it never matches a
+        /// hash of the content alone.
+        /// </summary>
+        private static string GetBackendHash(byte[] content)
+        {
+            byte[] header = Encoding.ASCII.GetBytes("EOS-FILE-HEADER");
+            byte[] file = new byte[header.Length + content.Length];
+            Buffer.BlockCopy(header, 0, file, 0, header.Length);
+            Buffer.BlockCopy(content, 0, file, header.Length, content.Length);
+
+            using MD5 md5 = MD5.Create();
+            return BitConverter.ToString(md5.ComputeHash(file)).Replace("-", string.Empty).ToLowerInvariant();
+        }
+
+        [Test]
+        public void TryRead_AfterStoreWithBackendHash_ReturnsStoredContent()
+        {
+            // Arrange
+            byte[] content = Encoding.UTF8.GetBytes("{\"level\":3}");
+            string backendHash = GetBackendHash(content);
+            Assert.IsFalse(StorageContentCache.HashesMatch(StorageContentCache.ComputeHash(content, 0, content.Length), backendHash));
+
+            new StorageContentCache(_directory).Store(FileName, content, content.Length, backendHash);
+
+            // Act
+            bool read = new StorageContentCache(_directory).TryRead(FileName, backendHash, out byte[] cached);
+
+            // Assert
+            Assert.IsTrue(read);
+            CollectionAssert.AreEqual(content, cached);
+        }
+
+        [Test]
+        public void TryRead_WhenBackendHashChanged_ReturnsFalse()
+        {
+            // Arrange
+            byte[] content = Encoding.UTF8.GetBytes("{\"level\":3}");
+            byte[] newContent = Encoding.UTF8.GetBytes("{\"level\":4}");
+            StorageContentCache cache = new(_directory);
+            cache.Store(FileName, content, content.Length, GetBackendHash(content));
+
+            // Act
+            bool read = cache.TryRead(FileName, GetBackendHash(newContent), out _);
+
+            // Assert
+            Assert.IsFalse(read);
+        }
+
+        [Test]
+        public void TryRead_WithCorruptCachedContent_ReturnsFalseAndForgetsFile()
+        {
+            // Arrange
+            byte[] content = Encoding.UTF8.GetBytes("{\"level\":3}");
+            string backendHash = GetBackendHash(content);
+            StorageContentCache cache = new(_directory);
+            string contentHash = cache.Store(FileName, content, content.Length, backendHash);
+            File.WriteAllText(Path.Combine(_directory, contentHash), "{\"level\":99}");
+
+            // Act
+            bool read = cache.TryRead(FileName, backendHash, out _);
+
+            // Assert
+            Assert.IsFalse(read);
+            Assert.IsFalse(cache.TryGetContentHash(FileName, out _));
+        }
+
+        [Test]
+        public void TryRead_AfterUploadOnceVersionIsSet_ReturnsStoredContent()
+        {
+            // Arrange
+            byte[] content = Encoding.UTF8.GetBytes("{\"level\":3}");
+            string backendHash = GetBackendHash(content);
+            StorageContentCache cache = new(_directory);
+            string contentHash = cache.Store(FileName, content, content.Length, null);
+            Assert.IsFalse(cache.TryRead(FileName, backendHash, out _));
+
+            // Act
+            cache.SetVersion(FileName, contentHash, backendHash);
+
+            // Assert
+            Assert.IsTrue(cache.TryRead(FileName, backendHash, out byte[] cached));
+            CollectionAssert.AreEqual(content, cached);
+        }
+    }
+}